@@ -0,0 +1,223 @@
+"""Several Tivas sharing one feeder on an RS-485 bus, see Link/bus_node.h for their side.
+
+Every Tiva on the bus hears every frame. An ADDRESS frame names the nodes the frames
+after it are for, so a burst goes out once for all the displays showing the same view.
+Only the feeder talks unasked: a Tiva holds its credits and reports until an ADDRESS
+frame polls it, and the feeder stays off the bus until the credit, always the last
+frame of the reply, is in.
+
+Each node counts every uplink frame, the ones for other nodes too, so a write adds to
+every node's outstanding count and a credit takes from its own node's only. The link
+goes by the node furthest behind, and polls that one when the window is full. A node
+that misses POLL_MISSES polls in a row is left out until it answers again, so a display
+that is switched off never holds up the others. Every node is polled at least every
+POLL_PERIOD_S besides, which brings in its view and latency reports.
+
+The bus runs at one rate, stored in every node along with its number by a NODE frame
+over a link of its own: `final.py --set-node N --baud RATE`.
+"""
+
+import math
+import time
+
+import protocol
+from serial_link import DEFAULT_WINDOW, SerialLink
+from view_filter import KM_PER_DEGREE, ViewFilter
+
+# A node that misses this many polls in a row stops counting towards the window
+POLL_MISSES = 3
+
+# Every node is polled at least this often, for its view and latency reports
+POLL_PERIOD_S = 1.0
+
+# Time allowed on top of the frames a reply waits behind and the reply itself
+POLL_SLACK_S = 0.05
+
+# Most frames in one reply, a credit and each report the Tiva holds, see BUS_NODE_HELD_TYPES
+REPLY_FRAMES = 4
+
+
+def parse_nodes(text):
+    """Node numbers from a list like 0,1,4."""
+    nodes = sorted({int(part) for part in text.split(",")})
+    if not nodes or nodes[0] < 0 or nodes[-1] >= protocol.BUS_NODES:
+        raise ValueError(f"bus nodes go from 0 to {protocol.BUS_NODES - 1}: {text}")
+    return nodes
+
+
+def node_mask(nodes):
+    """ADDRESS frame bit mask of some BusNodes."""
+    mask = 0
+    for node in nodes:
+        mask |= 1 << node.number
+    return mask
+
+
+def coverage(centers, range_km):
+    """Center and range of one box around several centers, each range_km around.
+
+    Returns (range_km, latitude, longitude), for fetching every node's traffic at once.
+    """
+    latitude = sum(center[0] for center in centers) / len(centers)
+    longitude = sum(center[1] for center in centers) / len(centers)
+    cos_latitude = math.cos(math.radians(latitude))
+    spread_km = max(math.hypot((center[1] - longitude) * KM_PER_DEGREE * cos_latitude,
+                               (center[0] - latitude) * KM_PER_DEGREE) for center in centers)
+    return range_km + spread_km, latitude, longitude
+
+
+class BusNode:
+    """The feeder's side of one Tiva on the bus: its credits and what it is showing."""
+
+    def __init__(self, number):
+        self.number = number
+        self.view = ViewFilter()
+        self.window = DEFAULT_WINDOW
+        self.outstanding = 0
+        self.compact_misses = None
+        self._consumed_total = None
+
+        self.polls = 0
+        self.misses = 0
+        self.last_poll = None
+
+    @property
+    def present(self):
+        return self.misses < POLL_MISSES
+
+    def view_key(self):
+        """Nodes with the same key are showing the same aircraft, and share a burst."""
+        view = self.view
+        return view.range_km, view.center, view.selected_icao24, view.quiet
+
+    def handle_credit(self, payload):
+        consumed_total, _free_slots, window, compact_misses = protocol.CREDIT_PAYLOAD.unpack_from(payload)
+        self.window = window
+        self.compact_misses = compact_misses
+
+        # Cumulative counter, so a lost credit frame is caught up by the next one
+        if self._consumed_total is not None:
+            consumed = (consumed_total - self._consumed_total) & 0xFFFFFFFF
+            self.outstanding = max(0, self.outstanding - consumed)
+        self._consumed_total = consumed_total
+
+
+class BusLink(SerialLink):
+    """SerialLink for a bus of Tivas, numbered as in `numbers`.
+
+    send_to() writes frames for some of the nodes. The window and outstanding count of the
+    link as a whole are those of the nodes still answering, compact_misses stays per node.
+    """
+
+    def __init__(self, port, baud_rate, numbers, capture=None):
+        super().__init__(port, baud_rate, capture)
+        self.nodes = [BusNode(number) for number in numbers]
+        self.addressed = 0
+        self.poll_timeouts = 0
+        self._polled = None
+        self._answered = False
+
+    def present_nodes(self):
+        return [node for node in self.nodes if node.present]
+
+    def _refresh(self):
+        present = self.present_nodes()
+        self.outstanding = max((node.outstanding for node in present), default=0)
+        self.window = min((node.window for node in present), default=DEFAULT_WINDOW)
+
+    def _reply_timeout(self):
+        """Longest a poll can take: the frames ahead of it, then the reply, then some slack."""
+        frame_s = 10 * protocol.FRAME_SIZE / self.uart.baudrate
+        return (self.window + 1 + REPLY_FRAMES) * frame_s + POLL_SLACK_S
+
+    def poll(self):
+        """Reads what the polled node sent. Anything else on the bus is our own uplink, heard back."""
+        waiting = self.uart.in_waiting
+        if not waiting:
+            return
+
+        node = self._polled
+        for frame_type, payload in self._decoder.feed(self.uart.read(waiting)):
+            if node is None or not frame_type & protocol.FRAME_DOWNLINK:
+                continue
+            if frame_type == protocol.FRAME_CREDIT:
+                node.handle_credit(payload)
+                self._answered = True
+            elif frame_type == protocol.FRAME_VIEW:
+                node.view.handle_report(payload)
+            elif frame_type in self.handlers:
+                self.handlers[frame_type](payload)
+
+    def poll_node(self, node):
+        """Asks one node for its credit and reports. Returns False if it didn't answer."""
+        self._polled = node
+        self._answered = False
+        self._write(protocol.encode_address(self.addressed, node.number), 1)
+
+        deadline = time.monotonic() + self._reply_timeout()
+        while not self._answered and time.monotonic() < deadline:
+            self.poll()
+            time.sleep(0.001)
+        self._polled = None
+
+        node.polls += 1
+        node.last_poll = time.monotonic()
+        if self._answered:
+            node.misses = 0
+        else:
+            node.misses += 1
+            self.poll_timeouts += 1
+        self._refresh()
+        return self._answered
+
+    def poll_due(self):
+        """Polls every node not heard from for POLL_PERIOD_S."""
+        now = time.monotonic()
+        for node in self.nodes:
+            if node.last_poll is None or now - node.last_poll >= POLL_PERIOD_S:
+                self.poll_node(node)
+
+    def wait(self, seconds, interval=0.05):
+        self.poll_due()
+        super().wait(seconds, interval)
+
+    def _write(self, chunk, frames):
+        super()._write(chunk, frames)
+        for node in self.nodes:
+            node.outstanding += frames
+
+    def _wait_for_credit(self):
+        self.credit_stalls += 1
+
+        while self.outstanding >= self.window:
+            node = max(self.present_nodes(), key=lambda node: node.outstanding, default=None)
+            if node is None:
+                # Nobody answering, write on and let the polls find them again
+                self.outstanding = 0
+                return
+
+            if not self.poll_node(node):
+                # Frames it never credits would hold the bus for good
+                self.credit_timeouts += 1
+                node.outstanding = 0
+                self._refresh()
+
+    def send_to(self, data, nodes):
+        """Writes frames for some of the nodes, leading with an ADDRESS frame if they are new."""
+        mask = node_mask(nodes)
+        if mask != self.addressed:
+            self.addressed = mask
+            self.send_frames(protocol.encode_address(mask))
+        self.send_frames(data)
+
+    def keep_alive(self, default_baud):
+        """The bus rate is fixed, see the module docstring."""
+        return True
+
+    def negotiate(self, max_baud):
+        return None
+
+    def summary(self):
+        return "bus: " + ", ".join(
+            f"node {node.number} {'up' if node.present else 'silent'} "
+            f"({node.polls} polls, {node.view.range_km or '?'} km)" for node in self.nodes)
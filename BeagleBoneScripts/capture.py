@@ -0,0 +1,177 @@
+"""Capture and replay of the exact byte stream the feeder sends on UART4.
+
+A capture is the bytes of every write, each with the time it was made, so a run can be
+repeated byte for byte on the board or in Simulator/flight_sim. The format is the one
+Simulator/sim.h reads:
+
+    4 bytes   MAGIC
+    per write, little-endian:
+    4 bytes   milliseconds since the capture started
+    2 bytes   length
+    length bytes
+
+Usage:
+    python3 capture.py info FILE
+    python3 capture.py replay [--speed N|max] [--port PORT] [--baud BAUD] FILE
+    python3 capture.py synth [--aircraft N] [--bursts N] [--interval S] [--range KM] [--staged]
+                             [--center LAT,LON] [--filter SPEC] [--full-frames] FILE
+"""
+
+import argparse
+import struct
+import time
+from collections import Counter
+
+import protocol
+from delta_encoder import DeltaEncoder, KEYFRAME_INTERVAL
+from serial_link import SerialLink
+from synthetic import SyntheticTraffic
+
+MAGIC = b"FTC1"
+RECORD = struct.Struct("<IH")
+MAX_WRITE = 0xFFFF
+
+
+class CaptureWriter:
+    def __init__(self, path):
+        self._file = open(path, "wb")
+        self._file.write(MAGIC)
+        self._start = time.monotonic()
+
+    def write(self, data, ms=None):
+        """Records one write, at `ms` into the capture or else now."""
+        if ms is None:
+            ms = int((time.monotonic() - self._start) * 1000)
+        for start in range(0, len(data), MAX_WRITE):
+            chunk = data[start:start + MAX_WRITE]
+            self._file.write(RECORD.pack(ms & 0xFFFFFFFF, len(chunk)) + chunk)
+
+    def close(self):
+        self._file.close()
+
+
+def read_capture(path):
+    """Returns the (ms, data) writes of a capture."""
+    with open(path, "rb") as file:
+        raw = file.read()
+    if raw[:len(MAGIC)] != MAGIC:
+        raise ValueError(f"{path} is not a capture")
+
+    writes = []
+    offset = len(MAGIC)
+    while offset + RECORD.size <= len(raw):
+        ms, length = RECORD.unpack_from(raw, offset)
+        offset += RECORD.size
+        writes.append((ms, raw[offset:offset + length]))
+        offset += length
+    return writes
+
+
+def replay(writes, link, speed=1.0):
+    """Sends captured writes through a SerialLink, `speed` times faster, 0 for flat out.
+
+    Frames still go through the credit window, so even a flat-out replay never overruns
+    the Tiva's receive ring.
+    """
+    start = time.monotonic()
+
+    for ms, data in writes:
+        if speed:
+            remaining = start + ms / 1000 / speed - time.monotonic()
+            if remaining > 0:
+                link.wait(remaining, interval=min(0.05, remaining))
+
+        link.send_frames(data)
+
+
+def synthesize(path, aircraft, bursts, interval_s, range_km, seed=1, progressive=True, center=None,
+               display_filter=None, compact=True):
+    """Writes a capture of synthetic traffic, bursts `interval_s` apart, without a board.
+
+    With a `center` the capture starts by moving the radar there, and the traffic is
+    around it.
+    """
+    traffic = SyntheticTraffic(aircraft, range_km, seed, center)
+    encoder = DeltaEncoder(progressive, display_filter, compact)
+    writer = CaptureWriter(path)
+
+    if center is not None:
+        writer.write(protocol.encode_center(*center, store=False), 0)
+
+    for burst in range(bursts):
+        if burst:
+            traffic.step(interval_s)
+        ms = int(burst * interval_s * 1000)
+        keyframe = burst % KEYFRAME_INTERVAL == 0
+
+        writer.write(encoder.burst(traffic.aircraft_list(), keyframe, burst + 1, ms).view(), ms)
+
+    writer.close()
+
+
+def describe(writes):
+    """One line about the capture and one per frame type in it."""
+    decoder = protocol.Decoder()
+    types = Counter(frame_type for _, data in writes for frame_type, _ in decoder.feed(data))
+    total = sum(len(data) for _, data in writes)
+    duration = writes[-1][0] / 1000 if writes else 0
+
+    lines = [f"{len(writes)} writes, {total} bytes over {duration:.1f} s, "
+             f"{decoder.crc_errors} bad frames"]
+    lines += [f"  type 0x{frame_type:02X}: {count} frames" for frame_type, count in sorted(types.items())]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="UART4 capture tools")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    info = commands.add_parser("info", help="summarize a capture")
+    info.add_argument("file")
+
+    play = commands.add_parser("replay", help="send a capture to the Tiva")
+    play.add_argument("--speed", default="1", help="time scale, or max for no delays")
+    play.add_argument("--port", default="/dev/ttyO4")
+    play.add_argument("--baud", type=int, default=115200)
+    play.add_argument("file")
+
+    synth = commands.add_parser("synth", help="write a capture of synthetic traffic")
+    synth.add_argument("--aircraft", type=int, default=2000)
+    synth.add_argument("--bursts", type=int, default=6)
+    synth.add_argument("--interval", type=float, default=10.0, help="seconds between bursts")
+    synth.add_argument("--range", type=float, default=50.0, help="km around the centre")
+    synth.add_argument("--seed", type=int, default=1)
+    synth.add_argument("--staged", action="store_true", help="staged rather than progressive keyframes")
+    synth.add_argument("--center", metavar="LAT,LON", help="move the radar here before the first burst")
+    synth.add_argument("--filter", type=protocol.parse_filter, metavar="SPEC",
+                       help="display filter sent with every keyframe, as final.py --filter")
+    synth.add_argument("--full-frames", action="store_true", help="one aircraft to a frame, as final.py --full-frames")
+    synth.add_argument("file")
+
+    args = parser.parse_args()
+
+    if args.command == "info":
+        print(describe(read_capture(args.file)))
+
+    elif args.command == "replay":
+        speed = 0 if args.speed == "max" else float(args.speed)
+        writes = read_capture(args.file)
+        link = SerialLink(args.port, args.baud)
+        try:
+            started = time.monotonic()
+            replay(writes, link, speed)
+            elapsed = time.monotonic() - started
+            print(f"Replayed {link.frames_sent} frames in {link.writes} writes, {elapsed:.2f} s, "
+                  f"credit stalls={link.credit_stalls}, timeouts={link.credit_timeouts}")
+        finally:
+            link.close()
+
+    else:
+        center = None if args.center is None else tuple(float(part) for part in args.center.split(","))
+        synthesize(args.file, args.aircraft, args.bursts, args.interval, args.range, args.seed,
+                   not args.staged, center, args.filter, not args.full_frames)
+        print(describe(read_capture(args.file)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+"""Compact aircraft records, about three to a frame, mirrored by Link/compact.c.
+
+A record carries the position as offsets from a reference point, altitude, velocity and
+heading at the resolution the radar draws them, and a dictionary entry in place of the
+address and callsign once the Tiva has been sent them. The layout is in Link/protocol.h.
+
+The encoder hands back, with every record, the full wire fields the Tiva will decode it
+to, so the delta model tracks the rounding exactly.
+"""
+
+import struct
+
+import protocol
+
+# Units, as COMPACT_* in Link/compact.c
+COMPACT_REFERENCE_UNIT = 100        # 0.01 degrees in wire units
+COMPACT_ALTITUDE_UNIT = 76200       # 25 ft, 7.62 m
+COMPACT_VELOCITY_UNIT = 20000       # 2 m/s
+COMPACT_HEADING_UNIT_2 = 28125      # twice 1/256 turn
+
+# Delta encoder dead band for each field, half a compact step, in wire units
+DEAD_BANDS = (0, 0, COMPACT_ALTITUDE_UNIT // 2, COMPACT_VELOCITY_UNIT // 2, COMPACT_HEADING_UNIT_2 // 4)
+
+INT16_MIN = -32768
+INT16_MAX = 32767
+
+REFERENCE = struct.Struct("<hh")
+OFFSETS = struct.Struct("<hh")
+
+
+def varint(value):
+    """Little-endian base 128, the top bit set on every byte but the last."""
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def reference_point(fields_list):
+    """Middle of the burst's bounding box, in 0.01 degrees, latitude first."""
+    if not fields_list:
+        return 0, 0
+    longitudes = [fields[0] for fields in fields_list]
+    latitudes = [fields[1] for fields in fields_list]
+    return (round((min(latitudes) + max(latitudes)) / 2 / COMPACT_REFERENCE_UNIT),
+            round((min(longitudes) + max(longitudes)) / 2 / COMPACT_REFERENCE_UNIT))
+
+
+class CompactEncoder:
+    def __init__(self):
+        # icao24 -> (entry, callsign as last sent)
+        self._entries = {}
+        self._free = list(range(protocol.COMPACT_ENTRIES - 1, -1, -1))
+        self.reference = (0, 0)
+
+    def forget(self):
+        """Starts the dictionary over, every aircraft is defined again on its next record."""
+        self._entries = {}
+        self._free = list(range(protocol.COMPACT_ENTRIES - 1, -1, -1))
+
+    def release(self, icao24):
+        """Frees the entry of an aircraft that is no longer sent."""
+        held = self._entries.pop(icao24, None)
+        if held is not None:
+            self._free.append(held[0])
+
+    def header(self):
+        return REFERENCE.pack(*self.reference)
+
+    def record(self, icao24, callsign, fields):
+        """Packs one aircraft from its quantized wire fields.
+
+        Returns (record, wire fields the Tiva decodes), or None if it has to go as a full
+        upsert: too far from the reference point, or the dictionary is full.
+        """
+        longitude, latitude, altitude, velocity, heading = fields
+        reference_latitude = self.reference[0] * COMPACT_REFERENCE_UNIT
+        reference_longitude = self.reference[1] * COMPACT_REFERENCE_UNIT
+        north = latitude - reference_latitude
+        east = longitude - reference_longitude
+        if not (INT16_MIN <= north <= INT16_MAX and INT16_MIN <= east <= INT16_MAX):
+            return None
+
+        name = (callsign or "").strip()[:protocol.COMPACT_CALLSIGN_SIZE].encode("ascii", "ignore")
+        held = self._entries.get(icao24)
+        if held is None:
+            if not self._free:
+                return None
+            held = (self._free.pop(), None)
+
+        entry, sent_name = held
+        define = sent_name != name
+        self._entries[icao24] = (entry, name)
+
+        steps = max(0, round(altitude / COMPACT_ALTITUDE_UNIT))
+        speed = min(255, max(0, round(velocity / COMPACT_VELOCITY_UNIT)))
+        turn = round((heading % 3600000) * 256 / 3600000) & 0xFF
+
+        record = varint(entry << 1 | (protocol.COMPACT_DEFINE if define else 0))
+        if define:
+            record += (icao24 & 0xFFFFFF).to_bytes(protocol.ICAO24_SIZE, "little")
+            record += varint(len(name)) + name
+        record += OFFSETS.pack(north, east) + varint(steps) + bytes((speed, turn))
+
+        wire = (reference_longitude + east, reference_latitude + north, steps * COMPACT_ALTITUDE_UNIT,
+                speed * COMPACT_VELOCITY_UNIT, turn * COMPACT_HEADING_UNIT_2 // 2)
+        return record, wire
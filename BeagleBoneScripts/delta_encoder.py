@@ -0,0 +1,237 @@
+"""Incremental update encoder keyed by ICAO24.
+
+The encoder keeps a model of exactly what the firmware holds for every aircraft, in
+wire units. Each cycle it emits upserts for new aircraft, packed delta records for
+aircraft whose quantized fields moved, and removals for aircraft that disappeared. Deltas
+are applied to the model with the same rounding the firmware sees, so error never
+accumulates between keyframes.
+
+Keyframes are progressive by default: every aircraft goes out as an upsert, applied to
+the live table and drawn the moment it arrives, and the end-of-burst frame retires
+whatever the burst left out. A staged keyframe instead fills the firmware's staging
+table and shows nothing until the swap at the end.
+
+A display filter, if there is one, leads every keyframe, so a Tiva that reset picks it
+up again with the table.
+
+Upserts go as compact records, several to a frame (see compact_encoder.py), unless
+`compact` is off or an aircraft doesn't fit one. The model then holds the rounded values
+the compact record decodes to, and altitude, velocity and heading only go out as deltas
+once they move by more than half a compact step. Staged keyframes keep the full frames
+the staging table takes.
+
+An incremental burst can be given a budget in frames. Removals always go, then changes
+in list order, nearest aircraft first after the view filter, until the next one might
+not fit. Whatever is left is deferred: the model keeps what the firmware last got, so it
+goes in a later burst without being counted as removed. Keyframes are never cut short,
+their retire would take every aircraft they left out off the screen.
+"""
+
+import protocol
+from compact_encoder import CompactEncoder, DEAD_BANDS, reference_point
+
+INT16_MIN = -32768
+INT16_MAX = 32767
+
+# Full keyframe every this many bursts, incremental updates in between
+KEYFRAME_INTERVAL = 6
+
+REMOVALS_PER_FRAME = (protocol.PAYLOAD_SIZE - 1) // protocol.ICAO24_SIZE
+
+
+class FrameCount:
+    """Follows BurstBuffer.records packing one record at a time, to count frames before they exist."""
+
+    def __init__(self, header_size=0):
+        self.header_size = header_size
+        self.frames = 0
+        self._fill = protocol.PAYLOAD_SIZE
+
+    def cost(self, size):
+        """Frames a record of `size` bytes would add."""
+        return 1 if self._fill + size > protocol.PAYLOAD_SIZE else 0
+
+    def add(self, size):
+        if self.cost(size):
+            self.frames += 1
+            self._fill = self.header_size
+        self._fill += size
+
+
+class DeltaEncoder:
+    def __init__(self, progressive=True, display_filter=None, compact=True):
+        # icao24 -> list of quantized fields as the firmware has them
+        self._model = {}
+        self.progressive = progressive
+        self.compact = CompactEncoder() if compact else None
+        self._dead_bands = DEAD_BANDS if compact else (0,) * len(protocol.DELTA_UNITS)
+        self._upserts = []
+
+        # Changes held back by the last budgeted burst
+        self.deferred = 0
+
+        # FILTER payload from protocol.parse_filter, or None to leave the Tiva's alone
+        self.display_filter = display_filter
+
+        # Reused for every burst
+        self._burst = protocol.BurstBuffer()
+
+    def forget_dictionary(self):
+        """The Tiva missed a compact entry, every aircraft is defined again from the next burst."""
+        if self.compact is not None:
+            self.compact.forget()
+
+    def _upsert(self, icao24, callsign, fields, out):
+        """Queues a compact record for the live table, or sends a full upsert if it doesn't fit one."""
+        packed = self.compact.record(icao24, callsign, fields) if self.compact is not None else None
+        if packed is None:
+            self._model[icao24] = list(fields)
+            out.aircraft(icao24, callsign, fields, protocol.FRAME_UPSERT)
+            return
+
+        record, wire = packed
+        self._model[icao24] = list(wire)
+        self._upserts.append(record)
+
+    def _upsert_counted(self, icao24, callsign, fields, out, upsert_frames):
+        """_upsert, counting the record in upsert_frames. Returns 1 if it went as a full frame instead."""
+        queued = len(self._upserts)
+        self._upsert(icao24, callsign, fields, out)
+        if len(self._upserts) == queued:
+            return 1
+        upsert_frames.add(len(self._upserts[-1]))
+        return 0
+
+    def _flush_upserts(self, out):
+        if self._upserts:
+            out.records(protocol.FRAME_COMPACT, self._upserts, self.compact.header())
+            self._upserts = []
+
+    def _set_reference(self, quantized):
+        if self.compact is not None:
+            self.compact.reference = reference_point(quantized)
+
+    def keyframe(self, aircraft_list, out):
+        """Full burst, replaces the firmware table. Resets the model."""
+        if self.compact is not None:
+            listed = {aircraft['icao24'] for aircraft in aircraft_list}
+            for icao24 in self._model:
+                if icao24 not in listed:
+                    self.compact.release(icao24)
+
+        self._model = {}
+        quantized = [protocol.quantize_aircraft(aircraft['longitude'], aircraft['latitude'],
+                                                aircraft['geo_altitude'], aircraft['velocity'],
+                                                aircraft['true_track'])
+                     for aircraft in aircraft_list]
+
+        if not self.progressive:
+            for aircraft, fields in zip(aircraft_list, quantized):
+                self._model[aircraft['icao24']] = list(fields)
+                out.aircraft(aircraft['icao24'], aircraft['callsign'], fields, protocol.FRAME_AIRCRAFT)
+            return out
+
+        self._set_reference(quantized)
+        for aircraft, fields in zip(aircraft_list, quantized):
+            self._upsert(aircraft['icao24'], aircraft['callsign'], fields, out)
+        self._flush_upserts(out)
+        return out
+
+    def update(self, aircraft_list, out, budget=None):
+        """Incremental burst: only new, changed and removed aircraft are sent, in at most `budget` frames."""
+        records = []
+        seen = set()
+        self.deferred = 0
+        quantized = [protocol.quantize_aircraft(aircraft['longitude'], aircraft['latitude'],
+                                                aircraft['geo_altitude'], aircraft['velocity'],
+                                                aircraft['true_track'])
+                     for aircraft in aircraft_list]
+        self._set_reference(quantized)
+
+        listed = {aircraft['icao24'] for aircraft in aircraft_list}
+        removed = [icao24 for icao24 in self._model if icao24 not in listed]
+
+        # Frames spent so far, removals first since they always go
+        upsert_frames = FrameCount(len(self.compact.header()) if self.compact is not None else 0)
+        delta_frames = FrameCount()
+        full_frames = -(-len(removed) // REMOVALS_PER_FRAME)
+
+        # An upsert is let in only with room for a whole frame, it may not fit a compact record
+        def fits(frames=0, delta_size=0):
+            if budget is None:
+                return True
+            spent = full_frames + upsert_frames.frames + delta_frames.frames
+            return spent + frames + delta_frames.cost(delta_size) <= budget
+
+        for aircraft, fields in zip(aircraft_list, quantized):
+            icao24 = aircraft['icao24']
+            seen.add(icao24)
+
+            held = self._model.get(icao24)
+            if held is None:
+                if not fits(frames=1):
+                    self.deferred += 1
+                    continue
+                full_frames += self._upsert_counted(icao24, aircraft['callsign'], fields, out, upsert_frames)
+                continue
+
+            mask = 0
+            deltas = []
+            overflow = False
+            for bit, (new, old, unit, dead_band) in enumerate(zip(fields, held, protocol.DELTA_UNITS,
+                                                                   self._dead_bands)):
+                delta = round((new - old) / unit)
+                if delta == 0 or abs(new - old) <= dead_band:
+                    continue
+                if not INT16_MIN <= delta <= INT16_MAX:
+                    overflow = True
+                    break
+                mask |= 1 << bit
+                deltas.append(delta)
+
+            if overflow:
+                # Jumped too far for a delta, resend the whole record
+                if not fits(frames=1):
+                    self.deferred += 1
+                    continue
+                full_frames += self._upsert_counted(icao24, aircraft['callsign'], fields, out, upsert_frames)
+            elif mask:
+                record = protocol.encode_delta_record(icao24, mask, deltas)
+                if not fits(delta_size=len(record)):
+                    self.deferred += 1
+                    continue
+
+                # Track what the firmware will actually hold after applying the delta
+                for bit, delta in zip((b for b in range(len(held)) if mask & (1 << b)), deltas):
+                    held[bit] += delta * protocol.DELTA_UNITS[bit]
+                delta_frames.add(len(record))
+                records.append(record)
+
+        self._flush_upserts(out)
+
+        for icao24 in removed:
+            del self._model[icao24]
+            if self.compact is not None:
+                self.compact.release(icao24)
+
+        return out.records(protocol.FRAME_DELTA, records).removals(removed)
+
+    def burst(self, aircraft_list, keyframe, sequence=0, host_ms=0, budget=None):
+        """Every frame of one burst packed in one buffer, finished with the end-of-burst frame.
+
+        `budget` caps the frames of an incremental burst, see the module docstring.
+
+        The buffer is reused, so the burst must be sent before the next one is encoded.
+        """
+        out = self._burst.reset()
+        if keyframe and self.display_filter is not None:
+            out.frame(protocol.FRAME_FILTER, self.display_filter)
+        if keyframe:
+            self.keyframe(aircraft_list, out)
+        else:
+            self.update(aircraft_list, out, budget)
+
+        # A progressive keyframe is live already, it only needs the retire and no swap
+        if keyframe and self.progressive:
+            return out.burst_end(False, sequence, host_ms, retire=True)
+        return out.burst_end(keyframe, sequence, host_ms)
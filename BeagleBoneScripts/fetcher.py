@@ -0,0 +1,244 @@
+"""Fetch stage of the feeder, running next to the UART writer instead of in front of it.
+
+Each source runs on its own thread and hands complete snapshots to the writer through a
+one-slot queue. The writer always takes the newest snapshot, so a slow burst on the UART
+never delays the next request, and a slow response never stalls credits or latency
+reports on the link.
+
+OpenSky only recomputes state vectors every few seconds, and the response's `time` field
+says which ones it sent. A response with the same `time` as the last one is dropped
+instead of being sent to the Tiva again, and the rate-limit headers decide how long to
+back off once the credits run low.
+
+Every fetcher counts into a StageMetrics for the feeder's /metrics (see supervisor.py), a
+snapshot as an item timed from the start of its request, and keeps polling through any
+exception a poll raises.
+
+A wide box makes for a response of megabytes, and decoding it is most of the feeder's CPU
+time. The body goes straight from bytes to objects, with orjson when it is installed and
+the standard json module otherwise, and parse_states builds each aircraft in one pass.
+"""
+
+import json
+import math
+import queue
+import threading
+import time
+from collections import namedtuple
+
+import requests
+
+try:
+    import orjson
+    decode_json = orjson.loads
+except ImportError:
+    decode_json = json.loads
+
+from latency import now_ms
+from supervisor import RETRY_S, StageMetrics, guarded
+
+# University of Florida coordinates, unless the Tiva or --center says otherwise
+CENTER_LATITUDE = 29.6465
+CENTER_LONGITUDE = -82.3533
+
+STATES_URL = "https://opensky-network.org/api/states/all"
+
+# Seconds between polls, OpenSky's anonymous time resolution
+POLL_INTERVAL_S = 10
+
+# Poll again this soon when the last response held no new state vectors
+REPOLL_S = 2
+
+# Give up on a request after this long, the next poll tries again
+REQUEST_TIMEOUT_S = 8
+
+# Never back off further than this on a rate limit without a retry header
+MAX_BACKOFF_S = 300
+
+Snapshot = namedtuple("Snapshot", ["aircraft_list", "response_ms", "data_time"])
+
+
+def bounding_box(search_range_km, latitude=CENTER_LATITUDE, longitude=CENTER_LONGITUDE):
+    """lamin, lamax, lomin, lomax of a box search_range_km around a centre."""
+    lat_range = search_range_km / 111  # Approximate degrees for latitude
+    lon_range = search_range_km / (111 * math.cos(math.radians(latitude)))  # Narrowing with latitude
+
+    return {
+        "lamin": latitude - lat_range,
+        "lamax": latitude + lat_range,
+        "lomin": longitude - lon_range,
+        "lomax": longitude + lon_range,
+    }
+
+
+def parse_states(data):
+    """The aircraft in a /states/all response, in the shape the encoders take."""
+    return [{
+        "icao24": int(state[0], 16),  # ICAO24 identifier
+        "callsign": state[1],  # Call sign
+        "longitude": state[5],  # Longitude
+        "latitude": state[6],  # Latitude
+        "geo_altitude": state[13],  # Geometric altitude
+        "velocity": state[9],  # Velocity
+        "true_track": state[10],  # True track (heading)
+        "on_ground": state[8],  # On ground, never drawn
+    } for state in data.get("states") or []]
+
+
+def publish(snapshots, snapshot):
+    """Puts a snapshot in the one-slot queue, replacing one the writer has not taken yet.
+
+    Returns True if an older snapshot was dropped.
+    """
+    dropped = False
+    while True:
+        try:
+            snapshots.put_nowait(snapshot)
+            return dropped
+        except queue.Full:
+            try:
+                snapshots.get_nowait()
+                dropped = True
+            except queue.Empty:
+                pass
+
+
+class OpenSkyFetcher(threading.Thread):
+    """Polls the box around center(), a callable returning latitude, longitude in degrees.
+
+    The box follows the center from one poll to the next, so a re-anchored radar is
+    filled in by the very next response. `area`, if given, stands in for both the range
+    and the center, a callable returning range_km, latitude, longitude. `name` labels its
+    stage in the metrics.
+    """
+
+    def __init__(self, snapshots, search_range_km, interval_s=POLL_INTERVAL_S,
+                 center=lambda: (CENTER_LATITUDE, CENTER_LONGITUDE), name="fetch", area=None):
+        super().__init__(name="opensky", daemon=True)
+        self.snapshots = snapshots
+        self.area = area or (lambda: (search_range_km, *center()))
+        self.params = None
+        self.interval_s = interval_s
+
+        # One keep-alive connection for every poll
+        self.session = requests.Session()
+
+        self.last_time = None
+        self.requests = 0
+        self.unchanged = 0
+        self.rate_limited = 0
+        self.credits_remaining = None
+        self.stage = StageMetrics(name)
+        self._stop_event = threading.Event()
+
+    def stop(self):
+        self._stop_event.set()
+        self.session.close()
+
+    def _backoff(self, response):
+        """Seconds to wait after a 429, from the retry header when there is one."""
+        self.rate_limited += 1
+        retry_after = response.headers.get("X-Rate-Limit-Retry-After-Seconds")
+        try:
+            return min(int(retry_after), MAX_BACKOFF_S)
+        except (TypeError, ValueError):
+            return MAX_BACKOFF_S
+
+    def poll(self):
+        """Makes one request, returns the seconds to wait before the next."""
+        # A new box gets new state vectors, even at the same time
+        params = bounding_box(*self.area())
+        if params != self.params:
+            self.params = params
+            self.last_time = None
+
+        self.requests += 1
+        started = time.monotonic()
+        try:
+            response = self.session.get(STATES_URL, params=self.params, timeout=REQUEST_TIMEOUT_S)
+        except requests.exceptions.RequestException as e:
+            self.stage.error()
+            print(f"An error occurred while making the API request: {e}")
+            return self.interval_s
+
+        remaining = response.headers.get("X-Rate-Limit-Remaining")
+        if remaining is not None and remaining.isdigit():
+            self.credits_remaining = int(remaining)
+
+        if response.status_code == 429:
+            wait_s = self._backoff(response)
+            print(f"OpenSky rate limit reached, waiting {wait_s} s")
+            return wait_s
+        if response.status_code != 200:
+            self.stage.error()
+            print(f"OpenSky returned HTTP {response.status_code}")
+            return self.interval_s
+
+        response_ms = now_ms()
+        try:
+            data = decode_json(response.content)
+        except ValueError:
+            self.stage.error()
+            print("OpenSky returned a response that is not JSON")
+            return self.interval_s
+
+        # Same state vectors as last time, nothing to send
+        data_time = data.get("time")
+        if data_time is not None and data_time == self.last_time:
+            self.unchanged += 1
+            return REPOLL_S
+        self.last_time = data_time
+
+        if publish(self.snapshots, Snapshot(parse_states(data), response_ms, data_time)):
+            self.stage.drop()
+        self.stage.observe(time.monotonic() - started)
+        return self.interval_s
+
+    def run(self):
+        while not self._stop_event.is_set():
+            started = time.monotonic()
+            wait_s = guarded(self.stage, self.poll)
+            if wait_s is None:
+                wait_s = RETRY_S
+            self._stop_event.wait(max(0, started + wait_s - time.monotonic()))
+
+    def summary(self):
+        credits = "" if self.credits_remaining is None else f", credits left={self.credits_remaining}"
+        return (f"OpenSky: {self.requests} requests, {self.unchanged} unchanged, "
+                f"{self.rate_limited} rate limited, {self.stage.errors} errors, "
+                f"{self.stage.dropped} snapshots superseded{credits}")
+
+
+class SyntheticFetcher(threading.Thread):
+    """Stands in for OpenSkyFetcher with SyntheticTraffic, one snapshot per interval."""
+
+    def __init__(self, snapshots, traffic, interval_s=POLL_INTERVAL_S):
+        super().__init__(name="synthetic", daemon=True)
+        self.snapshots = snapshots
+        self.traffic = traffic
+        self.interval_s = interval_s
+        self.requests = 0
+        self.stage = StageMetrics("fetch")
+        self._stop_event = threading.Event()
+
+    def stop(self):
+        self._stop_event.set()
+
+    def poll(self):
+        started = time.monotonic()
+        if self.requests:
+            self.traffic.step(self.interval_s)
+        self.requests += 1
+
+        snapshot = Snapshot(self.traffic.aircraft_list(), now_ms(), self.requests)
+        if publish(self.snapshots, snapshot):
+            self.stage.drop()
+        self.stage.observe(time.monotonic() - started)
+
+    def run(self):
+        while not self._stop_event.is_set():
+            guarded(self.stage, self.poll)
+            self._stop_event.wait(self.interval_s)
+
+    def summary(self):
+        return f"Synthetic: {self.requests} snapshots, {self.stage.dropped} superseded"
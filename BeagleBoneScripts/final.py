@@ -1,149 +1,484 @@
-import socket
-import pickle
-import struct
-from random import randint
-from time import sleep
-import serial
-import requests
-
-
-def fetch_filtered_opensky_data(search_range_km):
-    # University of Florida coordinates
-    center_latitude = 29.6465
-    center_longitude = -82.3533
-
-    # Calculate latitude/longitude range based on search_range_km
-    lat_range = search_range_km / 111  # Approximate degrees for latitude
-    lon_range = search_range_km / 96.2  # Approximate degrees for longitude at 29.6465° N
-
-    # Define bounding box
-    min_latitude = center_latitude - lat_range
-    max_latitude = center_latitude + lat_range
-    min_longitude = center_longitude - lon_range
-    max_longitude = center_longitude + lon_range
-
-    # Construct URL with calculated bounds
-    url = (f"https://opensky-network.org/api/states/all?"
-           f"lamin={min_latitude}&lamax={max_latitude}&"
-           f"lomin={min_longitude}&lomax={max_longitude}")
-
-    try:
-        print(f"Making API request to: {url}")
-        response = requests.get(url)
-
-        # Log HTTP status code and headers
-        print(f"Response Status Code: {response.status_code}")
-        print(f"Response Headers: {response.headers}")
-
-        # Check for JSON response
-        data = response.json()
-        #print(f"Response JSON: {data}")  # Log the raw JSON response
-
-        # Collect all desired fields
-        aircraft_list = []
-        for state in data.get("states", []):
-            aircraft_info = {
-                "callsign": state[1],  # Call sign
-                "longitude": state[5],  # Longitude
-                "latitude": state[6],  # Latitude
-                "geo_altitude": state[13],  # Geometric altitude
-                "velocity": state[9],  # Velocity
-                "true_track": state[10],  # True track (heading)
-            }
-            aircraft_list.append(aircraft_info)
-
-        print(f"Collected {len(aircraft_list)} aircraft from API response.")
-        return aircraft_list
-
-    except requests.exceptions.RequestException as e:
-        print(f"An error occurred while making the API request: {e}")
-        return []
-
-
-def main():
-    # Configure UART port
-    uart_port = "/dev/ttyO4"
-    baud_rate = 115200
-
-    try:
-        # Open UART connection
-        uart = serial.Serial(uart_port, baud_rate)
-        print(f"UART connection established on {uart_port} at {baud_rate} baud.")
-
-        while True:
-            # Fetch aircraft data within 50 km range
-            aircraft_list = fetch_filtered_opensky_data(200)
-
-            for aircraft in aircraft_list:
-                # Extract and sanitize data
-                longitude = aircraft['longitude'] if aircraft['longitude'] is not None else 0.0
-                latitude = aircraft['latitude'] if aircraft['latitude'] is not None else 0.0
-                altitude = aircraft['geo_altitude'] if aircraft['geo_altitude'] is not None else 0.0
-                velocity = aircraft['velocity'] if aircraft['velocity'] is not None else 0.0
-                true_track = aircraft['true_track'] if aircraft['true_track'] is not None else 0.0
-
-                # Callsign handling
-                callsign = aircraft['callsign'] if aircraft['callsign'] is not None else "N/A"
-                callsign = callsign.strip()[:8]  # Ensure max 8 characters
-
-                # Pad callsign to 8 characters with spaces
-                callsign_padded = callsign.ljust(8)
-
-                # Encode to bytes
-                callsign_bytes = callsign_padded.encode('ascii', 'ignore')
-
-                # Split into two 4-byte groups
-                callsign_part1 = callsign_bytes[:4]
-                callsign_part2 = callsign_bytes[4:8]
-
-                # Unpack each part into an integer (little-endian)
-                callsign_int1 = struct.unpack('<I', callsign_part1)[0]
-                callsign_int2 = struct.unpack('<I', callsign_part2)[0]
-
-                # Scale arbirtarily by 10,000 to keep precision (intepreted as int32)
-                longitude_int = int(longitude * 10000)
-                latitude_int = int(latitude * 10000)
-                altitude_int = int(altitude * 10000)
-                velocity_int = int(velocity * 10000)
-                true_track_int = int(true_track * 10000)
-
-                # Send structured data
-                data = struct.pack(
-                    "<IIiiiii",
-                    callsign_int1,
-                    callsign_int2,
-                    longitude_int,
-                    latitude_int,
-                    altitude_int,
-                    velocity_int,
-                    true_track_int
-                )
-                uart.write(data)
-
-                # Print the data for debugging
-                print(f"Sent: callsign={callsign}, longitude={longitude}, latitude={latitude}, "
-                      f"altitude={altitude}, velocity={velocity}, true_track={true_track}")
-
-                print(f"Sending raw data: {data.hex()}")
-
-                # short sleep to allow tiva to process data
-                sleep(0.01)
-
-            # Send the end-of-burst marker
-            end_marker = struct.pack("<I", 0xFFFFFFFF)
-            uart.write(end_marker)
-
-            print("Transmission Complete!")
-
-            # Delay before collecting new data
-            sleep(10)
-
-    except serial.SerialException as e:
-        print(f"Error opening UART port: {e}")
-    finally:
-        if uart.is_open:
-            uart.close()
-
-
-if __name__ == "__main__":
-    main()
+import argparse
+import queue
+import time
+from collections import namedtuple
+
+import serial
+
+import protocol
+from bus import BusLink, coverage, parse_nodes
+from capture import CaptureWriter
+from delta_encoder import DeltaEncoder, KEYFRAME_INTERVAL
+from fetcher import OpenSkyFetcher, SyntheticFetcher, POLL_INTERVAL_S
+from latency import LatencyTracker
+from local_receiver import FusedFetcher, SbsReceiver, parse_address
+from serial_link import LINK_RATES, SerialLink
+from supervisor import METRICS_PORT, Metrics, Stage, put_blocking
+from synthetic import SyntheticTraffic
+from view_filter import ViewFilter
+
+# OpenSky search box, km from the centre
+SEARCH_RANGE_KM = 200
+
+# How often the writer checks for a snapshot while keeping the link serviced
+SNAPSHOT_POLL_S = 0.05
+
+# Seconds between keyframes, however often snapshots come in
+KEYFRAME_PERIOD_S = KEYFRAME_INTERVAL * POLL_INTERVAL_S
+
+# An incremental burst gets this share of what the link carries until the next one is due
+LINK_SHARE = 0.8
+MIN_BURST_FRAMES = 8
+
+# Bursts encoded ahead of the serial stage
+BURST_QUEUE = 1
+
+# Seconds between the Tiva's wakes in quiet hours, it never wakes more often than every 300
+QUIET_PERIOD_S = 600
+
+# Time for a NODE frame to be credited, over a link of its own
+SET_NODE_WAIT_S = 0.5
+
+# What the Tiva's USB port carries as a UART rate, for the burst budget: a credit
+# window every couple of millisecond frames, well short of full speed bulk
+USB_LINK_BAUD = 2_000_000
+USB_PORT = "/dev/ttyACM0"
+
+# `nodes` are the BusNodes a burst is for on a bus, None on a link of its own
+Burst = namedtuple("Burst", ["data", "frames", "keyframe", "aircraft", "deferred", "sequence", "nodes"],
+                   defaults=(None,))
+
+
+def burst_budget(baud, elapsed_s, share=LINK_SHARE):
+    """Frames an incremental burst may use, from the link rate and the time since the last burst."""
+    frames_per_s = baud / (10 * protocol.FRAME_SIZE)
+    return max(MIN_BURST_FRAMES, int(frames_per_s * elapsed_s * share))
+
+
+def utc_offset_min():
+    """This machine's local time minus UTC, daylight saving included."""
+    return time.localtime().tm_gmtoff // 60
+
+
+def parse_node(text):
+    """A bus node number, or off for a link of its own."""
+    if text == "off":
+        return protocol.BUS_NONE
+    return parse_nodes(text)[0]
+
+
+def parse_center(text):
+    latitude, longitude = (float(part) for part in text.split(","))
+    return latitude, longitude
+
+
+def center_reported(center):
+    """A center as it comes back in a view report, to the micro-degree."""
+    return tuple(round(degrees * protocol.CENTER_UNITS_PER_DEGREE) / protocol.CENTER_UNITS_PER_DEGREE
+                 for degrees in center)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Feeds OpenSky aircraft to the Tiva over UART4")
+    parser.add_argument("--port", help=f"/dev/ttyO4, or {USB_PORT} with --usb")
+    parser.add_argument("--usb", action="store_true",
+                        help="feed the Tiva through its USB device port, no rate to negotiate")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--max-baud", type=int, default=LINK_RATES[0],
+                        help="fastest rate to negotiate up to, or --baud to stay put")
+    parser.add_argument("--capture", metavar="FILE",
+                        help="also record every byte sent, for capture.py replay and flight_sim")
+    parser.add_argument("--synthetic", type=int, metavar="N",
+                        help="send N synthetic aircraft instead of querying OpenSky")
+    parser.add_argument("--staged", action="store_true",
+                        help="swap keyframes in whole at the end instead of drawing them as they arrive")
+    parser.add_argument("--center", type=parse_center, metavar="LAT,LON",
+                        help="radar center in degrees, stored on the Tiva for later runs")
+    parser.add_argument("--filter", type=protocol.parse_filter, metavar="SPEC",
+                        help="display filter, e.g. alt=1000:9000,speed=50,named,colors")
+    parser.add_argument("--full-frames", action="store_true",
+                        help="send one aircraft to a frame instead of packing compact records")
+    parser.add_argument("--local", type=parse_address, metavar="HOST[:PORT]",
+                        help="also read a dump1090 SBS-1 stream, port 30003 by default, and fuse it with OpenSky")
+    parser.add_argument("--local-only", action="store_true",
+                        help="with --local, leave OpenSky out")
+    parser.add_argument("--quiet", type=protocol.parse_quiet, metavar="HH:MM-HH:MM",
+                        help="local hours the Tiva hibernates between updates, or off to clear them")
+    parser.add_argument("--quiet-period", type=int, default=QUIET_PERIOD_S, metavar="S",
+                        help=f"seconds between updates in quiet hours, {QUIET_PERIOD_S} by default")
+    parser.add_argument("--bus", type=parse_nodes, metavar="N,N,...",
+                        help="feed the Tivas with these node numbers on an RS-485 bus, at --baud")
+    parser.add_argument("--set-node", type=parse_node, metavar="N",
+                        help="make the Tiva on this link bus node N from its next reset, or off, then exit")
+    parser.add_argument("--bus-baud", type=int, metavar="BAUD",
+                        help="with --set-node, the bus rate the Tiva keeps, --baud by default")
+    parser.add_argument("--metrics-port", type=int, default=METRICS_PORT, metavar="PORT",
+                        help="serve per-stage metrics for Prometheus at /metrics, 0 to turn it off")
+    args = parser.parse_args()
+    if args.port is None:
+        args.port = USB_PORT if args.usb else "/dev/ttyO4"
+    return args
+
+
+class Stream:
+    """One delta encoder and its keyframe timing, for the displays showing one view."""
+
+    def __init__(self, args):
+        self.args = args
+        self.encoder = DeltaEncoder(progressive=not args.staged, display_filter=args.filter,
+                                    compact=not args.full_frames)
+        self.compact_misses = None
+        self.last_keyframe = None
+        self.last_burst = None
+        self.encoding = False
+        self.quiet_reports = 0
+
+    def burst(self, snapshot, view, reports, compact_misses, baud, latency, share=LINK_SHARE):
+        """Turns a snapshot into a Burst, or None while the displays sleep through quiet hours.
+
+        `reports` counts the view reports the displays sent, `compact_misses` is what
+        their credits last said, anything that changes when one of them misses.
+        """
+        started = time.monotonic()
+
+        # The Tiva lost track of a compact entry, or reset, so define every aircraft again
+        if compact_misses != self.compact_misses:
+            if self.compact_misses is not None:
+                print("Tiva missed compact entries, starting the dictionary over.")
+                self.encoder.forget_dictionary()
+            self.compact_misses = compact_misses
+
+        # In quiet hours the Tiva hibernates between wakes, each one reports in and gets a
+        # single keyframe. It woke through a reset, so the compact dictionary starts over.
+        if view.quiet:
+            if reports == self.quiet_reports:
+                return None
+            self.quiet_reports = reports
+            self.last_keyframe = None
+            self.encoder.forget_dictionary()
+
+        # A burst that raised half way leaves the model unsure of the Tiva, the next one resyncs
+        if self.encoding:
+            self.last_keyframe = None
+        self.encoding = True
+
+        aircraft_list = view.apply(snapshot.aircraft_list)
+        response_ms = snapshot.response_ms
+        sequence = latency.start_burst(response_ms)
+
+        # Keyframes resync the whole table, everything else only sends what changed
+        # The burst finishes with the end-of-burst frame, with the number of frames in it
+        # They go by time, a local receiver can send a snapshot every half second
+        keyframe = self.last_keyframe is None or started - self.last_keyframe >= KEYFRAME_PERIOD_S
+        if keyframe:
+            self.last_keyframe = started
+
+        # Changes past the budget wait for the next burst, so a fast source never queues up on the link
+        budget = (None if self.last_burst is None
+                  else burst_budget(baud, started - self.last_burst, share))
+        self.last_burst = started
+        burst = self.encoder.burst(aircraft_list, keyframe, sequence, response_ms, budget)
+        self.encoding = False
+
+        # The encoder reuses its buffer, the serial stage gets a copy
+        return Burst(bytes(burst.view()), burst.frames, keyframe, len(aircraft_list),
+                     self.encoder.deferred, sequence)
+
+
+class Feeder:
+    """The encode and serial stages, see supervisor.py. The fetch stage is the fetcher's own thread."""
+
+    def __init__(self, args, link, view, fetcher, metrics):
+        self.args = args
+        self.link = link
+        self.view = view
+        self.fetcher = fetcher
+        self.snapshots = fetcher.snapshots
+
+        # Never drops, the encoder's model assumes every burst reaches the Tiva
+        self.bursts = queue.Queue(maxsize=BURST_QUEUE)
+
+        self.stream = Stream(args)
+        # USB has no rate to negotiate, and carries far more than UART4 ever will
+        self.link_baud = USB_LINK_BAUD if args.usb else None
+
+        # The Tiva reports back how long each burst took to reach the screen
+        self.latency = LatencyTracker()
+        link.handlers[protocol.FRAME_LATENCY] = self.latency.handle_report
+        link.handlers[protocol.FRAME_VIEW] = view.handle_report
+
+        metrics.add_stage(fetcher.stage)
+        self.encode = Stage(metrics.stage("encode"), self.encode_step)
+        self.serial = Stage(metrics.stage("serial"), self.serial_step)
+        metrics.queue("snapshots", self.snapshots)
+        metrics.queue("bursts", self.bursts)
+        metrics.gauge("link_baud", "UART4 rate in use.", lambda: self.link_baud or args.baud)
+        metrics.gauge("link_credit_stalls_total", "Writes that waited for credit.",
+                      lambda: link.credit_stalls, "counter")
+        metrics.gauge("link_credit_timeouts_total", "Credit waits that gave up.",
+                      lambda: link.credit_timeouts, "counter")
+        metrics.gauge("encode_deferred", "Changes the last burst held back for its budget.",
+                      lambda: self.deferred())
+        metrics.gauge("latency_p50_ms", "Median response to pixels latency the Tiva reported.",
+                      lambda: self.latency.percentile(0.50))
+        metrics.gauge("latency_p99_ms", "99th percentile response to pixels latency.",
+                      lambda: self.latency.percentile(0.99))
+
+    def deferred(self):
+        return self.stream.encoder.deferred
+
+    def start(self):
+        self.fetcher.start()
+        self.encode.start()
+        self.serial.start()
+
+    def stop(self):
+        self.fetcher.stop()
+        self.encode.stop()
+        self.serial.stop()
+
+    def encode_step(self):
+        """Turns the newest snapshot into a burst and hands it to the serial stage."""
+        try:
+            snapshot = self.snapshots.get(timeout=SNAPSHOT_POLL_S)
+        except queue.Empty:
+            return
+        started = time.monotonic()
+
+        encoded = self.stream.burst(snapshot, self.view, self.view.reports, self.link.compact_misses,
+                                    self.link_baud or self.args.baud, self.latency)
+        if encoded is None:
+            return
+        self.encode.stage.observe(time.monotonic() - started)
+        put_blocking(self.bursts, encoded, self.encode.stop_event)
+
+    def serial_step(self):
+        """Sends the next burst, keeping the link serviced while there is none."""
+        link = self.link
+        baud_rate = self.args.baud
+
+        # Credits and latency reports keep coming in while the next snapshot is fetched
+        try:
+            burst = self.bursts.get_nowait()
+        except queue.Empty:
+            if self.link_baud is not None and not self.args.usb and not link.keep_alive(baud_rate):
+                print(f"Link lost at {self.link_baud} baud, back to {baud_rate}.")
+                self.link_baud = None
+            link.wait(SNAPSHOT_POLL_S)
+            return
+        started = time.monotonic()
+
+        # Keep asking until the Tiva answers, it may still be at a rate from an earlier run
+        if self.link_baud is None and self.args.max_baud > baud_rate:
+            self.link_baud = link.negotiate(self.args.max_baud)
+            if self.link_baud is not None:
+                print(f"Link running at {self.link_baud} baud.")
+
+        # Sent until a view report comes back with it, the first frame may land before the Tiva is up
+        center = self.args.center
+        if center is not None and self.view.center != center_reported(center):
+            link.send_frames(protocol.encode_center(*center))
+
+        # The clock and quiet hours go ahead of every keyframe, which keeps the Tiva's RTC honest
+        if self.args.quiet is not None and burst.keyframe:
+            link.send_frames(protocol.encode_schedule(time.time(), utc_offset_min(), self.args.quiet,
+                                                      self.args.quiet_period))
+
+        # The Tiva starts timing at the first frame, which leads the first write
+        writes = link.writes
+        self.latency.first_frame_sent(burst.sequence)
+        link.send_frames(burst.data)
+        self.serial.stage.observe(time.monotonic() - started)
+
+        print(f"Transmission Complete! {'keyframe' if burst.keyframe else 'incremental'}: "
+              f"{burst.aircraft} aircraft in {burst.frames - 1} frames, "
+              f"{link.writes - writes} writes, {burst.deferred} deferred, "
+              f"credit stalls={link.credit_stalls}, timeouts={link.credit_timeouts}")
+        print(self.view.summary())
+        print(self.latency.summary())
+        print(self.fetcher.summary())
+
+
+class BusFeeder(Feeder):
+    """Feeder for a BusLink: one stream per view shown on the bus, each burst sent once.
+
+    Nodes showing the same view share a stream. A node that moves to a view of its own,
+    or joins another, gets a new stream, which starts with a keyframe and an empty
+    compact dictionary. The link's share of the bus is split between the streams.
+    """
+
+    def __init__(self, args, link, fetcher, metrics):
+        super().__init__(args, link, link.nodes[0].view, fetcher, metrics)
+        self.streams = {}
+        self.members = {}
+
+        metrics.gauge("bus_poll_timeouts_total", "Polls a node never answered.",
+                      lambda: link.poll_timeouts, "counter")
+        metrics.gauge("bus_nodes_present", "Nodes answering their polls.",
+                      lambda: len(link.present_nodes()))
+
+    def deferred(self):
+        return sum(stream.encoder.deferred for stream in list(self.streams.values()))
+
+    def group(self):
+        """Present nodes by view, with a stream for each that still fits its members."""
+        groups = {}
+        for node in self.link.present_nodes():
+            groups.setdefault(node.view_key(), []).append(node)
+
+        streams = {}
+        for key, nodes in groups.items():
+            numbers = {node.number for node in nodes}
+            stream = self.streams.get(key)
+            # A node new to the stream has none of its history, so it starts over
+            if stream is None or not numbers <= self.members[key]:
+                stream = Stream(self.args)
+                self.members[key] = numbers
+            streams[key] = stream
+
+        self.members = {key: self.members[key] for key in streams}
+        self.streams = streams
+        return groups
+
+    def encode_step(self):
+        try:
+            snapshot = self.snapshots.get(timeout=SNAPSHOT_POLL_S)
+        except queue.Empty:
+            return
+        started = time.monotonic()
+
+        groups = self.group()
+        share = LINK_SHARE / max(1, len(groups))
+        for key, nodes in groups.items():
+            encoded = self.streams[key].burst(
+                snapshot, nodes[0].view, sum(node.view.reports for node in nodes),
+                tuple(node.compact_misses for node in nodes), self.args.baud, self.latency, share)
+            if encoded is not None:
+                put_blocking(self.bursts, encoded._replace(nodes=nodes), self.encode.stop_event)
+        self.encode.stage.observe(time.monotonic() - started)
+
+    def serial_step(self):
+        link = self.link
+        try:
+            burst = self.bursts.get_nowait()
+        except queue.Empty:
+            link.wait(SNAPSHOT_POLL_S)
+            return
+        started = time.monotonic()
+
+        center = self.args.center
+        if center is not None:
+            moved = [node for node in link.nodes if node.view.center != center_reported(center)]
+            if moved:
+                link.send_to(protocol.encode_center(*center), moved)
+
+        if self.args.quiet is not None and burst.keyframe:
+            link.send_to(protocol.encode_schedule(time.time(), utc_offset_min(), self.args.quiet,
+                                                  self.args.quiet_period), burst.nodes)
+
+        writes = link.writes
+        self.latency.first_frame_sent(burst.sequence)
+        link.send_to(burst.data, burst.nodes)
+        self.serial.stage.observe(time.monotonic() - started)
+
+        print(f"Transmission Complete! {'keyframe' if burst.keyframe else 'incremental'} "
+              f"for nodes {', '.join(str(node.number) for node in burst.nodes)}: "
+              f"{burst.aircraft} aircraft in {burst.frames - 1} frames, "
+              f"{link.writes - writes} writes, {burst.deferred} deferred, "
+              f"credit stalls={link.credit_stalls}, timeouts={link.credit_timeouts}")
+        print(link.summary())
+        print(self.latency.summary())
+        print(self.fetcher.summary())
+
+
+def set_node(args):
+    """Stores a bus node and rate in the Tiva on a link of its own, see --set-node."""
+    link = SerialLink(args.port, args.baud)
+    try:
+        link.send_frames(protocol.encode_node(args.set_node, args.bus_baud or args.baud))
+        link.wait(SET_NODE_WAIT_S)
+    finally:
+        link.close()
+
+    if args.set_node == protocol.BUS_NONE:
+        print("Tiva leaves the bus at its next reset.")
+    else:
+        print(f"Tiva is bus node {args.set_node} at {args.bus_baud or args.baud} baud from its next reset.")
+
+def main():
+    args = parse_args()
+    if args.set_node is not None:
+        set_node(args)
+        return
+
+    # Configure UART port
+    uart_port = args.port
+    baud_rate = args.baud
+    link = None
+    feeder = None
+    metrics = Metrics()
+    capture = CaptureWriter(args.capture) if args.capture else None
+
+    # What the Tiva is showing, so nothing it can't draw gets sent
+    view = ViewFilter()
+    center = args.center or view.center
+
+    # On a bus one box covers every node's center, read from the link once it is open
+    area = None
+    if args.bus and args.center is None:
+        area = lambda: coverage([node.view.center for node in link.nodes], SEARCH_RANGE_KM)
+
+    # The fetch stage runs on its own thread, the encoder only ever sees the newest snapshot
+    # The box follows the Tiva's center, which it keeps in EEPROM, unless --center moves it
+    snapshots = queue.Queue(maxsize=1)
+    if args.synthetic:
+        fetcher = SyntheticFetcher(snapshots, SyntheticTraffic(args.synthetic, center=center))
+    elif args.local:
+        # Nearby aircraft come from the receiver as they are heard, OpenSky fills in the rest
+        opensky = None
+        opensky_snapshots = None
+        if not args.local_only:
+            opensky_snapshots = queue.Queue(maxsize=1)
+            opensky = OpenSkyFetcher(opensky_snapshots, SEARCH_RANGE_KM,
+                                     center=lambda: args.center or view.center, name="opensky", area=area)
+            metrics.add_stage(opensky.stage)
+        fetcher = FusedFetcher(snapshots, SbsReceiver(*args.local), opensky, opensky_snapshots)
+    else:
+        fetcher = OpenSkyFetcher(snapshots, SEARCH_RANGE_KM,
+                                 center=lambda: args.center or view.center, area=area)
+
+    try:
+        # Open UART connection
+        if args.bus:
+            link = BusLink(uart_port, baud_rate, args.bus, capture)
+            feeder = BusFeeder(args, link, fetcher, metrics)
+        else:
+            link = SerialLink(uart_port, baud_rate, capture)
+            feeder = Feeder(args, link, view, fetcher, metrics)
+        print(f"UART connection established on {uart_port} at {baud_rate} baud.")
+
+        if args.metrics_port:
+            metrics.serve(args.metrics_port)
+            print(f"Metrics on http://localhost:{args.metrics_port}/metrics")
+        feeder.start()
+
+        # The stages carry on through their own faults, this thread only waits for Ctrl-C
+        while True:
+            time.sleep(1)
+
+    except serial.SerialException as e:
+        print(f"Error opening UART port: {e}")
+    except KeyboardInterrupt:
+        print(metrics.summary())
+    finally:
+        if feeder is not None:
+            feeder.stop()
+        metrics.close()
+        if link is not None:
+            link.close()
+        if capture is not None:
+            capture.close()
+
+
+if __name__ == "__main__":
+    main()
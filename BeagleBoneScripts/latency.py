@@ -0,0 +1,85 @@
+"""End-to-end latency from the OpenSky response to the pixels on the Tiva's display.
+
+Each burst is stamped with a sequence number and the feeder's clock when the API
+response came in. The Tiva times its own stages (receive, publish, draw) and reports
+them back in a FRAME_LATENCY frame. The feeder only has to add the time from the
+response to its first frame being written, which leaves out the few milliseconds the
+first frame spends on the wire.
+"""
+
+import bisect
+import time
+from collections import deque
+
+import protocol
+
+# Keep this many samples for the percentiles
+HISTORY = 512
+
+# Upper edges of the histogram buckets, in ms
+BUCKETS_MS = (50, 100, 200, 500, 1000, 2000, 5000, 10000)
+
+# Bursts whose report never came back are forgotten after this many newer ones
+PENDING_LIMIT = 16
+
+
+def now_ms():
+    return int(time.monotonic() * 1000) & 0xFFFFFFFF
+
+
+class LatencyTracker:
+    def __init__(self):
+        self.sequence = 0
+        self.samples = deque(maxlen=HISTORY)
+        self.last = None
+        self._pending = {}
+
+    def start_burst(self, response_ms):
+        """Numbers a new burst, returns its sequence number."""
+        self.sequence = (self.sequence + 1) & 0xFFFFFFFF
+        self._pending[self.sequence] = (response_ms, None)
+
+        for old in [s for s in self._pending if (self.sequence - s) & 0xFFFFFFFF > PENDING_LIMIT]:
+            del self._pending[old]
+        return self.sequence
+
+    def first_frame_sent(self, sequence):
+        response_ms, _ = self._pending.get(sequence, (None, None))
+        if response_ms is not None:
+            self._pending[sequence] = (response_ms, now_ms())
+
+    def handle_report(self, payload):
+        """FRAME_LATENCY handler for SerialLink."""
+        sequence, host_ms, receive_ms, publish_ms, draw_ms = \
+            protocol.LATENCY_PAYLOAD.unpack_from(payload)
+
+        _, sent_ms = self._pending.pop(sequence, (None, None))
+        if sent_ms is None:
+            return
+
+        feeder_ms = (sent_ms - host_ms) & 0xFFFFFFFF
+        total_ms = feeder_ms + receive_ms + publish_ms + draw_ms
+        self.samples.append(total_ms)
+        self.last = (sequence, feeder_ms, receive_ms, publish_ms, draw_ms, total_ms)
+
+    def percentile(self, fraction):
+        ordered = sorted(self.samples)
+        return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))] if ordered else None
+
+    def histogram(self):
+        counts = [0] * (len(BUCKETS_MS) + 1)
+        for sample in self.samples:
+            counts[bisect.bisect_left(BUCKETS_MS, sample)] += 1
+        return counts
+
+    def summary(self):
+        if not self.samples:
+            return "latency: no reports yet"
+
+        sequence, feeder_ms, receive_ms, publish_ms, draw_ms, total_ms = self.last
+        edges = [f"<={edge}" for edge in BUCKETS_MS] + [f">{BUCKETS_MS[-1]}"]
+        buckets = " ".join(f"{edge}:{count}" for edge, count in zip(edges, self.histogram()) if count)
+        return (f"latency #{sequence}: {total_ms} ms (feeder {feeder_ms}, receive {receive_ms}, "
+                f"publish {publish_ms}, draw {draw_ms}) | "
+                f"p50={self.percentile(0.50)} p99={self.percentile(0.99)} ms over "
+                f"{len(self.samples)} | {buckets}")
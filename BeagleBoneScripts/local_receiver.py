@@ -0,0 +1,306 @@
+"""Local ADS-B receiver input, fused with OpenSky.
+
+A dump1090 or readsb next to the BeagleBone decodes the receiver's Mode S messages and
+serves them as SBS-1 (BaseStation) text on TCP port 30003, one line per message, within
+a fraction of a second of the aircraft transmitting. SbsReceiver reads that stream and
+keeps the newest fields of every aircraft it hears.
+
+FusedFetcher stands where the other fetchers do, in front of the writer's one-slot
+queue. It merges the receiver's aircraft over OpenSky's last snapshot, ICAO24 by ICAO24:
+an aircraft heard locally takes its position from the receiver, and from OpenSky only
+once the local position is LOCAL_STALE_S old. Aircraft only one side knows are passed
+through as they are.
+
+A snapshot goes out on every new OpenSky response and whenever the receiver has heard
+something new, but no more often than every LOCAL_PUBLISH_S. The writer takes the newest
+snapshot once the last burst is sent, and the delta encoder only sends what moved, so
+nearby traffic updates as fast as the link can carry it and no faster.
+
+The Beast binary output on port 30005 carries the raw messages, undecoded. dump1090
+turns the same messages into the SBS-1 lines on 30003, so that is the port read here.
+"""
+
+import queue
+import socket
+import threading
+import time
+
+from fetcher import Snapshot, publish
+from latency import now_ms
+from supervisor import RETRY_S, StageMetrics, guarded
+
+LOCAL_PORT = 30003
+
+# Snapshots no closer together than this while the receiver keeps hearing aircraft
+LOCAL_PUBLISH_S = 0.5
+
+# A local position this old gives way to OpenSky's, and an aircraft not heard this long is dropped
+LOCAL_STALE_S = 30
+LOCAL_EXPIRE_S = 60
+
+# Wait between connection attempts, doubling up to the maximum
+RECONNECT_S = 1
+MAX_RECONNECT_S = 30
+
+# Socket read timeout, how often the reader checks for stop
+READ_TIMEOUT_S = 1
+
+FEET_TO_METERS = 0.3048
+KNOTS_TO_MPS = 0.514444
+
+# SBS-1 field positions, after splitting a line on commas
+SBS_ICAO24 = 4
+SBS_CALLSIGN = 10
+SBS_ALTITUDE = 11       # feet
+SBS_SPEED = 12          # knots over ground
+SBS_TRACK = 13          # degrees
+SBS_LATITUDE = 14
+SBS_LONGITUDE = 15
+SBS_ON_GROUND = 21      # -1 when on the ground
+SBS_FIELDS = 22
+
+
+def parse_address(text):
+    """host:port, or a bare host on the SBS-1 port."""
+    host, _, port = text.rpartition(":")
+    if not host:
+        return text, LOCAL_PORT
+    return host, int(port)
+
+
+def _number(text, scale=1.0):
+    try:
+        return float(text) * scale
+    except ValueError:
+        return None
+
+
+def parse_sbs(line):
+    """(icao24, fields) of one SBS-1 MSG line, fields holding only what the line carries."""
+    parts = line.strip().split(",")
+    if len(parts) < SBS_FIELDS or parts[0] != "MSG":
+        return None
+    try:
+        icao24 = int(parts[SBS_ICAO24], 16)
+    except ValueError:
+        return None
+
+    fields = {}
+    if parts[SBS_CALLSIGN].strip():
+        fields["callsign"] = parts[SBS_CALLSIGN].strip()
+    altitude = _number(parts[SBS_ALTITUDE], FEET_TO_METERS)
+    if altitude is not None:
+        fields["geo_altitude"] = altitude
+    velocity = _number(parts[SBS_SPEED], KNOTS_TO_MPS)
+    if velocity is not None:
+        fields["velocity"] = velocity
+    track = _number(parts[SBS_TRACK])
+    if track is not None:
+        fields["true_track"] = track
+    latitude = _number(parts[SBS_LATITUDE])
+    longitude = _number(parts[SBS_LONGITUDE])
+    if latitude is not None and longitude is not None:
+        fields["latitude"] = latitude
+        fields["longitude"] = longitude
+    if parts[SBS_ON_GROUND]:
+        fields["on_ground"] = parts[SBS_ON_GROUND] == "-1"
+    return icao24, fields
+
+
+class SbsReceiver(threading.Thread):
+    """Reads SBS-1 lines from host:port, reconnecting whenever the stream drops."""
+
+    def __init__(self, host, port=LOCAL_PORT):
+        super().__init__(name="sbs", daemon=True)
+        self.host = host
+        self.port = port
+
+        # icao24 -> newest fields, with "seen" and "position_seen" in monotonic seconds
+        self.aircraft = {}
+        self.lock = threading.Lock()
+        self.changed = threading.Event()
+
+        self.connects = 0
+        self.messages = 0
+        self.positions = 0
+        self.malformed = 0
+        self.stage = StageMetrics("local")
+        self._stop_event = threading.Event()
+
+    def stop(self):
+        self._stop_event.set()
+        self.changed.set()
+
+    def handle_line(self, line, seen=None):
+        parsed = parse_sbs(line)
+        if parsed is None:
+            self.malformed += 1
+            return
+        icao24, fields = parsed
+        if not fields:
+            return
+
+        seen = time.monotonic() if seen is None else seen
+        with self.lock:
+            held = self.aircraft.setdefault(icao24, {"icao24": icao24, "position_seen": None})
+            held.update(fields)
+            held["seen"] = seen
+            if "latitude" in fields:
+                held["position_seen"] = seen
+                self.positions += 1
+        self.messages += 1
+        self.changed.set()
+
+    def fresh(self, now):
+        """Copies of the aircraft heard in the last LOCAL_EXPIRE_S, dropping the rest."""
+        with self.lock:
+            for icao24 in [icao24 for icao24, held in self.aircraft.items()
+                           if now - held["seen"] > LOCAL_EXPIRE_S]:
+                del self.aircraft[icao24]
+            return [dict(held) for held in self.aircraft.values()]
+
+    def _read(self, stream):
+        pending = b""
+        while not self._stop_event.is_set():
+            try:
+                chunk = stream.recv(4096)
+            except socket.timeout:
+                continue
+            if not chunk:
+                return
+            lines = (pending + chunk).split(b"\n")
+            pending = lines.pop()
+            for line in lines:
+                self.handle_line(line.decode("ascii", "replace"))
+
+    def _connect(self):
+        """Reads one connection until it drops. Returns True if it was made."""
+        try:
+            with socket.create_connection((self.host, self.port), timeout=READ_TIMEOUT_S) as stream:
+                self.connects += 1
+                self._read(stream)
+                return True
+        except OSError as e:
+            self.stage.error()
+            print(f"Local receiver at {self.host}:{self.port} unavailable: {e}")
+            return False
+
+    def run(self):
+        wait_s = RECONNECT_S
+        while not self._stop_event.is_set():
+            if guarded(self.stage, self._connect):
+                wait_s = RECONNECT_S
+            self._stop_event.wait(wait_s)
+            wait_s = min(wait_s * 2, MAX_RECONNECT_S)
+
+    def summary(self):
+        return (f"Local: {self.messages} messages, {self.positions} positions, "
+                f"{len(self.aircraft)} aircraft, {self.connects} connects, {self.malformed} malformed")
+
+
+def fuse(opensky_list, local_list, now):
+    """OpenSky's aircraft with the receiver's fields laid over them, plus the ones only heard locally.
+
+    Returns (aircraft_list, fused, local_only).
+    """
+    by_icao24 = {aircraft["icao24"]: aircraft for aircraft in opensky_list}
+    fused = 0
+    local_only = 0
+
+    for held in local_list:
+        position_fresh = held["position_seen"] is not None and now - held["position_seen"] <= LOCAL_STALE_S
+        overlay = {key: value for key, value in held.items()
+                   if key not in ("seen", "position_seen", "latitude", "longitude")}
+        if position_fresh:
+            overlay["latitude"] = held["latitude"]
+            overlay["longitude"] = held["longitude"]
+
+        aircraft = by_icao24.get(held["icao24"])
+        if aircraft is not None:
+            by_icao24[held["icao24"]] = {**aircraft, **overlay}
+            fused += 1
+        elif position_fresh:
+            by_icao24[held["icao24"]] = {"callsign": None, "geo_altitude": None, "velocity": None,
+                                         "true_track": None, "on_ground": False, **overlay}
+            local_only += 1
+
+    return list(by_icao24.values()), fused, local_only
+
+
+class FusedFetcher(threading.Thread):
+    """Merges a receiver with an optional OpenSky fetcher, which publishes into its own queue.
+
+    Starting and stopping this thread starts and stops both sources.
+    """
+
+    def __init__(self, snapshots, receiver, opensky=None, opensky_snapshots=None,
+                 interval_s=LOCAL_PUBLISH_S):
+        super().__init__(name="fused", daemon=True)
+        self.snapshots = snapshots
+        self.receiver = receiver
+        self.opensky = opensky
+        self.opensky_snapshots = opensky_snapshots
+        self.interval_s = interval_s
+
+        self.opensky_list = []
+        self.fused = 0
+        self.local_only = 0
+        self.stage = StageMetrics("fetch")
+        self._last_publish = 0.0
+        self._stop_event = threading.Event()
+
+    def start(self):
+        self.receiver.start()
+        if self.opensky is not None:
+            self.opensky.start()
+        super().start()
+
+    def stop(self):
+        self._stop_event.set()
+        self.receiver.stop()
+        if self.opensky is not None:
+            self.opensky.stop()
+
+    def _take_opensky(self):
+        if self.opensky_snapshots is None:
+            return False
+        try:
+            self.opensky_list = self.opensky_snapshots.get_nowait().aircraft_list
+            return True
+        except queue.Empty:
+            return False
+
+    def poll(self):
+        # Wake on what the receiver hears, and often enough to see OpenSky's responses
+        self.receiver.changed.wait(self.interval_s)
+        heard = self.receiver.changed.is_set()
+        fresh_opensky = self._take_opensky()
+
+        now = time.monotonic()
+        if not fresh_opensky and (not heard or now - self._last_publish < self.interval_s):
+            if heard:
+                self._stop_event.wait(self._last_publish + self.interval_s - now)
+            return
+
+        self.receiver.changed.clear()
+        self._last_publish = now
+        aircraft_list, self.fused, self.local_only = fuse(self.opensky_list,
+                                                          self.receiver.fresh(now), now)
+        if publish(self.snapshots, Snapshot(aircraft_list, now_ms(), self.stage.items + 1)):
+            self.stage.drop()
+        self.stage.observe(time.monotonic() - now)
+
+    def run(self):
+        while not self._stop_event.is_set():
+            errors = self.stage.errors
+            guarded(self.stage, self.poll)
+            if self.stage.errors != errors:
+                self._stop_event.wait(RETRY_S)
+
+    def summary(self):
+        lines = [f"Fused: {self.stage.items} snapshots, {self.stage.dropped} superseded, "
+                 f"{self.fused} heard locally and on OpenSky, {self.local_only} only locally",
+                 self.receiver.summary()]
+        if self.opensky is not None:
+            lines.append(self.opensky.summary())
+        return "\n".join(lines)
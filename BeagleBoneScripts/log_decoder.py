@@ -0,0 +1,152 @@
+"""Decodes the Tiva's binary debug log from UART0.
+
+The firmware only sends a message ID and raw argument words (see System/log.h). The
+formats live in System/log_messages.h, which is parsed here so the two can't drift apart.
+Anything on the port that isn't a log record is passed through as text.
+
+Usage: python3 log_decoder.py [port | capture.bin] [baud]
+"""
+
+import os
+import re
+import struct
+import sys
+
+LOG_SYNC = 0xA5
+HEADER = struct.Struct("<I")
+
+MESSAGES_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               "..", "System", "log_messages.h")
+
+_ENTRY = re.compile(r'X\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+_CONVERSION = re.compile(r"%(q\d|[duxs%])")
+
+
+def load_messages(path=MESSAGES_HEADER):
+    """Returns (name, format) for every message, in ID order."""
+    with open(path, encoding="ascii") as header:
+        text = header.read()
+
+    table = text[text.index("#define LOG_MESSAGES"):]
+    return [(name, bytes(fmt, "ascii").decode("unicode_escape"))
+            for name, fmt in _ENTRY.findall(table)]
+
+
+def argument_count(fmt):
+    return sum(1 for conversion in _CONVERSION.findall(fmt) if conversion != "%")
+
+
+def format_message(fmt, args):
+    args = iter(args)
+
+    def convert(match):
+        conversion = match.group(1)
+        if conversion == "%":
+            return "%"
+
+        word = next(args)
+        signed = word - (1 << 32) if word & 0x80000000 else word
+        if conversion == "d":
+            return str(signed)
+        if conversion == "u":
+            return str(word)
+        if conversion == "x":
+            return f"{word:06x}"
+        if conversion == "s":
+            return struct.pack("<I", word).rstrip(b"\0").decode("ascii", "replace")
+
+        # %qN, signed fixed point with N decimal places
+        places = int(conversion[1:])
+        sign = "-" if signed < 0 else ""
+        whole, fraction = divmod(abs(signed), 10 ** places)
+        return f"{sign}{whole}.{fraction:0{places}d}" if places else f"{sign}{whole}"
+
+    return _CONVERSION.sub(convert, fmt)
+
+
+class Decoder:
+    """Splits a UART0 byte stream into log lines and plain text."""
+
+    def __init__(self, messages=None):
+        self.messages = messages if messages is not None else load_messages()
+        self.argcs = [argument_count(fmt) for _name, fmt in self.messages]
+        self._buffer = bytearray()
+
+        # The header only carries 20 bits of milliseconds, extend them as they wrap
+        self._last_ms = None
+        self._epoch_ms = 0
+
+    def _timestamp(self, millis):
+        if self._last_ms is not None and millis + (1 << 19) < self._last_ms:
+            self._epoch_ms += 1 << 20
+        self._last_ms = millis
+        return self._epoch_ms + millis
+
+    def _record(self):
+        """Returns (length, line) for a record at the start of the buffer, or None."""
+        if len(self._buffer) < 1 + HEADER.size:
+            return 0, None
+
+        (header,) = HEADER.unpack_from(self._buffer, 1)
+        message, argc, millis = header & 0xFF, (header >> 8) & 0x0F, header >> 12
+        if message >= len(self.messages) or argc != self.argcs[message]:
+            return None
+
+        length = 1 + HEADER.size + 4 * argc
+        if len(self._buffer) < length:
+            return 0, None
+
+        args = struct.unpack_from(f"<{argc}I", self._buffer, 1 + HEADER.size)
+        name, fmt = self.messages[message]
+        stamp = self._timestamp(millis) / 1000
+        return length, f"[{stamp:10.3f}] {name}: {format_message(fmt, args)}"
+
+    def feed(self, data):
+        """Yields every complete log line or run of text in data."""
+        self._buffer.extend(data)
+
+        while self._buffer:
+            if self._buffer[0] != LOG_SYNC:
+                end = self._buffer.find(bytes([LOG_SYNC]))
+                end = len(self._buffer) if end < 0 else end
+                text = self._buffer[:end].decode("ascii", "replace")
+                del self._buffer[:end]
+                yield text
+                continue
+
+            record = self._record()
+            if record is None:
+                # Not a record after all, treat the byte as noise
+                del self._buffer[:1]
+                continue
+
+            length, line = record
+            if not length:
+                return
+            del self._buffer[:length]
+            yield line + "\n"
+
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyACM0"
+    baud_rate = int(sys.argv[2]) if len(sys.argv) > 2 else 115200
+    decoder = Decoder()
+
+    if os.path.isfile(source):
+        with open(source, "rb") as capture:
+            for line in decoder.feed(capture.read()):
+                sys.stdout.write(line)
+        return
+
+    import serial
+
+    with serial.Serial(source, baud_rate, timeout=0.1) as uart:
+        print(f"Decoding log on {source} at {baud_rate} baud.")
+        while True:
+            for line in decoder.feed(uart.read(uart.in_waiting or 1)):
+                sys.stdout.write(line)
+            sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
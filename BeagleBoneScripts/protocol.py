@@ -0,0 +1,431 @@
+"""Framed, checksummed telemetry protocol (v2) shared with Link/protocol.h.
+
+Every frame is exactly FRAME_SIZE bytes:
+
+    offset  size  field
+    0       2     sync preamble 0xA5 0x5A
+    2       1     frame type
+    3       1     payload length in use
+    4       34    payload, zero padded
+    38      2     CRC-16 (IBM/ARC) over bytes 2..37, little-endian
+"""
+
+import struct
+
+SYNC = b"\xA5\x5A"
+
+FRAME_SIZE = 40
+HEADER_SIZE = 4
+CRC_SIZE = 2
+PAYLOAD_SIZE = FRAME_SIZE - HEADER_SIZE - CRC_SIZE
+
+# Frame types
+FRAME_AIRCRAFT = 0x01
+FRAME_BURST_END = 0x02
+FRAME_UPSERT = 0x03
+FRAME_DELTA = 0x04
+FRAME_REMOVE = 0x05
+FRAME_BAUD = 0x06
+FRAME_BAUD_TEST = 0x07
+FRAME_CENTER = 0x08
+FRAME_FILTER = 0x09
+FRAME_STATS = 0x0A      # on UART0, from stats.py
+FRAME_COMPACT = 0x0B    # reference point and packed compact records, see compact_encoder.py
+FRAME_SCHEDULE = 0x0C   # wall clock and quiet hours, see System/quiet_hours.h
+FRAME_ADDRESS = 0x0D    # which bus nodes the frames after it are for, see bus.py
+FRAME_NODE = 0x0E       # the unit's bus node and rate, from its next boot
+
+# Burst end flags
+BURST_KEYFRAME = 0x01
+BURST_RETIRE = 0x02     # live aircraft the burst didn't upsert are removed
+
+# Center flags
+CENTER_STORE = 0x01     # the Tiva also keeps it in EEPROM for the next boot
+
+# Filter flags
+FILTER_HIDE_UNNAMED = 0x01      # hide aircraft without a callsign
+FILTER_ALTITUDE_COLORS = 0x02   # color each aircraft by its altitude
+
+# Stats query groups, answered with log records on UART0
+STATS_TRAFFIC = 0x01
+STATS_LINK = 0x02
+STATS_FRAMES = 0x04
+STATS_LOCKS = 0x08
+STATS_QUEUES = 0x10
+STATS_STACKS = 0x20
+STATS_CPU = 0x40
+STATS_ALL = 0x7F
+
+# Delta record field bits, in packing order, and the wire units each delta counts in.
+# Wire units are the x10000 scaled integers of a full aircraft record.
+DELTA_LONGITUDE = 0x01
+DELTA_LATITUDE = 0x02
+DELTA_ALTITUDE = 0x04
+DELTA_VELOCITY = 0x08
+DELTA_HEADING = 0x10
+DELTA_UNITS = (1, 1, 10000, 1000, 1000)
+DELTA_HEADER = struct.Struct("<HBB")    # ICAO24 low 16 bits, ICAO24 high 8 bits, mask
+ICAO24_SIZE = 3
+
+# Compact records, see Link/protocol.h
+COMPACT_DEFINE = 0x01
+COMPACT_ENTRIES = 256
+COMPACT_CALLSIGN_SIZE = 8
+
+# Downlink frame types, Tiva to feeder, all with FRAME_DOWNLINK set
+FRAME_DOWNLINK = 0x80
+FRAME_CREDIT = 0x80
+FRAME_LATENCY = 0x81
+FRAME_VIEW = 0x82
+FRAME_BAUD_REPLY = 0x83
+
+# Bus nodes, see Link/bus_node.h
+BUS_NODES = 32
+BUS_NONE = 0xFF         # no node: a link of its own, or nobody polled
+
+# Baud reply status
+BAUD_SWITCHING = 0x01
+BAUD_CONFIRMED = 0x02
+BAUD_REJECTED = 0x03
+BAUD_FALLBACK = 0x04
+
+# View flags
+VIEW_SELECTED = 0x01
+VIEW_QUIET = 0x02       # in quiet hours, the Tiva is awake for one keyframe
+
+# icao24, callsign[8], longitude, latitude, altitude, velocity, heading
+AIRCRAFT_PAYLOAD = struct.Struct("<I8siiiii")
+# frame_count, flags, reserved, sequence, host_ms
+BURST_END_PAYLOAD = struct.Struct("<HBxII")
+# consumed_total, free_slots, window, compact_misses
+CREDIT_PAYLOAD = struct.Struct("<IBBH")
+# sequence, host_ms, receive_ms, publish_ms, draw_ms
+LATENCY_PAYLOAD = struct.Struct("<IIHHH")
+# selected_icao24, range_km, flags, reserved, center latitude, center longitude
+VIEW_PAYLOAD = struct.Struct("<IHBxii")
+# baud, test_frames, status, reserved
+BAUD_PAYLOAD = struct.Struct("<IBBxx")
+# latitude, longitude, flags, reserved
+CENTER_PAYLOAD = struct.Struct("<iiBxxx")
+# min_altitude, max_altitude, min_velocity, flags, reserved
+FILTER_PAYLOAD = struct.Struct("<hhhBx")
+# utc_seconds, utc_offset_min, quiet_start_min, quiet_end_min, period_s
+SCHEDULE_PAYLOAD = struct.Struct("<IhHHH")
+# nodes, poll, reserved
+ADDRESS_PAYLOAD = struct.Struct("<IBxxx")
+# baud, node, reserved
+NODE_PAYLOAD = struct.Struct("<IBxxx")
+# groups
+STATS_QUERY_PAYLOAD = struct.Struct("<I")
+
+# Center coordinates go as micro-degrees
+CENTER_UNITS_PER_DEGREE = 1000000
+
+# preamble, frame type, payload length
+FRAME_HEADER = struct.Struct("<2sBB")
+CRC = struct.Struct("<H")
+
+# Fixed-point scale applied to every numeric field
+FIELD_SCALE = 10000
+
+# Frames a BurstBuffer has room for before it first grows
+BURST_CAPACITY = 256
+
+_ZERO_PAYLOAD = bytes(PAYLOAD_SIZE)
+
+
+def _make_crc16_table():
+    # Reflected form of x^16 + x^15 + x^2 + 1, same table as driverlib/sw_crc.c
+    table = []
+    for byte in range(256):
+        crc = byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+        table.append(crc)
+    return table
+
+
+_CRC16_TABLE = _make_crc16_table()
+
+
+def crc16(data, crc=0):
+    """CRC-16/ARC, matches Crc16(0, data, len) in driverlib/sw_crc.c."""
+    for byte in data:
+        crc = (crc >> 8) ^ _CRC16_TABLE[(crc ^ byte) & 0xFF]
+    return crc
+
+
+def encode_frame(frame_type, payload=b""):
+    """Wraps a payload in a v2 frame: preamble, type, length, padding and CRC."""
+    if len(payload) > PAYLOAD_SIZE:
+        raise ValueError(f"payload too long: {len(payload)} > {PAYLOAD_SIZE}")
+
+    body = bytes([frame_type, len(payload)]) + payload.ljust(PAYLOAD_SIZE, b"\x00")
+    return SYNC + body + CRC.pack(crc16(body))
+
+
+def quantize_aircraft(longitude, latitude, altitude, velocity, true_track):
+    """Scales a state vector to the wire's x10000 integers. Missing fields become zero."""
+    return (
+        int((longitude or 0.0) * FIELD_SCALE),
+        int((latitude or 0.0) * FIELD_SCALE),
+        int((altitude or 0.0) * FIELD_SCALE),
+        int((velocity or 0.0) * FIELD_SCALE),
+        int((true_track or 0.0) * FIELD_SCALE),
+    )
+
+
+def encode_aircraft_fields(icao24, callsign, fields, frame_type=FRAME_AIRCRAFT):
+    """Encodes an already quantized aircraft record as a keyframe or upsert frame."""
+    callsign_bytes = (callsign or "N/A").strip()[:8].ljust(8).encode("ascii", "ignore")
+    payload = AIRCRAFT_PAYLOAD.pack(icao24 & 0xFFFFFFFF, callsign_bytes, *fields)
+    return encode_frame(frame_type, payload)
+
+
+def encode_aircraft(icao24, callsign, longitude, latitude, altitude, velocity, true_track,
+                    frame_type=FRAME_AIRCRAFT):
+    """Encodes one aircraft state vector. Missing fields are sent as zero."""
+    fields = quantize_aircraft(longitude, latitude, altitude, velocity, true_track)
+    return encode_aircraft_fields(icao24, callsign, fields, frame_type)
+
+
+def encode_delta_record(icao24, mask, deltas):
+    """Packs one delta record: 3-byte address, mask, then an int16 per set mask bit."""
+    record = DELTA_HEADER.pack(icao24 & 0xFFFF, (icao24 >> 16) & 0xFF, mask)
+    for delta in deltas:
+        record += struct.pack("<h", delta)
+    return record
+
+
+def pack_records(frame_type, records):
+    """Greedily packs byte records into as few frames of one type as possible."""
+    return BurstBuffer(len(records)).records(frame_type, records).frame_list()
+
+
+def encode_removals(icao24_list):
+    """REMOVE frames: a count byte followed by up to 11 three-byte addresses."""
+    return BurstBuffer(len(icao24_list)).removals(icao24_list).frame_list()
+
+
+def burst_flags(keyframe, retire=False):
+    return (BURST_KEYFRAME if keyframe else 0) | (BURST_RETIRE if retire else 0)
+
+
+def encode_burst_end(frame_count, keyframe=True, sequence=0, host_ms=0, retire=False):
+    """End-of-burst frame, carries how many data frames the burst contained.
+
+    The sequence number and host timestamp come back in the Tiva's latency report.
+    """
+    flags = burst_flags(keyframe, retire)
+    payload = BURST_END_PAYLOAD.pack(frame_count & 0xFFFF, flags, sequence & 0xFFFFFFFF,
+                                     host_ms & 0xFFFFFFFF)
+    return encode_frame(FRAME_BURST_END, payload)
+
+
+def encode_baud_request(baud, test_frames):
+    return encode_frame(FRAME_BAUD, BAUD_PAYLOAD.pack(baud, test_frames, 0))
+
+
+def encode_baud_test(index):
+    """Test frame `index`, every byte after the index as test_byte() in Link/link_rate.c."""
+    payload = bytes([index]) + bytes((0xA5 ^ (index * 29) ^ (offset * 73)) & 0xFF
+                                     for offset in range(1, PAYLOAD_SIZE))
+    return encode_frame(FRAME_BAUD_TEST, payload)
+
+
+def encode_center(latitude, longitude, store=True):
+    """Moves the radar center, in degrees, and keeps it there across resets if `store`."""
+    payload = CENTER_PAYLOAD.pack(round(latitude * CENTER_UNITS_PER_DEGREE),
+                                  round(longitude * CENTER_UNITS_PER_DEGREE),
+                                  CENTER_STORE if store else 0)
+    return encode_frame(FRAME_CENTER, payload)
+
+
+def encode_address(nodes, poll=BUS_NONE):
+    """Frames after this one, up to the next, are for the nodes in the `nodes` bit mask, and `poll` answers."""
+    return encode_frame(FRAME_ADDRESS, ADDRESS_PAYLOAD.pack(nodes, poll))
+
+
+def encode_node(node, baud):
+    """Makes the unit bus node `node` at `baud` from its next boot, BUS_NONE for a link of its own."""
+    return encode_frame(FRAME_NODE, NODE_PAYLOAD.pack(baud, node))
+
+
+def parse_quiet(text):
+    """(start, end) minutes after local midnight from HH:MM-HH:MM, or (0, 0) for off."""
+    if text == "off":
+        return 0, 0
+    minutes = []
+    for part in text.split("-"):
+        hours, _, mins = part.partition(":")
+        minutes.append(int(hours) * 60 + int(mins or 0))
+    start, end = minutes
+    if not (0 <= start < 1440 and 0 <= end < 1440):
+        raise ValueError(f"quiet hours out of the day: {text}")
+    return start, end
+
+
+def encode_schedule(utc_seconds, utc_offset_min, quiet, period_s):
+    """Sets the Tiva's clock and its quiet hours, (start, end) as parse_quiet returns them."""
+    start, end = quiet
+    payload = SCHEDULE_PAYLOAD.pack(int(utc_seconds) & 0xFFFFFFFF, utc_offset_min, start, end,
+                                    min(period_s, 0xFFFF))
+    return encode_frame(FRAME_SCHEDULE, payload)
+
+
+def parse_filter(text):
+    """Display filter payload from a spec like alt=1000:9000,speed=50,named,colors.
+
+    alt is a band in meters, either end may be left out, speed a minimum in m/s, named
+    hides aircraft without a callsign and colors colors each aircraft by its altitude.
+    """
+    min_altitude, max_altitude, min_velocity, flags = -32768, 32767, -32768, 0
+
+    for item in filter(None, (part.strip() for part in text.split(","))):
+        key, _, value = item.partition("=")
+        if key == "alt":
+            low, _, high = value.partition(":")
+            min_altitude = int(low) if low else min_altitude
+            max_altitude = int(high) if high else max_altitude
+        elif key == "speed":
+            min_velocity = round(float(value) * 10)
+        elif key == "named":
+            flags |= FILTER_HIDE_UNNAMED
+        elif key == "colors":
+            flags |= FILTER_ALTITUDE_COLORS
+        else:
+            raise ValueError(f"unknown filter item: {item}")
+
+    return FILTER_PAYLOAD.pack(min_altitude, max_altitude, min_velocity, flags)
+
+
+class BurstBuffer:
+    """A whole burst of frames packed back to back in one reusable bytearray.
+
+    Payloads are packed in place with the precompiled structs, so a burst costs no
+    per-frame bytes objects and goes to the serial port in as few writes as the credit
+    window allows. The buffer is reused from burst to burst and only ever grows.
+    """
+
+    def __init__(self, capacity=BURST_CAPACITY):
+        self._buffer = bytearray(max(capacity, 1) * FRAME_SIZE)
+        self.frames = 0
+
+    def reset(self):
+        self.frames = 0
+        return self
+
+    def _begin(self, frame_type, length):
+        """Writes the header of the next frame and zeroes its payload, returns its offset."""
+        offset = self.frames * FRAME_SIZE
+        if offset + FRAME_SIZE > len(self._buffer):
+            # A new buffer rather than a resize, views of the old one may still be held
+            grown = bytearray(2 * len(self._buffer))
+            grown[:offset] = self._buffer[:offset]
+            self._buffer = grown
+
+        FRAME_HEADER.pack_into(self._buffer, offset, SYNC, frame_type, length)
+        self._buffer[offset + HEADER_SIZE:offset + FRAME_SIZE - CRC_SIZE] = _ZERO_PAYLOAD
+        return offset
+
+    def _finish(self, offset):
+        crc = crc16(self._buffer[offset + 2:offset + FRAME_SIZE - CRC_SIZE])
+        CRC.pack_into(self._buffer, offset + FRAME_SIZE - CRC_SIZE, crc)
+        self.frames += 1
+
+    def frame(self, frame_type, payload=b""):
+        """Appends a frame around an already built payload."""
+        if len(payload) > PAYLOAD_SIZE:
+            raise ValueError(f"payload too long: {len(payload)} > {PAYLOAD_SIZE}")
+
+        offset = self._begin(frame_type, len(payload))
+        self._buffer[offset + HEADER_SIZE:offset + HEADER_SIZE + len(payload)] = payload
+        self._finish(offset)
+        return self
+
+    def aircraft(self, icao24, callsign, fields, frame_type=FRAME_AIRCRAFT):
+        """Appends an already quantized aircraft record as a keyframe or upsert frame."""
+        callsign_bytes = (callsign or "N/A").strip()[:8].ljust(8).encode("ascii", "ignore")
+        offset = self._begin(frame_type, AIRCRAFT_PAYLOAD.size)
+        AIRCRAFT_PAYLOAD.pack_into(self._buffer, offset + HEADER_SIZE,
+                                   icao24 & 0xFFFFFFFF, callsign_bytes, *fields)
+        self._finish(offset)
+        return self
+
+    def records(self, frame_type, records, header=b""):
+        """Greedily packs byte records into as few frames of one type as possible.
+
+        Every frame starts with `header`.
+        """
+        payload = header
+        for record in records:
+            if len(payload) + len(record) > PAYLOAD_SIZE:
+                self.frame(frame_type, payload)
+                payload = header
+            payload += record
+        if len(payload) > len(header):
+            self.frame(frame_type, payload)
+        return self
+
+    def removals(self, icao24_list):
+        """REMOVE frames: a count byte followed by up to 11 three-byte addresses."""
+        per_frame = (PAYLOAD_SIZE - 1) // ICAO24_SIZE
+        for start in range(0, len(icao24_list), per_frame):
+            chunk = icao24_list[start:start + per_frame]
+            payload = bytes([len(chunk)]) + b"".join(
+                (address & 0xFFFFFF).to_bytes(ICAO24_SIZE, "little") for address in chunk)
+            self.frame(FRAME_REMOVE, payload)
+        return self
+
+    def burst_end(self, keyframe=True, sequence=0, host_ms=0, retire=False):
+        """Closes the burst with its end frame, counting every frame before it."""
+        flags = burst_flags(keyframe, retire)
+        offset = self._begin(FRAME_BURST_END, BURST_END_PAYLOAD.size)
+        BURST_END_PAYLOAD.pack_into(self._buffer, offset + HEADER_SIZE, self.frames & 0xFFFF,
+                                    flags, sequence & 0xFFFFFFFF, host_ms & 0xFFFFFFFF)
+        self._finish(offset)
+        return self
+
+    def view(self):
+        """The packed frames, valid until the buffer is next reset."""
+        return memoryview(self._buffer)[:self.frames * FRAME_SIZE]
+
+    def frame_list(self):
+        """The packed frames as separate bytes objects."""
+        return [bytes(self._buffer[i * FRAME_SIZE:(i + 1) * FRAME_SIZE]) for i in range(self.frames)]
+
+
+class Decoder:
+    """Byte-stream v2 frame decoder with resync, mirrors Protocol_Decode()."""
+
+    def __init__(self):
+        self._buffer = bytearray()
+        self.crc_errors = 0
+
+    def feed(self, data):
+        """Consumes received bytes and returns a list of (frame_type, payload)."""
+        self._buffer += data
+        frames = []
+
+        while True:
+            start = self._buffer.find(SYNC)
+            if start < 0:
+                # Keep a trailing first preamble byte, it may be completed next time
+                del self._buffer[:-1 if self._buffer[-1:] == SYNC[:1] else len(self._buffer)]
+                return frames
+
+            del self._buffer[:start]
+            if len(self._buffer) < FRAME_SIZE:
+                return frames
+
+            frame = bytes(self._buffer[:FRAME_SIZE])
+            body = frame[2:FRAME_SIZE - CRC_SIZE]
+            (crc,) = struct.unpack_from("<H", frame, FRAME_SIZE - CRC_SIZE)
+
+            if crc == crc16(body) and body[1] <= PAYLOAD_SIZE:
+                frames.append((body[0], body[2:2 + body[1]]))
+                del self._buffer[:FRAME_SIZE]
+            else:
+                # Bad frame, slide past this preamble and look for the next one
+                self.crc_errors += 1
+                del self._buffer[:1]
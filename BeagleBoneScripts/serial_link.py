@@ -0,0 +1,229 @@
+"""UART link to the Tiva with credit-based flow control.
+
+UART4 on the TM4C123 has no RTS/CTS pins, so the Tiva reports back how many frames it
+has consumed. The feeder keeps at most `window` frames outstanding and otherwise writes
+at line rate, instead of sleeping after every aircraft.
+
+The link comes up at 115,200 baud and negotiate() steps it up from there, see
+Link/link_rate.h for the Tiva's side. Each candidate rate is only kept once a run of
+CRC-checked test frames has crossed intact, otherwise both ends drop back and the next
+rate down is tried.
+"""
+
+import time
+
+import serial
+
+import protocol
+
+# Until the first credit frame arrives, assume the firmware default window
+DEFAULT_WINDOW = 6
+
+# If no credit shows up for this long while blocked, frames were lost on the line
+CREDIT_TIMEOUT_S = 0.25
+
+# Rates negotiate() tries, fastest first
+LINK_RATES = (1500000, 921600, 460800, 230400)
+
+# Test frames sent at a candidate rate, the Tiva keeps it only if all of them arrive
+BAUD_TEST_FRAMES = 16
+
+BAUD_REPLY_TIMEOUT_S = 0.5
+BAUD_TRIAL_TIMEOUT_S = 1.5      # the Tiva's LINK_RATE_TRIAL_MS and some margin
+BAUD_SETTLE_S = 0.05            # the Tiva switches within LINK_RATE_POLL_MS of its reply
+
+# A raised rate is confirmed after this long without sending, well inside the Tiva's
+# LINK_RATE_SILENCE_MS, so a slow API never lets it time out
+KEEPALIVE_S = 10
+
+
+class SerialLink:
+    def __init__(self, port, baud_rate, capture=None):
+        self.uart = serial.Serial(port, baud_rate, timeout=0)
+        self.capture = capture
+        self._decoder = protocol.Decoder()
+
+        self.window = DEFAULT_WINDOW
+        self.outstanding = 0
+        self._consumed_total = None
+
+        # Compact records the Tiva couldn't place, a change means its dictionary is out of step
+        self.compact_misses = None
+
+        self.frames_sent = 0
+        self.writes = 0
+        self.last_write = time.monotonic()
+        self.credit_stalls = 0
+        self.credit_timeouts = 0
+
+        # Callbacks for other downlink frame types, by type
+        self.handlers = {protocol.FRAME_BAUD_REPLY: self._handle_baud_reply}
+        self._baud_reply = None
+
+    def close(self):
+        if self.uart.is_open:
+            self.uart.close()
+
+    def _handle_credit(self, payload):
+        consumed_total, _free_slots, window, compact_misses = protocol.CREDIT_PAYLOAD.unpack_from(payload)
+        self.window = window
+        self.compact_misses = compact_misses
+
+        # Cumulative counter, so a lost credit frame is caught up by the next one
+        if self._consumed_total is not None:
+            consumed = (consumed_total - self._consumed_total) & 0xFFFFFFFF
+            self.outstanding = max(0, self.outstanding - consumed)
+        self._consumed_total = consumed_total
+
+    def poll(self):
+        """Reads and handles any downlink frames waiting on the port."""
+        waiting = self.uart.in_waiting
+        if not waiting:
+            return
+
+        for frame_type, payload in self._decoder.feed(self.uart.read(waiting)):
+            if frame_type == protocol.FRAME_CREDIT:
+                self._handle_credit(payload)
+            elif frame_type in self.handlers:
+                self.handlers[frame_type](payload)
+
+    def wait(self, seconds, interval=0.05):
+        """Sleeps for a while, still handling downlink frames as they come in."""
+        deadline = time.monotonic() + seconds
+        while True:
+            self.poll()
+            remaining = deadline - time.monotonic()
+            if remaining <= 0:
+                return
+            time.sleep(min(interval, remaining))
+
+    def _wait_for_credit(self):
+        self.credit_stalls += 1
+        deadline = time.monotonic() + CREDIT_TIMEOUT_S
+
+        while self.outstanding >= self.window:
+            self.poll()
+            if time.monotonic() > deadline:
+                # Frames corrupted on the way never get credited, start over
+                self.credit_timeouts += 1
+                self.outstanding = 0
+                return
+            time.sleep(0.001)
+
+    def _handle_baud_reply(self, payload):
+        self._baud_reply = protocol.BAUD_PAYLOAD.unpack_from(payload)
+
+    def _wait_baud_reply(self, timeout_s, statuses):
+        """Returns the (baud, test_frames, status) reply, or None if none came in time."""
+        deadline = time.monotonic() + timeout_s
+        while time.monotonic() < deadline:
+            self.poll()
+            if self._baud_reply is not None and self._baud_reply[2] in statuses:
+                return self._baud_reply
+            time.sleep(0.005)
+        return None
+
+    def _ask_baud(self, baud, test_frames, timeout_s, statuses):
+        self._baud_reply = None
+        self.send_frame(protocol.encode_baud_request(baud, test_frames))
+        return self._wait_baud_reply(timeout_s, statuses)
+
+    def _set_baud(self, baud):
+        self.uart.baudrate = baud
+        # Frames in flight across the switch are never credited
+        self.outstanding = 0
+
+    def _try_baud(self, baud):
+        """One round of the handshake at `baud`, returns True if both ends stay there."""
+        start_baud = self.uart.baudrate
+
+        reply = self._ask_baud(baud, BAUD_TEST_FRAMES, BAUD_REPLY_TIMEOUT_S,
+                               (protocol.BAUD_SWITCHING, protocol.BAUD_REJECTED))
+        if reply is None or reply[2] != protocol.BAUD_SWITCHING:
+            return False
+
+        time.sleep(BAUD_SETTLE_S)
+        self._set_baud(baud)
+        self._baud_reply = None
+        for index in range(BAUD_TEST_FRAMES):
+            self.send_frame(protocol.encode_baud_test(index))
+
+        reply = self._wait_baud_reply(BAUD_TRIAL_TIMEOUT_S,
+                                      (protocol.BAUD_CONFIRMED, protocol.BAUD_FALLBACK))
+        if reply is not None and reply[2] == protocol.BAUD_CONFIRMED:
+            return True
+
+        # The confirmation itself may be what got lost, a Tiva that kept the rate says so again
+        if reply is None and self._ask_baud(baud, 0, BAUD_REPLY_TIMEOUT_S,
+                                            (protocol.BAUD_CONFIRMED,)) is not None:
+            return True
+
+        self._set_baud(start_baud)
+        return False
+
+    def keep_alive(self, default_baud):
+        """Confirms a raised rate if the line has been quiet for KEEPALIVE_S.
+
+        Returns False if the Tiva no longer answers at it, in which case the port is back
+        at default_baud and the rate needs negotiating again.
+        """
+        baud = self.uart.baudrate
+        if baud == default_baud or time.monotonic() - self.last_write < KEEPALIVE_S:
+            return True
+
+        if self._ask_baud(baud, 0, BAUD_REPLY_TIMEOUT_S, (protocol.BAUD_CONFIRMED,)) is not None:
+            return True
+
+        self._set_baud(default_baud)
+        return False
+
+    def negotiate(self, max_baud):
+        """Steps the link up to the fastest rate up to max_baud that carries cleanly.
+
+        Returns the rate in use, or None if the Tiva didn't answer at the current rate at
+        all, either older firmware or still at a raised rate from before a restart. It
+        falls back to the default by itself after LINK_RATE_SILENCE_MS, so try again later.
+        """
+        current = self.uart.baudrate
+        if self._ask_baud(current, 0, BAUD_REPLY_TIMEOUT_S, (protocol.BAUD_CONFIRMED,)) is None:
+            return None
+
+        for baud in LINK_RATES:
+            if current < baud <= max_baud and self._try_baud(baud):
+                return baud
+        return current
+
+    def _write(self, chunk, frames):
+        """Writes whole frames without looking at the window, and counts them outstanding."""
+        self.uart.write(chunk)
+        if self.capture is not None:
+            self.capture.write(chunk)
+
+        self.outstanding += frames
+        self.frames_sent += frames
+        self.writes += 1
+        self.last_write = time.monotonic()
+
+    def send_frames(self, data):
+        """Writes whole frames packed back to back, blocking only while the Tiva's receive
+        ring is full.
+
+        Every frame the window has room for goes out in a single write, so a burst that
+        fits the window costs one syscall.
+        """
+        view = memoryview(data)
+        count = len(view) // protocol.FRAME_SIZE
+        sent = 0
+
+        while sent < count:
+            self.poll()
+            if self.outstanding >= self.window:
+                self._wait_for_credit()
+
+            batch = min(count - sent, self.window - self.outstanding)
+            self._write(view[sent * protocol.FRAME_SIZE:(sent + batch) * protocol.FRAME_SIZE], batch)
+            sent += batch
+
+    def send_frame(self, frame):
+        """Writes one frame, blocking only while the Tiva's receive ring is full."""
+        self.send_frames(frame)
@@ -0,0 +1,113 @@
+"""Live statistics dashboard for the Tiva, over the UART0 debug console.
+
+Every interval a FRAME_STATS query goes out on UART0 asking for the chosen groups, and
+the Tiva answers with one log record per line of counters, closed by LOG_STATS_END (see
+System/console.h). The answer is redrawn in place once it is complete. Anything else
+the firmware logs in between, warnings and events, scrolls underneath.
+
+Usage: python3 stats.py [port] [interval_s] [groups...]
+
+Groups are traffic, link, frames, locks, queues, stacks and cpu, all of them by default.
+"""
+
+import sys
+import time
+from collections import deque
+
+import protocol
+from log_decoder import Decoder
+
+GROUPS = {
+    "traffic": protocol.STATS_TRAFFIC,
+    "link": protocol.STATS_LINK,
+    "frames": protocol.STATS_FRAMES,
+    "locks": protocol.STATS_LOCKS,
+    "queues": protocol.STATS_QUEUES,
+    "stacks": protocol.STATS_STACKS,
+    "cpu": protocol.STATS_CPU,
+}
+
+# Records that answer a query, the rest go in the event tail
+STATS_RECORDS = ("LOG_STATS_", "LOG_LINK_HEALTH", "LOG_STACK", "LOG_PROFILE")
+
+# Log lines kept under the dashboard
+EVENT_LINES = 12
+
+CLEAR = "\x1b[H\x1b[2J"
+
+
+def query_frame(groups):
+    return protocol.encode_frame(protocol.FRAME_STATS, protocol.STATS_QUERY_PAYLOAD.pack(groups))
+
+
+def split_line(line):
+    """Returns (name, text) of a decoded log line, or (None, line) for plain text."""
+    stamp_end = line.find("] ")
+    name_end = line.find(": ", stamp_end)
+    if not line.startswith("[") or stamp_end < 0 or name_end < 0:
+        return None, line
+    return line[stamp_end + 2:name_end], line[name_end + 2:]
+
+
+class Dashboard:
+    def __init__(self):
+        self.rows = {}
+        self.answer = {}
+        self.events = deque(maxlen=EVENT_LINES)
+        self.answered_at = None
+
+    def feed(self, line):
+        """Takes one decoded line, returns True once a whole answer is in."""
+        name, text = split_line(line.rstrip("\n"))
+        if name is None or not name.startswith(STATS_RECORDS):
+            if line.strip():
+                self.events.append(line.rstrip("\n"))
+            return False
+
+        if name == "LOG_STATS_END":
+            self.rows = self.answer
+            self.answer = {}
+            self.answered_at = time.strftime("%H:%M:%S")
+            return True
+
+        # Locks, stacks and CPU contexts repeat the message, one row each
+        entity = text.split(":", 1)[0] if ":" in text else ""
+        self.answer[(name, entity)] = text
+        return False
+
+    def draw(self, port):
+        out = [CLEAR, f"Tiva statistics on {port}, last answer {self.answered_at or 'none yet'}", ""]
+        out.extend(text for text in self.rows.values())
+        out.extend(["", "Recent log:"])
+        out.extend(self.events)
+        sys.stdout.write("\n".join(out) + "\n")
+        sys.stdout.flush()
+
+
+def main():
+    port = sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyACM0"
+    interval_s = float(sys.argv[2]) if len(sys.argv) > 2 else 2.0
+    groups = 0
+    for name in sys.argv[3:]:
+        groups |= GROUPS[name]
+    groups = groups or protocol.STATS_ALL
+
+    import serial
+
+    decoder = Decoder()
+    dashboard = Dashboard()
+    next_query = 0.0
+
+    with serial.Serial(port, 115200, timeout=0.1) as uart:
+        while True:
+            if time.monotonic() >= next_query:
+                uart.write(query_frame(groups))
+                next_query = time.monotonic() + interval_s
+
+            for line in decoder.feed(uart.read(uart.in_waiting or 1)):
+                if dashboard.feed(line):
+                    dashboard.draw(port)
+
+
+if __name__ == "__main__":
+    main()
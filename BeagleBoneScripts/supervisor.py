@@ -0,0 +1,202 @@
+"""Supervised feeder stages and their metrics, exported in Prometheus text format.
+
+The feeder runs as three stages on their own threads, joined by bounded queues:
+
+    fetch       OpenSky, the local receiver or synthetic traffic, into the snapshot queue
+    encode      view filter and delta encoder, one snapshot into one burst
+    serial      the UART link: credits, rate negotiation and sending bursts
+
+The snapshot queue holds one and drops the oldest, a snapshot only matters until the
+next one is in. The burst queue never drops: the delta encoder's model assumes every
+burst it made reaches the Tiva, so a full burst queue blocks the encoder instead, and the
+backpressure ends at the snapshot queue.
+
+Every stage step runs under guarded(). An exception, from requests, a None in a field
+nobody expected or anything else, is printed with its traceback and counted, the stage
+waits a moment and carries on with the next step, and the other stages never notice.
+
+Each stage counts its items, errors and drops and times its steps. Metrics.serve answers
+GET /metrics with all of it, plus queue depths and whatever gauges the feeder adds.
+Scrape it with Prometheus, or read it with curl.
+"""
+
+import queue
+import threading
+import traceback
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+# Default port for /metrics
+METRICS_PORT = 9105
+
+# Pause after a step raised, so a fault that repeats doesn't spin
+RETRY_S = 1.0
+
+# How often a blocked stage checks for stop
+STOP_POLL_S = 0.1
+
+METRIC_PREFIX = "feeder_"
+
+
+class StageMetrics:
+    """Counters and step timing for one stage."""
+
+    def __init__(self, name):
+        self.name = name
+        self.items = 0
+        self.errors = 0
+        self.dropped = 0
+        self.seconds_sum = 0.0
+        self.seconds_max = 0.0
+
+    def observe(self, seconds):
+        """One item done, in `seconds`."""
+        self.items += 1
+        self.seconds_sum += seconds
+        self.seconds_max = max(self.seconds_max, seconds)
+
+    def error(self):
+        self.errors += 1
+
+    def drop(self):
+        self.dropped += 1
+
+
+def guarded(stage, step, *args):
+    """Runs one step, counting and printing any exception instead of letting it through.
+
+    Returns what the step returned, or None if it raised.
+    """
+    try:
+        return step(*args)
+    except Exception:
+        stage.error()
+        print(f"{stage.name} stage failed, carrying on:")
+        traceback.print_exc()
+        return None
+
+
+def put_blocking(out, item, stop_event):
+    """Puts an item in a bounded queue, waiting for room, unless stop is set first."""
+    while not stop_event.is_set():
+        try:
+            out.put(item, timeout=STOP_POLL_S)
+            return True
+        except queue.Full:
+            pass
+    return False
+
+
+class Stage(threading.Thread):
+    """Calls step() until stopped. A step that raises is counted, and the next one runs RETRY_S later.
+
+    step() does its own timing, with stage.observe, since only it knows when it did work.
+    """
+
+    def __init__(self, stage, step, retry_s=RETRY_S):
+        super().__init__(name=stage.name, daemon=True)
+        self.stage = stage
+        self.step = step
+        self.retry_s = retry_s
+        self.stop_event = threading.Event()
+
+    def stop(self):
+        self.stop_event.set()
+
+    def run(self):
+        while not self.stop_event.is_set():
+            errors = self.stage.errors
+            guarded(self.stage, self.step)
+            if self.stage.errors != errors:
+                self.stop_event.wait(self.retry_s)
+
+
+class Metrics:
+    """Collects stage metrics, queue depths and gauges, and renders them for Prometheus."""
+
+    def __init__(self):
+        self.stages = []
+        self.queues = {}
+        self.gauges = []
+        self._server = None
+
+    def stage(self, name):
+        stage = StageMetrics(name)
+        self.stages.append(stage)
+        return stage
+
+    def add_stage(self, stage):
+        self.stages.append(stage)
+        return stage
+
+    def queue(self, name, watched):
+        self.queues[name] = watched
+
+    def gauge(self, name, help_text, read, kind="gauge"):
+        """A value read when scraped, None leaves it out. A counter's name ends in _total."""
+        self.gauges.append((METRIC_PREFIX + name, kind, help_text, read))
+
+    def render(self):
+        lines = []
+
+        def family(name, kind, help_text, samples):
+            """samples are (suffix, labels, value), the suffix for a summary's _sum and _count."""
+            lines.append(f"# HELP {name} {help_text}")
+            lines.append(f"# TYPE {name} {kind}")
+            for suffix, labels, value in samples:
+                lines.append(f"{name}{suffix}{{{labels}}} {value}" if labels else f"{name}{suffix} {value}")
+
+        def per_stage(read, suffix=""):
+            return [(suffix, f'stage="{stage.name}"', read(stage)) for stage in self.stages]
+
+        family(METRIC_PREFIX + "stage_items_total", "counter", "Items a stage finished.",
+               per_stage(lambda stage: stage.items))
+        family(METRIC_PREFIX + "stage_errors_total", "counter", "Steps that raised, or failed a request.",
+               per_stage(lambda stage: stage.errors))
+        family(METRIC_PREFIX + "stage_dropped_total", "counter", "Items dropped for a newer one.",
+               per_stage(lambda stage: stage.dropped))
+        family(METRIC_PREFIX + "stage_seconds", "summary", "Time a stage spent per item.",
+               per_stage(lambda stage: f"{stage.seconds_sum:.6f}", "_sum") +
+               per_stage(lambda stage: stage.items, "_count"))
+        family(METRIC_PREFIX + "stage_seconds_max", "gauge", "Longest a stage has spent on one item.",
+               per_stage(lambda stage: f"{stage.seconds_max:.6f}"))
+        family(METRIC_PREFIX + "queue_depth", "gauge", "Items waiting in a stage queue.",
+               [("", f'queue="{name}"', watched.qsize()) for name, watched in self.queues.items()])
+
+        for name, kind, help_text, read in self.gauges:
+            value = read()
+            if value is not None:
+                family(name, kind, help_text, [("", "", value)])
+        return "\n".join(lines) + "\n"
+
+    def serve(self, port=METRICS_PORT):
+        """Answers GET /metrics on a thread of its own."""
+        metrics = self
+
+        class Handler(BaseHTTPRequestHandler):
+            def do_GET(self):
+                if self.path != "/metrics":
+                    self.send_error(404)
+                    return
+                body = metrics.render().encode()
+                self.send_response(200)
+                self.send_header("Content-Type", "text/plain; version=0.0.4")
+                self.send_header("Content-Length", str(len(body)))
+                self.end_headers()
+                self.wfile.write(body)
+
+            def log_message(self, *args):
+                pass
+
+        self._server = ThreadingHTTPServer(("", port), Handler)
+        threading.Thread(target=self._server.serve_forever, name="metrics", daemon=True).start()
+
+    def close(self):
+        if self._server is not None:
+            self._server.shutdown()
+            self._server.server_close()
+
+    def summary(self):
+        return " | ".join(f"{stage.name}: {stage.items} in {stage.seconds_sum:.1f} s, "
+                          f"max {stage.seconds_max * 1000:.0f} ms, {stage.errors} errors, {stage.dropped} dropped"
+                          for stage in self.stages)
+
@@ -0,0 +1,65 @@
+"""Synthetic air traffic for stress tests, shaped like fetch_filtered_opensky_data output.
+
+Aircraft fly straight at a constant speed from random points inside the range. One that
+leaves the range is replaced by a new aircraft, with a new ICAO24 address, entering at
+the edge, so incremental bursts carry upserts and removals as well as deltas.
+"""
+
+import math
+import random
+
+CENTER_LATITUDE = 29.6465
+CENTER_LONGITUDE = -82.3533
+
+KM_PER_DEGREE = 111.32
+
+
+class SyntheticTraffic:
+    def __init__(self, count, range_km=50, seed=1, center=None):
+        self.range_km = range_km
+        self.center = center or (CENTER_LATITUDE, CENTER_LONGITUDE)
+        self._random = random.Random(seed)
+        self._next_icao24 = 0xA00000
+        self._aircraft = [self._spawn(self.range_km * math.sqrt(self._random.random()))
+                          for _ in range(count)]
+
+    def _spawn(self, distance_km):
+        bearing = self._random.uniform(0, 2 * math.pi)
+        icao24 = self._next_icao24
+        self._next_icao24 = (self._next_icao24 + 1) & 0xFFFFFF
+
+        return {
+            "icao24": icao24,
+            "callsign": f"SYN{icao24 & 0xFFFF:04X}",
+            "x_km": distance_km * math.sin(bearing),
+            "y_km": distance_km * math.cos(bearing),
+            "geo_altitude": self._random.uniform(300, 12000),
+            "velocity": self._random.uniform(60, 260),
+            "true_track": self._random.uniform(0, 360),
+        }
+
+    def step(self, seconds):
+        """Moves every aircraft on by `seconds` of flight."""
+        for index, aircraft in enumerate(self._aircraft):
+            track = math.radians(aircraft["true_track"])
+            distance_km = aircraft["velocity"] * seconds / 1000
+            aircraft["x_km"] += distance_km * math.sin(track)
+            aircraft["y_km"] += distance_km * math.cos(track)
+
+            if math.hypot(aircraft["x_km"], aircraft["y_km"]) > self.range_km:
+                self._aircraft[index] = self._spawn(self.range_km)
+
+    def aircraft_list(self):
+        """The current state in the shape the feeder's encoders take."""
+        latitude, longitude = self.center
+        cos_latitude = math.cos(math.radians(latitude))
+        return [{
+            "icao24": aircraft["icao24"],
+            "callsign": aircraft["callsign"],
+            "longitude": longitude + aircraft["x_km"] / (KM_PER_DEGREE * cos_latitude),
+            "latitude": latitude + aircraft["y_km"] / KM_PER_DEGREE,
+            "geo_altitude": aircraft["geo_altitude"],
+            "velocity": aircraft["velocity"],
+            "true_track": aircraft["true_track"],
+            "on_ground": False,
+        } for aircraft in self._aircraft]
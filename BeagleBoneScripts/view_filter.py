@@ -0,0 +1,98 @@
+"""Drops what the Tiva can't show before it is encoded, nearest aircraft first.
+
+The Tiva reports its display range, radar center and selected aircraft in a FRAME_VIEW
+frame whenever one changes, and every few seconds besides. Until the first report arrives
+nothing is dropped for range, and distances are from the built-in center. On-ground aircraft, aircraft without a position and repeated ICAO24
+addresses are always dropped.
+
+What is left is ordered by distance from the centre, with the selected aircraft ahead of
+everything, so the part of a burst that matters most lands first.
+"""
+
+import math
+
+import protocol
+from fetcher import CENTER_LATITUDE, CENTER_LONGITUDE
+
+KM_PER_DEGREE = 111.32
+
+# Aircraft this far past the edge are still sent, they can fly in before the next burst
+RANGE_MARGIN_KM = 5
+
+
+class ViewFilter:
+    def __init__(self):
+        self.range_km = None
+        self.selected_icao24 = None
+        self.quiet = False
+        self.reports = 0
+        self.dropped = 0
+        self._set_center(CENTER_LATITUDE, CENTER_LONGITUDE)
+
+    def _set_center(self, latitude, longitude):
+        self.center = (latitude, longitude)
+        self._cos_latitude = math.cos(math.radians(latitude))
+
+    def handle_report(self, payload):
+        """FRAME_VIEW handler for SerialLink."""
+        (selected_icao24, range_km, flags,
+         center_latitude, center_longitude) = protocol.VIEW_PAYLOAD.unpack_from(payload)
+        self.range_km = range_km
+        self.selected_icao24 = selected_icao24 if flags & protocol.VIEW_SELECTED else None
+        self.quiet = bool(flags & protocol.VIEW_QUIET)
+        self._set_center(center_latitude / protocol.CENTER_UNITS_PER_DEGREE,
+                         center_longitude / protocol.CENTER_UNITS_PER_DEGREE)
+        self.reports += 1
+
+    def distance_km(self, aircraft):
+        latitude, longitude = self.center
+        dx = (aircraft["longitude"] - longitude) * KM_PER_DEGREE * self._cos_latitude
+        dy = (aircraft["latitude"] - latitude) * KM_PER_DEGREE
+        return math.hypot(dx, dy)
+
+    def apply(self, aircraft_list):
+        """The aircraft worth sending, nearest first.
+
+        Called on every aircraft in a snapshot, so it compares and sorts squared distances
+        and leaves distance_km to single lookups.
+        """
+        limit_km = None if self.range_km is None else self.range_km + RANGE_MARGIN_KM
+        limit_sq = math.inf if limit_km is None else limit_km * limit_km
+        latitude, longitude = self.center
+        x_scale = KM_PER_DEGREE * self._cos_latitude
+        selected_icao24 = self.selected_icao24
+        seen = set()
+        kept = []
+
+        for aircraft in aircraft_list:
+            icao24 = aircraft["icao24"]
+            if icao24 in seen or aircraft.get("on_ground"):
+                continue
+            aircraft_longitude = aircraft["longitude"]
+            aircraft_latitude = aircraft["latitude"]
+            if aircraft_longitude is None or aircraft_latitude is None:
+                continue
+            seen.add(icao24)
+
+            dx = (aircraft_longitude - longitude) * x_scale
+            dy = (aircraft_latitude - latitude) * KM_PER_DEGREE
+            distance_sq = dx * dx + dy * dy
+            if icao24 == selected_icao24:
+                distance_sq = -1.0
+            elif distance_sq > limit_sq:
+                continue
+            kept.append((distance_sq, aircraft))
+
+        kept.sort(key=lambda entry: entry[0])
+        self.dropped = len(aircraft_list) - len(kept)
+        return [aircraft for _, aircraft in kept]
+
+    def summary(self):
+        latitude, longitude = self.center
+        view = "none yet" if self.range_km is None else f"{self.range_km} km"
+        view += f" around {latitude:.4f}, {longitude:.4f}"
+        if self.selected_icao24 is not None:
+            view += f", selected {self.selected_icao24:06X}"
+        if self.quiet:
+            view += ", quiet hours"
+        return f"view: {view}, {self.dropped} aircraft dropped"
@@ -0,0 +1,81 @@
+/***************************************************************************************
+ * @file        aircraft_filter.c
+ * @brief       Which live aircraft are drawn, and in what color, worked out per update.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./aircraft_filter.h"
+
+#include "MultimodDrivers/multimod.h"
+#include "System/ramfunc.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Hue from 20 to 200 degrees in even steps, full saturation, worked out offline
+FLASH_LUT const uint16_t AIRCRAFT_FILTER_PALETTE[AIRCRAFT_FILTER_LAYERS + 1] = {
+    0xFAA0, 0xFC40, 0xFDC0, 0xFF60, 0xDFE0, 0xAFE0, 0x77E0, 0x47E0,
+    0x17E0, 0x07E4, 0x07EA, 0x07F1, 0x07F7, 0x07FD, 0x06FF, 0x055F,
+    ST7789_BLUE
+};
+
+// Shows everything until the feeder says otherwise
+static AircraftFilter_t active;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftFilter_Init(void) {
+    active.min_altitude = INT16_MIN;
+    active.max_altitude = INT16_MAX;
+    active.min_velocity = INT16_MIN;
+    active.flags = 0;
+}
+
+/**
+ * @brief Makes a new filter the one AircraftFilter_Apply checks against.
+ *
+ * @return bool True if it differs from the last one, every slot needs applying again.
+ */
+bool AircraftFilter_Set(const AircraftFilter_t *filter) {
+    if (filter->min_altitude == active.min_altitude && filter->max_altitude == active.max_altitude &&
+        filter->min_velocity == active.min_velocity && filter->flags == active.flags)
+        return false;
+
+    active = *filter;
+    return true;
+}
+
+/**
+ * @brief Checks one slot against the filter and files it in its altitude layer.
+ *
+ * Call whenever a slot's altitude, velocity or callsign changes, or another aircraft
+ * moves into it.
+ */
+void AircraftFilter_Apply(const AircraftStore_t *aircrafts, AircraftScreen_t *screen, int16_t slot) {
+    int16_t altitude = aircrafts->altitude[slot];
+
+    bool visible = altitude >= active.min_altitude && altitude <= active.max_altitude &&
+                   aircrafts->velocity[slot] >= active.min_velocity &&
+                   !((active.flags & PROTOCOL_FILTER_HIDE_UNNAMED) && !AircraftStore_HasCallsign(aircrafts, slot));
+
+    AircraftScreen_AssignBit(screen->visible, slot, visible);
+
+    int16_t layer = (altitude > 0) ? (altitude >> AIRCRAFT_FILTER_LAYER_SHIFT) : 0;
+    if (layer >= AIRCRAFT_FILTER_LAYERS)
+        layer = AIRCRAFT_FILTER_LAYERS - 1;
+    screen->layer[slot] = (active.flags & PROTOCOL_FILTER_ALTITUDE_COLORS) ? layer : AIRCRAFT_FILTER_PLAIN;
+}
+
+/********************************Public Functions***********************************/
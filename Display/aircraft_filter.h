@@ -0,0 +1,77 @@
+/***************************************************************************************
+ * @file        aircraft_filter.h
+ * @brief       Which live aircraft are drawn, and in what color, worked out per update.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The feeder sets an altitude band, a minimum speed and whether aircraft without a
+ * callsign are hidden, see PROTOCOL_FRAME_FILTER. Each slot is checked against them when
+ * its data changes, not when a frame is drawn, and the answer kept as one bit of
+ * AircraftScreen_t.visible. Hidden aircraft are left out of the screen grid as well as the
+ * radar, so they can't be selected either.
+ *
+ * The same check files the slot in one of AIRCRAFT_FILTER_LAYERS altitude layers, or in
+ * AIRCRAFT_FILTER_PLAIN with altitude colors off, and the renderer takes its color
+ * straight from AIRCRAFT_FILTER_PALETTE.
+ *
+***************************************************************************************/
+
+#ifndef AIRCRAFT_FILTER_H_
+#define AIRCRAFT_FILTER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+#include "Radar/aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define AIRCRAFT_FILTER_LAYER_SHIFT     10      // 1024 m per altitude layer
+#define AIRCRAFT_FILTER_LAYERS          16      // the top one holds everything above 15 km
+#define AIRCRAFT_FILTER_PLAIN           AIRCRAFT_FILTER_LAYERS
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t min_altitude;       // meters
+    int16_t max_altitude;       // meters
+    int16_t min_velocity;       // 0.1 m/s
+    uint8_t flags;              // PROTOCOL_FILTER_*
+} AircraftFilter_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+// RGB565 per altitude layer, low and warm to high and cool, then the plain color
+extern const uint16_t AIRCRAFT_FILTER_PALETTE[AIRCRAFT_FILTER_LAYERS + 1];
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftFilter_Init(void);
+bool AircraftFilter_Set(const AircraftFilter_t *filter);
+
+void AircraftFilter_Apply(const AircraftStore_t *aircrafts, AircraftScreen_t *screen, int16_t slot);
+
+static inline bool AircraftFilter_IsVisible(const AircraftScreen_t *screen, int16_t slot) {
+    return AircraftScreen_TestBit(screen->visible, slot);
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* AIRCRAFT_FILTER_H_ */
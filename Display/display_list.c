@@ -0,0 +1,417 @@
+/***************************************************************************************
+ * @file        display_list.c
+ * @brief       Per-frame list of drawing commands, streamed to the panel a band at a time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Commands are painted in the order they were recorded, so later ones cover earlier
+ * ones. Sprites in a layer are painted bucket by bucket from the bottom of the screen
+ * up, and in index order within a bucket, which makes their stacking depend only on
+ * the frame and not on which region is being rendered.
+ *
+ * The diff pairs commands up by their place in the two lists, which works because an
+ * owner records the same kinds of things in the same order every frame. Copied text
+ * is padded with terminators to its full length, so two runs of the same length can be
+ * compared a character at a time.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./display_list.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+// The list being rendered, for paint_list
+static const DisplayList_t *rendering;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static DisplayCommand_t *add(DisplayList_t *list, uint8_t type, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (list->count == list->max_commands)
+        return NULL;
+
+    DisplayCommand_t *command = &list->commands[list->count++];
+    command->type = type;
+    command->box.x0 = x0;
+    command->box.y0 = y0;
+    command->box.x1 = x1;
+    command->box.y1 = y1;
+    return command;
+}
+
+static int16_t bucket_of(int16_t row) {
+    if (row < 0)
+        return 0;
+    if (row >= PANEL_HEIGHT)
+        return DISPLAY_LIST_BUCKETS - 1;
+    return row >> DISPLAY_LIST_BUCKET_SHIFT;
+}
+
+/**
+ * @brief Paints the sprites of a layer whose bucket a band can reach.
+ */
+static void paint_sprites(const StripCanvas_t *canvas, const DisplaySprites_t *sprites) {
+    int16_t first = bucket_of(canvas->box.y0 - sprites->reach);
+    int16_t last = bucket_of(canvas->box.y1 + sprites->reach);
+
+    for (uint16_t i = sprites->first[first]; i < sprites->first[last + 1]; i++) {
+        sprites->paint(canvas, sprites->order[i]);
+    }
+}
+
+static void paint_list(const StripCanvas_t *canvas) {
+    const DisplayList_t *list = rendering;
+
+    for (uint8_t i = 0; i < list->count; i++) {
+        const DisplayCommand_t *command = &list->commands[i];
+        const StripBox_t *box = &command->box;
+
+        if (!StripBox_Overlaps(box, &canvas->box))
+            continue;
+
+        switch (command->type) {
+            case DISPLAY_MASK: {
+                const StripMask_t *mask = command->arg.data;
+                StripCanvas_Mask(canvas, box->x0 + mask->radius, box->y0 + mask->radius, mask, command->color);
+                break;
+            }
+            case DISPLAY_FILL_CIRCLE:
+                StripCanvas_FillCircle(canvas, box->x0 + command->size, box->y0 + command->size,
+                                       command->size, command->color);
+                break;
+            case DISPLAY_DOTTED_LINE: {
+                int16_t x0 = command->arg.start.x;
+                int16_t y0 = command->arg.start.y;
+                int16_t x1 = (x0 == box->x0) ? box->x1 : box->x0;
+                int16_t y1 = (y0 == box->y0) ? box->y1 : box->y0;
+                StripCanvas_DottedLine(canvas, x0, y0, x1, y1, command->color, command->size);
+                break;
+            }
+            case DISPLAY_GLYPHS:
+            case DISPLAY_TEXT:
+                StripCanvas_String(canvas, box->x0, box->y0, command->arg.data, command->size,
+                                   command->color, list->background);
+                break;
+            case DISPLAY_BITMAP:
+                StripCanvas_Bitmap(canvas, box->x0, box->y0, command->arg.data, box->x1 - box->x0 + 1,
+                                   box->y1 - box->y0 + 1, command->size, command->color, list->background);
+                break;
+            case DISPLAY_PAINTER:
+                command->arg.painter(canvas);
+                break;
+            case DISPLAY_SPRITES:
+                paint_sprites(canvas, command->arg.sprites);
+                break;
+        }
+    }
+}
+
+static bool same_box(const StripBox_t *a, const StripBox_t *b) {
+    return a->x0 == b->x0 && a->y0 == b->y0 && a->x1 == b->x1 && a->y1 == b->y1;
+}
+
+static bool same_command(const DisplayCommand_t *a, const DisplayCommand_t *b) {
+    if (a->type != b->type || a->size != b->size || a->color != b->color || !same_box(&a->box, &b->box))
+        return false;
+
+    switch (a->type) {
+        case DISPLAY_FILL_CIRCLE:
+            return true;
+        case DISPLAY_DOTTED_LINE:
+            return a->arg.start.x == b->arg.start.x && a->arg.start.y == b->arg.start.y;
+        case DISPLAY_TEXT:
+            return memcmp(a->arg.data, b->arg.data, a->size) == 0;
+        case DISPLAY_PAINTER:
+            return a->arg.painter == b->arg.painter;
+        case DISPLAY_SPRITES:
+            return a->arg.sprites == b->arg.sprites;
+        default:
+            return a->arg.data == b->arg.data;
+    }
+}
+
+static StripBox_t text_box(const DisplayCommand_t *command, int16_t first, int16_t last) {
+    StripBox_t box = { command->box.x0 + first * STRIP_GLYPH_ADVANCE, command->box.y0,
+                       command->box.x0 + (last + 1) * STRIP_GLYPH_ADVANCE - 1, command->box.y1 };
+    return box;
+}
+
+/**
+ * @brief Damages the runs of characters that differ between two texts in the same place.
+ *
+ * Runs DISPLAY_LIST_RUN_JOIN unchanged characters apart are sent as one, a second
+ * address window costs more than a few columns of pixels.
+ */
+static bool damage_text(const DisplayCommand_t *a, const DisplayCommand_t *b, DisplayDamage_t damage) {
+    const char *old_text = a->arg.data;
+    const char *new_text = b->arg.data;
+    int16_t first = -1;
+    int16_t last = -1;
+
+    for (int16_t i = 0; i < b->size; i++) {
+        if (old_text[i] == new_text[i])
+            continue;
+
+        if (first >= 0 && i - last > DISPLAY_LIST_RUN_JOIN + 1) {
+            if (!damage(text_box(b, first, last)))
+                return false;
+            first = -1;
+        }
+        if (first < 0)
+            first = i;
+        last = i;
+    }
+
+    return first < 0 || damage(text_box(b, first, last));
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Gives a list its storage, owned by the caller.
+ *
+ * @param commands     Room for `max_commands` commands.
+ * @param text         Arena for DisplayList_Text, may be NULL if the list has none.
+ */
+void DisplayList_Init(DisplayList_t *list, DisplayCommand_t *commands, uint8_t max_commands,
+                      char *text, uint16_t text_size) {
+    list->commands = commands;
+    list->max_commands = max_commands;
+    list->count = 0;
+    list->background = 0;
+    list->text = text;
+    list->text_size = text_size;
+    list->text_used = 0;
+}
+
+/**
+ * @brief Empties a list for the next frame.
+ */
+void DisplayList_Clear(DisplayList_t *list, uint16_t background) {
+    list->count = 0;
+    list->text_used = 0;
+    list->background = background;
+}
+
+/**
+ * @brief Records the shapes of a StripMask_t around one center.
+ *
+ * Commands past the list's room are dropped, as with every call below.
+ */
+void DisplayList_Mask(DisplayList_t *list, int16_t cx, int16_t cy, const StripMask_t *mask, uint16_t color) {
+    int16_t r = mask->radius;
+    DisplayCommand_t *command = add(list, DISPLAY_MASK, cx - r, cy - r, cx + r, cy + r);
+    if (command == NULL)
+        return;
+
+    command->color = color;
+    command->arg.data = mask;
+}
+
+void DisplayList_FillCircle(DisplayList_t *list, int16_t cx, int16_t cy, uint8_t r, uint16_t color) {
+    DisplayCommand_t *command = add(list, DISPLAY_FILL_CIRCLE, cx - r, cy - r, cx + r, cy + r);
+    if (command == NULL)
+        return;
+
+    command->size = r;
+    command->color = color;
+}
+
+/**
+ * @brief Records a line with `gap` pixels left out between dots, dotted from (x0, y0).
+ */
+void DisplayList_DottedLine(DisplayList_t *list, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color, uint8_t gap) {
+    DisplayCommand_t *command = add(list, DISPLAY_DOTTED_LINE, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+                                    (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+    if (command == NULL)
+        return;
+
+    command->size = gap;
+    command->color = color;
+    command->arg.start.x = x0;
+    command->arg.start.y = y0;
+}
+
+/**
+ * @brief Records up to `length` characters of text, on the list's background.
+ *
+ * @param y Bottom row of the text.
+ */
+void DisplayList_Glyphs(DisplayList_t *list, int16_t x, int16_t y, const char *text, uint8_t length, uint16_t color) {
+    DisplayCommand_t *command = add(list, DISPLAY_GLYPHS, x, y, x + length * STRIP_GLYPH_ADVANCE - 1,
+                                    y + STRIP_GLYPH_ROWS - 1);
+    if (command == NULL)
+        return;
+
+    command->size = length;
+    command->color = color;
+    command->arg.data = text;
+}
+
+/**
+ * @brief Records up to `length` characters of text, copied into the list's arena.
+ *
+ * For text that is rewritten in place between frames. The copy is what DisplayList_Diff
+ * compares, character by character.
+ *
+ * @param y Bottom row of the text.
+ */
+void DisplayList_Text(DisplayList_t *list, int16_t x, int16_t y, const char *text, uint8_t length, uint16_t color) {
+    if (list->text_used + length > list->text_size)
+        return;
+
+    DisplayCommand_t *command = add(list, DISPLAY_TEXT, x, y, x + length * STRIP_GLYPH_ADVANCE - 1,
+                                    y + STRIP_GLYPH_ROWS - 1);
+    if (command == NULL)
+        return;
+
+    char *copy = &list->text[list->text_used];
+    list->text_used += length;
+
+    uint8_t i = 0;
+    for (; i < length && text[i] != '\0'; i++) {
+        copy[i] = text[i];
+    }
+    memset(&copy[i], '\0', length - i);
+
+    command->size = length;
+    command->color = color;
+    command->arg.data = copy;
+}
+
+/**
+ * @brief Records a 1 bpp bitmap, set bits in `color` and clear ones in the background.
+ *
+ * @param y    Bottom row of the bitmap.
+ * @param rows Bitmap rows, top row first, most significant bit leftmost.
+ */
+void DisplayList_Bitmap(DisplayList_t *list, int16_t x, int16_t y, const uint8_t *rows,
+                        int16_t width, int16_t height, uint8_t stride, uint16_t color) {
+    DisplayCommand_t *command = add(list, DISPLAY_BITMAP, x, y, x + width - 1, y + height - 1);
+    if (command == NULL)
+        return;
+
+    command->size = stride;
+    command->color = color;
+    command->arg.data = rows;
+}
+
+/**
+ * @brief Records a painter for anything drawn straight onto the canvas, within `box`.
+ */
+void DisplayList_Painter(DisplayList_t *list, const StripBox_t *box, StripPainter_t painter) {
+    DisplayCommand_t *command = add(list, DISPLAY_PAINTER, box->x0, box->y0, box->x1, box->y1);
+    if (command == NULL)
+        return;
+
+    command->arg.painter = painter;
+}
+
+/**
+ * @brief Files sprites 0 to `count` - 1 by row and records the layer.
+ *
+ * A counting sort, two calls to the row function per sprite. Sprites off the top or
+ * bottom of the panel are filed in the nearest bucket, ones at DISPLAY_NO_SPRITE not
+ * at all.
+ */
+void DisplayList_Sprites(DisplayList_t *list, DisplaySprites_t *sprites, int16_t count) {
+    uint16_t next[DISPLAY_LIST_BUCKETS];
+
+    for (int16_t b = 0; b <= DISPLAY_LIST_BUCKETS; b++) {
+        sprites->first[b] = 0;
+    }
+
+    for (int16_t i = 0; i < count; i++) {
+        int16_t row = sprites->row(i);
+        if (row != DISPLAY_NO_SPRITE)
+            sprites->first[bucket_of(row) + 1]++;
+    }
+
+    for (int16_t b = 0; b < DISPLAY_LIST_BUCKETS; b++) {
+        sprites->first[b + 1] += sprites->first[b];
+        next[b] = sprites->first[b];
+    }
+
+    for (int16_t i = 0; i < count; i++) {
+        int16_t row = sprites->row(i);
+        if (row != DISPLAY_NO_SPRITE)
+            sprites->order[next[bucket_of(row)]++] = i;
+    }
+
+    DisplayCommand_t *command = add(list, DISPLAY_SPRITES, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1);
+    if (command == NULL)
+        return;
+
+    command->arg.sprites = sprites;
+}
+
+/**
+ * @brief Reports what has to be repainted to turn the previous frame into the current one.
+ *
+ * Commands that appeared or went damage their box, ones that differ damage both their
+ * old and new box, and copied text in the same place only the characters that changed.
+ * The damage is rendered from `current`.
+ *
+ * @param previous The list the panel shows now.
+ * @param current  The list of the next frame.
+ * @return bool False as soon as `damage` can't take any more, the caller repaints everything.
+ */
+bool DisplayList_Diff(const DisplayList_t *previous, const DisplayList_t *current, DisplayDamage_t damage) {
+    uint8_t count = (previous->count > current->count) ? previous->count : current->count;
+
+    if (previous->background != current->background)
+        return false;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const DisplayCommand_t *a = (i < previous->count) ? &previous->commands[i] : NULL;
+        const DisplayCommand_t *b = (i < current->count) ? &current->commands[i] : NULL;
+
+        if (a != NULL && b != NULL) {
+            if (same_command(a, b))
+                continue;
+
+            if (a->type == DISPLAY_TEXT && b->type == DISPLAY_TEXT && a->size == b->size &&
+                a->color == b->color && same_box(&a->box, &b->box)) {
+                if (!damage_text(a, b, damage))
+                    return false;
+                continue;
+            }
+        }
+
+        if (a != NULL && !damage(a->box))
+            return false;
+        if (b != NULL && !damage(b->box))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Streams a region of the frame to the panel, built band by band from the list.
+ *
+ * Must be called with `sem_SPIA` held.
+ */
+void DisplayList_Render(const DisplayList_t *list, const StripBox_t *region) {
+    rendering = list;
+    StripRenderer_Render(region, list->background, paint_list);
+}
+
+/********************************Public Functions***********************************/
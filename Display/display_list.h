@@ -0,0 +1,150 @@
+/***************************************************************************************
+ * @file        display_list.h
+ * @brief       Per-frame list of drawing commands, streamed to the panel a band at a time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A frame is recorded as a short list of commands (ring masks, filled circles, dotted
+ * lines, glyph runs, bitmaps) and then rendered into any region of the screen through
+ * the strip renderer. Each band of rows is produced on the fly from the list and sent,
+ * so no pixel of the frame is ever stored beyond the band being built. What a larger
+ * panel costs is bus time, not RAM.
+ *
+ * Commands are 16 bytes and hold their own bounding box, so a band skips every command
+ * it doesn't touch without looking further. Masks, bitmaps and DisplayList_Glyphs text
+ * are referenced, not copied, and must stay put until the list has been rendered.
+ * Text that changes from frame to frame is copied into the list's own arena with
+ * DisplayList_Text. The owner provides the command and text storage, sized for what
+ * it draws.
+ *
+ * Owners keep the previous frame's list next to the one being recorded, and
+ * DisplayList_Diff works out what changed between them: the boxes of commands that
+ * appeared, went or differ, and for copied text only the runs of characters that
+ * differ. Rendering just those boxes from the new list erases what went and draws what
+ * came in one pass, so the cost of a frame follows how much of the picture changed.
+ *
+ * Aircraft would need hundreds of commands, so they are not recorded one by one. A
+ * sprite layer instead files the owner's sprites into buckets of 16 rows, with a
+ * counting sort over the frame, and each band only paints the sprites in the buckets
+ * it can reach. The owner keeps the sprite data and paints a sprite when asked. The
+ * diff only sees the layer itself, and painters the same way, so their owners report
+ * what changed inside them.
+ *
+***************************************************************************************/
+
+#ifndef DISPLAY_LIST_H_
+#define DISPLAY_LIST_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+#include "./strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DISPLAY_LIST_RUN_JOIN       1    // unchanged characters a damaged run of text may span
+
+#define DISPLAY_LIST_BUCKET_SHIFT   4    // 16 rows a sprite bucket
+#define DISPLAY_LIST_BUCKETS        ((PANEL_HEIGHT + (1 << DISPLAY_LIST_BUCKET_SHIFT) - 1) >> DISPLAY_LIST_BUCKET_SHIFT)
+
+#define DISPLAY_NO_SPRITE           INT16_MIN   // row of a sprite that draws nothing
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    DISPLAY_MASK,
+    DISPLAY_FILL_CIRCLE,
+    DISPLAY_DOTTED_LINE,
+    DISPLAY_GLYPHS,
+    DISPLAY_TEXT,
+    DISPLAY_BITMAP,
+    DISPLAY_PAINTER,
+    DISPLAY_SPRITES
+} DisplayCommandType_t;
+
+// Records a damaged box, false once the caller can't take any more
+typedef bool (*DisplayDamage_t)(StripBox_t box);
+
+// A sprite's index in its layer's order, a byte while every aircraft slot fits in one
+#if MAX_AIRCRAFTS <= 256
+typedef uint8_t DisplaySlot_t;
+#else
+typedef uint16_t DisplaySlot_t;
+#endif
+
+// Row a sprite is filed under, or DISPLAY_NO_SPRITE
+typedef int16_t (*DisplaySpriteRow_t)(int16_t index);
+typedef void (*DisplaySpritePainter_t)(const StripCanvas_t *canvas, int16_t index);
+
+typedef struct {
+    DisplaySpriteRow_t row;
+    DisplaySpritePainter_t paint;
+    int16_t reach;                              // rows a sprite extends from its row, either way
+    DisplaySlot_t *order;                       // a slot per sprite, filled by DisplayList_Sprites
+    uint16_t first[DISPLAY_LIST_BUCKETS + 1];   // where each bucket starts in `order`
+} DisplaySprites_t;
+
+typedef struct {
+    StripBox_t box;     // everything the command can touch
+    uint8_t type;
+    uint8_t size;       // radius, dot gap, glyph count or bitmap stride
+    uint16_t color;
+    union {
+        struct {
+            int16_t x;
+            int16_t y;
+        } start;                    // where a dotted line begins, it ends at the opposite corner
+        const void *data;           // mask, text or bitmap rows, copied text is in the arena
+        StripPainter_t painter;
+        DisplaySprites_t *sprites;
+    } arg;
+} DisplayCommand_t;
+
+typedef struct {
+    DisplayCommand_t *commands;
+    uint8_t max_commands;
+    uint8_t count;
+    uint16_t background;    // under everything, and behind glyphs and bitmaps
+    char *text;             // arena for DisplayList_Text
+    uint16_t text_size;
+    uint16_t text_used;
+} DisplayList_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void DisplayList_Init(DisplayList_t *list, DisplayCommand_t *commands, uint8_t max_commands,
+                      char *text, uint16_t text_size);
+void DisplayList_Clear(DisplayList_t *list, uint16_t background);
+
+void DisplayList_Mask(DisplayList_t *list, int16_t cx, int16_t cy, const StripMask_t *mask, uint16_t color);
+void DisplayList_FillCircle(DisplayList_t *list, int16_t cx, int16_t cy, uint8_t r, uint16_t color);
+void DisplayList_DottedLine(DisplayList_t *list, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color, uint8_t gap);
+void DisplayList_Glyphs(DisplayList_t *list, int16_t x, int16_t y, const char *text, uint8_t length, uint16_t color);
+void DisplayList_Text(DisplayList_t *list, int16_t x, int16_t y, const char *text, uint8_t length, uint16_t color);
+void DisplayList_Bitmap(DisplayList_t *list, int16_t x, int16_t y, const uint8_t *rows,
+                        int16_t width, int16_t height, uint8_t stride, uint16_t color);
+void DisplayList_Painter(DisplayList_t *list, const StripBox_t *box, StripPainter_t painter);
+void DisplayList_Sprites(DisplayList_t *list, DisplaySprites_t *sprites, int16_t count);
+
+bool DisplayList_Diff(const DisplayList_t *previous, const DisplayList_t *current, DisplayDamage_t damage);
+void DisplayList_Render(const DisplayList_t *list, const StripBox_t *region);
+
+/********************************Public Functions***********************************/
+
+#endif /* DISPLAY_LIST_H_ */
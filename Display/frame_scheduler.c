@@ -0,0 +1,306 @@
+/***************************************************************************************
+ * @file        frame_scheduler.c
+ * @brief       Coalesces redraw requests into frames at a capped rate.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The display thread only ever blocks on the event group, without a timeout. The two
+ * deadlines, the held-back motion frame and the next power step, are soft timers that
+ * set a flag in the same group, so an idle display costs no wake-ups at all.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./frame_scheduler.h"
+
+#include "G8RTOS/G8RTOS.h"
+#include "System/clock.h"
+#include "System/event_group.h"
+#include "System/soft_timer.h"
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Flags besides the parts, never returned
+#define FRAME_WAKE          0x10    // input came in, set by FrameScheduler_Activity
+#define FRAME_MOTION_DUE    0x20    // a held-back motion frame is due
+#define FRAME_POWER_DUE     0x40    // quiet long enough for the next power step
+
+#define FRAME_PARTS         (FRAME_ALL | FRAME_MOTION)
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+// One flag per dirty part, however many times it was requested
+static EventGroup_t pending_parts;
+static uint32_t first_request_ms = 0;
+
+static uint32_t frame_start_ms = 0;
+static uint32_t frame_start_us = 0;
+static uint32_t frame_request_ms = 0;
+static bool frame_motion_only = false;
+
+// Frames taken by FrameScheduler_WaitFrame, and the last one finished
+static volatile uint32_t frames_started = 0;
+static volatile uint32_t frames_done = 0;
+
+static volatile uint32_t last_activity_ms = 0;
+static volatile bool had_input = false;
+static PanelPower_t power = PANEL_POWER_ON;
+
+static SoftTimer_t motionTimer;
+static SoftTimer_t powerTimer;
+
+static FrameSchedulerStats_t stats;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Arms the power timer for the step after `from`, if there is one.
+ *
+ * A DISPLAY_DIM_MS or DISPLAY_SLEEP_MS of 0 skips that step.
+ */
+static void arm_power_step(PanelPower_t from) {
+    uint32_t delay_ms = 0;
+
+    if (from == PANEL_POWER_ON)
+        delay_ms = DISPLAY_DIM_MS ? DISPLAY_DIM_MS : DISPLAY_SLEEP_MS;
+    else if (from == PANEL_POWER_DIM && DISPLAY_SLEEP_MS > DISPLAY_DIM_MS)
+        delay_ms = DISPLAY_SLEEP_MS - DISPLAY_DIM_MS;
+
+    if (delay_ms)
+        SoftTimer_Start(&powerTimer, delay_ms, 0);
+}
+
+/**
+ * @brief Takes the next power step down, dimming first if DISPLAY_DIM_MS asks for it.
+ */
+static void step_down(void) {
+    if (power == PANEL_POWER_ON && DISPLAY_DIM_MS && (DISPLAY_SLEEP_MS == 0 || DISPLAY_SLEEP_MS > DISPLAY_DIM_MS)) {
+        power = PANEL_POWER_DIM;
+    } else {
+        power = PANEL_POWER_SLEEP;
+        stats.sleeps++;
+    }
+    arm_power_step(power);
+}
+
+/**
+ * @brief True if only motion is pending and it can't be drawn yet, arming its timer if so.
+ */
+static bool hold_motion(uint32_t pending) {
+    uint32_t now = Clock_Millis();
+    uint32_t since = now - frame_start_ms;
+
+    if (pending & (FRAME_ALL | FRAME_MOTION_DUE))
+        return false;
+    if (now - last_activity_ms < FRAME_ACTIVE_MS || since >= FRAME_MOTION_INTERVAL_MS)
+        return false;
+
+    if (!SoftTimer_IsArmed(&motionTimer))
+        SoftTimer_Start(&motionTimer, FRAME_MOTION_INTERVAL_MS - since, 0);
+    return true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up the scheduler with every part dirty, so the first frame draws it all.
+ *
+ * Must be called after SoftTimer_Init and before the scheduler is launched.
+ */
+void FrameScheduler_Init(void) {
+    EventGroup_Init(&pending_parts);
+    EventGroup_Set(&pending_parts, FRAME_ALL);
+    first_request_ms = Clock_Millis();
+    frame_start_ms = first_request_ms - FRAME_INTERVAL_MS;
+    last_activity_ms = first_request_ms;
+
+    SoftTimer_Create(&motionTimer, NULL, &pending_parts, FRAME_MOTION_DUE);
+    SoftTimer_Create(&powerTimer, NULL, &pending_parts, FRAME_POWER_DUE);
+    arm_power_step(PANEL_POWER_ON);
+}
+
+/**
+ * @brief Marks parts of the screen as needing a redraw.
+ *
+ * Cheap enough to call on every change, and safe to call with the aircraft tables locked.
+ *
+ * @param parts FRAME_* bits.
+ */
+void FrameScheduler_Request(uint32_t parts) {
+    // Masked so the frame can't be taken between the flags and their timestamp
+    bool masked = IntMasterDisable();
+
+    uint32_t previous = EventGroup_Set(&pending_parts, parts);
+    stats.requests++;
+    // Motion is timed from nothing, it is held back on purpose
+    if ((parts & FRAME_ALL) && (previous & FRAME_ALL) == 0)
+        first_request_ms = Clock_Millis();
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Marks user input: full frame rate for FRAME_ACTIVE_MS, and the panel wakes.
+ *
+ * The joystick, buttons and zoom call this along with their own requests.
+ */
+void FrameScheduler_Activity(void) {
+    last_activity_ms = Clock_Millis();
+    had_input = true;
+    arm_power_step(PANEL_POWER_ON);
+    EventGroup_Clear(&pending_parts, FRAME_POWER_DUE);
+    EventGroup_Set(&pending_parts, FRAME_WAKE);
+}
+
+/**
+ * @brief Milliseconds since the last FrameScheduler_Activity, UINT32_MAX if there was none.
+ */
+uint32_t FrameScheduler_InputIdleMs(void) {
+    return had_input ? Clock_Millis() - last_activity_ms : UINT32_MAX;
+}
+
+/**
+ * @brief Blocks until a frame is due and returns the parts it has to draw.
+ *
+ * Requests that come in while waiting out the frame interval join this frame. When the
+ * panel has to change power state FRAME_POWER is returned, along with the parts to draw
+ * if it is waking. Asleep, only input ends the wait.
+ */
+uint32_t FrameScheduler_WaitFrame(void) {
+    uint32_t power_change = 0;
+    bool motion_held = false;
+
+    while (1) {
+        uint32_t waited = FRAME_WAKE;
+        if (power != PANEL_POWER_SLEEP)
+            waited |= FRAME_ALL | FRAME_POWER_DUE | (motion_held ? FRAME_MOTION_DUE : FRAME_MOTION);
+
+        uint32_t present = EventGroup_Wait(&pending_parts, waited, EVENT_GROUP_ANY, EVENT_GROUP_FOREVER);
+
+        if (present & FRAME_WAKE) {
+            EventGroup_Clear(&pending_parts, FRAME_WAKE);
+
+            // Everything is drawn again on waking, however long the requests waited
+            if (power != PANEL_POWER_ON) {
+                if (power == PANEL_POWER_SLEEP)
+                    FrameScheduler_Request(FRAME_ALL);
+                first_request_ms = Clock_Millis();
+                power = PANEL_POWER_ON;
+                power_change = FRAME_POWER;
+            }
+        } else if (present & FRAME_POWER_DUE) {
+            EventGroup_Clear(&pending_parts, FRAME_POWER_DUE);
+            step_down();
+            return FRAME_POWER;
+        }
+
+        // Motion alone goes at the slower rate, unless the user is at the controls
+        uint32_t pending = EventGroup_Get(&pending_parts);
+        if ((pending & FRAME_PARTS) && !hold_motion(pending))
+            break;
+        motion_held = (pending & FRAME_MOTION) != 0;
+
+        if (power_change)
+            return power_change;
+    }
+
+    SoftTimer_Stop(&motionTimer);
+
+    uint32_t since = Clock_Millis() - frame_start_ms;
+    if (since < FRAME_INTERVAL_MS)
+        sleep(FRAME_INTERVAL_MS - since);
+
+    bool masked = IntMasterDisable();
+
+    uint32_t parts = EventGroup_Clear(&pending_parts, FRAME_PARTS | FRAME_MOTION_DUE) & FRAME_PARTS;
+    frame_request_ms = first_request_ms;
+    frames_started++;
+
+    if (!masked)
+        IntMasterEnable();
+
+    frame_motion_only = !(parts & FRAME_ALL);
+    if (frame_motion_only)
+        stats.motion_frames++;
+
+    frame_start_ms = Clock_Millis();
+    frame_start_us = Clock_Micros();
+    return parts | power_change;
+}
+
+/**
+ * @brief Ends the frame started by FrameScheduler_WaitFrame and checks its deadline.
+ *
+ * Motion frames are held back on purpose, only frames with something else in them are
+ * held to FRAME_LATENCY_MS.
+ */
+void FrameScheduler_FrameDone(void) {
+    uint32_t latency = Clock_Millis() - frame_request_ms;
+    uint32_t draw = Clock_Micros() - frame_start_us;
+
+    frames_done = frames_started;
+    stats.frames++;
+    stats.draw_us += draw;
+    if (draw > stats.worst_draw_us)
+        stats.worst_draw_us = draw;
+    if (frame_motion_only)
+        return;
+    if (latency > FRAME_LATENCY_MS)
+        stats.missed++;
+    if (latency > stats.worst_latency_ms)
+        stats.worst_latency_ms = latency;
+}
+
+/**
+ * @brief Waits until everything requested so far is on the panel.
+ *
+ * Call it from a thread other than the display's. It checks every FRAME_INTERVAL_MS, and
+ * returns straight away with the panel asleep, nothing is drawn then.
+ */
+void FrameScheduler_Flush(void) {
+    bool masked = IntMasterDisable();
+
+    // Pending parts go in the next frame, otherwise the one being drawn is the last
+    uint32_t target = frames_started;
+    if (EventGroup_Get(&pending_parts) & FRAME_PARTS)
+        target++;
+
+    if (!masked)
+        IntMasterEnable();
+
+    while (power != PANEL_POWER_SLEEP && (int32_t)(frames_done - target) < 0)
+        sleep(FRAME_INTERVAL_MS);
+}
+
+/**
+ * @brief What the panel should be set to, for the display thread to apply on FRAME_POWER.
+ */
+PanelPower_t FrameScheduler_GetPower(void) {
+    return power;
+}
+
+/**
+ * @brief Copies out the frame counters, for checking the latency target over the UART.
+ */
+void FrameScheduler_GetStats(FrameSchedulerStats_t *copy) {
+    *copy = stats;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,109 @@
+/***************************************************************************************
+ * @file        frame_scheduler.h
+ * @brief       Coalesces redraw requests into frames at a capped rate.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Anything that changes what is on screen marks the affected parts dirty with
+ * FrameScheduler_Request. Requests only set bits, so any number of them between two
+ * frames cost one render. The display thread is woken on the first request of a frame,
+ * waits out whatever is left of FRAME_INTERVAL_MS since the previous frame, and then
+ * draws every part that was marked.
+ *
+ * The time from the first request to the end of its frame is checked against
+ * FRAME_LATENCY_MS, the input-to-photon target, and frames that miss it are counted.
+ *
+ * The rate also depends on what changed:
+ *
+ *      input       FrameScheduler_Activity, from the joystick, buttons and zoom, keeps
+ *                  every frame at FRAME_INTERVAL_MS for FRAME_ACTIVE_MS
+ *      data        FRAME_RADAR and FRAME_INFO, a burst, selection or setting, are drawn
+ *                  at FRAME_INTERVAL_MS
+ *      motion      FRAME_MOTION, dead reckoning moved an aircraft by a pixel, waits for
+ *                  FRAME_MOTION_INTERVAL_MS unless input or data joins it
+ *      nothing     no frame at all, the display thread stays blocked
+ *
+ * With no input for DISPLAY_DIM_MS the panel is dimmed, and after DISPLAY_SLEEP_MS it is
+ * blanked and put to sleep. The display thread is told with FRAME_POWER and switches the
+ * panel with FrameScheduler_GetPower. Nothing is drawn while the panel sleeps, requests
+ * just collect, and the next input wakes it and draws the whole screen.
+ *
+***************************************************************************************/
+
+#ifndef FRAME_SCHEDULER_H_
+#define FRAME_SCHEDULER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./panel.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define FRAME_INTERVAL_MS   50      // shortest time between frames, caps the rate at 20 Hz
+#define FRAME_LATENCY_MS    100     // target from a request to its pixels being on screen
+
+#define FRAME_MOTION_INTERVAL_MS    250     // dead reckoning alone redraws at 4 Hz
+#define FRAME_ACTIVE_MS             3000    // full rate for this long after any input
+
+// Inactivity before the panel is dimmed and then put to sleep, 0 never does
+#ifndef DISPLAY_DIM_MS
+#define DISPLAY_DIM_MS      120000
+#endif
+#ifndef DISPLAY_SLEEP_MS
+#define DISPLAY_SLEEP_MS    600000
+#endif
+
+// Parts of the screen that can be marked dirty
+#define FRAME_RADAR         0x01
+#define FRAME_INFO          0x02
+#define FRAME_ALL           (FRAME_RADAR | FRAME_INFO)
+#define FRAME_MOTION        0x04    // the radar, for dead reckoning only
+#define FRAME_POWER         0x08    // returned by FrameScheduler_WaitFrame, never requested
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t frames;            // frames drawn
+    uint32_t requests;          // requests made, most are folded into a pending frame
+    uint32_t missed;            // frames that finished later than FRAME_LATENCY_MS
+    uint32_t worst_latency_ms;  // longest request to end of frame
+    uint32_t worst_draw_us;     // longest frame from the wake-up to FrameScheduler_FrameDone
+    uint64_t draw_us;           // all frames together, for the average
+    uint32_t motion_frames;     // frames drawn for dead reckoning alone
+    uint32_t sleeps;            // times the panel was put to sleep
+} FrameSchedulerStats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void FrameScheduler_Init(void);
+
+void FrameScheduler_Request(uint32_t parts);
+void FrameScheduler_Activity(void);
+uint32_t FrameScheduler_InputIdleMs(void);
+
+uint32_t FrameScheduler_WaitFrame(void);
+void FrameScheduler_FrameDone(void);
+void FrameScheduler_Flush(void);
+
+PanelPower_t FrameScheduler_GetPower(void);
+
+void FrameScheduler_GetStats(FrameSchedulerStats_t *stats);
+
+/********************************Public Functions***********************************/
+
+#endif /* FRAME_SCHEDULER_H_ */
@@ -0,0 +1,316 @@
+/***************************************************************************************
+ * @file        ili9488.c
+ * @brief       320x480 ILI9488 panel, streamed over the display SPI bus.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Commands go out through the Multimod driver's bus helpers, which drive the shared chip
+ * select and D/C line, so only the command set differs from the ST7789: the address
+ * window is the same MIPI DCS CASET/RASET/RAMWR, with rows counted from the top.
+ *
+ * As with the ST7789, the first pixel is written on the CPU so the driver leaves D/C in
+ * data mode, and the rest goes over uDMA in 8-bit items. A fill widens its color into
+ * one buffer once and sends it again and again, a blit widens each chunk while the one
+ * before it is being sent. The SSI interrupt signals the end of every chunk.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./ili9488.h"
+#include "./panel.h"
+#include "System/dma_table.h"
+
+#include <stddef.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "MultimodDrivers/multimod.h"
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ssi.h"
+#include "driverlib/ssi.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+/************************************Includes***************************************/
+
+// CCS builds every source in the project, this one only matters on the ILI9488
+#if DISPLAY_PANEL == DISPLAY_PANEL_ILI9488
+
+/*************************************Defines***************************************/
+
+#define ILI9488_SSI_BASE        SSI3_BASE           // display SPI bus on the Multimod board
+#define ILI9488_DMA_CHANNEL     UDMA_CH15_SSI3TX
+
+#define ILI9488_SWRESET         0x01
+#define ILI9488_SLPIN           0x10
+#define ILI9488_SLPOUT          0x11
+#define ILI9488_DISPOFF         0x28
+#define ILI9488_DISPON          0x29
+#define ILI9488_WRDISBV         0x51
+#define ILI9488_WRCTRLD         0x53
+#define ILI9488_CTRLD_ON        0x24     // brightness control and backlight on
+#define ILI9488_CASET           0x2A
+#define ILI9488_RASET           0x2B
+#define ILI9488_RAMWR           0x2C
+#define ILI9488_MADCTL          0x36
+#define ILI9488_COLMOD          0x3A
+
+#define ILI9488_MADCTL_PORTRAIT 0x48     // columns mirrored to match the connector, BGR order
+#define ILI9488_COLMOD_18BIT    0x66     // the only depth the SPI interface takes
+#define ILI9488_WAKE_MS         120      // after a reset or leaving sleep
+
+#define BYTES_PER_PIXEL         3
+#define CHUNK_BYTES             (ILI9488_CHUNK_PIXELS * BYTES_PER_PIXEL)
+
+#if CHUNK_BYTES > 1024
+#error "A chunk must fit one basic-mode uDMA transfer"
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static semaphore_t sem_chunk_done;
+static volatile bool dma_active = false;
+
+// One is widened while the other is sent
+static uint8_t chunks[2][CHUNK_BYTES];
+
+static PanelPower_t panel_power = PANEL_POWER_ON;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void delay_ms(uint32_t ms) {
+    SysCtlDelay(SysCtlClockGet() / 3000 * ms);
+}
+
+static void command(uint8_t code, const uint8_t *data, uint8_t length) {
+    ST7789_WriteCommand(code);
+    for (uint8_t i = 0; i < length; i++) {
+        ST7789_WriteData(data[i]);
+    }
+}
+
+/**
+ * @brief Points RAMWR at a window, given with y from the bottom row.
+ */
+static void set_window(int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x1 = x + w - 1;
+    int16_t top = PANEL_HEIGHT - (y + h);
+    int16_t bottom = PANEL_HEIGHT - 1 - y;
+
+    const uint8_t columns[4] = { x >> 8, x & 0xFF, x1 >> 8, x1 & 0xFF };
+    const uint8_t rows[4] = { top >> 8, top & 0xFF, bottom >> 8, bottom & 0xFF };
+
+    command(ILI9488_CASET, columns, sizeof(columns));
+    command(ILI9488_RASET, rows, sizeof(rows));
+    command(ILI9488_RAMWR, NULL, 0);
+}
+
+/**
+ * @brief Widens RGB565 to the panel's 6 bits a channel, each in the top of a byte.
+ *
+ * @param increment False to repeat the first pixel `count` times.
+ */
+static void widen(uint8_t *out, const uint16_t *pixels, uint16_t count, bool increment) {
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t color = increment ? pixels[i] : pixels[0];
+        *out++ = (color >> 8) & 0xF8;
+        *out++ = (color >> 3) & 0xFC;
+        *out++ = color << 3;
+    }
+}
+
+static void send_chunk(const uint8_t *bytes, uint16_t count) {
+    uDMAChannelControlSet(ILI9488_DMA_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+    uDMAChannelTransferSet(ILI9488_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)bytes, (void *)(ILI9488_SSI_BASE + SSI_O_DR), count);
+
+    dma_active = true;
+    uDMAChannelEnable(ILI9488_DMA_CHANNEL);
+}
+
+/**
+ * @brief Streams `w` x `h` pixels into a window and sleeps until they are on the wire.
+ */
+static void stream(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels, bool increment) {
+    uint32_t count = (uint32_t)w * h;
+    uint32_t sent = 0;
+    uint8_t which = 0;
+    bool pending = false;
+
+    // A fill sends the same chunk every time
+    if (!increment)
+        widen(chunks[0], pixels, ILI9488_CHUNK_PIXELS, false);
+
+    ST7789_Select();
+    set_window(x, y, w, h);
+    SSIDMAEnable(ILI9488_SSI_BASE, SSI_DMA_TX);
+
+    while (sent < count) {
+        uint16_t n = (count - sent > ILI9488_CHUNK_PIXELS) ? ILI9488_CHUNK_PIXELS : (count - sent);
+        const uint8_t *bytes = chunks[0];
+
+        // Widened while the previous chunk is still going out
+        if (increment) {
+            bytes = chunks[which];
+            widen(chunks[which], &pixels[sent], n, true);
+            which ^= 1;
+        }
+
+        if (pending)
+            G8RTOS_WaitSemaphore(&sem_chunk_done);
+
+        uint16_t skip = 0;
+        if (sent == 0) {
+            // First pixel on the CPU, it leaves D/C selecting data
+            for (skip = 0; skip < BYTES_PER_PIXEL; skip++) {
+                ST7789_WriteData(bytes[skip]);
+            }
+        }
+
+        pending = (n * BYTES_PER_PIXEL > skip);
+        if (pending)
+            send_chunk(&bytes[skip], n * BYTES_PER_PIXEL - skip);
+        sent += n;
+    }
+
+    if (pending)
+        G8RTOS_WaitSemaphore(&sem_chunk_done);
+
+    SSIDMADisable(ILI9488_SSI_BASE, SSI_DMA_TX);
+    while (SSIBusy(ILI9488_SSI_BASE));
+    ST7789_Deselect();
+}
+
+static bool clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h) {
+    if (*x < 0) { *w += *x; *x = 0; }
+    if (*y < 0) { *h += *y; *y = 0; }
+    if (*x + *w > PANEL_WIDTH) *w = PANEL_WIDTH - *x;
+    if (*y + *h > PANEL_HEIGHT) *h = PANEL_HEIGHT - *y;
+
+    return *w > 0 && *h > 0;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Brings the panel out of reset in 18-bit color and sets up its TX uDMA channel.
+ *
+ * Must be called after multimod_init() has configured the display bus and after
+ * G8RTOS_Init(). Busy-waits about a quarter of a second for the panel to wake.
+ */
+void Ili9488_Init(void) {
+    const uint8_t colmod = ILI9488_COLMOD_18BIT;
+    const uint8_t madctl = ILI9488_MADCTL_PORTRAIT;
+
+    G8RTOS_InitSemaphore(&sem_chunk_done, 0);
+
+    ST7789_Select();
+    command(ILI9488_SWRESET, NULL, 0);
+    delay_ms(ILI9488_WAKE_MS);
+    command(ILI9488_SLPOUT, NULL, 0);
+    delay_ms(ILI9488_WAKE_MS);
+    command(ILI9488_COLMOD, &colmod, 1);
+    command(ILI9488_MADCTL, &madctl, 1);
+    command(ILI9488_DISPON, NULL, 0);
+    while (SSIBusy(ILI9488_SSI_BASE));
+    ST7789_Deselect();
+
+    DMA_Init();
+
+    uDMAChannelAssign(ILI9488_DMA_CHANNEL);
+    uDMAChannelAttributeDisable(ILI9488_DMA_CHANNEL, UDMA_ATTR_ALTSELECT |
+                                                     UDMA_ATTR_HIGH_PRIORITY |
+                                                     UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(ILI9488_DMA_CHANNEL, UDMA_ATTR_USEBURST);
+}
+
+/**
+ * @brief Services the display SSI interrupt, waking the drawing thread after each chunk.
+ */
+void Ili9488_HandleInterrupt(void) {
+    uint32_t status = SSIIntStatus(ILI9488_SSI_BASE, true);
+    SSIIntClear(ILI9488_SSI_BASE, status);
+
+    if (!dma_active || uDMAChannelIsEnabled(ILI9488_DMA_CHANNEL))
+        return;
+
+    dma_active = false;
+    G8RTOS_SignalSemaphore(&sem_chunk_done);
+}
+
+/**
+ * @brief Fills a rectangle with one color.
+ *
+ * Must be called with `sem_SPIA` held.
+ */
+void Ili9488_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clip(&x, &y, &w, &h))
+        return;
+
+    stream(x, y, w, h, &color, false);
+}
+
+/**
+ * @brief Copies a block of RGB565 pixels to the screen, top row first.
+ *
+ * Must be called with `sem_SPIA` held. The rectangle must lie on the screen.
+ */
+void Ili9488_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    if (w <= 0 || h <= 0)
+        return;
+
+    stream(x, y, w, h, pixels, true);
+}
+
+/**
+ * @brief Dims, sleeps or wakes the panel. Sleep keeps the frame memory.
+ *
+ * Must be called with `sem_SPIA` held, from a thread: waking sleeps ILI9488_WAKE_MS.
+ */
+void Ili9488_SetPower(PanelPower_t power) {
+    const uint8_t control = ILI9488_CTRLD_ON;
+    uint8_t brightness = (power == PANEL_POWER_DIM) ? PANEL_BRIGHTNESS_DIM : PANEL_BRIGHTNESS_FULL;
+
+    if (power == panel_power)
+        return;
+
+    ST7789_Select();
+
+    if (panel_power == PANEL_POWER_SLEEP) {
+        command(ILI9488_SLPOUT, NULL, 0);
+        sleep(ILI9488_WAKE_MS);
+        command(ILI9488_DISPON, NULL, 0);
+    }
+
+    if (power == PANEL_POWER_SLEEP) {
+        command(ILI9488_DISPOFF, NULL, 0);
+        command(ILI9488_SLPIN, NULL, 0);
+    } else {
+        command(ILI9488_WRCTRLD, &control, 1);
+        command(ILI9488_WRDISBV, &brightness, 1);
+    }
+
+    while (SSIBusy(ILI9488_SSI_BASE));
+    ST7789_Deselect();
+
+    panel_power = power;
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* DISPLAY_PANEL == DISPLAY_PANEL_ILI9488 */
@@ -0,0 +1,54 @@
+/***************************************************************************************
+ * @file        ili9488.h
+ * @brief       320x480 ILI9488 panel, streamed over the display SPI bus.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Over SPI the ILI9488 only takes 18-bit color, three bytes a pixel, so the RGB565 rows
+ * the strip renderer produces can't be sent as they are. They are widened a chunk at a
+ * time into one of two small buffers while the other one is on the wire, which keeps the
+ * bus busy without a converted copy of the whole band. At 320 pixels a row the panel
+ * needs no more RAM than the ST7789 does, only more time on the bus.
+ *
+ * Selected with DISPLAY_PANEL = DISPLAY_PANEL_ILI9488, see panel.h. The panel sits on
+ * the same connector as the ST7789, so it shares SSI3, its chip select and D/C line.
+ *
+***************************************************************************************/
+
+#ifndef ILI9488_H_
+#define ILI9488_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./panel.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ILI9488_CHUNK_PIXELS    160  // pixels widened per DMA transfer, 480 bytes per buffer
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void Ili9488_Init(void);
+void Ili9488_HandleInterrupt(void);
+
+void Ili9488_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Ili9488_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
+void Ili9488_SetPower(PanelPower_t power);
+
+/********************************Public Functions***********************************/
+
+#endif /* ILI9488_H_ */
@@ -0,0 +1,123 @@
+/***************************************************************************************
+ * @file        info_panel.c
+ * @brief       Retained information panel, redrawn a changed character at a time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The panel is recorded as a display list every time, a label and a value per field,
+ * and compared with the list it showed before. Labels are the same strings every time
+ * and never differ, values are copied into the list, so only their changed characters
+ * are sent.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./info_panel.h"
+#include "./display_list.h"
+
+#include <string.h>
+
+#include "threads.h"
+#include "MultimodDrivers/multimod.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define PANEL_COLOR         ST7789_LGRAY
+#define TEXT_COLOR          ST7789_BLACK
+
+#define INFO_COMMANDS       (2 * INFO_FIELDS)   // a label and a value per field
+#define INFO_TEXT_BYTES     112                 // the value widths in LAYOUT added up
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t x;
+    int16_t y;          // bottom row of the value
+    uint8_t chars;      // characters the field has room for
+    const char *label;  // drawn 10 pixels above the value, or NULL
+} InfoLayout_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static const InfoLayout_t LAYOUT[INFO_FIELDS] = {
+    [INFO_CALLSIGN]  = {  10, MIDLINE - 25, 14, "CALL SIGN" },
+    [INFO_LONGITUDE] = {  95, MIDLINE - 25, 13, "LONGITUDE" },
+    [INFO_LATITUDE]  = { 175, MIDLINE - 25, 10, "LATITUDE" },
+    [INFO_ALTITUDE]  = {  10, MIDLINE - 53, 14, "ALTITUDE" },
+    [INFO_TRACK]     = {  95, MIDLINE - 53, 13, "TRUE TRACK" },
+    [INFO_VELOCITY]  = { 175, MIDLINE - 53, 10, "VELOCITY" },
+    [INFO_APPROACH]  = {  10, MIDLINE - 66, INFO_PANEL_MAX_CHARS, NULL },
+};
+
+// The list on the panel now and the one being recorded, in turn
+static DisplayCommand_t commands[2][INFO_COMMANDS];
+static char text[2][INFO_TEXT_BYTES];
+static DisplayList_t lists[2] = {
+    { .commands = commands[0], .max_commands = INFO_COMMANDS, .text = text[0], .text_size = INFO_TEXT_BYTES },
+    { .commands = commands[1], .max_commands = INFO_COMMANDS, .text = text[1], .text_size = INFO_TEXT_BYTES },
+};
+static uint8_t shown = 0;
+static bool valid = false;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static bool send(StripBox_t box) {
+    DisplayList_Render(&lists[shown], &box);
+    return true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Makes the next InfoPanel_Draw repaint the whole panel.
+ */
+void InfoPanel_Invalidate(void) {
+    valid = false;
+}
+
+/**
+ * @brief Shows a value in every field, sending only the characters that changed.
+ *
+ * Must be called with `sem_SPIA` held.
+ *
+ * @param values Text for each field, longer text is cut at the field's width.
+ */
+void InfoPanel_Draw(const char *const values[INFO_FIELDS]) {
+    const StripBox_t area = { 0, 0, PANEL_WIDTH - 1, MIDLINE - 1 };
+    const DisplayList_t *previous = &lists[shown];
+
+    shown ^= 1;
+    DisplayList_t *next = &lists[shown];
+
+    DisplayList_Clear(next, PANEL_COLOR);
+    for (int32_t field = 0; field < INFO_FIELDS; field++) {
+        const InfoLayout_t *layout = &LAYOUT[field];
+
+        if (layout->label != NULL)
+            DisplayList_Glyphs(next, layout->x, layout->y + 10, layout->label, strlen(layout->label), TEXT_COLOR);
+        DisplayList_Text(next, layout->x, layout->y, values[field], layout->chars, TEXT_COLOR);
+    }
+
+    if (!valid || !DisplayList_Diff(previous, next, send))
+        DisplayList_Render(next, &area);
+    valid = true;
+}
+
+/********************************Public Functions***********************************/
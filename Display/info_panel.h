@@ -0,0 +1,62 @@
+/***************************************************************************************
+ * @file        info_panel.h
+ * @brief       Retained information panel, redrawn a changed character at a time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The panel above MIDLINE is a fixed layout of labels and value fields. The background
+ * and the labels are drawn once. An update records the new text into a display list
+ * and diffs it against the previous one, which only sends the runs of characters that
+ * differ, each as one small strip render. A new selection typically changes a handful
+ * of digits per field, a few hundred pixels against the 17,000 of a full repaint.
+ *
+ * Text shorter than what the field showed before leaves its tail as background, which
+ * counts as a change, so nothing stale is left behind.
+ *
+***************************************************************************************/
+
+#ifndef INFO_PANEL_H_
+#define INFO_PANEL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define INFO_PANEL_MAX_CHARS    38   // longest field, the closest approach line
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    INFO_CALLSIGN,
+    INFO_LONGITUDE,
+    INFO_LATITUDE,
+    INFO_ALTITUDE,
+    INFO_TRACK,
+    INFO_VELOCITY,
+    INFO_APPROACH,
+    INFO_FIELDS
+} InfoField_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void InfoPanel_Invalidate(void);
+void InfoPanel_Draw(const char *const values[INFO_FIELDS]);
+
+/********************************Public Functions***********************************/
+
+#endif /* INFO_PANEL_H_ */
@@ -0,0 +1,113 @@
+/***************************************************************************************
+ * @file        label_cache.c
+ * @brief       Cache of pre-rasterized callsign labels.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./label_cache.h"
+
+#include <string.h>
+
+#include "System/arena.h"
+#include "Radar/aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LABEL_CACHE_MASK        (LABEL_CACHE_ENTRIES - 1)
+
+#if (LABEL_CACHE_ENTRIES & LABEL_CACHE_MASK) != 0
+#error "LABEL_CACHE_ENTRIES must be a power of two"
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static LabelCacheEntry_t *entries;      // LABEL_CACHE_ENTRIES, carved from the arena
+static uint32_t miss_count = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Rasterizes a callsign into an entry's row bitmap.
+ *
+ * The label ends at the terminator, like ST7789_DrawString stopping there.
+ */
+static void rasterize(LabelCacheEntry_t *entry, uint64_t packed) {
+    char callsign[AIRCRAFT_CALLSIGN_SIZE];
+    AircraftStore_CallsignText(packed, callsign);
+
+    memset(entry->rows, 0, sizeof(entry->rows));
+    entry->width = 0;
+
+    for (int16_t i = 0; i < LABEL_CACHE_CHARS && callsign[i] != '\0'; i++) {
+        entry->width += STRIP_GLYPH_ADVANCE;
+
+        const uint8_t *glyph = StripRenderer_Glyph(callsign[i]);
+
+        for (int16_t column = 0; column < STRIP_GLYPH_ADVANCE - 1; column++) {
+            int16_t x = i * STRIP_GLYPH_ADVANCE + column;
+
+            // Glyph columns have the top row in bit 0
+            for (int16_t row = 0; row < LABEL_CACHE_HEIGHT; row++) {
+                if (glyph[column] & (1 << row))
+                    entry->rows[row][x >> 3] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Carves the cache out of the arena and empties it.
+ *
+ * Must be called once, before the scheduler is launched.
+ */
+void LabelCache_Init(void) {
+    entries = Arena_Alloc(LABEL_CACHE_ENTRIES * sizeof(LabelCacheEntry_t), "Labels");
+    for (int16_t i = 0; i < LABEL_CACHE_ENTRIES; i++) {
+        entries[i].slot = -1;
+    }
+    miss_count = 0;
+}
+
+/**
+ * @brief Returns the bitmap for a slot's callsign, rasterizing it on a miss.
+ *
+ * @return const LabelCacheEntry_t* The entry, whose rows are top row first. Valid until
+ *                                  the next call that maps to the same entry.
+ */
+const LabelCacheEntry_t *LabelCache_Get(int16_t slot, uint64_t callsign) {
+    LabelCacheEntry_t *entry = &entries[slot & LABEL_CACHE_MASK];
+
+    if (entry->slot != slot || entry->callsign != callsign) {
+        entry->slot = slot;
+        entry->callsign = callsign;
+        rasterize(entry, callsign);
+        miss_count++;
+    }
+
+    return entry;
+}
+
+uint32_t LabelCache_GetMissCount(void) {
+    return miss_count;
+}
+
+/********************************Public Functions***********************************/
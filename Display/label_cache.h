@@ -0,0 +1,66 @@
+/***************************************************************************************
+ * @file        label_cache.h
+ * @brief       Cache of pre-rasterized callsign labels.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A callsign label is rasterized from the font once and kept as a 1 bpp bitmap, tagged
+ * with the aircraft slot and the packed callsign it was built from, so a lookup is two
+ * integer compares. Drawing the label again is
+ * a single bitmap blit into the strip buffer, with no glyph lookups or per-pixel
+ * clipping. The colors are applied when the bitmap is blitted, so selecting an aircraft
+ * does not invalidate its label.
+ *
+ * The cache is direct mapped by slot. Full RGB565 labels would take 672 bytes each, so
+ * at 64 bytes an entry it covers a quarter of the table in 1 KB.
+ *
+***************************************************************************************/
+
+#ifndef LABEL_CACHE_H_
+#define LABEL_CACHE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LABEL_CACHE_ENTRIES     16   // must be a power of two
+#define LABEL_CACHE_CHARS       7
+#define LABEL_CACHE_WIDTH       (LABEL_CACHE_CHARS * STRIP_GLYPH_ADVANCE)
+#define LABEL_CACHE_HEIGHT      STRIP_GLYPH_ROWS
+#define LABEL_CACHE_STRIDE      ((LABEL_CACHE_WIDTH + 7) / 8)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint64_t callsign;              // packed, see AircraftStore_PackCallsign
+    int16_t slot;                   // -1 when unused
+    int16_t width;                  // pixels covered, ST7789_DrawString stops at the terminator
+    uint8_t rows[LABEL_CACHE_HEIGHT][LABEL_CACHE_STRIDE];
+} LabelCacheEntry_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void LabelCache_Init(void);
+const LabelCacheEntry_t *LabelCache_Get(int16_t slot, uint64_t callsign);
+uint32_t LabelCache_GetMissCount(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* LABEL_CACHE_H_ */
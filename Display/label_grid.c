@@ -0,0 +1,93 @@
+/***************************************************************************************
+ * @file        label_grid.c
+ * @brief       Coarse occupancy grid for placing callsign labels.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./label_grid.h"
+
+#include <string.h>
+
+#include "threads.h"
+#include "MultimodDrivers/multimod.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define GRID_COLUMNS    ((PANEL_WIDTH + (1 << LABEL_GRID_CELL_SHIFT) - 1) >> LABEL_GRID_CELL_SHIFT)
+#define GRID_ROWS       ((PANEL_HEIGHT - MIDLINE + (1 << LABEL_GRID_CELL_SHIFT) - 1) >> LABEL_GRID_CELL_SHIFT)
+#define GRID_BYTES      ((GRID_COLUMNS + 7) / 8)
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint8_t occupancy[GRID_ROWS][GRID_BYTES];
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Converts a pixel box to the range of cells it touches.
+ *
+ * @return bool False if the box is not fully inside the radar area.
+ */
+static bool to_cells(const StripBox_t *box, int16_t *c0, int16_t *r0, int16_t *c1, int16_t *r1) {
+    if (box->x0 < 0 || box->x1 >= PANEL_WIDTH || box->y0 < MIDLINE || box->y1 >= PANEL_HEIGHT)
+        return false;
+
+    *c0 = box->x0 >> LABEL_GRID_CELL_SHIFT;
+    *c1 = box->x1 >> LABEL_GRID_CELL_SHIFT;
+    *r0 = (box->y0 - MIDLINE) >> LABEL_GRID_CELL_SHIFT;
+    *r1 = (box->y1 - MIDLINE) >> LABEL_GRID_CELL_SHIFT;
+    return true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void LabelGrid_Clear(void) {
+    memset(occupancy, 0, sizeof(occupancy));
+}
+
+/**
+ * @brief Claims the cells under a label if they are all free.
+ *
+ * @return bool True if the label was placed. Boxes reaching outside the radar area are
+ *              never placed.
+ */
+bool LabelGrid_Place(const StripBox_t *box) {
+    int16_t c0, r0, c1, r1;
+
+    if (!to_cells(box, &c0, &r0, &c1, &r1))
+        return false;
+
+    for (int16_t row = r0; row <= r1; row++) {
+        for (int16_t column = c0; column <= c1; column++) {
+            if (occupancy[row][column >> 3] & (1 << (column & 7)))
+                return false;
+        }
+    }
+
+    for (int16_t row = r0; row <= r1; row++) {
+        for (int16_t column = c0; column <= c1; column++) {
+            occupancy[row][column >> 3] |= 1 << (column & 7);
+        }
+    }
+
+    return true;
+}
+
+/********************************Public Functions***********************************/
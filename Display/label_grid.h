@@ -0,0 +1,45 @@
+/***************************************************************************************
+ * @file        label_grid.h
+ * @brief       Coarse occupancy grid for placing callsign labels.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The radar area is split into 4x4 pixel cells, one bit each. A label is only placed if
+ * every cell under it is free, and placing it claims those cells, so labels never draw
+ * over each other. Cells are coarse on purpose, they leave a little gap between labels
+ * and keep a placement test down to a few dozen bit checks.
+ *
+***************************************************************************************/
+
+#ifndef LABEL_GRID_H_
+#define LABEL_GRID_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LABEL_GRID_CELL_SHIFT   2    // 4x4 pixel cells
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void LabelGrid_Clear(void);
+bool LabelGrid_Place(const StripBox_t *box);
+
+/********************************Public Functions***********************************/
+
+#endif /* LABEL_GRID_H_ */
@@ -0,0 +1,116 @@
+/***************************************************************************************
+ * @file        panel.c
+ * @brief       The display panel the firmware draws on, picked at build time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Forwards each call to the driver DISPLAY_PANEL selects. The choice is made by the
+ * preprocessor, so there is no indirection left at run time.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./panel.h"
+
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+#include "./st7789_dma.h"
+#else
+#include "./ili9488.h"
+#endif
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up the panel's pixel path.
+ *
+ * Must be called after multimod_init() has configured the display bus and after
+ * G8RTOS_Init(). INT_SSI3 has to be registered to call Panel_HandleInterrupt.
+ */
+void Panel_Init(void) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_Init();
+#else
+    Ili9488_Init();
+#endif
+}
+
+/**
+ * @brief Services the display SSI interrupt.
+ */
+void Panel_HandleInterrupt(void) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_HandleInterrupt();
+#else
+    Ili9488_HandleInterrupt();
+#endif
+}
+
+/**
+ * @brief Fills a rectangle with one color, clipped to the panel.
+ *
+ * Must be called with `sem_SPIA` held.
+ */
+void Panel_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_FillRectangle(x, y, w, h, color);
+#else
+    Ili9488_FillRectangle(x, y, w, h, color);
+#endif
+}
+
+/**
+ * @brief Copies a block of RGB565 pixels to the panel, top row first.
+ *
+ * Must be called with `sem_SPIA` held. The rectangle must lie on the panel and the
+ * buffer must stay untouched until the call returns.
+ */
+void Panel_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_BlitRectangle(x, y, w, h, pixels);
+#else
+    Ili9488_BlitRectangle(x, y, w, h, pixels);
+#endif
+}
+
+/**
+ * @brief Starts a batch of blits that fill a window top row first.
+ *
+ * Must be called with `sem_SPIA` held, and ended with Panel_EndBatch before it is released.
+ */
+void Panel_BeginBatch(int16_t x, int16_t y, int16_t w, int16_t h) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_BeginBatch(x, y, w, h);
+#else
+    (void)x; (void)y; (void)w; (void)h;
+#endif
+}
+
+void Panel_EndBatch(void) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_EndBatch();
+#endif
+}
+
+/**
+ * @brief Dims, sleeps or wakes the panel.
+ *
+ * Must be called with `sem_SPIA` held, from a thread.
+ */
+void Panel_SetPower(PanelPower_t power) {
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+    St7789Dma_SetPower(power);
+#else
+    Ili9488_SetPower(power);
+#endif
+}
+
+/********************************Public Functions***********************************/
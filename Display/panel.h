@@ -0,0 +1,96 @@
+/***************************************************************************************
+ * @file        panel.h
+ * @brief       The display panel the firmware draws on, picked at build time.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Everything above this layer draws through the strip renderer, which only ever needs
+ * two things from a panel: filling a rectangle with one color and streaming a block of
+ * RGB565 rows into a window. Those, the panel size and the bus interrupt are all this
+ * header exposes, so driving another controller means writing those calls for it.
+ *
+ *      DISPLAY_PANEL_ST7789     240 x 280, RGB565 over uDMA, see st7789_dma.h
+ *      DISPLAY_PANEL_ILI9488    320 x 480, RGB666 streamed a chunk at a time, see ili9488.h
+ *
+ * Panel_SetPower dims the backlight and puts the controller to sleep, see
+ * frame_scheduler.h for when. Dimming goes through the controller's brightness register,
+ * which only reaches the backlight on boards that wire its LEDPWM output to it. Sleep
+ * blanks the panel on any board, and the frame memory keeps the picture for waking.
+ *
+ * Panel_BeginBatch and Panel_EndBatch bracket blits that fill one window band by band,
+ * top first. A panel that can stream them into one address window does, the others
+ * set a window per blit as usual.
+ *
+ * Coordinates are the same for every panel: x from the left, y from the bottom row up,
+ * and a blit's first buffer row is its top row.
+ *
+***************************************************************************************/
+
+#ifndef PANEL_H_
+#define PANEL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "MultimodDrivers/multimod.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DISPLAY_PANEL_ST7789    0
+#define DISPLAY_PANEL_ILI9488   1
+
+#ifndef DISPLAY_PANEL
+#define DISPLAY_PANEL           DISPLAY_PANEL_ST7789
+#endif
+
+#if DISPLAY_PANEL == DISPLAY_PANEL_ST7789
+#define PANEL_WIDTH             X_MAX
+#define PANEL_HEIGHT            Y_MAX
+#elif DISPLAY_PANEL == DISPLAY_PANEL_ILI9488
+#define PANEL_WIDTH             320
+#define PANEL_HEIGHT            480
+#else
+#error "Unknown DISPLAY_PANEL"
+#endif
+
+#define PANEL_BRIGHTNESS_FULL   0xFF
+#define PANEL_BRIGHTNESS_DIM    0x20
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    PANEL_POWER_ON,
+    PANEL_POWER_DIM,
+    PANEL_POWER_SLEEP,
+} PanelPower_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Panel_Init(void);
+void Panel_HandleInterrupt(void);
+
+void Panel_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void Panel_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
+void Panel_BeginBatch(int16_t x, int16_t y, int16_t w, int16_t h);
+void Panel_EndBatch(void);
+
+void Panel_SetPower(PanelPower_t power);
+
+/********************************Public Functions***********************************/
+
+#endif /* PANEL_H_ */
@@ -0,0 +1,564 @@
+/***************************************************************************************
+ * @file        radar_renderer.c
+ * @brief       Incremental dirty-rectangle renderer for the radar area.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A frame is drawn in two passes. The first compares every slot's sprite with what was
+ * drawn last time and records the old and new bounding boxes of the ones that changed,
+ * merging boxes that overlap. The second renders each damaged box from scratch, so
+ * erasing and repairing the background happen in the same pass and nothing shows up
+ * half drawn.
+ *
+ * Sprites are tracked per slot of the live array, so an aircraft that moves to another
+ * slot is simply dropped from one and drawn in the other.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./radar_renderer.h"
+#include "./aircraft_filter.h"
+#include "./display_list.h"
+#include "./label_cache.h"
+#include "./label_grid.h"
+#include "./track_history.h"
+
+#include <string.h>
+
+#include "MultimodDrivers/multimod.h"
+#include "MultimodDrivers/font.h"
+#include "System/arena.h"
+#include "System/clock.h"
+#include "System/format.h"
+#include "System/sine_table.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifdef FONT_HEIGHT
+#define GLYPH_HEIGHT        FONT_HEIGHT
+#else
+#define GLYPH_HEIGHT        8
+#endif
+
+#define RADAR_CENTER_DOT    5
+
+#define TRACK_LENGTH        30
+#define TRACK_GAP           3
+#define TRAIL_COLOR         ST7789_GRAY
+#define STALE_COLOR         ST7789_GRAY     // aircraft from the warm-start snapshot, or gone quiet
+#define CONFLICT_COLOR      ST7789_RED      // aircraft too close to another, see conflict_detector.h
+
+#define SPRITE_CALLSIGN     0x01
+#define SPRITE_TRACK        0x02
+#define SPRITE_PLACEMENT    0x0C     // which candidate offset the label ended up at
+#define PLACEMENT_SHIFT     2
+#define PLACEMENTS          4
+
+#define LABEL_LENGTH        (FORMAT_INT_SIZE + 3)
+
+// Callsigns are kept this close to the center at RADAR_DETAIL_NEAR
+#define NEAR_RADIUS_SQUARED ((int32_t)(RADAR_RADIUS_PX / 2) * (RADAR_RADIUS_PX / 2))
+
+#define SCENE_COMMANDS      6    // ring mask, range labels, trails and the aircraft
+
+// Rows a sprite reaches from its center, the heading line being the longest part
+#define SPRITE_REACH        TRACK_LENGTH
+
+#if SPRITE_REACH < 5 + 2 + GLYPH_HEIGHT
+#error "SPRITE_REACH must cover a label placed above or below the largest symbol"
+#endif
+
+#if RADAR_RADIUS_PX > STRIP_RING_RADIUS
+#error "The outer range ring is larger than a StripMask_t holds"
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static RadarSprite_t *drawn;        // MAX_AIRCRAFTS of them, carved from the arena
+static int16_t drawn_count = 0;
+
+static StripBox_t damage[RADAR_RENDERER_MAX_DAMAGE];
+static uint16_t damage_count = 0;
+
+static const StripBox_t radar_area = { RADAR_LEFT, RADAR_TOP, RADAR_RIGHT, RADAR_BOTTOM };
+
+// Range rings and the center dot, built once
+static StripMask_t rings;
+
+// Range labels of the frame being drawn, formatted again only when the range changes
+static char label_text[2][LABEL_LENGTH];
+static int16_t label_x[2];
+static const int16_t label_y[2] = { RADAR_CENTER_Y + RADAR_RADIUS_PX - RADAR_LABEL_INSET,
+                                    RADAR_CENTER_Y + RADAR_INNER_RADIUS_PX - RADAR_LABEL_INSET };
+static uint16_t label_range_km = 0;
+
+static uint16_t drawn_range_km = 0;
+static bool drawn_trails = false;
+static bool valid = false;
+static bool stale = false;
+
+// The display list on the panel and the one of the next frame, in turn
+static DisplayCommand_t scene_commands[2][SCENE_COMMANDS];
+static char scene_text[2][2 * LABEL_LENGTH];
+static DisplayList_t scenes[2];
+static uint8_t scene = 0;
+
+static DisplaySlot_t *sprite_order;  // MAX_AIRCRAFTS, carved from the arena
+static DisplaySprites_t sprites;
+
+// Detail of the next frame, from how long the last ones took
+static RadarRendererStats_t stats = { RADAR_DETAIL_FULL, 0, 0, 0 };
+static uint32_t frame_start_us = 0;
+static bool repainting = false;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void box_include(StripBox_t *box, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (x0 < box->x0) box->x0 = x0;
+    if (y0 < box->y0) box->y0 = y0;
+    if (x1 > box->x1) box->x1 = x1;
+    if (y1 > box->y1) box->y1 = y1;
+}
+
+static uint64_t sprite_callsign(const RadarSprite_t *sprite) {
+    return sprite->callsign | ((uint64_t)sprite->callsign_tail << 32);
+}
+
+static int16_t label_width(const RadarSprite_t *sprite) {
+    return AircraftStore_CallsignLength(sprite_callsign(sprite)) * (FONT_WIDTH + 1);
+}
+
+/**
+ * @brief Bottom-left corner of a sprite's label for its current placement.
+ *
+ * Candidates in order of preference: right of the symbol, left of it, above and below.
+ */
+static void label_origin(const RadarSprite_t *sprite, int16_t *x, int16_t *y) {
+    int16_t gap = sprite->radius + 2;
+    int16_t width = label_width(sprite);
+
+    switch ((sprite->flags & SPRITE_PLACEMENT) >> PLACEMENT_SHIFT) {
+        case 0:  *x = sprite->x + gap;              *y = sprite->y - 5;                     break;
+        case 1:  *x = sprite->x - gap - width + 1;  *y = sprite->y - 5;                     break;
+        case 2:  *x = sprite->x - width / 2;        *y = sprite->y + gap;                   break;
+        default: *x = sprite->x - width / 2;        *y = sprite->y - gap - GLYPH_HEIGHT + 1; break;
+    }
+}
+
+static StripBox_t label_box(const RadarSprite_t *sprite) {
+    int16_t x, y;
+    label_origin(sprite, &x, &y);
+
+    StripBox_t box = { x, y, x + label_width(sprite) - 1, y + GLYPH_HEIGHT - 1 };
+    return box;
+}
+
+/**
+ * @brief Bounding box of everything drawn for a sprite.
+ */
+static StripBox_t sprite_box(const RadarSprite_t *sprite) {
+    StripBox_t box = { sprite->x - sprite->radius, sprite->y - sprite->radius,
+                       sprite->x + sprite->radius, sprite->y + sprite->radius };
+
+    if (sprite->flags & SPRITE_CALLSIGN) {
+        StripBox_t label = label_box(sprite);
+        box_include(&box, label.x0, label.y0, label.x1, label.y1);
+    }
+
+    if (sprite->flags & SPRITE_TRACK) {
+        int16_t track_x = sprite->x + sprite->track_dx;
+        int16_t track_y = sprite->y + sprite->track_dy;
+        int16_t x0 = (sprite->x < track_x) ? sprite->x : track_x;
+        int16_t x1 = (sprite->x < track_x) ? track_x : sprite->x;
+        int16_t y0 = (sprite->y < track_y) ? sprite->y : track_y;
+        int16_t y1 = (sprite->y < track_y) ? track_y : sprite->y;
+        box_include(&box, x0, y0, x1, y1);
+    }
+
+    return box;
+}
+
+/**
+ * @brief What the detail stage leaves of an unselected aircraft's callsign and track vector.
+ */
+static uint8_t detail_flags(int16_t x, int16_t y, uint8_t flags) {
+    if (stats.detail >= RADAR_DETAIL_SYMBOLS)
+        return 0;
+
+    if (stats.detail >= RADAR_DETAIL_NO_TRACKS)
+        flags &= ~SPRITE_TRACK;
+
+    if (stats.detail >= RADAR_DETAIL_NEAR) {
+        int32_t dx = x - RADAR_CENTER_X;
+        int32_t dy = y - RADAR_CENTER_Y;
+        if (dx * dx + dy * dy > NEAR_RADIUS_SQUARED)
+            flags &= ~SPRITE_CALLSIGN;
+    }
+
+    return flags;
+}
+
+/**
+ * @brief Works out what should be drawn for one aircraft.
+ *
+ * @param slot Slot in the live store, or -1 for a slot that is no longer in use.
+ */
+static void build_sprite(const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t slot,
+                         bool selected, uint8_t flags, RadarSprite_t *sprite) {
+    memset(sprite, 0, sizeof(*sprite));
+
+    if (slot < 0 || !screen->on_screen[slot] || !AircraftFilter_IsVisible(screen, slot))
+        return;
+
+    sprite->x = screen->x[slot];
+    sprite->y = screen->y[slot];
+    bool conflict = AircraftScreen_TestBit(screen->conflict, slot);
+    sprite->radius = selected ? 5 : conflict ? 4 : 3;
+    sprite->color = selected ? ST7789_MAGENTA : conflict ? CONFLICT_COLOR :
+                    (stale || screen->dimmed[slot]) ? STALE_COLOR : AIRCRAFT_FILTER_PALETTE[screen->layer[slot]];
+    sprite->flags = selected ? flags : detail_flags(sprite->x, sprite->y, flags);
+    sprite->callsign = aircrafts->callsign[slot];
+    sprite->callsign_tail = aircrafts->callsign_tail[slot];
+
+    // Endpoint of a line representing the heading of the aircraft, see RadarRenderer_SetTrack
+    if (sprite->flags & SPRITE_TRACK) {
+        sprite->track_dx = screen->track_dx[slot];
+        sprite->track_dy = screen->track_dy[slot];
+    }
+}
+
+/**
+ * @brief Puts a sprite's label at the first candidate offset that is still free.
+ *
+ * Labels that fit nowhere are dropped for this frame rather than drawn over others.
+ */
+static void place_label(RadarSprite_t *sprite) {
+    if (!(sprite->flags & SPRITE_CALLSIGN))
+        return;
+
+    for (uint8_t placement = 0; placement < PLACEMENTS; placement++) {
+        sprite->flags = (sprite->flags & ~SPRITE_PLACEMENT) | (placement << PLACEMENT_SHIFT);
+
+        StripBox_t box = label_box(sprite);
+        if (LabelGrid_Place(&box))
+            return;
+    }
+
+    sprite->flags &= ~(SPRITE_CALLSIGN | SPRITE_PLACEMENT);
+}
+
+static bool same_sprite(const RadarSprite_t *a, const RadarSprite_t *b) {
+    if (a->radius == 0 || b->radius == 0)
+        return a->radius == b->radius;
+
+    return a->x == b->x && a->y == b->y &&
+           a->radius == b->radius && a->color == b->color && a->flags == b->flags &&
+           (!(a->flags & SPRITE_TRACK) || (a->track_dx == b->track_dx && a->track_dy == b->track_dy)) &&
+           a->callsign == b->callsign && a->callsign_tail == b->callsign_tail;
+}
+
+/**
+ * @brief Records a damaged box, growing an overlapping one where possible.
+ *
+ * @return bool False if the damage list is full.
+ */
+static bool add_damage(StripBox_t box) {
+    if (box.y0 < radar_area.y0)
+        box.y0 = radar_area.y0;
+
+    for (uint16_t i = 0; i < damage_count; i++) {
+        if (StripBox_Overlaps(&damage[i], &box)) {
+            box_include(&damage[i], box.x0, box.y0, box.x1, box.y1);
+            return true;
+        }
+    }
+
+    if (damage_count == RADAR_RENDERER_MAX_DAMAGE)
+        return false;
+
+    damage[damage_count++] = box;
+    return true;
+}
+
+/**
+ * @brief Whether the damaged boxes add up to more pixels than the whole radar area.
+ *
+ * Boxes grown by merging can overlap others, and past this point one repaint is cheaper.
+ */
+static bool damage_exceeds_area(void) {
+    uint32_t pixels = 0;
+    for (uint16_t i = 0; i < damage_count; i++) {
+        pixels += (uint32_t)(damage[i].x1 - damage[i].x0 + 1) * (damage[i].y1 - damage[i].y0 + 1);
+    }
+    return pixels >= (uint32_t)RADAR_WIDTH * RADAR_HEIGHT;
+}
+
+static void prepare_labels(uint16_t range_km) {
+    const uint16_t label_km[2] = { range_km, range_km / 2 };
+
+    if (range_km == label_range_km)
+        return;
+    label_range_km = range_km;
+
+    // Append current display ranges to the radar circles
+    for (int32_t i = 0; i < 2; i++) {
+        Format_Int(label_km[i], label_text[i]);
+        strcat(label_text[i], " km");
+        label_x[i] = RADAR_CENTER_X - (strlen(label_text[i]) * (FONT_WIDTH + 1)) / 2;
+    }
+}
+
+static int16_t sprite_row(int16_t index) {
+    return (drawn[index].radius != 0) ? drawn[index].y : DISPLAY_NO_SPRITE;
+}
+
+/**
+ * @brief Rasterizes one aircraft into a band.
+ */
+static void paint_sprite(const StripCanvas_t *canvas, int16_t index) {
+    const RadarSprite_t *sprite = &drawn[index];
+
+    StripBox_t box = sprite_box(sprite);
+    if (!StripBox_Overlaps(&box, &canvas->box))
+        return;
+
+    // Draw aircraft symbol
+    StripCanvas_FillCircle(canvas, sprite->x, sprite->y, sprite->radius, sprite->color);
+
+    // Draw callsign next to the aircraft, a single blit of the cached label
+    if (sprite->flags & SPRITE_CALLSIGN) {
+        const LabelCacheEntry_t *label = LabelCache_Get(index, sprite_callsign(sprite));
+        int16_t x, y;
+        label_origin(sprite, &x, &y);
+        StripCanvas_Bitmap(canvas, x, y, &label->rows[0][0], label->width, LABEL_CACHE_HEIGHT,
+                           LABEL_CACHE_STRIDE, ST7789_WHITE, ST7789_BLACK);
+    }
+
+    // Draw the heading line
+    if (sprite->flags & SPRITE_TRACK)
+        StripCanvas_DottedLine(canvas, sprite->x, sprite->y,
+                               sprite->x + sprite->track_dx, sprite->y + sprite->track_dy,
+                               sprite->color, TRACK_GAP);
+}
+
+static void paint_trails(const StripCanvas_t *canvas) {
+    TrackHistory_Paint(canvas, TRAIL_COLOR);
+}
+
+/**
+ * @brief Records the whole radar scene, bottom layer first.
+ */
+static void record_scene(DisplayList_t *list) {
+    DisplayList_Clear(list, ST7789_BLACK);
+
+    // Major and minor radius and the center dot, one mask
+    DisplayList_Mask(list, RADAR_CENTER_X, RADAR_CENTER_Y, &rings, ST7789_LIGHTORANGE);
+
+    for (int32_t i = 0; i < 2; i++) {
+        DisplayList_Text(list, label_x[i], label_y[i], label_text[i], LABEL_LENGTH, ST7789_LIGHTORANGE);
+    }
+
+    // Trails go under the symbols
+    if (drawn_trails)
+        DisplayList_Painter(list, &radar_area, paint_trails);
+
+    DisplayList_Sprites(list, &sprites, drawn_count);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Carves the sprites, label cache and trail pool out of the arena, and starts blank.
+ *
+ * Must be called once, before the scheduler is launched.
+ */
+void RadarRenderer_Init(void) {
+    drawn = Arena_Alloc(MAX_AIRCRAFTS * sizeof(RadarSprite_t), "Sprites");
+    sprite_order = Arena_Alloc(MAX_AIRCRAFTS * sizeof(DisplaySlot_t), "Order");
+
+    LabelCache_Init();
+    TrackHistory_Init();
+    StripMask_Clear(&rings);
+    StripMask_AddRing(&rings, RADAR_RADIUS_PX);
+    StripMask_AddRing(&rings, RADAR_INNER_RADIUS_PX);
+    StripMask_AddDisc(&rings, RADAR_CENTER_DOT);
+    sprites.row = sprite_row;
+    sprites.paint = paint_sprite;
+    sprites.reach = SPRITE_REACH;
+    sprites.order = sprite_order;
+    for (int32_t i = 0; i < 2; i++) {
+        DisplayList_Init(&scenes[i], scene_commands[i], SCENE_COMMANDS, scene_text[i], sizeof(scene_text[i]));
+    }
+    label_range_km = 0;
+    drawn_count = 0;
+    damage_count = 0;
+    valid = false;
+}
+
+/**
+ * @brief Works out a slot's heading line, kept until its heading next changes.
+ *
+ * The line is TRACK_LENGTH pixels long, at the heading rounded to the nearest degree.
+ * True track is clockwise from north, and up the screen is +y.
+ *
+ * @param heading 0.1 degrees, as AircraftStore_t keeps it.
+ */
+void RadarRenderer_SetTrack(AircraftScreen_t *screen, int16_t slot, int16_t heading) {
+    int32_t degrees = (heading >= 0) ? (heading + AIRCRAFT_HEADING_SCALE / 2) / AIRCRAFT_HEADING_SCALE
+                                     : (heading - AIRCRAFT_HEADING_SCALE / 2) / AIRCRAFT_HEADING_SCALE;
+    int32_t half = 1 << (SINE_TABLE_BITS - 1);
+
+    screen->track_dx[slot] = (TRACK_LENGTH * SineTable_Sin(degrees) + half) >> SINE_TABLE_BITS;
+    screen->track_dy[slot] = (TRACK_LENGTH * SineTable_Cos(degrees) + half) >> SINE_TABLE_BITS;
+}
+
+/**
+ * @brief Forces the next frame to repaint the whole radar area and start the trails over.
+ */
+void RadarRenderer_Invalidate(void) {
+    valid = false;
+}
+
+/**
+ * @brief Draws the aircraft that aren't selected in gray while the store is stale.
+ *
+ * Each sprite's color is part of what was drawn, so the change repaints only the
+ * aircraft, on the next RadarRenderer_Prepare.
+ */
+void RadarRenderer_SetStale(bool is_stale) {
+    stale = is_stale;
+}
+
+/**
+ * @brief Works out what the next frame draws from the live aircraft store.
+ *
+ * Reads the store without changing it, under a read of `seq_CURRENT_AIRCRAFTS`. The
+ * pixels are only sent by RadarRenderer_Paint.
+ *
+ * @param aircrafts     The live aircraft store.
+ * @param screen        Where each of its aircraft is on the radar.
+ * @param selected      Index of the selected aircraft, or -1.
+ * @param range_km      Display range shown on the labels.
+ * @param show_callsign Draw callsigns next to the symbols.
+ * @param show_track    Draw heading lines.
+ * @param show_trails   Draw the trail of recent positions behind each aircraft.
+ */
+void RadarRenderer_Prepare(const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t selected,
+                           uint16_t range_km, bool show_callsign, bool show_track, bool show_trails) {
+    int16_t count = aircrafts->count;
+    uint8_t flags = (show_callsign ? SPRITE_CALLSIGN : 0) | (show_track ? SPRITE_TRACK : 0);
+    int16_t slots = (count > drawn_count) ? count : drawn_count;
+    // Trails are dropped on a range change, and nothing but a full repaint erases them
+    bool full = !valid || show_trails != drawn_trails || (drawn_trails && range_km != drawn_range_km);
+
+    frame_start_us = Clock_Micros();
+    if (stats.detail != RADAR_DETAIL_FULL)
+        stats.degraded++;
+
+    damage_count = 0;
+
+    // Trail points are in pixels, they mean nothing at another range or center
+    if (!valid || range_km != drawn_range_km || (drawn_trails && !show_trails))
+        TrackHistory_Clear();
+
+    // The selected aircraft claims its label space first so it always has a callsign
+    RadarSprite_t selected_sprite;
+    LabelGrid_Clear();
+    if (selected >= 0 && selected < count) {
+        build_sprite(aircrafts, screen, selected, true, flags, &selected_sprite);
+        place_label(&selected_sprite);
+    }
+
+    // Damage where every changed sprite was and where it is now
+    for (int16_t i = 0; i < slots; i++) {
+        RadarSprite_t sprite;
+        if (i == selected) {
+            sprite = selected_sprite;
+        } else {
+            build_sprite(aircrafts, screen, (i < count) ? i : -1, false, flags, &sprite);
+            place_label(&sprite);
+        }
+
+        // Only segments a trail gains or loses need repainting
+        if (show_trails && sprite.radius != 0)
+            full = !TrackHistory_Record(aircrafts->icao24[i], sprite.x, sprite.y, add_damage) || full;
+
+        if (same_sprite(&sprite, &drawn[i]))
+            continue;
+
+        if (!full && drawn[i].radius != 0)
+            full = !add_damage(sprite_box(&drawn[i]));
+        if (!full && sprite.radius != 0)
+            full = !add_damage(sprite_box(&sprite));
+
+        drawn[i] = sprite;
+    }
+
+    if (show_trails)
+        full = !TrackHistory_Sweep(add_damage) || full;
+
+    drawn_count = count;
+    drawn_range_km = range_km;
+    drawn_trails = show_trails;
+    valid = true;
+
+    // Rings, labels and trails are diffed as drawing commands, the aircraft were above
+    prepare_labels(range_km);
+    record_scene(&scenes[scene ^ 1]);
+    if (!full)
+        full = !DisplayList_Diff(&scenes[scene], &scenes[scene ^ 1], add_damage);
+    scene ^= 1;
+
+    repainting = full || damage_exceeds_area();
+    if (repainting) {
+        damage[0] = radar_area;
+        damage_count = 1;
+    }
+}
+
+/**
+ * @brief Sends the damage RadarRenderer_Prepare found to the panel.
+ *
+ * Must be called with `sem_SPIA` held. Only the renderer's own sprite copies are read.
+ */
+void RadarRenderer_Paint(void) {
+    for (uint16_t i = 0; i < damage_count; i++) {
+        DisplayList_Render(&scenes[scene], &damage[i]);
+    }
+
+    uint32_t cost = Clock_Micros() - frame_start_us;
+    if (cost > stats.worst_us)
+        stats.worst_us = cost;
+    if (repainting)
+        return;
+
+    // One stage at a time each way, with a gap between so a stage that just fits stays
+    if (cost > RADAR_RENDERER_BUDGET_US) {
+        stats.overruns++;
+        if (stats.detail < RADAR_DETAIL_SYMBOLS)
+            stats.detail++;
+    } else if (cost < RADAR_RENDERER_BUDGET_US / 2 && stats.detail > RADAR_DETAIL_FULL) {
+        stats.detail--;
+    }
+}
+
+void RadarRenderer_GetStats(RadarRendererStats_t *copy) {
+    *copy = stats;
+}
+
+/********************************Public Functions***********************************/
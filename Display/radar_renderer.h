@@ -0,0 +1,115 @@
+/***************************************************************************************
+ * @file        radar_renderer.h
+ * @brief       Incremental dirty-rectangle renderer for the radar area.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The renderer remembers what it drew for each aircraft slot last frame: the symbol,
+ * the callsign and the track line. On each update only the boxes covering slots whose
+ * picture changed, where the sprite was and where it is now, are damaged. Each damaged
+ * box is re-rasterized from the frame's display list (rings, center dot, range labels,
+ * trails and every aircraft touching it) and sent in one piece. The cost of
+ * a frame therefore scales with the number of aircraft that moved instead of with the
+ * radar area.
+ *
+ * The rest of the scene, rings, range labels and trails, is recorded as a display list
+ * and diffed against the previous frame's, so a new range only repaints the digits of
+ * the labels that changed. A full repaint still happens on the first frame, when trails
+ * are turned on or off or dropped by a range change, and when more regions are damaged
+ * than the renderer tracks.
+ *
+ * A frame is two calls. RadarRenderer_Prepare reads the aircraft store and works out
+ * the sprites and damage, a few microseconds per aircraft. RadarRenderer_Paint then
+ * streams the damage out from the renderer's own copies, so the store is free again
+ * long before the pixels are.
+ *
+ * The renderer times each frame from Prepare to the end of Paint. A frame over
+ * RADAR_RENDERER_BUDGET_US lowers the detail of the next one a stage, and a frame under
+ * half of it raises it a stage again:
+ *
+ *      full        symbols, callsigns and track vectors as the settings say
+ *      near        callsigns only within half the radius of the center
+ *      no tracks   no track vectors either
+ *      symbols     symbols alone
+ *
+ * The selected aircraft is always drawn in full. Whatever a stage dropped differs from
+ * what is on the panel, so the frame that restores it repaints just those aircraft. A
+ * full repaint costs the whole radar area whatever the detail, so it is not judged.
+ *
+***************************************************************************************/
+
+#ifndef RADAR_RENDERER_H_
+#define RADAR_RENDERER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+#include "Radar/aircraft_store.h"
+#include "./strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define RADAR_RENDERER_MAX_DAMAGE   32   // damaged regions tracked before giving up and repainting
+#define RADAR_RENDERER_BUDGET_US    25000   // half a frame interval, a radar frame past it draws less next time
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    RADAR_DETAIL_FULL,
+    RADAR_DETAIL_NEAR,
+    RADAR_DETAIL_NO_TRACKS,
+    RADAR_DETAIL_SYMBOLS
+} RadarDetail_t;
+
+typedef struct {
+    RadarDetail_t detail;       // of the next frame
+    uint32_t degraded;          // frames drawn below full detail
+    uint32_t overruns;          // frames over RADAR_RENDERER_BUDGET_US
+    uint32_t worst_us;          // longest frame, Prepare to the end of Paint
+} RadarRendererStats_t;
+
+// What was drawn for one aircraft slot
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint32_t callsign;      // packed, see AircraftStore_Callsign
+    uint16_t callsign_tail;
+    uint16_t color;
+    int8_t track_dx;        // heading line end from x, y
+    int8_t track_dy;
+    uint8_t radius;     // 0 when nothing is drawn for the slot
+    uint8_t flags;
+} RadarSprite_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void RadarRenderer_Init(void);
+void RadarRenderer_Invalidate(void);
+void RadarRenderer_SetStale(bool is_stale);
+
+void RadarRenderer_SetTrack(AircraftScreen_t *screen, int16_t slot, int16_t heading);
+
+void RadarRenderer_Prepare(const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t selected,
+                           uint16_t range_km, bool show_callsign, bool show_track, bool show_trails);
+void RadarRenderer_Paint(void);
+
+void RadarRenderer_GetStats(RadarRendererStats_t *copy);
+
+/********************************Public Functions***********************************/
+
+#endif /* RADAR_RENDERER_H_ */
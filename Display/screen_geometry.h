@@ -0,0 +1,69 @@
+/***************************************************************************************
+ * @file        screen_geometry.h
+ * @brief       Screen layout, worked out at build time from the panel size.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The panel size comes from panel.h as PANEL_WIDTH by PANEL_HEIGHT, and the only other
+ * input is the height of the information panel, INFO_PANEL_HEIGHT, which can be set on
+ * the compiler command line. Everything else is derived from those: the radar area is
+ * the rest of the screen, its center is the middle of that area, and the outer range
+ * ring is the largest circle that fits inside it. The projection, the renderer, the
+ * grids and the selection all take their numbers from here, so they can't disagree
+ * about where the radar is, and another panel size is a rebuild.
+ *
+***************************************************************************************/
+
+#ifndef SCREEN_GEOMETRY_H_
+#define SCREEN_GEOMETRY_H_
+
+/************************************Includes***************************************/
+
+#include "./panel.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef INFO_PANEL_HEIGHT
+#define INFO_PANEL_HEIGHT       70
+#endif
+
+#define MIDLINE                 INFO_PANEL_HEIGHT   // first row of the radar area
+
+// Radar area, inclusive
+#define RADAR_LEFT              0
+#define RADAR_RIGHT             (PANEL_WIDTH - 1)
+#define RADAR_TOP               MIDLINE
+#define RADAR_BOTTOM            (PANEL_HEIGHT - 1)
+#define RADAR_WIDTH             (RADAR_RIGHT - RADAR_LEFT + 1)
+#define RADAR_HEIGHT            (RADAR_BOTTOM - RADAR_TOP + 1)
+
+#define RADAR_CENTER_X          (RADAR_LEFT + RADAR_WIDTH / 2)
+#define RADAR_CENTER_Y          (RADAR_TOP + RADAR_HEIGHT / 2)
+
+// The display range lands on the outer ring, the inner one is at half the range
+#define RADAR_RADIUS_PX         (((RADAR_WIDTH < RADAR_HEIGHT) ? RADAR_WIDTH : RADAR_HEIGHT) / 2 - 1)
+#define RADAR_INNER_RADIUS_PX   (RADAR_RADIUS_PX / 2)
+#define RADAR_RADIUS_SQUARED    ((int32_t)RADAR_RADIUS_PX * RADAR_RADIUS_PX)
+
+// Range labels sit just inside the top of each ring
+#define RADAR_LABEL_INSET       15
+
+#if INFO_PANEL_HEIGHT < 70
+#error "The information panel layout needs 70 rows"
+#endif
+
+#if RADAR_RADIUS_PX < 16
+#error "The radar area is too small for the panel size"
+#endif
+
+/*************************************Defines***************************************/
+
+#endif /* SCREEN_GEOMETRY_H_ */
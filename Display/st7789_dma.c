@@ -0,0 +1,374 @@
+/***************************************************************************************
+ * @file        st7789_dma.c
+ * @brief       uDMA-backed SSI pixel streaming for the ST7789 display.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The address window is set with the regular driver, and the first pixel is written on
+ * the CPU so the driver leaves the D/C line in data mode. The SSI is then switched to
+ * 16-bit frames, so one RGB565 pixel is one DMA item and goes out MSB first, which is the
+ * order the panel expects. A fill reads the same halfword over and over, a blit walks
+ * through the source buffer.
+ *
+ * A basic-mode transfer moves at most 1024 items, so longer streams are re-armed from
+ * the SSI interrupt, which is where the uDMA controller reports a finished peripheral
+ * transfer. The waiting thread is only signaled once the last chunk is done.
+ *
+ * A batch sets the address window once for a whole region. Its first blit opens the
+ * window as above, and every blit after it that continues the window row for row is
+ * streamed straight on, with chip select held and the SSI left in 16-bit frames, so the
+ * panel's address counter carries on where the last band ended. A blit or fill that
+ * doesn't continue it closes the batch first.
+ *
+ * Fills too small for a DMA transfer are pushed through the 8-entry TX FIFO in 16-bit
+ * frames, one pixel per write, rather than a byte at a time by the Multimod driver.
+ *
+ * St7789Dma_Init raises SSI3 to ST7789_DMA_SSI_HZ. The ST7789 takes writes at up to
+ * 62.5 MHz, so the limit is the TM4C123's own 25 MHz SSI, and the fastest rate the
+ * even prescaler reaches under it from 80 MHz is 20 MHz.
+ *
+ * St7789Dma_SetPower dims through the brightness register and sleeps with DISPOFF and
+ * SLPIN, which leave the frame memory as it was.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./st7789_dma.h"
+#include "System/dma_table.h"
+
+#include "G8RTOS/G8RTOS.h"
+#include "MultimodDrivers/multimod.h"
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_ssi.h"
+#include "driverlib/ssi.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ST7789_DMA_SSI_BASE     SSI3_BASE           // display SPI bus on the Multimod board
+#define ST7789_DMA_CHANNEL      UDMA_CH15_SSI3TX
+#define ST7789_DMA_MAX_ITEMS    1024
+#define ST7789_DMA_PRESCALE     2       // CPSDVSR, the smallest even prescaler
+
+#define ST7789_DMA_SLPIN        0x10
+#define ST7789_DMA_SLPOUT       0x11
+#define ST7789_DMA_DISPOFF      0x28
+#define ST7789_DMA_DISPON       0x29
+#define ST7789_DMA_WRDISBV      0x51    // display brightness
+#define ST7789_DMA_WRCTRLD      0x53    // brightness control, BCTRL and BL on
+#define ST7789_DMA_CTRLD_ON     0x24
+#define ST7789_DMA_WAKE_MS      5       // after SLPOUT, before the next command
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static semaphore_t sem_dma_done;
+
+static const uint16_t *dma_source;
+static bool dma_source_increment;
+static volatile uint32_t dma_remaining = 0;
+static volatile bool dma_active = false;
+
+static uint16_t dma_fill_color;
+
+// Open batch: its window, the rows still to come and whether the window is set yet
+static bool batch_active = false;
+static bool batch_open = false;
+static int16_t batch_x;
+static int16_t batch_w;
+static int16_t batch_top;           // top row of the next blit, counting down
+static int16_t batch_bottom;
+
+static PanelPower_t panel_power = PANEL_POWER_ON;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void set_frame_size(uint32_t dss) {
+    while (SSIBusy(ST7789_DMA_SSI_BASE));
+
+    SSIDisable(ST7789_DMA_SSI_BASE);
+    HWREG(ST7789_DMA_SSI_BASE + SSI_O_CR0) = (HWREG(ST7789_DMA_SSI_BASE + SSI_O_CR0) & ~SSI_CR0_DSS_M) | dss;
+    SSIEnable(ST7789_DMA_SSI_BASE);
+}
+
+/**
+ * @brief Arms the channel on the next chunk of the stream.
+ */
+static void queue_chunk(void) {
+    uint32_t items = (dma_remaining > ST7789_DMA_MAX_ITEMS) ? ST7789_DMA_MAX_ITEMS : dma_remaining;
+
+    uDMAChannelControlSet(ST7789_DMA_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_16 | UDMA_DST_INC_NONE | UDMA_ARB_4 |
+                          (dma_source_increment ? UDMA_SRC_INC_16 : UDMA_SRC_INC_NONE));
+    uDMAChannelTransferSet(ST7789_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)dma_source, (void *)(ST7789_DMA_SSI_BASE + SSI_O_DR), items);
+
+    if (dma_source_increment)
+        dma_source += items;
+    dma_remaining -= items;
+
+    uDMAChannelEnable(ST7789_DMA_CHANNEL);
+}
+
+/**
+ * @brief Selects the panel, sets a window and leaves the SSI in 16-bit frames.
+ *
+ * The first pixel goes out on the CPU, which leaves D/C selecting data.
+ */
+static void open_window(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t first) {
+    ST7789_Select();
+    ST7789_SetWindow(x, y, w, h);
+
+    ST7789_WriteData(first >> 8);
+    ST7789_WriteData(first & 0xFF);
+
+    set_frame_size(SSI_CR0_DSS_16);
+}
+
+static void close_window(void) {
+    set_frame_size(SSI_CR0_DSS_8);
+    ST7789_Deselect();
+}
+
+/**
+ * @brief Sends `count` pixels into the open window and sleeps until they are on the wire.
+ */
+static void stream(const uint16_t *pixels, uint32_t count, bool increment) {
+    if (count == 0)
+        return;
+
+    dma_source = pixels;
+    dma_source_increment = increment;
+    dma_remaining = count;
+    dma_active = true;
+
+    SSIDMAEnable(ST7789_DMA_SSI_BASE, SSI_DMA_TX);
+    queue_chunk();
+
+    // The CPU is free for other threads until the last chunk finishes
+    G8RTOS_WaitSemaphore(&sem_dma_done);
+
+    SSIDMADisable(ST7789_DMA_SSI_BASE, SSI_DMA_TX);
+}
+
+/**
+ * @brief Closes the open batch, if there is one.
+ */
+static void end_batch(void) {
+    if (batch_open)
+        close_window();
+
+    batch_active = false;
+    batch_open = false;
+}
+
+/**
+ * @brief Raises the SSI clock as far as the panel and the SSI allow, see ST7789_DMA_SSI_HZ.
+ */
+static void set_clock(void) {
+    uint32_t divider = ST7789_DMA_PRESCALE * ST7789_DMA_SSI_HZ;
+    uint32_t scr = (SysCtlClockGet() + divider - 1) / divider - 1;
+
+    while (SSIBusy(ST7789_DMA_SSI_BASE));
+
+    SSIDisable(ST7789_DMA_SSI_BASE);
+    HWREG(ST7789_DMA_SSI_BASE + SSI_O_CPSR) = ST7789_DMA_PRESCALE;
+    HWREG(ST7789_DMA_SSI_BASE + SSI_O_CR0) = (HWREG(ST7789_DMA_SSI_BASE + SSI_O_CR0) & ~SSI_CR0_SCR_M) |
+                                             (scr << SSI_CR0_SCR_S);
+    SSIEnable(ST7789_DMA_SSI_BASE);
+}
+
+/**
+ * @brief Clips a rectangle to the screen.
+ *
+ * @return bool False if nothing is left to draw.
+ */
+static bool clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h) {
+    if (*x < 0) { *w += *x; *x = 0; }
+    if (*y < 0) { *h += *y; *y = 0; }
+    if (*x + *w > X_MAX) *w = X_MAX - *x;
+    if (*y + *h > Y_MAX) *h = Y_MAX - *y;
+
+    return *w > 0 && *h > 0;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up the display's SSI TX uDMA channel.
+ *
+ * Must be called after multimod_init() has configured the display and after
+ * G8RTOS_Init(). INT_SSI3 has to be registered to call St7789Dma_HandleInterrupt.
+ */
+void St7789Dma_Init(void) {
+    G8RTOS_InitSemaphore(&sem_dma_done, 0);
+
+    DMA_Init();
+
+    uDMAChannelAssign(ST7789_DMA_CHANNEL);
+    uDMAChannelAttributeDisable(ST7789_DMA_CHANNEL, UDMA_ATTR_ALTSELECT |
+                                                    UDMA_ATTR_HIGH_PRIORITY |
+                                                    UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(ST7789_DMA_CHANNEL, UDMA_ATTR_USEBURST);
+
+    set_clock();
+}
+
+/**
+ * @brief Services the display SSI interrupt.
+ *
+ * Re-arms the channel while the stream has chunks left, then wakes the drawing thread.
+ */
+void St7789Dma_HandleInterrupt(void) {
+    uint32_t status = SSIIntStatus(ST7789_DMA_SSI_BASE, true);
+    SSIIntClear(ST7789_DMA_SSI_BASE, status);
+
+    if (!dma_active || uDMAChannelIsEnabled(ST7789_DMA_CHANNEL))
+        return;
+
+    if (dma_remaining > 0) {
+        queue_chunk();
+    } else {
+        dma_active = false;
+        G8RTOS_SignalSemaphore(&sem_dma_done);
+    }
+}
+
+/**
+ * @brief Fills a rectangle with one color.
+ *
+ * Must be called with `sem_SPIA` held. Small rectangles go through the TX FIFO.
+ */
+void St7789Dma_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clip(&x, &y, &w, &h))
+        return;
+
+    end_batch();
+
+    uint32_t count = (uint32_t)w * h;
+    open_window(x, y, w, h, color);
+
+    if (count < ST7789_DMA_MIN_PIXELS) {
+        // SSIDataPut waits for a free FIFO entry, so the line never idles
+        for (uint32_t i = 1; i < count; i++) {
+            SSIDataPut(ST7789_DMA_SSI_BASE, color);
+        }
+    } else {
+        dma_fill_color = color;
+        stream(&dma_fill_color, count - 1, false);
+    }
+
+    close_window();
+}
+
+/**
+ * @brief Copies a block of RGB565 pixels to the screen, row by row.
+ *
+ * Must be called with `sem_SPIA` held. The rectangle must lie on the screen and the
+ * buffer must stay untouched until the call returns.
+ */
+void St7789Dma_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    if (w <= 0 || h <= 0)
+        return;
+
+    uint32_t count = (uint32_t)w * h;
+
+    // The next rows of the batch window, where the panel's address counter already is
+    if (batch_active && x == batch_x && w == batch_w && y + h - 1 == batch_top && y >= batch_bottom) {
+        if (batch_open) {
+            stream(pixels, count, true);
+        } else {
+            open_window(batch_x, batch_bottom, batch_w, batch_top - batch_bottom + 1, pixels[0]);
+            stream(pixels + 1, count - 1, true);
+            batch_open = true;
+        }
+
+        batch_top = y - 1;
+        return;
+    }
+
+    end_batch();
+
+    open_window(x, y, w, h, pixels[0]);
+    stream(pixels + 1, count - 1, true);
+    close_window();
+}
+
+/**
+ * @brief Starts a batch of blits that fill a window top row first, see the file header.
+ *
+ * Must be called with `sem_SPIA` held, and ended with St7789Dma_EndBatch before it is
+ * released. The window must lie on the screen.
+ */
+void St7789Dma_BeginBatch(int16_t x, int16_t y, int16_t w, int16_t h) {
+    end_batch();
+
+    if (w <= 0 || h <= 0)
+        return;
+
+    batch_active = true;
+    batch_x = x;
+    batch_w = w;
+    batch_top = y + h - 1;
+    batch_bottom = y;
+}
+
+/**
+ * @brief Ends the batch and releases the bus, whether or not every row was sent.
+ */
+void St7789Dma_EndBatch(void) {
+    end_batch();
+}
+
+/**
+ * @brief Dims, sleeps or wakes the panel.
+ *
+ * Must be called with `sem_SPIA` held, from a thread: waking sleeps ST7789_DMA_WAKE_MS.
+ */
+void St7789Dma_SetPower(PanelPower_t power) {
+    if (power == panel_power)
+        return;
+
+    end_batch();
+    ST7789_Select();
+
+    if (panel_power == PANEL_POWER_SLEEP) {
+        ST7789_WriteCommand(ST7789_DMA_SLPOUT);
+        sleep(ST7789_DMA_WAKE_MS);
+        ST7789_WriteCommand(ST7789_DMA_DISPON);
+    }
+
+    if (power == PANEL_POWER_SLEEP) {
+        ST7789_WriteCommand(ST7789_DMA_DISPOFF);
+        ST7789_WriteCommand(ST7789_DMA_SLPIN);
+    } else {
+        ST7789_WriteCommand(ST7789_DMA_WRCTRLD);
+        ST7789_WriteData(ST7789_DMA_CTRLD_ON);
+        ST7789_WriteCommand(ST7789_DMA_WRDISBV);
+        ST7789_WriteData((power == PANEL_POWER_DIM) ? PANEL_BRIGHTNESS_DIM : PANEL_BRIGHTNESS_FULL);
+    }
+
+    while (SSIBusy(ST7789_DMA_SSI_BASE));
+    ST7789_Deselect();
+
+    panel_power = power;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,61 @@
+/***************************************************************************************
+ * @file        st7789_dma.h
+ * @brief       uDMA-backed SSI pixel streaming for the ST7789 display.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Large rectangle fills and pixel blits are streamed to the display over uDMA instead
+ * of being pushed byte by byte by the CPU. The calling thread sleeps on a completion
+ * semaphore while the pixels go out, so the parser and the selection thread get the CPU
+ * back for the whole transfer.
+ *
+ * Both calls share the display's SPI bus with the CPU-driven ST7789 functions, so they
+ * must be made with `sem_SPIA` held, like any other drawing.
+ *
+ * St7789Dma_BeginBatch and St7789Dma_EndBatch bracket blits that tile one window top
+ * row first, the bands of the strip renderer. The window is set once and chip select
+ * held for all of them, so a band costs its pixels and nothing else.
+ *
+***************************************************************************************/
+
+#ifndef ST7789_DMA_H_
+#define ST7789_DMA_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./panel.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ST7789_DMA_MIN_PIXELS   64   // smaller fills are cheaper on the CPU than setting up a transfer
+#define ST7789_DMA_SSI_HZ       20000000
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void St7789Dma_Init(void);
+void St7789Dma_HandleInterrupt(void);
+
+void St7789Dma_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void St7789Dma_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
+void St7789Dma_BeginBatch(int16_t x, int16_t y, int16_t w, int16_t h);
+void St7789Dma_EndBatch(void);
+
+void St7789Dma_SetPower(PanelPower_t power);
+
+/********************************Public Functions***********************************/
+
+#endif /* ST7789_DMA_H_ */
@@ -0,0 +1,492 @@
+/***************************************************************************************
+ * @file        strip_renderer.c
+ * @brief       Strip-buffered rasterizer for the radar area.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Screen Y grows towards the top of the panel, as with the ST7789 driver, while pixels
+ * in an address window stream from the top row down. The buffer is therefore stored top
+ * row first, and buffer row 0 is the band's highest Y.
+ *
+ * Glyphs use the classic 5x7 column font, one byte per column with the least significant
+ * bit on top, and advance FONT_WIDTH + 1 pixels like ST7789_DrawString.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./strip_renderer.h"
+
+#include <stdlib.h>
+
+#include "MultimodDrivers/multimod.h"
+#include "MultimodDrivers/font.h"
+#include "System/arena.h"
+#include "System/ramfunc.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define GLYPH_FIRST         0x20
+#define GLYPH_LAST          0x7E
+#define GLYPH_COLUMNS       5
+#define GLYPH_ROWS          STRIP_GLYPH_ROWS
+
+#if STRIP_PIXELS < PANEL_WIDTH
+#error "STRIP_PIXELS must hold at least one full row of the panel"
+#endif
+
+#if STRIP_RING_RADIUS > UINT8_MAX
+#error "Mask runs are kept in a byte a row"
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint16_t *strip;     // STRIP_PIXELS, carved from the arena
+
+// Half-width of each row of the small filled circles used for aircraft symbols
+static uint8_t circle_spans[STRIP_SPRITE_RADIUS + 1][STRIP_SPRITE_RADIUS + 1];
+static bool circle_spans_ready = false;
+
+static const uint8_t glyphs[GLYPH_LAST - GLYPH_FIRST + 1][GLYPH_COLUMNS] = {
+    {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00},
+    {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, {0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33},
+    {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07},
+    {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, {0x00,0x40,0x34,0x00,0x00},
+    {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06},
+    {0x3E,0x41,0x5D,0x59,0x4E}, {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x41,0x51,0x73},
+    {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x26,0x49,0x49,0x49,0x32},
+    {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+    {0x63,0x14,0x08,0x14,0x63}, {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41},
+    {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x03,0x07,0x08,0x00}, {0x20,0x54,0x54,0x78,0x40}, {0x7F,0x28,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x28},
+    {0x38,0x44,0x44,0x28,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x00,0x08,0x7E,0x09,0x02}, {0x18,0xA4,0xA4,0x9C,0x78},
+    {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x40,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+    {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x78,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+    {0xFC,0x18,0x24,0x24,0x18}, {0x18,0x24,0x24,0x18,0xFC}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x24},
+    {0x04,0x04,0x3F,0x44,0x24}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44}, {0x4C,0x90,0x90,0x90,0x7C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x77,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x02,0x01,0x02,0x04,0x02},
+};
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static bool inside(const StripCanvas_t *canvas, int16_t x, int16_t y) {
+    return x >= canvas->box.x0 && x <= canvas->box.x1 && y >= canvas->box.y0 && y <= canvas->box.y1;
+}
+
+static uint16_t *pixel_at(const StripCanvas_t *canvas, int16_t x, int16_t y) {
+    return &canvas->pixels[(canvas->box.y1 - y) * canvas->width + (x - canvas->box.x0)];
+}
+
+RAMFUNC static void span(const StripCanvas_t *canvas, int16_t x0, int16_t x1, int16_t y, uint16_t color) {
+    if (y < canvas->box.y0 || y > canvas->box.y1)
+        return;
+    if (x0 < canvas->box.x0) x0 = canvas->box.x0;
+    if (x1 > canvas->box.x1) x1 = canvas->box.x1;
+
+    uint16_t *pixel = pixel_at(canvas, x0, y);
+    for (int16_t x = x0; x <= x1; x++) {
+        *pixel++ = color;
+    }
+}
+
+static int16_t half_width(int16_t r, int16_t dy) {
+    int16_t dx = 0;
+    while ((dx + 1) * (dx + 1) + dy * dy <= r * r) {
+        dx++;
+    }
+    return dx;
+}
+
+static void mask_include(StripMask_t *mask, uint8_t shape, uint8_t dx, uint8_t dy) {
+    if (dx < mask->inner[dy][shape]) mask->inner[dy][shape] = dx;
+    if (dx > mask->outer[dy][shape]) mask->outer[dy][shape] = dx;
+}
+
+/**
+ * @brief Takes the next shape of a mask, widening the mask to its radius.
+ *
+ * @return int16_t The shape, or -1 if the mask is full or the radius too large.
+ */
+static int16_t mask_shape(StripMask_t *mask, int16_t r) {
+    if (mask->shapes >= STRIP_MASK_SHAPES || r < 0 || r > STRIP_RING_RADIUS)
+        return -1;
+
+    if (r > mask->radius)
+        mask->radius = r;
+    return mask->shapes++;
+}
+
+static void build_circle_spans(void) {
+    for (int16_t r = 0; r <= STRIP_SPRITE_RADIUS; r++) {
+        for (int16_t dy = 0; dy <= r; dy++) {
+            circle_spans[r][dy] = half_width(r, dy);
+        }
+    }
+    circle_spans_ready = true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Column bitmap of a character, least significant bit on top.
+ */
+const uint8_t *StripRenderer_Glyph(char c) {
+    return glyphs[(c >= GLYPH_FIRST && c <= GLYPH_LAST) ? (c - GLYPH_FIRST) : 0];
+}
+
+bool StripBox_Overlaps(const StripBox_t *a, const StripBox_t *b) {
+    return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+/**
+ * @brief Carves the strip buffer out of the arena.
+ *
+ * Must be called once, before the scheduler is launched.
+ */
+void StripRenderer_Init(void) {
+    strip = Arena_Alloc(STRIP_PIXELS * sizeof(uint16_t), "Strip");
+}
+
+/**
+ * @brief Renders a region of the screen band by band.
+ *
+ * Must be called with `sem_SPIA` held. Every band is cleared to `background` before the
+ * painter runs, and sent as soon as the painter returns.
+ */
+RAMFUNC void StripRenderer_Render(const StripBox_t *region, uint16_t background, StripPainter_t painter) {
+    StripBox_t area = *region;
+
+    if (area.x0 < 0) area.x0 = 0;
+    if (area.y0 < 0) area.y0 = 0;
+    if (area.x1 >= PANEL_WIDTH) area.x1 = PANEL_WIDTH - 1;
+    if (area.y1 >= PANEL_HEIGHT) area.y1 = PANEL_HEIGHT - 1;
+    if (area.x0 > area.x1 || area.y0 > area.y1)
+        return;
+
+    StripCanvas_t canvas;
+    canvas.pixels = strip;
+    canvas.width = area.x1 - area.x0 + 1;
+
+    // A narrow region fits more rows in the same buffer
+    int16_t band_rows = STRIP_PIXELS / canvas.width;
+
+    // The bands tile the region top first, the panel can take them as one window
+    Panel_BeginBatch(area.x0, area.y0, canvas.width, area.y1 - area.y0 + 1);
+
+    for (int16_t top = area.y1; top >= area.y0; top -= band_rows) {
+        canvas.box.x0 = area.x0;
+        canvas.box.x1 = area.x1;
+        canvas.box.y1 = top;
+        canvas.box.y0 = (top - band_rows + 1 > area.y0) ? (top - band_rows + 1) : area.y0;
+
+        int16_t rows = canvas.box.y1 - canvas.box.y0 + 1;
+        uint32_t count = (uint32_t)rows * canvas.width;
+        for (uint32_t i = 0; i < count; i++) {
+            strip[i] = background;
+        }
+
+        painter(&canvas);
+
+        Panel_BlitRectangle(canvas.box.x0, canvas.box.y0, canvas.width, rows, strip);
+    }
+
+    Panel_EndBatch();
+}
+
+void StripCanvas_Pixel(const StripCanvas_t *canvas, int16_t x, int16_t y, uint16_t color) {
+    if (inside(canvas, x, y))
+        *pixel_at(canvas, x, y) = color;
+}
+
+/**
+ * @brief Empties a mask, every row of every shape unused.
+ */
+void StripMask_Clear(StripMask_t *mask) {
+    mask->radius = 0;
+    mask->shapes = 0;
+    for (int16_t dy = 0; dy <= STRIP_RING_RADIUS; dy++) {
+        for (uint8_t shape = 0; shape < STRIP_MASK_SHAPES; shape++) {
+            mask->inner[dy][shape] = UINT8_MAX;
+            mask->outer[dy][shape] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Adds the outline StripCanvas_Circle draws, from the midpoint circle.
+ *
+ * Every row of a midpoint circle is a single run of pixels either side of the center,
+ * so two bytes a row describe it.
+ *
+ * @param r Radius, at most STRIP_RING_RADIUS.
+ * @return bool False if the mask has no shape left for it.
+ */
+bool StripMask_AddRing(StripMask_t *mask, int16_t r) {
+    int16_t shape = mask_shape(mask, r);
+    if (shape < 0)
+        return false;
+
+    int16_t f = 1 - r;
+    int16_t ddf_x = 1;
+    int16_t ddf_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    mask_include(mask, shape, 0, r);
+    mask_include(mask, shape, r, 0);
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddf_y += 2;
+            f += ddf_y;
+        }
+        x++;
+        ddf_x += 2;
+        f += ddf_x;
+
+        mask_include(mask, shape, x, y);
+        mask_include(mask, shape, y, x);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Adds the filled circle StripCanvas_FillCircle draws.
+ *
+ * @return bool False if the mask has no shape left for it.
+ */
+bool StripMask_AddDisc(StripMask_t *mask, int16_t r) {
+    int16_t shape = mask_shape(mask, r);
+    if (shape < 0)
+        return false;
+
+    for (int16_t dy = 0; dy <= r; dy++) {
+        mask->inner[dy][shape] = 0;
+        mask->outer[dy][shape] = half_width(r, dy);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Circle outline, the same midpoint circle ST7789_DrawCircle draws.
+ */
+void StripCanvas_Circle(const StripCanvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    if (cx + r < canvas->box.x0 || cx - r > canvas->box.x1 || cy + r < canvas->box.y0 || cy - r > canvas->box.y1)
+        return;
+
+    int16_t f = 1 - r;
+    int16_t ddf_x = 1;
+    int16_t ddf_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    StripCanvas_Pixel(canvas, cx, cy + r, color);
+    StripCanvas_Pixel(canvas, cx, cy - r, color);
+    StripCanvas_Pixel(canvas, cx + r, cy, color);
+    StripCanvas_Pixel(canvas, cx - r, cy, color);
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddf_y += 2;
+            f += ddf_y;
+        }
+        x++;
+        ddf_x += 2;
+        f += ddf_x;
+
+        StripCanvas_Pixel(canvas, cx + x, cy + y, color);
+        StripCanvas_Pixel(canvas, cx - x, cy + y, color);
+        StripCanvas_Pixel(canvas, cx + x, cy - y, color);
+        StripCanvas_Pixel(canvas, cx - x, cy - y, color);
+        StripCanvas_Pixel(canvas, cx + y, cy + x, color);
+        StripCanvas_Pixel(canvas, cx - y, cy + x, color);
+        StripCanvas_Pixel(canvas, cx + y, cy - x, color);
+        StripCanvas_Pixel(canvas, cx - y, cy - x, color);
+    }
+}
+
+/**
+ * @brief Every shape of a mask, two spans a shape on each row that falls inside the band.
+ *
+ * Draws the same pixels as StripCanvas_Circle and StripCanvas_FillCircle would for its
+ * shapes, without any circle math.
+ */
+void StripCanvas_Mask(const StripCanvas_t *canvas, int16_t cx, int16_t cy, const StripMask_t *mask, uint16_t color) {
+    int16_t r = mask->radius;
+    int16_t y0 = (cy - r > canvas->box.y0) ? (cy - r) : canvas->box.y0;
+    int16_t y1 = (cy + r < canvas->box.y1) ? (cy + r) : canvas->box.y1;
+
+    for (int16_t y = y0; y <= y1; y++) {
+        int16_t dy = abs(y - cy);
+        for (uint8_t shape = 0; shape < mask->shapes; shape++) {
+            uint8_t inner = mask->inner[dy][shape];
+            uint8_t outer = mask->outer[dy][shape];
+            if (inner > outer)
+                continue;
+
+            span(canvas, cx + inner, cx + outer, y, color);
+            span(canvas, cx - outer, cx - inner, y, color);
+        }
+    }
+}
+
+/**
+ * @brief Filled circle, one span per row that falls inside the band.
+ *
+ * Symbol-sized circles read their spans from a table built once, so drawing one is a
+ * handful of span fills.
+ */
+void StripCanvas_FillCircle(const StripCanvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    int16_t y0 = (cy - r > canvas->box.y0) ? (cy - r) : canvas->box.y0;
+    int16_t y1 = (cy + r < canvas->box.y1) ? (cy + r) : canvas->box.y1;
+
+    if (r <= STRIP_SPRITE_RADIUS && !circle_spans_ready)
+        build_circle_spans();
+
+    for (int16_t y = y0; y <= y1; y++) {
+        int16_t dy = abs(y - cy);
+        int16_t dx = (r <= STRIP_SPRITE_RADIUS) ? circle_spans[r][dy] : half_width(r, dy);
+        span(canvas, cx - dx, cx + dx, y, color);
+    }
+}
+
+/**
+ * @brief Bresenham line that only plots every `gap`th pixel.
+ *
+ * Only the dots inside the band are written. Rows and columns only ever move one way
+ * along the line, so stepping stops as soon as the line has left the band, and a band
+ * that the line only grazes costs a few steps rather than the whole line.
+ */
+void StripCanvas_DottedLine(const StripCanvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color, int16_t gap) {
+    const StripBox_t *box = &canvas->box;
+    int16_t min_x = (x0 < x1) ? x0 : x1;
+    int16_t max_x = (x0 < x1) ? x1 : x0;
+    int16_t min_y = (y0 < y1) ? y0 : y1;
+    int16_t max_y = (y0 < y1) ? y1 : y0;
+    if (max_x < box->x0 || min_x > box->x1 || max_y < box->y0 || min_y > box->y1)
+        return;
+
+    int16_t dx = abs(x1 - x0);
+    int16_t dy = -abs(y1 - y0);
+    int16_t sx = (x0 < x1) ? 1 : -1;
+    int16_t sy = (y0 < y1) ? 1 : -1;
+    int16_t error = dx + dy;
+
+    // Where the line leaves the band for good, one past its last row and column in it
+    int16_t exit_x = (sx > 0) ? box->x1 + 1 : box->x0 - 1;
+    int16_t exit_y = (sy > 0) ? box->y1 + 1 : box->y0 - 1;
+
+    // Counts down to the next dot, so no division per step
+    int16_t dot = 0;
+
+    while (x0 != exit_x && y0 != exit_y) {
+        if (dot == 0) {
+            dot = gap;
+            if (inside(canvas, x0, y0))
+                *pixel_at(canvas, x0, y0) = color;
+        }
+        dot--;
+
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int16_t twice = 2 * error;
+        if (twice >= dy) {
+            error += dy;
+            x0 += sx;
+        }
+        if (twice <= dx) {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * @brief Text with a solid background, laid out like ST7789_DrawString.
+ *
+ * Fine for the odd short string. Labels drawn every frame should be rasterized once and
+ * drawn with StripCanvas_Bitmap.
+ *
+ * @param x      Left edge of the first character.
+ * @param y      Bottom row of the text.
+ * @param length Maximum number of characters, the string may end earlier.
+ */
+void StripCanvas_String(const StripCanvas_t *canvas, int16_t x, int16_t y, const char *str, int16_t length,
+                        uint16_t fg, uint16_t bg) {
+    const int16_t advance = FONT_WIDTH + 1;
+
+    if (y + GLYPH_ROWS - 1 < canvas->box.y0 || y > canvas->box.y1)
+        return;
+
+    for (int16_t i = 0; i < length && str[i] != '\0'; i++, x += advance) {
+        if (x + advance - 1 < canvas->box.x0 || x > canvas->box.x1)
+            continue;
+
+        const uint8_t *glyph = StripRenderer_Glyph(str[i]);
+
+        for (int16_t column = 0; column < advance; column++) {
+            uint8_t bits = (column < GLYPH_COLUMNS) ? glyph[column] : 0;
+
+            // Bit 0 is the top row of the glyph
+            for (int16_t row = 0; row < GLYPH_ROWS; row++) {
+                StripCanvas_Pixel(canvas, x + column, y + GLYPH_ROWS - 1 - row, (bits & (1 << row)) ? fg : bg);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Two-color 1 bpp bitmap, clipped once and written a row span at a time.
+ *
+ * @param x      Left edge of the bitmap.
+ * @param y      Bottom row of the bitmap.
+ * @param rows   Bitmap rows, top row first, most significant bit leftmost.
+ * @param stride Bytes per bitmap row.
+ */
+void StripCanvas_Bitmap(const StripCanvas_t *canvas, int16_t x, int16_t y, const uint8_t *rows,
+                        int16_t width, int16_t height, int16_t stride, uint16_t fg, uint16_t bg) {
+    int16_t top = y + height - 1;
+    int16_t x0 = (x > canvas->box.x0) ? x : canvas->box.x0;
+    int16_t x1 = (x + width - 1 < canvas->box.x1) ? (x + width - 1) : canvas->box.x1;
+    int16_t y0 = (y > canvas->box.y0) ? y : canvas->box.y0;
+    int16_t y1 = (top < canvas->box.y1) ? top : canvas->box.y1;
+
+    for (int16_t py = y1; py >= y0; py--) {
+        const uint8_t *row = rows + (top - py) * stride;
+        uint16_t *pixel = pixel_at(canvas, x0, py);
+
+        for (int16_t px = x0; px <= x1; px++) {
+            int16_t column = px - x;
+            *pixel++ = (row[column >> 3] & (0x80 >> (column & 7))) ? fg : bg;
+        }
+    }
+}
+
+/********************************Public Functions***********************************/
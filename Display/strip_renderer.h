@@ -0,0 +1,108 @@
+/***************************************************************************************
+ * @file        strip_renderer.h
+ * @brief       Strip-buffered rasterizer for the radar area.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * There is no room for a framebuffer, so a region of the screen is rendered as a stack
+ * of horizontal bands into one small RGB565 buffer. For each band the buffer is cleared,
+ * a painter callback rasterizes the scene into it through the canvas primitives below,
+ * and the band is sent with one address window and one DMA burst. Nothing reaches the
+ * panel half drawn, and there is no per-primitive command overhead.
+ *
+ * Canvas primitives clip to the band, so a painter can simply draw the whole scene and
+ * only the parts inside the band land in the buffer.
+ *
+ * Static outlines around one center, the range rings and the center dot, are kept as a
+ * StripMask_t: a run per shape on each row, built once with the midpoint circle. A band
+ * composites it with a few span fills a row and no circle math at all, which is also
+ * all it costs to restore a piece of ring an aircraft was erased from.
+ *
+***************************************************************************************/
+
+#ifndef STRIP_RENDERER_H_
+#define STRIP_RENDERER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./panel.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define STRIP_PIXELS        960  // 1.9 KB of RGB565, 4 rows of the ST7789, 3 of the ILI9488
+
+#define STRIP_GLYPH_ROWS    8
+#define STRIP_GLYPH_ADVANCE 6    // FONT_WIDTH + 1, like ST7789_DrawString
+#define STRIP_SPRITE_RADIUS 5    // filled circles up to this radius come from a span table
+#define STRIP_RING_RADIUS   (((PANEL_WIDTH < PANEL_HEIGHT) ? PANEL_WIDTH : PANEL_HEIGHT) / 2)
+#define STRIP_MASK_SHAPES   3    // the two range rings and the center dot
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t x0;     // inclusive bounds in screen pixels
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} StripBox_t;
+
+// One band being rendered
+typedef struct {
+    uint16_t *pixels;
+    StripBox_t box;
+    int16_t width;
+} StripCanvas_t;
+
+// Concentric rings and discs worked out once, as the run each covers on every row right
+// of the center. A row a shape doesn't reach has inner > outer.
+typedef struct {
+    int16_t radius;                                         // of the largest shape
+    uint8_t shapes;
+    uint8_t inner[STRIP_RING_RADIUS + 1][STRIP_MASK_SHAPES]; // by rows from the center
+    uint8_t outer[STRIP_RING_RADIUS + 1][STRIP_MASK_SHAPES];
+} StripMask_t;
+
+typedef void (*StripPainter_t)(const StripCanvas_t *canvas);
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void StripRenderer_Init(void);
+void StripRenderer_Render(const StripBox_t *region, uint16_t background, StripPainter_t painter);
+
+bool StripBox_Overlaps(const StripBox_t *a, const StripBox_t *b);
+
+void StripMask_Clear(StripMask_t *mask);
+bool StripMask_AddRing(StripMask_t *mask, int16_t r);
+bool StripMask_AddDisc(StripMask_t *mask, int16_t r);
+
+void StripCanvas_Pixel(const StripCanvas_t *canvas, int16_t x, int16_t y, uint16_t color);
+void StripCanvas_Circle(const StripCanvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t color);
+void StripCanvas_Mask(const StripCanvas_t *canvas, int16_t cx, int16_t cy, const StripMask_t *mask, uint16_t color);
+void StripCanvas_FillCircle(const StripCanvas_t *canvas, int16_t cx, int16_t cy, int16_t r, uint16_t color);
+void StripCanvas_DottedLine(const StripCanvas_t *canvas, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                            uint16_t color, int16_t gap);
+void StripCanvas_String(const StripCanvas_t *canvas, int16_t x, int16_t y, const char *str, int16_t length,
+                        uint16_t fg, uint16_t bg);
+void StripCanvas_Bitmap(const StripCanvas_t *canvas, int16_t x, int16_t y, const uint8_t *rows,
+                        int16_t width, int16_t height, int16_t stride, uint16_t fg, uint16_t bg);
+
+const uint8_t *StripRenderer_Glyph(char c);
+
+/********************************Public Functions***********************************/
+
+#endif /* STRIP_RENDERER_H_ */
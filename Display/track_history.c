@@ -0,0 +1,192 @@
+/***************************************************************************************
+ * @file        track_history.c
+ * @brief       Pooled breadcrumb trails behind aircraft on the radar.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./track_history.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "threads.h"
+#include "MultimodDrivers/multimod.h"
+#include "System/arena.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define POINT_MASK      (TRACK_HISTORY_POINTS - 1)
+
+#if (TRACK_HISTORY_POINTS & POINT_MASK) != 0
+#error "TRACK_HISTORY_POINTS must be a power of two"
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static Trail_t *trails;     // TRACK_HISTORY_RINGS, carved from the arena
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint8_t point_at(const Trail_t *trail, uint8_t age) {
+    return (trail->head - 1 - age) & POINT_MASK;
+}
+
+static StripBox_t segment_box(const Trail_t *trail, uint8_t a, uint8_t b) {
+    StripBox_t box;
+    box.x0 = (trail->x[a] < trail->x[b]) ? trail->x[a] : trail->x[b];
+    box.x1 = (trail->x[a] < trail->x[b]) ? trail->x[b] : trail->x[a];
+    box.y0 = MIDLINE + ((trail->y[a] < trail->y[b]) ? trail->y[a] : trail->y[b]);
+    box.y1 = MIDLINE + ((trail->y[a] < trail->y[b]) ? trail->y[b] : trail->y[a]);
+    return box;
+}
+
+static Trail_t *find_trail(uint32_t icao24) {
+    Trail_t *free_trail = NULL;
+
+    for (int16_t i = 0; i < TRACK_HISTORY_RINGS; i++) {
+        if (trails[i].count == 0) {
+            if (free_trail == NULL)
+                free_trail = &trails[i];
+        } else if (trails[i].icao24 == icao24) {
+            return &trails[i];
+        }
+    }
+
+    // Claim a free ring for an aircraft that doesn't have one yet
+    if (free_trail != NULL) {
+        free_trail->icao24 = icao24;
+        free_trail->head = 0;
+    }
+    return free_trail;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Carves the pool out of the arena, with every ring free.
+ *
+ * Must be called once, before the scheduler is launched.
+ */
+void TrackHistory_Init(void) {
+    trails = Arena_Alloc(TRACK_HISTORY_RINGS * sizeof(Trail_t), "Trails");
+}
+
+/**
+ * @brief Returns every ring to the pool without reporting damage.
+ *
+ * For when the radar is about to be repainted anyway.
+ */
+void TrackHistory_Clear(void) {
+    memset(trails, 0, TRACK_HISTORY_RINGS * sizeof(Trail_t));
+}
+
+/**
+ * @brief Notes where an on-screen aircraft is this frame.
+ *
+ * @param damage Told about the segments that appear or disappear.
+ * @return bool False if `damage` could not take a box.
+ */
+bool TrackHistory_Record(uint32_t icao24, int16_t x, int16_t y, TrackDamage_t damage) {
+    Trail_t *trail = find_trail(icao24);
+    if (trail == NULL)
+        return true;
+
+    trail->seen = true;
+
+    if (x < 0 || x >= PANEL_WIDTH || y < MIDLINE || y >= PANEL_HEIGHT)
+        return true;
+
+    bool ok = true;
+
+    if (trail->count > 0) {
+        uint8_t newest = point_at(trail, 0);
+        if (abs(x - trail->x[newest]) < TRACK_HISTORY_STEP && abs(y - MIDLINE - trail->y[newest]) < TRACK_HISTORY_STEP)
+            return true;
+
+        // The oldest segment goes when the ring is full
+        if (trail->count == TRACK_HISTORY_POINTS) {
+            uint8_t oldest = point_at(trail, TRACK_HISTORY_POINTS - 1);
+            ok = damage(segment_box(trail, oldest, point_at(trail, TRACK_HISTORY_POINTS - 2)));
+            trail->count--;
+        }
+    }
+
+    trail->x[trail->head] = x;
+    trail->y[trail->head] = y - MIDLINE;
+    trail->head = (trail->head + 1) & POINT_MASK;
+    trail->count++;
+
+    if (trail->count > 1)
+        ok = damage(segment_box(trail, point_at(trail, 1), point_at(trail, 0))) && ok;
+
+    return ok;
+}
+
+/**
+ * @brief Frees the rings of aircraft that weren't recorded since the last sweep.
+ *
+ * Called once a frame after every on-screen aircraft has been recorded.
+ *
+ * @return bool False if `damage` could not take a box.
+ */
+bool TrackHistory_Sweep(TrackDamage_t damage) {
+    bool ok = true;
+
+    for (int16_t i = 0; i < TRACK_HISTORY_RINGS; i++) {
+        Trail_t *trail = &trails[i];
+        if (trail->count == 0)
+            continue;
+
+        if (!trail->seen) {
+            StripBox_t box = segment_box(trail, point_at(trail, 0), point_at(trail, 0));
+            for (uint8_t age = 1; age < trail->count; age++) {
+                StripBox_t segment = segment_box(trail, point_at(trail, age), point_at(trail, age));
+                if (segment.x0 < box.x0) box.x0 = segment.x0;
+                if (segment.y0 < box.y0) box.y0 = segment.y0;
+                if (segment.x1 > box.x1) box.x1 = segment.x1;
+                if (segment.y1 > box.y1) box.y1 = segment.y1;
+            }
+            ok = damage(box) && ok;
+            trail->count = 0;
+        }
+
+        trail->seen = false;
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Draws the parts of every trail that fall in a band.
+ */
+void TrackHistory_Paint(const StripCanvas_t *canvas, uint16_t color) {
+    for (int16_t i = 0; i < TRACK_HISTORY_RINGS; i++) {
+        const Trail_t *trail = &trails[i];
+
+        for (uint8_t age = 1; age < trail->count; age++) {
+            uint8_t a = point_at(trail, age);
+            uint8_t b = point_at(trail, age - 1);
+            StripCanvas_DottedLine(canvas, trail->x[a], MIDLINE + trail->y[a], trail->x[b], MIDLINE + trail->y[b],
+                                   color, 1);
+        }
+    }
+}
+
+/********************************Public Functions***********************************/
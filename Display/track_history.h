@@ -0,0 +1,82 @@
+/***************************************************************************************
+ * @file        track_history.h
+ * @brief       Pooled breadcrumb trails behind aircraft on the radar.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Each trail is a ring of the last TRACK_HISTORY_POINTS screen positions of one aircraft,
+ * two bytes a point on the ST7789 and four on the larger ILI9488. Rings come from a
+ * fixed pool and are keyed by ICAO24, so they follow an aircraft across buffer swaps
+ * and slot moves without any relinking. An aircraft only gets a ring while one is
+ * free. A ring goes back to the pool the first frame its aircraft is not on screen.
+ *
+ * A point is added once an aircraft has moved TRACK_HISTORY_STEP pixels. Only the new
+ * segment, and the oldest one when the ring is full, are reported as damage, so a trail
+ * costs one short segment per update no matter how long it is. Points are in pixels, so
+ * trails are dropped when the display range changes.
+ *
+***************************************************************************************/
+
+#ifndef TRACK_HISTORY_H_
+#define TRACK_HISTORY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./strip_renderer.h"
+#include "./screen_geometry.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define TRACK_HISTORY_POINTS    16   // points per trail
+#define TRACK_HISTORY_RINGS     16   // trails in the pool
+#define TRACK_HISTORY_STEP      3    // pixels moved before a point is added
+
+/*************************************Defines***************************************/
+
+// A byte a coordinate while the radar area allows it, as on the ST7789
+#if PANEL_WIDTH > 256 || RADAR_HEIGHT > 256
+typedef uint16_t TrailCoordinate_t;
+#else
+typedef uint8_t TrailCoordinate_t;
+#endif
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t icao24;
+    uint8_t head;                       // where the next point goes
+    uint8_t count;                      // points held, 0 when the ring is free
+    bool seen;                          // recorded since the last sweep
+    TrailCoordinate_t x[TRACK_HISTORY_POINTS];
+    TrailCoordinate_t y[TRACK_HISTORY_POINTS];  // rows below MIDLINE
+} Trail_t;
+
+// Records a damaged box, false once the caller can't take any more
+typedef bool (*TrackDamage_t)(StripBox_t box);
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void TrackHistory_Init(void);
+void TrackHistory_Clear(void);
+
+bool TrackHistory_Record(uint32_t icao24, int16_t x, int16_t y, TrackDamage_t damage);
+bool TrackHistory_Sweep(TrackDamage_t damage);
+
+void TrackHistory_Paint(const StripCanvas_t *canvas, uint16_t color);
+
+/********************************Public Functions***********************************/
+
+#endif /* TRACK_HISTORY_H_ */
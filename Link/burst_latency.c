@@ -0,0 +1,175 @@
+/***************************************************************************************
+ * @file        burst_latency.c
+ * @brief       Times each burst from its first frame to the pixels showing it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./burst_latency.h"
+#include "./uart_tx.h"
+#include "System/clock.h"
+#include "System/log.h"
+
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    bool active;
+    uint32_t sequence;
+    uint32_t host_ms;
+    uint32_t first_ms;      // first frame parsed
+    uint32_t end_ms;        // end-of-burst parsed
+    uint32_t published_ms;  // data live
+} BurstStamp_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+// One burst per stage, a later burst can be receiving while an earlier one is drawn
+static BurstStamp_t receiving;
+static BurstStamp_t ended;
+static BurstStamp_t published;
+
+static ProtocolLatency_t report;
+static bool report_pending = false;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint16_t stage_ms(uint32_t from, uint32_t to) {
+    uint32_t elapsed = to - from;
+    return (elapsed > UINT16_MAX) ? UINT16_MAX : elapsed;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Notes a data frame, the first one since the last end-of-burst starts the clock.
+ */
+void BurstLatency_FrameReceived(void) {
+    if (!receiving.active) {
+        receiving.first_ms = Clock_Millis();
+        receiving.active = true;
+    }
+}
+
+/**
+ * @brief Ends the receive stage of the burst in progress.
+ *
+ * @param burst_end The burst's end frame, for its sequence number and host timestamp.
+ */
+void BurstLatency_BurstEnd(const ProtocolBurstEnd_t *burst_end) {
+    uint32_t now = Clock_Millis();
+
+    // An empty burst still gets timed from here
+    if (!receiving.active)
+        receiving.first_ms = now;
+    receiving.active = true;
+
+    receiving.sequence = burst_end->sequence;
+    receiving.host_ms = burst_end->host_ms;
+    receiving.end_ms = now;
+
+    bool masked = IntMasterDisable();
+    ended = receiving;
+    if (!masked)
+        IntMasterEnable();
+
+    receiving.active = false;
+}
+
+/**
+ * @brief Marks the last ended burst as live, so the next frame drawn will show it.
+ */
+void BurstLatency_Published(void) {
+    bool masked = IntMasterDisable();
+
+    if (ended.active) {
+        published = ended;
+        published.published_ms = Clock_Millis();
+        ended.active = false;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Asks whether the frame about to be drawn is the first to show a burst.
+ *
+ * Call with the live store locked, so nothing can be published between this and drawing.
+ *
+ * @param sequence Set to the burst's sequence number, to pass to BurstLatency_Drawn.
+ * @return bool True if a burst is waiting to be drawn.
+ */
+bool BurstLatency_ClaimDraw(uint32_t *sequence) {
+    bool masked = IntMasterDisable();
+
+    bool waiting = published.active;
+    *sequence = published.sequence;
+
+    if (!masked)
+        IntMasterEnable();
+
+    return waiting;
+}
+
+/**
+ * @brief Ends the draw stage and queues the burst's report for the feeder.
+ *
+ * @param sequence From BurstLatency_ClaimDraw. Ignored if a newer burst was published
+ *                 in the meantime, this frame didn't show all of that one.
+ */
+void BurstLatency_Drawn(uint32_t sequence) {
+    uint32_t now = Clock_Millis();
+
+    bool masked = IntMasterDisable();
+
+    bool matched = published.active && published.sequence == sequence;
+    if (matched) {
+        report.sequence = published.sequence;
+        report.host_ms = published.host_ms;
+        report.receive_ms = stage_ms(published.first_ms, published.end_ms);
+        report.publish_ms = stage_ms(published.end_ms, published.published_ms);
+        report.draw_ms = stage_ms(published.published_ms, now);
+        report_pending = true;
+        published.active = false;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+
+    if (matched) {
+        LOG_INFO(LOG_BURST_LATENCY, report.sequence, report.receive_ms, report.publish_ms,
+                 report.draw_ms);
+        BurstLatency_Flush();
+    }
+}
+
+/**
+ * @brief Sends the queued report if the transmit buffer is free.
+ *
+ * Called from the display thread after every frame, so a report that lost the race for
+ * the transmit buffer to a credit goes out shortly after.
+ */
+void BurstLatency_Flush(void) {
+    if (report_pending && UartTx_SendFrame(PROTOCOL_FRAME_LATENCY, &report, sizeof(report)))
+        report_pending = false;
+}
+
+/********************************Public Functions***********************************/
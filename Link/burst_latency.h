@@ -0,0 +1,50 @@
+/***************************************************************************************
+ * @file        burst_latency.h
+ * @brief       Times each burst from its first frame to the pixels showing it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A burst goes through three stages on the Tiva: its frames are received and parsed, it
+ * is published (swapped in for keyframes, already live for incremental bursts) and then
+ * drawn. Each stage boundary is stamped with Clock_Millis, and once the display has
+ * finished the first frame that includes the burst a ProtocolLatency_t goes back to the
+ * feeder. The feeder adds the time from the API response to the first frame and keeps the
+ * histogram, since it is the only side that sees the whole path.
+ *
+ * The report is retried on every display frame until the transmit buffer is free. Only
+ * the latest burst is tracked per stage, a stage that is overtaken before it completes is
+ * simply not reported.
+ *
+***************************************************************************************/
+
+#ifndef BURST_LATENCY_H_
+#define BURST_LATENCY_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void BurstLatency_FrameReceived(void);
+void BurstLatency_BurstEnd(const ProtocolBurstEnd_t *burst_end);
+void BurstLatency_Published(void);
+
+bool BurstLatency_ClaimDraw(uint32_t *sequence);
+void BurstLatency_Drawn(uint32_t sequence);
+void BurstLatency_Flush(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* BURST_LATENCY_H_ */
@@ -0,0 +1,200 @@
+/***************************************************************************************
+ * @file        bus_node.c
+ * @brief       One display among several sharing a feeder on an RS-485 bus.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Held frames are written by whichever thread sends them and read out by
+ * Process_New_Aircraft_Thread when the poll comes in, both with interrupts masked. The
+ * reply is encoded into a buffer of its own, which the DMA reads from while new frames
+ * are held for the next poll.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./bus_node.h"
+#include "./link_rate.h"
+#include "./uart_rx.h"
+#include "./uart_tx.h"
+#include "System/log.h"
+#include "System/site_config.h"
+
+#include <string.h>
+
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint8_t length;
+    uint8_t payload[PROTOCOL_PAYLOAD_SIZE];
+} HeldFrame_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint8_t node = PROTOCOL_BUS_NONE;
+
+// Whether the frames since the last ADDRESS frame are for this node
+static bool addressed = false;
+
+// Newest frame of each downlink type, by type without PROTOCOL_FRAME_DOWNLINK
+static HeldFrame_t held[BUS_NODE_HELD_TYPES];
+static uint32_t held_mask = 0;
+
+static ProtocolFrame_t reply[BUS_NODE_HELD_TYPES];
+
+static uint32_t polls = 0;
+static uint32_t skipped = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Sends everything held, the credit last, with the receiver's count brought up to date.
+ */
+static void answer_poll(void) {
+    // Still sending the last reply means the feeder polled again too soon, it gets the next one
+    if (UartTx_IsBusy())
+        return;
+
+    UartRx_SendCredit();
+
+    bool masked = IntMasterDisable();
+
+    uint8_t count = 0;
+    for (uint8_t i = 1; i <= BUS_NODE_HELD_TYPES; i++) {
+        uint8_t slot = i % BUS_NODE_HELD_TYPES;
+        if (held_mask & (1u << slot)) {
+            Protocol_EncodeFrame(&reply[count++], PROTOCOL_FRAME_DOWNLINK | slot,
+                                 held[slot].payload, held[slot].length);
+        }
+    }
+    held_mask = 0;
+
+    if (!masked)
+        IntMasterEnable();
+
+    UartTx_SendFrames(reply, count);
+    polls++;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Reads this unit's bus node and puts the link on the bus rate, if it has one.
+ *
+ * Must be called after SiteConfig_Init and before UartRx_Init, whose first credit
+ * would otherwise go out unasked.
+ */
+void BusNode_Init(void) {
+    BusSettings_t settings;
+
+    if (!SiteConfig_LoadBus(&settings) || settings.node >= PROTOCOL_BUS_NODES)
+        return;
+
+    node = settings.node;
+    LinkRate_Fix(settings.baud);
+    LOG_INFO(LOG_BUS_NODE, node, LinkRate_GetBaud());
+}
+
+/**
+ * @brief This unit's node, PROTOCOL_BUS_NONE on a link of its own.
+ */
+uint8_t BusNode_Get(void) {
+    return node;
+}
+
+/**
+ * @brief Takes in ADDRESS frames and tells whether a frame is for this unit.
+ *
+ * Call it on every frame before parsing it. ADDRESS frames themselves are never for
+ * the caller, and a poll for this node is answered from here.
+ *
+ * @return bool False if the frame should be released without being parsed.
+ */
+bool BusNode_Accept(const ProtocolFrame_t *frame) {
+    if (frame->type == PROTOCOL_FRAME_ADDRESS) {
+        const ProtocolAddress_t *address = (const ProtocolAddress_t *)frame->payload;
+
+        if (node != PROTOCOL_BUS_NONE) {
+            addressed = (address->nodes >> node) & 1;
+            if (address->poll == node)
+                answer_poll();
+        }
+        return false;
+    }
+
+    if (node == PROTOCOL_BUS_NONE || addressed)
+        return true;
+
+    skipped++;
+    return false;
+}
+
+/**
+ * @brief Keeps a downlink frame for the next poll, if this unit is on a bus.
+ *
+ * Called by UartTx_SendFrame. A frame of a type already held replaces it, every downlink
+ * frame carries absolute state.
+ *
+ * @return bool False on a link of its own, the frame should go out now.
+ */
+bool BusNode_Hold(uint8_t type, const void *payload, uint8_t length) {
+    if (node == PROTOCOL_BUS_NONE)
+        return false;
+
+    uint8_t slot = type & ~PROTOCOL_FRAME_DOWNLINK;
+    if (slot >= BUS_NODE_HELD_TYPES || length > PROTOCOL_PAYLOAD_SIZE)
+        return true;
+
+    bool masked = IntMasterDisable();
+
+    memcpy(held[slot].payload, payload, length);
+    held[slot].length = length;
+    held_mask |= 1u << slot;
+
+    if (!masked)
+        IntMasterEnable();
+
+    return true;
+}
+
+/**
+ * @brief Stores the bus node and rate a PROTOCOL_FRAME_NODE carries, for the next boot.
+ *
+ * Blocks for the EEPROM write, call it from a thread.
+ */
+void BusNode_Store(const ProtocolNode_t *wire) {
+    if (wire->node >= PROTOCOL_BUS_NODES && wire->node != PROTOCOL_BUS_NONE) {
+        LOG_WARN(LOG_BUS_NODE_REJECTED, wire->node);
+        return;
+    }
+
+    BusSettings_t settings = { wire->node, wire->baud };
+    if (SiteConfig_StoreBus(&settings))
+        LOG_INFO(LOG_BUS_NODE_STORED, wire->node, wire->baud);
+}
+
+/**
+ * @brief Logs the polls answered and frames skipped, on a bus.
+ */
+void BusNode_Report(void) {
+    if (node != PROTOCOL_BUS_NONE)
+        LOG_INFO(LOG_STATS_BUS, node, polls, skipped);
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,67 @@
+/***************************************************************************************
+ * @file        bus_node.h
+ * @brief       One display among several sharing a feeder on an RS-485 bus.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Up to PROTOCOL_BUS_NODES units can hang off one feeder on a single RS-485 pair. Their
+ * transceivers switch direction by themselves, so UART4 needs no direction pin. The
+ * feeder is the bus master. Every unit hears every frame, and a unit only ever transmits
+ * when the feeder polls it:
+ *
+ *      1. A PROTOCOL_FRAME_ADDRESS frame names the nodes the frames after it are for, up
+ *         to the next one. A burst for one view goes out once, to every node showing it.
+ *      2. Frames for other nodes are skipped without being parsed, but they are still
+ *         credited. Every node counts every uplink frame, so the feeder's count of
+ *         frames outstanding is the same for all of them.
+ *      3. Credits, latency and view reports are held, the newest of each type, until an
+ *         ADDRESS frame polls this node. Then they go out back to back, the credit last,
+ *         and once it is in the bus is the feeder's again.
+ *
+ * The node number and the bus rate are read from EEPROM at boot. A unit with neither
+ * stored is on a link of its own, and everything here passes straight through. The
+ * feeder stores them with a PROTOCOL_FRAME_NODE frame, taking effect at the next boot.
+ * A bus runs at a fixed rate, see LinkRate_Fix, since the rate handshake needs a link
+ * to itself.
+ *
+***************************************************************************************/
+
+#ifndef BUS_NODE_H_
+#define BUS_NODE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+// Downlink types held until a poll, PROTOCOL_FRAME_CREDIT up to PROTOCOL_FRAME_BAUD_REPLY
+#define BUS_NODE_HELD_TYPES     4
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void BusNode_Init(void);
+uint8_t BusNode_Get(void);
+
+bool BusNode_Accept(const ProtocolFrame_t *frame);
+bool BusNode_Hold(uint8_t type, const void *payload, uint8_t length);
+void BusNode_Store(const ProtocolNode_t *wire);
+
+void BusNode_Report(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* BUS_NODE_H_ */
@@ -0,0 +1,183 @@
+/***************************************************************************************
+ * @file        compact.c
+ * @brief       Unpacks COMPACT frames, several aircraft to a frame, into full wire records.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The units below must match COMPACT_* in BeagleBoneScripts/compact_encoder.py, which
+ * works out the same wire values so its delta model stays exact.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./compact.h"
+#include "System/arena.h"
+
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define COMPACT_REFERENCE_UNIT  100         // 0.01 degrees in wire units
+#define COMPACT_ALTITUDE_UNIT   76200       // 25 ft, 7.62 m, in wire units
+#define COMPACT_VELOCITY_UNIT   20000       // 2 m/s in wire units
+#define COMPACT_HEADING_UNIT_2  28125       // twice 1/256 turn in wire units
+
+#define COMPACT_DEFINED         0x80000000  // entry holds an address
+#define COMPACT_VARINT_BYTES    5           // enough for 32 bits
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Address for each entry the feeder has defined, carved from the arena
+static uint32_t *entries;
+
+static volatile uint16_t misses = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Reads one base 128 varint.
+ *
+ * @return bool False if it runs past the payload.
+ */
+static bool read_varint(CompactReader_t *reader, uint32_t *value) {
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < COMPACT_VARINT_BYTES && reader->offset < reader->length; i++) {
+        uint8_t byte = reader->payload[reader->offset++];
+        result |= (uint32_t)(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int16_t read_int16(const uint8_t *bytes) {
+    return (int16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Carves out the dictionary. Must be called before the scheduler is launched.
+ */
+void Compact_Init(void) {
+    entries = Arena_Alloc(PROTOCOL_COMPACT_ENTRIES * sizeof(uint32_t), "Dict");
+}
+
+/**
+ * @brief Starts reading a COMPACT payload.
+ */
+void Compact_Begin(CompactReader_t *reader, const uint8_t *payload, uint8_t length) {
+    reader->payload = payload;
+    reader->length = length;
+    reader->offset = PROTOCOL_COMPACT_REFERENCE_SIZE;
+
+    if (length < PROTOCOL_COMPACT_REFERENCE_SIZE) {
+        reader->offset = length;
+        return;
+    }
+
+    reader->reference_latitude = read_int16(&payload[0]) * COMPACT_REFERENCE_UNIT;
+    reader->reference_longitude = read_int16(&payload[2]) * COMPACT_REFERENCE_UNIT;
+}
+
+/**
+ * @brief Unpacks the next record the dictionary can place.
+ *
+ * Records for an entry never defined are counted as misses and skipped.
+ *
+ * @param wire  Filled in as if a full record had arrived. Without `named` the callsign
+ *              is blank, keep the one already held for the address.
+ * @param named Set if the record carried the callsign.
+ * @return bool False once the payload is used up, or at a record that doesn't fit in it.
+ */
+bool Compact_Next(CompactReader_t *reader, ProtocolAircraft_t *wire, bool *named) {
+    uint32_t entry;
+
+    while (read_varint(reader, &entry)) {
+        bool define = entry & PROTOCOL_COMPACT_DEFINE;
+        entry >>= 1;
+        if (entry >= PROTOCOL_COMPACT_ENTRIES)
+            return false;
+
+        memset(wire->callsign, ' ', sizeof(wire->callsign));
+
+        if (define) {
+            uint32_t callsign_length;
+            if (reader->offset + PROTOCOL_ICAO24_SIZE > reader->length)
+                return false;
+
+            const uint8_t *address = &reader->payload[reader->offset];
+            reader->offset += PROTOCOL_ICAO24_SIZE;
+            entries[entry] = COMPACT_DEFINED | address[0] | (address[1] << 8) | (address[2] << 16);
+
+            if (!read_varint(reader, &callsign_length) || callsign_length > PROTOCOL_COMPACT_CALLSIGN_SIZE ||
+                reader->offset + callsign_length > reader->length)
+                return false;
+
+            memcpy(wire->callsign, &reader->payload[reader->offset], callsign_length);
+            reader->offset += callsign_length;
+        }
+
+        const uint8_t *fields = &reader->payload[reader->offset];
+        uint32_t altitude;
+        if (reader->offset + 4 > reader->length)
+            return false;
+        reader->offset += 4;
+        if (!read_varint(reader, &altitude) || reader->offset + 2 > reader->length)
+            return false;
+        const uint8_t *vector = &reader->payload[reader->offset];
+        reader->offset += 2;
+
+        if (!(entries[entry] & COMPACT_DEFINED)) {
+            Compact_Miss();
+            continue;
+        }
+
+        wire->icao24 = entries[entry] & ~COMPACT_DEFINED;
+        wire->latitude = reader->reference_latitude + read_int16(&fields[0]);
+        wire->longitude = reader->reference_longitude + read_int16(&fields[2]);
+        wire->altitude = (int32_t)(altitude * COMPACT_ALTITUDE_UNIT);
+        wire->velocity = vector[0] * COMPACT_VELOCITY_UNIT;
+        wire->heading = vector[1] * COMPACT_HEADING_UNIT_2 / 2;
+
+        *named = define;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Counts a record that named an aircraft this side doesn't have.
+ */
+void Compact_Miss(void) {
+    misses++;
+}
+
+/**
+ * @brief Misses since boot, sent back in every credit.
+ */
+uint16_t Compact_GetMisses(void) {
+    return misses;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,67 @@
+/***************************************************************************************
+ * @file        compact.h
+ * @brief       Unpacks COMPACT frames, several aircraft to a frame, into full wire records.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A full UPSERT spends a whole 40-byte frame on one aircraft. A compact record, laid
+ * out in protocol.h, sends the position as offsets from a reference point, altitude,
+ * velocity and heading at the resolution the radar draws them, and once the aircraft has
+ * been sent, a dictionary entry in place of the address and callsign. A record is 9 to
+ * 10 bytes, so three aircraft share a frame, three times the aircraft a second at the
+ * same baud.
+ *
+ * Compact_Next turns each record back into a ProtocolAircraft_t, so the live table is
+ * updated through the same upsert as a full frame. The dictionary maps entries to
+ * addresses only: the callsign of an aircraft sent by entry is the one the live table
+ * already holds, and an entry whose aircraft is no longer there counts as a miss, like
+ * an entry never defined. Misses go back to the feeder in every credit, and the feeder
+ * starts its dictionary over when the count changes, which also covers a reset here.
+ *
+ * The dictionary is written and read by Process_New_Aircraft_Thread only.
+ *
+***************************************************************************************/
+
+#ifndef COMPACT_H_
+#define COMPACT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    const uint8_t *payload;
+    uint32_t length;
+    uint32_t offset;                // next record
+    int32_t reference_latitude;     // wire units, 1e-4 degrees
+    int32_t reference_longitude;
+} CompactReader_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Compact_Init(void);
+
+void Compact_Begin(CompactReader_t *reader, const uint8_t *payload, uint8_t length);
+bool Compact_Next(CompactReader_t *reader, ProtocolAircraft_t *wire, bool *named);
+
+void Compact_Miss(void);
+uint16_t Compact_GetMisses(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* COMPACT_H_ */
@@ -0,0 +1,126 @@
+/***************************************************************************************
+ * @file        frame_ring.c
+ * @brief       Lock-free single-producer/single-consumer ring of protocol frames.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Each index update is preceded by a data memory barrier so the slot contents are
+ * visible before the other side can see the index move.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./frame_ring.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#if defined(ccs)
+#define FRAME_RING_BARRIER()    __asm("    dmb\n")
+#elif !defined(__arm__)
+#define FRAME_RING_BARRIER()    __sync_synchronize()    // host build, see Simulator/
+#else
+#define FRAME_RING_BARRIER()    __asm volatile ("dmb" ::: "memory")
+#endif
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void FrameRing_Init(FrameRing_t *ring) {
+    ring->reserve = 0;
+    ring->head = 0;
+    ring->tail = 0;
+    ring->high_water = 0;
+}
+
+/**
+ * @brief Hands the producer the next free slot to fill.
+ *
+ * @return ProtocolFrame_t* The slot, or NULL if the consumer still holds every slot.
+ */
+ProtocolFrame_t *FrameRing_Reserve(FrameRing_t *ring) {
+    if (ring->reserve - ring->tail >= FRAME_RING_SIZE)
+        return NULL;
+
+    return &ring->slots[ring->reserve++ & FRAME_RING_MASK];
+}
+
+/**
+ * @brief Makes the oldest reserved slot visible to the consumer.
+ *
+ * @return bool True if the ring was empty beforehand. The consumer drains the ring
+ *              completely on every wake-up, so it only needs waking on this edge.
+ */
+bool FrameRing_Publish(FrameRing_t *ring) {
+    uint32_t head = ring->head;
+
+    if (head == ring->reserve)
+        return false;
+
+    bool was_empty = (head == ring->tail);
+
+    FRAME_RING_BARRIER();
+    ring->head = head + 1;
+
+    if (head + 1 - ring->tail > ring->high_water)
+        ring->high_water = head + 1 - ring->tail;
+
+    return was_empty;
+}
+
+/**
+ * @brief Returns the oldest published slot without removing it.
+ *
+ * @return const ProtocolFrame_t* The slot, or NULL if nothing is published.
+ */
+const ProtocolFrame_t *FrameRing_Peek(const FrameRing_t *ring) {
+    uint32_t tail = ring->tail;
+
+    if (tail == ring->head)
+        return NULL;
+
+    FRAME_RING_BARRIER();
+    return &ring->slots[tail & FRAME_RING_MASK];
+}
+
+/**
+ * @brief Hands the oldest published slot back to the producer.
+ */
+void FrameRing_Release(FrameRing_t *ring) {
+    uint32_t tail = ring->tail;
+
+    if (tail == ring->head)
+        return;
+
+    FRAME_RING_BARRIER();
+    ring->tail = tail + 1;
+}
+
+uint32_t FrameRing_Count(const FrameRing_t *ring) {
+    return ring->head - ring->tail;
+}
+
+/**
+ * @brief Number of slots neither published nor reserved by the producer.
+ */
+uint32_t FrameRing_Free(const FrameRing_t *ring) {
+    return FRAME_RING_SIZE - (ring->reserve - ring->tail);
+}
+
+/**
+ * @brief Most slots that were ever published and waiting for the consumer at once.
+ */
+uint32_t FrameRing_HighWater(const FrameRing_t *ring) {
+    return ring->high_water;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        frame_ring.h
+ * @brief       Lock-free single-producer/single-consumer ring of protocol frames.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Frames are stored whole, so the consumer works on a slot in place instead of pulling
+ * a message out word by word. The indices are free running and only ever written by
+ * one side each: the producer owns `reserve` and `head`, the consumer owns `tail`.
+ * Aligned 32-bit stores are atomic on the Cortex-M4, so no lock or critical section is
+ * needed between the interrupt and the thread.
+ *
+ * A producer reserves a slot, fills it (possibly by DMA, long after reserving it) and
+ * then publishes it. Slots are published in the order they were reserved.
+ *
+***************************************************************************************/
+
+#ifndef FRAME_RING_H_
+#define FRAME_RING_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define FRAME_RING_SIZE         8    // frame slots, must be a power of two
+#define FRAME_RING_MASK         (FRAME_RING_SIZE - 1)
+
+#if (FRAME_RING_SIZE & FRAME_RING_MASK) != 0
+#error "FRAME_RING_SIZE must be a power of two"
+#endif
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    ProtocolFrame_t slots[FRAME_RING_SIZE];
+    uint32_t reserve;               // producer, next slot to hand out
+    volatile uint32_t head;         // producer, next slot to publish
+    volatile uint32_t tail;         // consumer, next slot to read
+    uint32_t high_water;            // producer, most slots ever published and unread
+} FrameRing_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void FrameRing_Init(FrameRing_t *ring);
+
+ProtocolFrame_t *FrameRing_Reserve(FrameRing_t *ring);
+bool FrameRing_Publish(FrameRing_t *ring);
+
+const ProtocolFrame_t *FrameRing_Peek(const FrameRing_t *ring);
+void FrameRing_Release(FrameRing_t *ring);
+
+uint32_t FrameRing_Count(const FrameRing_t *ring);
+uint32_t FrameRing_Free(const FrameRing_t *ring);
+uint32_t FrameRing_HighWater(const FrameRing_t *ring);
+
+/********************************Public Functions***********************************/
+
+#endif /* FRAME_RING_H_ */
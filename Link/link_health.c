@@ -0,0 +1,141 @@
+/***************************************************************************************
+ * @file        link_health.c
+ * @brief       Watches the UART4 link and restarts the receiver when it stops delivering.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Everything but LinkHealth_BurstEnd runs in Link_Rate_Thread. The end of a burst is
+ * noted by Process_New_Aircraft_Thread with a single word store.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./link_health.h"
+#include "./link_rate.h"
+#include "./uart_rx.h"
+#include "System/clock.h"
+#include "System/log.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static volatile uint32_t burst_ms;
+
+// Good frames and errors at the start of the current window
+static uint32_t window_ms;
+static uint32_t window_frames;
+static uint32_t window_errors;
+
+// Last good frame, and the last restart, for the stall check
+static uint32_t heard_count;
+static uint32_t heard_ms;
+static uint32_t restart_ms;
+
+// Good frames when the rate was last worked out, and that rate
+static uint32_t rate_ms;
+static uint32_t rate_frames;
+static uint32_t frames_per_s;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint32_t error_count(void) {
+    return UartRx_GetCrcErrorCount() + UartRx_GetResyncCount();
+}
+
+static bool restart(uint32_t now) {
+    restart_ms = now;
+    return UartRx_Restart();
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Notes that an end-of-burst frame was parsed.
+ */
+void LinkHealth_BurstEnd(void) {
+    burst_ms = Clock_Millis();
+}
+
+/**
+ * @brief Updates the counters and restarts the receiver if it stalled. Call every LINK_RATE_POLL_MS.
+ *
+ * @return bool True if frames are waiting in the receive ring after a restart, in which
+ *              case the parser has to be woken.
+ */
+bool LinkHealth_Service(void) {
+    uint32_t now = Clock_Millis();
+    uint32_t frames = UartRx_GetConsumedCount();
+    bool wake = false;
+
+    if (frames != heard_count) {
+        heard_count = frames;
+        heard_ms = now;
+    }
+
+    if (now - window_ms >= LINK_HEALTH_WINDOW_MS) {
+        uint32_t errors = error_count();
+        bool garbled = (frames == window_frames) && (errors - window_errors >= LINK_HEALTH_GARBLED_LIMIT);
+
+        // Bytes keep coming but none of them make a frame
+        if (garbled && LinkRate_IsIdle()) {
+            LOG_WARN(LOG_LINK_DESYNC, errors - window_errors, now - window_ms);
+            wake |= restart(now);
+        }
+
+        window_ms = now;
+        window_frames = frames;
+        window_errors = errors;
+    }
+
+    // Nothing at all, the feeder is gone or the receiver is wedged
+    if (now - heard_ms >= LINK_HEALTH_STALL_MS && now - restart_ms >= LINK_HEALTH_STALL_MS && LinkRate_IsIdle()) {
+        LOG_WARN(LOG_LINK_STALL, now - heard_ms);
+        wake |= restart(now);
+    }
+
+    if (now - rate_ms >= LINK_HEALTH_RATE_MS) {
+        frames_per_s = (frames - rate_frames) * 1000 / (now - rate_ms);
+        rate_frames = frames;
+        rate_ms = now;
+    }
+
+    return wake;
+}
+
+/**
+ * @brief Logs the link counters, for a statistics query.
+ */
+void LinkHealth_Report(void) {
+    LinkHealthStats_t stats;
+
+    LinkHealth_GetStats(&stats);
+    LOG_INFO(LOG_LINK_HEALTH, stats.frames_per_s, stats.crc_errors, stats.resyncs, stats.overflows,
+             stats.restarts, stats.since_burst_ms);
+}
+
+/**
+ * @brief Copies out the link counters.
+ */
+void LinkHealth_GetStats(LinkHealthStats_t *stats) {
+    stats->frames_per_s = frames_per_s;
+    stats->frames = UartRx_GetConsumedCount();
+    stats->crc_errors = UartRx_GetCrcErrorCount();
+    stats->resyncs = UartRx_GetResyncCount();
+    stats->overflows = UartRx_GetOverflowCount();
+    stats->restarts = UartRx_GetRestartCount();
+    stats->since_burst_ms = Clock_Millis() - burst_ms;
+}
+
+/********************************Public Functions***********************************/
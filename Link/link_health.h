@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        link_health.h
+ * @brief       Watches the UART4 link and restarts the receiver when it stops delivering.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Link_Rate_Thread calls LinkHealth_Service every LINK_RATE_POLL_MS. It follows the
+ * receiver's frame and error counters a LINK_HEALTH_WINDOW_MS at a time, and restarts
+ * the receive path with UartRx_Restart in two cases:
+ *
+ *      desync      LINK_HEALTH_GARBLED_LIMIT CRC errors and resyncs in one window
+ *                  without a single good frame, bytes arrive but nothing lines up
+ *      stall       no good frame for LINK_HEALTH_STALL_MS, one and a half bursts,
+ *                  and again every LINK_HEALTH_STALL_MS for as long as it lasts
+ *
+ * A restart re-arms the receiver on fresh slots and sends the feeder a credit, which
+ * also reopens its window if credits went missing on the line. The UART rate and the
+ * aircraft tables are left alone, and frames already in the ring are still parsed, so a
+ * transient fault costs the frames that were on the line and nothing else. No restart
+ * happens in the middle of a rate change, see link_rate.h.
+ *
+ * LinkHealth_Report logs the counters when the debug console asks, with the frame rate
+ * over the last LINK_HEALTH_RATE_MS and the time since the last burst ended.
+ *
+***************************************************************************************/
+
+#ifndef LINK_HEALTH_H_
+#define LINK_HEALTH_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LINK_HEALTH_WINDOW_MS       1000
+#define LINK_HEALTH_GARBLED_LIMIT   8       // errors in a window with no good frame
+#define LINK_HEALTH_STALL_MS        15000   // a burst is due every 10 s
+#define LINK_HEALTH_RATE_MS         10000   // one burst, frames/s is averaged over this
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t frames_per_s;      // good frames a second over the last LINK_HEALTH_RATE_MS
+    uint32_t frames;            // good frames since boot
+    uint32_t crc_errors;
+    uint32_t resyncs;
+    uint32_t overflows;         // frames lost to a full receive ring
+    uint32_t restarts;
+    uint32_t since_burst_ms;    // since the last end-of-burst frame, or since boot
+} LinkHealthStats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void LinkHealth_BurstEnd(void);
+bool LinkHealth_Service(void);
+
+void LinkHealth_Report(void);
+void LinkHealth_GetStats(LinkHealthStats_t *stats);
+
+/********************************Public Functions***********************************/
+
+#endif /* LINK_HEALTH_H_ */
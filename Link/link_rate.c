@@ -0,0 +1,270 @@
+/***************************************************************************************
+ * @file        link_rate.c
+ * @brief       Raises the UART4 rate above 115,200 baud when the feeder asks for it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Requests and test frames are handed in by Process_New_Aircraft_Thread, everything else
+ * runs in Link_Rate_Thread every LINK_RATE_POLL_MS. Both run at thread level, and the
+ * state is only written with interrupts masked, so the two never see half an update.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./link_rate.h"
+#include "./uart_rx.h"
+#include "./uart_tx.h"
+#include "./usb_link.h"
+#include "System/clock.h"
+#include "System/log.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LINK_RATE_CONFIG    (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    LINK_IDLE,          // running at `baud`
+    LINK_SWITCHING,     // SWITCHING reply queued at the old rate, not yet on the wire
+    LINK_TRIAL,         // at the new rate, counting test frames
+    LINK_REVERTING,     // trial failed, back at the old rate with the FALLBACK reply queued
+    LINK_CONFIRMING     // trial passed, CONFIRMED reply queued at the new rate
+} LinkState_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static LinkState_t state = LINK_IDLE;
+static uint32_t baud = LINK_RATE_DEFAULT_BAUD;
+static uint32_t trial_baud;
+static uint32_t trial_start_ms;
+static bool reply_pending = false;
+
+// On a bus the rate is the bus's, see LinkRate_Fix
+static bool fixed = false;
+
+// One bit per test frame seen intact, so a repeat never counts twice
+static uint32_t trial_seen;
+static uint8_t trial_frames;
+
+// Last time a good frame of any kind came in, for the silence fallback
+static uint32_t heard_count;
+static uint32_t heard_ms;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static bool supported(uint32_t rate) {
+    return rate >= LINK_RATE_DEFAULT_BAUD && rate <= LINK_RATE_MAX_BAUD &&
+           rate * 8 <= SysCtlClockGet();
+}
+
+static uint8_t count_bits(uint32_t bits) {
+    uint8_t count = 0;
+    for (; bits; bits &= bits - 1)
+        count++;
+    return count;
+}
+
+static bool send_reply(uint32_t rate, uint8_t status) {
+    ProtocolBaud_t reply = { rate, count_bits(trial_seen), status, 0 };
+    return UartTx_SendFrame(PROTOCOL_FRAME_BAUD_REPLY, &reply, sizeof(reply));
+}
+
+/**
+ * @brief Reprograms UART4 once the transmitter is idle.
+ *
+ * The check and the switch happen with interrupts masked, so a credit can't start going
+ * out at the old rate in between.
+ *
+ * @return bool False if a frame is still leaving, try again next poll.
+ */
+static bool switch_rate(uint32_t rate) {
+    bool switched = false;
+    bool masked = IntMasterDisable();
+
+    if (!UartTx_IsBusy() && !UARTBusy(UART4_BASE)) {
+        UARTConfigSetExpClk(UART4_BASE, SysCtlClockGet(), rate, LINK_RATE_CONFIG);
+        switched = true;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+
+    return switched;
+}
+
+/**
+ * @brief Byte `offset` of test frame `index`, mirrored by protocol.baud_test_payload.
+ *
+ * Walks through every bit pattern over the frames, long runs of ones and zeros included.
+ */
+static uint8_t test_byte(uint8_t index, uint32_t offset) {
+    return (uint8_t)(0xA5 ^ (index * 29) ^ (offset * 73));
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts a rate change the feeder asked for.
+ *
+ * A request for the rate already in use is confirmed straight away, which is also how
+ * the feeder finds out the rate after a restart of its own.
+ */
+void LinkRate_Request(const ProtocolBaud_t *request) {
+    if (state != LINK_IDLE)
+        return;
+
+    if (request->baud == baud) {
+        trial_seen = 0;
+        send_reply(baud, PROTOCOL_BAUD_CONFIRMED);
+        return;
+    }
+
+    // Nothing to raise on USB, and a bus keeps its rate
+    if (fixed || UsbLink_IsOpen() || !supported(request->baud) || request->test_frames == 0 || request->test_frames > 32) {
+        send_reply(request->baud, PROTOCOL_BAUD_REJECTED);
+        return;
+    }
+
+    bool masked = IntMasterDisable();
+    trial_baud = request->baud;
+    trial_frames = request->test_frames;
+    trial_seen = 0;
+    state = LINK_SWITCHING;
+    if (!masked)
+        IntMasterEnable();
+
+    // Retried from LinkRate_Service if a credit holds the transmitter
+    reply_pending = !send_reply(trial_baud, PROTOCOL_BAUD_SWITCHING);
+}
+
+/**
+ * @brief Counts a test frame that arrived during a trial, if every byte is as expected.
+ */
+void LinkRate_TestFrame(const uint8_t *payload, uint8_t length) {
+    if (state != LINK_TRIAL || length != PROTOCOL_PAYLOAD_SIZE || payload[0] >= trial_frames)
+        return;
+
+    for (uint32_t offset = 1; offset < length; offset++) {
+        if (payload[offset] != test_byte(payload[0], offset))
+            return;
+    }
+
+    bool masked = IntMasterDisable();
+    trial_seen |= 1u << payload[0];
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Moves the handshake along and watches for a silent link. Call every LINK_RATE_POLL_MS.
+ */
+void LinkRate_Service(void) {
+    uint32_t now = Clock_Millis();
+
+    // Any frame parsed counts as hearing the feeder
+    uint32_t consumed = UartRx_GetConsumedCount();
+    if (consumed != heard_count) {
+        heard_count = consumed;
+        heard_ms = now;
+    }
+
+    switch (state) {
+        case LINK_IDLE:
+            if (!fixed && baud != LINK_RATE_DEFAULT_BAUD && now - heard_ms >= LINK_RATE_SILENCE_MS &&
+                switch_rate(LINK_RATE_DEFAULT_BAUD)) {
+                LOG_WARN(LOG_LINK_SILENT, baud);
+                baud = LINK_RATE_DEFAULT_BAUD;
+            }
+            break;
+
+        case LINK_SWITCHING:
+            // The SWITCHING reply has to go out first, at the rate the feeder is still on
+            if (reply_pending) {
+                reply_pending = !send_reply(trial_baud, PROTOCOL_BAUD_SWITCHING);
+            } else if (switch_rate(trial_baud)) {
+                trial_start_ms = now;
+                state = LINK_TRIAL;
+            }
+            break;
+
+        case LINK_TRIAL: {
+            uint32_t wanted = (trial_frames == 32) ? 0xFFFFFFFF : (1u << trial_frames) - 1;
+            if (trial_seen == wanted) {
+                state = LINK_CONFIRMING;
+            } else if (now - trial_start_ms >= LINK_RATE_TRIAL_MS && switch_rate(baud)) {
+                LOG_WARN(LOG_LINK_FALLBACK, trial_baud, count_bits(trial_seen), trial_frames);
+                state = LINK_REVERTING;
+            }
+            break;
+        }
+
+        case LINK_REVERTING:
+            if (send_reply(trial_baud, PROTOCOL_BAUD_FALLBACK))
+                state = LINK_IDLE;
+            break;
+
+        case LINK_CONFIRMING:
+            if (send_reply(trial_baud, PROTOCOL_BAUD_CONFIRMED)) {
+                LOG_INFO(LOG_LINK_RATE, trial_baud);
+                baud = trial_baud;
+                heard_ms = now;
+                state = LINK_IDLE;
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Puts UART4 on a bus's rate for good.
+ *
+ * Every node on a bus has to stay at the bus rate, so requests for another are rejected
+ * from here on, and a silent link never falls back to the default. Must be called before
+ * the scheduler is launched.
+ *
+ * @return bool False if the rate isn't supported, the link stays at the default.
+ */
+bool LinkRate_Fix(uint32_t rate) {
+    fixed = true;
+    if (!supported(rate))
+        return false;
+
+    UARTConfigSetExpClk(UART4_BASE, SysCtlClockGet(), rate, LINK_RATE_CONFIG);
+    baud = rate;
+    return true;
+}
+
+uint32_t LinkRate_GetBaud(void) {
+    return baud;
+}
+
+/**
+ * @brief False while a rate change is under way and the line is expected to be quiet or garbled.
+ */
+bool LinkRate_IsIdle(void) {
+    return state == LINK_IDLE;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,68 @@
+/***************************************************************************************
+ * @file        link_rate.h
+ * @brief       Raises the UART4 rate above 115,200 baud when the feeder asks for it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The link always comes up at LINK_RATE_DEFAULT_BAUD. The feeder proposes a faster rate
+ * and the Tiva takes it in three steps:
+ *
+ *      1. ProtocolBaud_t request arrives, LINK_RATE_SWITCHING goes back at the old rate
+ *      2. Once that reply has left the FIFO, UART4 is reprogrammed with
+ *         UARTConfigSetExpClk, which turns high-speed mode on by itself when needed
+ *      3. The feeder follows and sends `test_frames` BAUD_TEST frames of a fixed
+ *         pattern. If every one of them arrives intact within LINK_RATE_TRIAL_MS, the
+ *         reply is LINK_RATE_CONFIRMED at the new rate and the rate is kept.
+ *
+ * Anything less and the Tiva goes back to the rate it had and says LINK_RATE_FALLBACK
+ * there, and the feeder tries a lower rate. Both ends can mismatch their dividers by a
+ * few percent at the top rates, which is exactly what the test frames are for.
+ *
+ * At a raised rate, LINK_RATE_SILENCE_MS without a single good frame also drops the link
+ * back to the default rate, so a feeder that restarts always finds the Tiva where it
+ * expects it. A unit on a bus skips all of this and stays at the bus rate, see
+ * bus_node.h.
+ *
+***************************************************************************************/
+
+#ifndef LINK_RATE_H_
+#define LINK_RATE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LINK_RATE_DEFAULT_BAUD  115200
+#define LINK_RATE_MAX_BAUD      1500000
+#define LINK_RATE_TRIAL_MS      1000    // for all the test frames to arrive at the new rate
+#define LINK_RATE_SILENCE_MS    30000   // three missed bursts at a raised rate, back to default
+#define LINK_RATE_POLL_MS       20
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void LinkRate_Request(const ProtocolBaud_t *request);
+void LinkRate_TestFrame(const uint8_t *payload, uint8_t length);
+void LinkRate_Service(void);
+bool LinkRate_Fix(uint32_t rate);
+
+uint32_t LinkRate_GetBaud(void);
+bool LinkRate_IsIdle(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* LINK_RATE_H_ */
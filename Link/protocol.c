@@ -0,0 +1,144 @@
+/***************************************************************************************
+ * @file        protocol.c
+ * @brief       Framed, checksummed telemetry protocol (v2) decoder.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./protocol.h"
+
+#include <string.h>
+
+#include "System/ramfunc.h"
+#include "driverlib/sw_crc.h"
+
+/************************************Includes***************************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Drops the first byte of the buffered frame and slides forward to the next
+ *        candidate preamble.
+ *
+ * Only the bytes already buffered are searched, so a corrupted frame costs at most one
+ * frame of extra latency before the decoder locks onto the next good one.
+ */
+RAMFUNC static void resync(ProtocolDecoder_t *decoder) {
+    uint8_t *bytes = (uint8_t *)&decoder->frame;
+    uint32_t start = 1;
+
+    while (start < decoder->fill &&
+           !(bytes[start] == PROTOCOL_SYNC_0 &&
+             (start + 1 == decoder->fill || bytes[start + 1] == PROTOCOL_SYNC_1))) {
+        start++;
+    }
+
+    decoder->fill -= start;
+    memmove(bytes, bytes + start, decoder->fill);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void Protocol_InitDecoder(ProtocolDecoder_t *decoder) {
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+/**
+ * @brief Validates the preamble, length and CRC of a complete frame.
+ */
+RAMFUNC bool Protocol_CheckFrame(const ProtocolFrame_t *frame) {
+    if (frame->sync[0] != PROTOCOL_SYNC_0 || frame->sync[1] != PROTOCOL_SYNC_1)
+        return false;
+
+    if (frame->length > PROTOCOL_PAYLOAD_SIZE)
+        return false;
+
+    uint16_t crc = Crc16(0, &frame->type, PROTOCOL_FRAME_SIZE - 2 - PROTOCOL_CRC_SIZE);
+    return crc == frame->crc;
+}
+
+/**
+ * @brief Builds a complete frame around a payload, including padding and CRC.
+ *
+ * @param frame   Destination frame.
+ * @param type    Frame type.
+ * @param payload Payload bytes, may be NULL if length is 0.
+ * @param length  Payload length, at most PROTOCOL_PAYLOAD_SIZE.
+ */
+void Protocol_EncodeFrame(ProtocolFrame_t *frame, uint8_t type, const void *payload, uint8_t length) {
+    if (length > PROTOCOL_PAYLOAD_SIZE)
+        length = PROTOCOL_PAYLOAD_SIZE;
+
+    frame->sync[0] = PROTOCOL_SYNC_0;
+    frame->sync[1] = PROTOCOL_SYNC_1;
+    frame->type = type;
+    frame->length = length;
+
+    memset(frame->payload, 0, PROTOCOL_PAYLOAD_SIZE);
+    if (length)
+        memcpy(frame->payload, payload, length);
+
+    frame->crc = Crc16(0, &frame->type, PROTOCOL_FRAME_SIZE - 2 - PROTOCOL_CRC_SIZE);
+}
+
+/**
+ * @brief Feeds received bytes into the decoder until one frame completes.
+ *
+ * Bytes are consumed until either the input is exhausted or a valid frame has been
+ * assembled in decoder->frame. The caller must use the frame before decoding again, then
+ * call again with the remaining input.
+ *
+ * @param decoder     Decoder state.
+ * @param data        Received bytes.
+ * @param length      Number of received bytes.
+ * @param frame_ready Set to true if decoder->frame now holds a valid frame.
+ * @return uint32_t   Number of input bytes consumed.
+ */
+RAMFUNC uint32_t Protocol_Decode(ProtocolDecoder_t *decoder, const uint8_t *data, uint32_t length, bool *frame_ready) {
+    uint8_t *bytes = (uint8_t *)&decoder->frame;
+    uint32_t consumed = 0;
+
+    *frame_ready = false;
+
+    while (consumed < length) {
+        uint8_t byte = data[consumed++];
+
+        // Hunt for the preamble one byte at a time
+        if ((decoder->fill == 0 && byte != PROTOCOL_SYNC_0) ||
+            (decoder->fill == 1 && byte != PROTOCOL_SYNC_1)) {
+            decoder->sync_errors += (decoder->fill == 1);
+            decoder->fill = (byte == PROTOCOL_SYNC_0) ? 1 : 0;
+            bytes[0] = byte;
+            continue;
+        }
+
+        bytes[decoder->fill++] = byte;
+
+        if (decoder->fill < PROTOCOL_FRAME_SIZE)
+            continue;
+
+        if (Protocol_CheckFrame(&decoder->frame)) {
+            decoder->fill = 0;
+            *frame_ready = true;
+            break;
+        }
+
+        // Bad frame, look for a preamble inside what we already have
+        decoder->crc_errors++;
+        resync(decoder);
+    }
+
+    return consumed;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,281 @@
+/***************************************************************************************
+ * @file        protocol.h
+ * @brief       Framed, checksummed telemetry protocol (v2) shared with final.py.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every frame on the link is exactly PROTOCOL_FRAME_SIZE bytes:
+ *
+ *      offset  size  field
+ *      0       2     sync preamble 0xA5 0x5A
+ *      2       1     frame type
+ *      3       1     payload length in use (<= PROTOCOL_PAYLOAD_SIZE)
+ *      4       34    payload, zero padded
+ *      38      2     CRC-16 (IBM/ARC, sw_crc.c Crc16) over bytes 2..37, little-endian
+ *
+ * A fixed size keeps every frame a whole number of 4-byte DMA bursts and lets the
+ * receiver realign its DMA transfers on frame boundaries after an error. The decoder
+ * below resynchronizes by searching for the next preamble whenever a CRC check fails.
+ *
+***************************************************************************************/
+
+#ifndef PROTOCOL_H_
+#define PROTOCOL_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define PROTOCOL_SYNC_0             0xA5
+#define PROTOCOL_SYNC_1             0x5A
+
+#define PROTOCOL_FRAME_SIZE         40
+#define PROTOCOL_HEADER_SIZE        4
+#define PROTOCOL_CRC_SIZE           2
+#define PROTOCOL_PAYLOAD_SIZE       (PROTOCOL_FRAME_SIZE - PROTOCOL_HEADER_SIZE - PROTOCOL_CRC_SIZE)
+
+// Frame types
+#define PROTOCOL_FRAME_NONE         0x00    // marks an empty receive slot, never sent
+#define PROTOCOL_FRAME_AIRCRAFT     0x01    // ProtocolAircraft_t
+#define PROTOCOL_FRAME_BURST_END    0x02    // ProtocolBurstEnd_t
+#define PROTOCOL_FRAME_UPSERT       0x03    // ProtocolAircraft_t, applied to the live table
+#define PROTOCOL_FRAME_DELTA        0x04    // packed delta records, see below
+#define PROTOCOL_FRAME_REMOVE       0x05    // count byte followed by 3-byte ICAO24 addresses
+#define PROTOCOL_FRAME_BAUD         0x06    // ProtocolBaud_t, asks for a new link rate
+#define PROTOCOL_FRAME_BAUD_TEST    0x07    // index byte and a fixed pattern, see link_rate.c
+#define PROTOCOL_FRAME_CENTER       0x08    // ProtocolCenter_t, moves the radar center
+#define PROTOCOL_FRAME_FILTER       0x09    // ProtocolFilter_t, which aircraft are drawn and how
+#define PROTOCOL_FRAME_STATS        0x0A    // ProtocolStatsQuery_t, on UART0 from the debug console
+#define PROTOCOL_FRAME_COMPACT      0x0B    // reference point and packed compact records, see below
+#define PROTOCOL_FRAME_SCHEDULE     0x0C    // ProtocolSchedule_t, wall clock and quiet hours
+#define PROTOCOL_FRAME_ADDRESS      0x0D    // ProtocolAddress_t, which bus nodes the frames after it are for
+#define PROTOCOL_FRAME_NODE         0x0E    // ProtocolNode_t, this unit's bus node and rate, see bus_node.h
+
+// ProtocolBurstEnd_t flags
+#define PROTOCOL_BURST_KEYFRAME     0x01    // burst replaced the whole table via staging
+#define PROTOCOL_BURST_RETIRE       0x02    // live aircraft this burst didn't upsert are removed
+
+/*
+ * Delta records are packed back to back in a DELTA payload:
+ *
+ *      3 bytes   ICAO24 address, little-endian
+ *      1 byte    field mask (PROTOCOL_DELTA_*)
+ *      2 bytes   signed delta for every bit set in the mask, in mask bit order
+ *
+ * Each delta is in the unit below, and the feeder tracks the value the firmware holds so
+ * rounding never accumulates. There is no sign extension of the address, aircraft are
+ * always 24-bit ICAO addresses.
+ */
+#define PROTOCOL_DELTA_LONGITUDE    0x01    // 1e-4 degrees
+#define PROTOCOL_DELTA_LATITUDE     0x02    // 1e-4 degrees
+#define PROTOCOL_DELTA_ALTITUDE     0x04    // 1 m
+#define PROTOCOL_DELTA_VELOCITY     0x08    // 0.1 m/s
+#define PROTOCOL_DELTA_HEADING      0x10    // 0.1 degrees
+#define PROTOCOL_DELTA_FIELDS       5
+#define PROTOCOL_DELTA_HEADER_SIZE  4
+#define PROTOCOL_ICAO24_SIZE        3
+
+/*
+ * A COMPACT payload upserts aircraft like UPSERT frames, three or so to a frame. It
+ * starts with a reference point, two int16 in 0.01 degrees, latitude first, then packs
+ * records back to back:
+ *
+ *      varint    entry << 1, PROTOCOL_COMPACT_DEFINE set if the aircraft follows
+ *      3 bytes   ICAO24 address, only with PROTOCOL_COMPACT_DEFINE
+ *      varint    callsign length, at most 8, only with PROTOCOL_COMPACT_DEFINE
+ *      n bytes   callsign, unpadded, only with PROTOCOL_COMPACT_DEFINE
+ *      2 bytes   signed latitude from the reference point, 1e-4 degrees
+ *      2 bytes   signed longitude from the reference point, 1e-4 degrees
+ *      varint    altitude in 25 ft steps
+ *      1 byte    velocity in 2 m/s steps
+ *      1 byte    heading in 1/256 of a turn
+ *
+ * Varints are little-endian base 128, the top bit of a byte set when another follows.
+ * The feeder numbers each aircraft with a dictionary entry the first time it sends it,
+ * and after that the entry stands in for the address and callsign. An entry the
+ * firmware doesn't know, or one whose aircraft has since left the live table, is
+ * counted in ProtocolCredit_t and the feeder starts its dictionary over.
+ */
+#define PROTOCOL_COMPACT_DEFINE         0x01
+#define PROTOCOL_COMPACT_ENTRIES        256
+#define PROTOCOL_COMPACT_REFERENCE_SIZE 4
+#define PROTOCOL_COMPACT_CALLSIGN_SIZE  8
+
+// Downlink frame types, Tiva to feeder, all with PROTOCOL_FRAME_DOWNLINK set
+#define PROTOCOL_FRAME_DOWNLINK     0x80
+#define PROTOCOL_FRAME_CREDIT       0x80    // ProtocolCredit_t
+#define PROTOCOL_FRAME_LATENCY      0x81    // ProtocolLatency_t
+#define PROTOCOL_FRAME_VIEW         0x82    // ProtocolView_t
+#define PROTOCOL_FRAME_BAUD_REPLY   0x83    // ProtocolBaud_t
+
+// ProtocolBaud_t status, replies only
+#define PROTOCOL_BAUD_SWITCHING     0x01    // sent at the old rate, the new one starts next
+#define PROTOCOL_BAUD_CONFIRMED     0x02    // every test frame arrived, the new rate stays
+#define PROTOCOL_BAUD_REJECTED      0x03    // rate not supported, nothing changed
+#define PROTOCOL_BAUD_FALLBACK      0x04    // test frames went missing, back at the old rate
+
+// Bus nodes, see bus_node.h
+#define PROTOCOL_BUS_NODES          32      // one bit each in ProtocolAddress_t
+#define PROTOCOL_BUS_NONE           0xFF    // no node: not on a bus, or nobody polled
+
+// View flags
+#define PROTOCOL_VIEW_SELECTED      0x01    // selected_icao24 is valid
+#define PROTOCOL_VIEW_QUIET         0x02    // in quiet hours, one keyframe per wake, see quiet_hours.h
+
+// ProtocolCenter_t flags
+#define PROTOCOL_CENTER_STORE       0x01    // also keep it in EEPROM for the next boot
+
+// ProtocolFilter_t flags
+#define PROTOCOL_FILTER_HIDE_UNNAMED    0x01    // hide aircraft without a callsign
+#define PROTOCOL_FILTER_ALTITUDE_COLORS 0x02    // color each aircraft by its altitude
+
+// ProtocolStatsQuery_t groups, each answered with log records, see System/console.h
+#define PROTOCOL_STATS_TRAFFIC      0x01    // aircraft counts and parse rate
+#define PROTOCOL_STATS_LINK         0x02    // link_health.h counters
+#define PROTOCOL_STATS_FRAMES       0x04    // render frame times and latency
+#define PROTOCOL_STATS_LOCKS        0x08    // time spent waiting on each lock
+#define PROTOCOL_STATS_QUEUES       0x10    // receive and log ring high-water marks
+#define PROTOCOL_STATS_STACKS       0x20    // stack high water
+#define PROTOCOL_STATS_CPU          0x40    // each thread's share of the CPU, PROFILE_ENABLE builds
+#define PROTOCOL_STATS_ALL          0x7F
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint8_t sync[2];
+    uint8_t type;
+    uint8_t length;
+    uint8_t payload[PROTOCOL_PAYLOAD_SIZE];
+    uint16_t crc;
+} ProtocolFrame_t;
+
+// All wire fields are little-endian and word aligned inside the payload
+typedef struct {
+    uint32_t icao24;
+    char callsign[8];       // space padded, not null terminated
+    int32_t longitude;      // degrees * 10000
+    int32_t latitude;       // degrees * 10000
+    int32_t altitude;       // meters * 10000
+    int32_t velocity;       // m/s * 10000
+    int32_t heading;        // degrees * 10000
+} ProtocolAircraft_t;
+
+typedef struct {
+    uint16_t frame_count;       // aircraft, upsert, compact, delta, remove and filter frames in this burst
+    uint8_t flags;              // PROTOCOL_BURST_*
+    uint8_t reserved;
+    uint32_t sequence;          // burst number, echoed back in ProtocolLatency_t
+    uint32_t host_ms;           // feeder's clock when the API response came in
+} ProtocolBurstEnd_t;
+
+typedef struct {
+    uint32_t consumed_total;    // frames parsed since boot, wraps
+    uint8_t free_slots;         // receive slots currently free
+    uint8_t window;             // frames the feeder may have outstanding
+    uint16_t compact_misses;    // compact records for an unknown entry since boot, wraps
+} ProtocolCredit_t;
+
+// How long a burst took on the Tiva, each stage in milliseconds from the previous one
+typedef struct {
+    uint32_t sequence;          // from the burst's ProtocolBurstEnd_t
+    uint32_t host_ms;           // likewise, so the feeder can match it without a lookup
+    uint16_t receive_ms;        // first frame parsed to end-of-burst parsed
+    uint16_t publish_ms;        // end-of-burst to the data being live (the swap for keyframes)
+    uint16_t draw_ms;           // live to the display finishing the first frame showing it
+} ProtocolLatency_t;
+
+// Link rate request from the feeder, and the Tiva's replies
+typedef struct {
+    uint32_t baud;
+    uint8_t test_frames;        // request: test frames that follow, at most 32. Reply: how many arrived
+    uint8_t status;             // PROTOCOL_BAUD_*, zero in requests
+    uint16_t reserved;
+} ProtocolBaud_t;
+
+// What the display is showing, the feeder only sends aircraft inside range_km of the center
+typedef struct {
+    uint32_t selected_icao24;   // selected aircraft, 0 if none
+    uint16_t range_km;          // display_range_km
+    uint8_t flags;              // PROTOCOL_VIEW_*
+    uint8_t reserved;
+    int32_t center_latitude;    // micro-degrees
+    int32_t center_longitude;   // micro-degrees
+} ProtocolView_t;
+
+// New radar center from the feeder, echoed back in the next ProtocolView_t
+typedef struct {
+    int32_t latitude;           // micro-degrees
+    int32_t longitude;          // micro-degrees
+    uint8_t flags;              // PROTOCOL_CENTER_*
+    uint8_t reserved[3];
+} ProtocolCenter_t;
+
+// Display filter from the feeder, sent with every keyframe so a reset picks it up again
+typedef struct {
+    int16_t min_altitude;       // meters, aircraft outside the band are hidden
+    int16_t max_altitude;       // meters
+    int16_t min_velocity;       // 0.1 m/s, slower aircraft are hidden
+    uint8_t flags;              // PROTOCOL_FILTER_*
+    uint8_t reserved;
+} ProtocolFilter_t;
+
+// Wall clock and quiet hours from the feeder, sent ahead of every keyframe
+typedef struct {
+    uint32_t utc_seconds;       // feeder's clock, seconds since 1970
+    int16_t utc_offset_min;     // local time minus UTC
+    uint16_t quiet_start_min;   // local minutes after midnight the quiet hours start
+    uint16_t quiet_end_min;     // and end, the same as the start for none
+    uint16_t period_s;          // time between wakes in quiet hours
+} ProtocolSchedule_t;
+
+// On a bus, the frames up to the next one are for `nodes`, and `poll` may answer
+typedef struct {
+    uint32_t nodes;             // bit per node, node 0 in bit 0
+    uint8_t poll;               // node that sends its downlink frames now, or PROTOCOL_BUS_NONE
+    uint8_t reserved[3];
+} ProtocolAddress_t;
+
+// Bus node and rate to take from the next boot on, kept in EEPROM
+typedef struct {
+    uint32_t baud;              // bus rate, LINK_RATE_DEFAULT_BAUD to LINK_RATE_MAX_BAUD
+    uint8_t node;               // below PROTOCOL_BUS_NODES, or PROTOCOL_BUS_NONE for a point-to-point link
+    uint8_t reserved[3];
+} ProtocolNode_t;
+
+// Statistics the debug console asks for, the replies are log records on UART0
+typedef struct {
+    uint32_t groups;            // PROTOCOL_STATS_*
+} ProtocolStatsQuery_t;
+
+typedef struct {
+    ProtocolFrame_t frame;      // frame being assembled, also holds the last good frame
+    uint32_t fill;              // bytes buffered in frame
+    uint32_t crc_errors;
+    uint32_t sync_errors;
+} ProtocolDecoder_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Protocol_InitDecoder(ProtocolDecoder_t *decoder);
+bool Protocol_CheckFrame(const ProtocolFrame_t *frame);
+void Protocol_EncodeFrame(ProtocolFrame_t *frame, uint8_t type, const void *payload, uint8_t length);
+uint32_t Protocol_Decode(ProtocolDecoder_t *decoder, const uint8_t *data, uint32_t length, bool *frame_ready);
+
+/********************************Public Functions***********************************/
+
+#endif /* PROTOCOL_H_ */
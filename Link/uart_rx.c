@@ -0,0 +1,523 @@
+/***************************************************************************************
+ * @file        uart_rx.c
+ * @brief       DMA-driven UART4 receive path for aircraft telemetry.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The primary and alternate control structures of the UART4 RX channel are always armed
+ * on two consecutive ring slots. When one finishes, the interrupt checks that slot and
+ * re-arms the structure on the next free slot while the other structure keeps
+ * receiving, so no byte is lost across the hand-off.
+ *
+ * While the stream is aligned every transfer is exactly one frame and is validated in
+ * place. After a dropped or corrupted byte the chunk goes through the protocol decoder,
+ * which resynchronizes on the next preamble, and the following transfer is shortened so
+ * later transfers line up with frame boundaries again.
+ *
+ * The channel uses burst requests only, 4 bytes at a time. Bytes that do not add up to a
+ * whole burst stay in the UART FIFO and raise the receive-timeout interrupt once the line
+ * goes quiet, at which point the in-flight transfer is flushed through the decoder.
+ *
+ * Frames that came in on the USB port wait in usb_link.c's ring. The consumer side here
+ * drains both, so the parser and the credits don't care which way a frame arrived.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./uart_rx.h"
+#include "./uart_tx.h"
+#include "./usb_link.h"
+#include "./compact.h"
+#include "System/dma_table.h"
+#include "System/arena.h"
+#include "System/ramfunc.h"
+
+#include <string.h>
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define UART_RX_DMA_CHANNEL     UDMA_CH18_UART4RX
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Frame slots, word-aligned so the parser can read the fields in place
+static FrameRing_t *rx_ring;     // carved from the arena
+static ProtocolFrame_t rx_discard;
+
+// Ring the frame last handed to the parser came from, UART4's or the USB port's
+static FrameRing_t *rx_peeked;
+
+static ProtocolDecoder_t rx_decoder;
+
+#if UART_RX_USE_DMA
+// Slot and transfer length of each control structure, NULL when receiving into rx_discard
+static ProtocolFrame_t *rx_primary_slot = NULL;
+static ProtocolFrame_t *rx_alternate_slot = NULL;
+static uint32_t rx_primary_length = PROTOCOL_FRAME_SIZE;
+static uint32_t rx_alternate_length = PROTOCOL_FRAME_SIZE;
+
+// Control structure that will complete next
+static uint32_t rx_next_select = UDMA_PRI_SELECT;
+#endif
+
+// Flow control, frames handed to the parser and how many the feeder has been told about
+static uint32_t rx_consumed_total = 0;
+static uint32_t rx_credited_total = 0;
+
+static volatile uint32_t rx_overflow_count = 0;
+static volatile uint32_t rx_resync_count = 0;
+static uint32_t rx_restart_count = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Claims the next free ring slot.
+ *
+ * @return ProtocolFrame_t* The slot, or NULL if the consumer is too far behind and
+ *                          every slot is still waiting to be parsed.
+ */
+static ProtocolFrame_t *claim_slot(void) {
+    ProtocolFrame_t *slot = FrameRing_Reserve(rx_ring);
+
+    if (slot == NULL)
+        rx_overflow_count++;
+
+    return slot;
+}
+
+static ProtocolFrame_t *slot_buffer(ProtocolFrame_t *slot) {
+    return (slot == NULL) ? &rx_discard : slot;
+}
+
+/**
+ * @brief Hands a slot back to whichever receiver filled it.
+ */
+static void release_slot(FrameRing_t *ring) {
+    FrameRing_Release(ring);
+
+    if (ring != rx_ring)
+        UsbLink_Resume();
+}
+
+/**
+ * @brief Returns the oldest valid frame in one ring, releasing the empty slots ahead of it.
+ */
+static const ProtocolFrame_t *peek_ring(FrameRing_t *ring) {
+    const ProtocolFrame_t *frame;
+
+    while ((frame = FrameRing_Peek(ring)) != NULL) {
+        if (frame->type != PROTOCOL_FRAME_NONE)
+            return frame;
+
+        release_slot(ring);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Validates the bytes received into a slot and commits the slot.
+ *
+ * A slot that does not end up holding a valid frame is still committed, marked as
+ * PROTOCOL_FRAME_NONE, so slots always reach the consumer in the order they were claimed.
+ *
+ * @param slot   Slot the bytes were received into.
+ * @param length Number of bytes received into the slot.
+ * @return bool True if the ring was empty before this slot was published.
+ */
+RAMFUNC static bool commit_chunk(ProtocolFrame_t *slot, uint32_t length) {
+    ProtocolFrame_t *chunk = slot_buffer(slot);
+    bool valid = false;
+
+    // Fast path, the stream is aligned and the frame is checked where it landed
+    if (rx_decoder.fill == 0 && length == PROTOCOL_FRAME_SIZE && Protocol_CheckFrame(chunk)) {
+        valid = true;
+    } else {
+        ProtocolFrame_t completed;
+        const uint8_t *bytes = (const uint8_t *)chunk;
+        uint32_t offset = 0;
+
+        // A chunk is never longer than a frame, so at most one frame completes in it
+        while (offset < length) {
+            bool frame_ready;
+            offset += Protocol_Decode(&rx_decoder, bytes + offset, length - offset, &frame_ready);
+
+            if (frame_ready) {
+                completed = rx_decoder.frame;
+                valid = true;
+            }
+        }
+
+        if (valid)
+            *chunk = completed;
+        else
+            chunk->type = PROTOCOL_FRAME_NONE;
+    }
+
+    // On a bus this unit hears every reply, its own included, none of them are for it
+    if (valid && (chunk->type & PROTOCOL_FRAME_DOWNLINK))
+        chunk->type = PROTOCOL_FRAME_NONE;
+
+    if (slot == NULL)
+        return false;
+
+    return FrameRing_Publish(rx_ring);
+}
+
+#if UART_RX_USE_DMA
+
+/**
+ * @brief Picks a transfer length that ends on the next frame boundary.
+ *
+ * @param inflight_length Bytes the other control structure will still deliver before
+ *                        the transfer being armed starts.
+ */
+static uint32_t aligned_length(uint32_t inflight_length) {
+    uint32_t partial = (rx_decoder.fill + inflight_length) % PROTOCOL_FRAME_SIZE;
+    return partial ? (PROTOCOL_FRAME_SIZE - partial) : PROTOCOL_FRAME_SIZE;
+}
+
+/**
+ * @brief Arms one control structure of the RX channel on a slot.
+ */
+static void arm_transfer(uint32_t select, ProtocolFrame_t *slot, uint32_t length) {
+    uDMAChannelTransferSet(UART_RX_DMA_CHANNEL | select, UDMA_MODE_PINGPONG,
+                           (void *)(UART4_BASE + UART_O_DR), slot_buffer(slot), length);
+}
+
+/**
+ * @brief Arms both control structures on fresh slots, primary first, and enables the channel.
+ */
+static void rearm(void) {
+    rx_primary_slot = claim_slot();
+    rx_primary_length = aligned_length(0);
+    rx_alternate_slot = claim_slot();
+    rx_alternate_length = aligned_length(rx_primary_length);
+
+    uDMAChannelAttributeDisable(UART_RX_DMA_CHANNEL, UDMA_ATTR_ALTSELECT);
+    arm_transfer(UDMA_PRI_SELECT, rx_primary_slot, rx_primary_length);
+    arm_transfer(UDMA_ALT_SELECT, rx_alternate_slot, rx_alternate_length);
+    rx_next_select = UDMA_PRI_SELECT;
+
+    uDMAChannelEnable(UART_RX_DMA_CHANNEL);
+}
+
+/**
+ * @brief Restarts both transfers after the line went quiet mid-burst.
+ *
+ * The partially filled transfer is pushed through the decoder, followed by whatever is
+ * left in the UART FIFO, and both structures are re-armed on fresh slots with lengths
+ * that line up with the next frame boundary.
+ *
+ * @return bool True if the consumer needs waking.
+ */
+static bool flush(void) {
+    bool wake = false;
+
+    uDMAChannelDisable(UART_RX_DMA_CHANNEL);
+
+    ProtocolFrame_t *active_slot = (rx_next_select == UDMA_PRI_SELECT) ? rx_primary_slot : rx_alternate_slot;
+    ProtocolFrame_t *idle_slot = (rx_next_select == UDMA_PRI_SELECT) ? rx_alternate_slot : rx_primary_slot;
+    uint32_t active_length = (rx_next_select == UDMA_PRI_SELECT) ? rx_primary_length : rx_alternate_length;
+
+    // Bytes the DMA already moved into the active slot come first
+    uint32_t received = active_length - uDMAChannelSizeGet(UART_RX_DMA_CHANNEL | rx_next_select);
+    wake |= commit_chunk(active_slot, received);
+
+    // Then the stragglers still sitting in the FIFO, read into the untouched slot
+    uint8_t *idle = (uint8_t *)slot_buffer(idle_slot);
+    uint32_t stragglers = 0;
+    while (UARTCharsAvail(UART4_BASE) && stragglers < PROTOCOL_FRAME_SIZE) {
+        idle[stragglers++] = UARTCharGetNonBlocking(UART4_BASE);
+    }
+    wake |= commit_chunk(idle_slot, stragglers);
+
+    rearm();
+    rx_resync_count++;
+
+    return wake;
+}
+
+#endif
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up the UART4 receive path.
+ *
+ * Must be called after multimod_init() has configured UART4 and before the scheduler
+ * is launched. In DMA mode the per-byte RX interrupt is replaced by the DMA-done and
+ * receive-timeout interrupts.
+ */
+void UartRx_Init(void) {
+    rx_ring = Arena_Alloc(sizeof(FrameRing_t), "RX ring");
+    FrameRing_Init(rx_ring);
+    rx_peeked = rx_ring;
+    Protocol_InitDecoder(&rx_decoder);
+
+#if UART_RX_USE_DMA
+    DMA_Init();
+
+    UARTIntDisable(UART4_BASE, UART_INT_RX | UART_INT_RT);
+
+    // Trigger a DMA burst every 4 bytes
+    UARTFIFOEnable(UART4_BASE);
+    UARTFIFOLevelSet(UART4_BASE, UART_FIFO_TX4_8, UART_FIFO_RX2_8);
+
+    uDMAChannelAssign(UART_RX_DMA_CHANNEL);
+    uDMAChannelAttributeDisable(UART_RX_DMA_CHANNEL, UDMA_ATTR_ALTSELECT |
+                                                     UDMA_ATTR_HIGH_PRIORITY |
+                                                     UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(UART_RX_DMA_CHANNEL, UDMA_ATTR_USEBURST);
+
+    uDMAChannelControlSet(UART_RX_DMA_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_4);
+    uDMAChannelControlSet(UART_RX_DMA_CHANNEL | UDMA_ALT_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_4);
+
+    rx_primary_slot = claim_slot();
+    rx_alternate_slot = claim_slot();
+    arm_transfer(UDMA_PRI_SELECT, rx_primary_slot, rx_primary_length);
+    arm_transfer(UDMA_ALT_SELECT, rx_alternate_slot, rx_alternate_length);
+    rx_next_select = UDMA_PRI_SELECT;
+
+    UARTDMAEnable(UART4_BASE, UART_DMA_RX);
+    uDMAChannelEnable(UART_RX_DMA_CHANNEL);
+
+    UARTIntClear(UART4_BASE, UART_INT_DMARX | UART_INT_RT);
+    UARTIntEnable(UART4_BASE, UART_INT_DMARX | UART_INT_RT);
+#else
+    UARTIntEnable(UART4_BASE, UART_INT_RX | UART_INT_RT);
+#endif
+
+    // Let a feeder that is already waiting know the receiver is up
+    UartRx_SendCredit();
+}
+
+/**
+ * @brief Services the UART4 interrupt.
+ *
+ * In DMA mode every transfer that has completed is committed, in the order they were
+ * armed, and each finished control structure is re-armed on the next free slot.
+ * Otherwise the FIFO is drained byte by byte through the decoder.
+ *
+ * @return bool True if the ring went from empty to non-empty, in which case the consumer
+ *              has to be woken. Otherwise it is still draining and will see the new
+ *              frames on its own.
+ */
+RAMFUNC bool UartRx_HandleInterrupt(void) {
+    uint32_t status = UARTIntStatus(UART4_BASE, true);
+    UARTIntClear(UART4_BASE, status);
+
+    bool wake = false;
+
+#if UART_RX_USE_DMA
+    while (uDMAChannelModeGet(UART_RX_DMA_CHANNEL | rx_next_select) == UDMA_MODE_STOP) {
+        bool primary = (rx_next_select == UDMA_PRI_SELECT);
+        ProtocolFrame_t **slot = primary ? &rx_primary_slot : &rx_alternate_slot;
+        uint32_t *length = primary ? &rx_primary_length : &rx_alternate_length;
+        uint32_t inflight_length = primary ? rx_alternate_length : rx_primary_length;
+
+        wake |= commit_chunk(*slot, *length);
+
+        *slot = claim_slot();
+        *length = aligned_length(inflight_length);
+        arm_transfer(rx_next_select, *slot, *length);
+
+        rx_next_select ^= UDMA_ALT_SELECT;
+    }
+
+    // Both structures may have finished before we got here
+    if (!uDMAChannelIsEnabled(UART_RX_DMA_CHANNEL)) {
+        uDMAChannelEnable(UART_RX_DMA_CHANNEL);
+    }
+
+    // The line went quiet with bytes that don't make a full burst
+    if ((status & UART_INT_RT) && UARTCharsAvail(UART4_BASE)) {
+        wake |= flush();
+    }
+#else
+    while (UARTCharsAvail(UART4_BASE)) {
+        uint8_t byte = UARTCharGetNonBlocking(UART4_BASE);
+        bool frame_ready;
+
+        Protocol_Decode(&rx_decoder, &byte, 1, &frame_ready);
+
+        if (frame_ready && !(rx_decoder.frame.type & PROTOCOL_FRAME_DOWNLINK)) {
+            ProtocolFrame_t *slot = claim_slot();
+            if (slot != NULL) {
+                *slot = rx_decoder.frame;
+                wake |= FrameRing_Publish(rx_ring);
+            }
+        }
+    }
+#endif
+
+    return wake;
+}
+
+/**
+ * @brief Starts the receive path over without touching the UART rate or the ring's frames.
+ *
+ * The bytes on the line and in the slots being received into are dropped, the UART's
+ * error flags are cleared and the decoder starts looking for a preamble again. In DMA
+ * mode both control structures are re-armed on fresh slots, the old ones going to the
+ * consumer empty so the ring keeps its order. The feeder gets a credit, in case the
+ * last ones never reached it.
+ *
+ * Call from a thread.
+ *
+ * @return bool True if frames are waiting in the ring, in which case the consumer has to
+ *              be woken. A lost wake-up would otherwise leave them there.
+ */
+bool UartRx_Restart(void) {
+    bool wake = false;
+    bool masked = IntMasterDisable();
+
+    rx_decoder.fill = 0;
+
+#if UART_RX_USE_DMA
+    uDMAChannelDisable(UART_RX_DMA_CHANNEL);
+
+    ProtocolFrame_t *active_slot = (rx_next_select == UDMA_PRI_SELECT) ? rx_primary_slot : rx_alternate_slot;
+    ProtocolFrame_t *idle_slot = (rx_next_select == UDMA_PRI_SELECT) ? rx_alternate_slot : rx_primary_slot;
+
+    wake |= commit_chunk(active_slot, 0);
+    wake |= commit_chunk(idle_slot, 0);
+#endif
+
+    while (UARTCharsAvail(UART4_BASE)) {
+        UARTCharGetNonBlocking(UART4_BASE);
+    }
+    UARTRxErrorClear(UART4_BASE);
+
+#if UART_RX_USE_DMA
+    rearm();
+    UARTDMAEnable(UART4_BASE, UART_DMA_RX);
+
+    UARTIntClear(UART4_BASE, UART_INT_DMARX | UART_INT_RT);
+    UARTIntEnable(UART4_BASE, UART_INT_DMARX | UART_INT_RT);
+#else
+    UARTIntClear(UART4_BASE, UART_INT_RX | UART_INT_RT);
+    UARTIntEnable(UART4_BASE, UART_INT_RX | UART_INT_RT);
+#endif
+
+    rx_restart_count++;
+    wake |= FrameRing_Count(rx_ring) > 0;
+
+    if (!masked)
+        IntMasterEnable();
+
+    UartRx_SendCredit();
+    return wake;
+}
+
+/**
+ * @brief Returns the oldest valid frame without removing it from the ring.
+ *
+ * Slots that did not end up holding a valid frame are skipped. UART4's ring goes first,
+ * then the USB port's; only one feeder is ever sending, so nothing is reordered.
+ *
+ * @return const ProtocolFrame_t* The frame, or NULL if both rings are empty.
+ */
+const ProtocolFrame_t *UartRx_PeekFrame(void) {
+    FrameRing_t *usb_ring = UsbLink_GetRing();
+
+    rx_peeked = rx_ring;
+    const ProtocolFrame_t *frame = peek_ring(rx_ring);
+
+    if (frame == NULL && usb_ring != NULL) {
+        rx_peeked = usb_ring;
+        frame = peek_ring(usb_ring);
+    }
+
+    return frame;
+}
+
+/**
+ * @brief Hands the oldest frame slot back to the receiver once it has been parsed.
+ *
+ * Credits are returned to the feeder in batches, and whenever the ring runs empty so a
+ * short burst tail never leaves the feeder waiting.
+ */
+void UartRx_ReleaseFrame(void) {
+    if (FrameRing_Count(rx_peeked) == 0)
+        return;
+
+    release_slot(rx_peeked);
+    rx_consumed_total++;
+
+    if (rx_consumed_total - rx_credited_total >= UART_RX_CREDIT_BATCH ||
+        FrameRing_Count(rx_peeked) == 0) {
+        UartRx_SendCredit();
+    }
+}
+
+/**
+ * @brief Tells the feeder how many frames have been consumed so far.
+ *
+ * The count is cumulative, so a credit frame lost on the line or skipped because the
+ * transmitter was busy is made up for by the next one. The receiver sends them by
+ * itself, and bus_node.c ahead of every reply to a poll.
+ */
+void UartRx_SendCredit(void) {
+    ProtocolCredit_t credit;
+
+    credit.consumed_total = rx_consumed_total;
+    credit.free_slots = FrameRing_Free(UsbLink_IsOpen() ? UsbLink_GetRing() : rx_ring);
+    credit.window = UART_RX_CREDIT_WINDOW;
+    credit.compact_misses = Compact_GetMisses();
+
+    if (UartTx_SendFrame(PROTOCOL_FRAME_CREDIT, &credit, sizeof(credit)))
+        rx_credited_total = rx_consumed_total;
+}
+
+uint32_t UartRx_GetConsumedCount(void) {
+    return rx_consumed_total;
+}
+
+uint32_t UartRx_GetOverflowCount(void) {
+    return rx_overflow_count;
+}
+
+/**
+ * @brief Times the receiver lost frame alignment, flushes and bytes skipped by the decoder alike.
+ */
+uint32_t UartRx_GetResyncCount(void) {
+    return rx_resync_count + rx_decoder.sync_errors;
+}
+
+uint32_t UartRx_GetCrcErrorCount(void) {
+    return rx_decoder.crc_errors;
+}
+
+uint32_t UartRx_GetRestartCount(void) {
+    return rx_restart_count;
+}
+
+uint32_t UartRx_GetRingHighWater(void) {
+    return FrameRing_HighWater(rx_ring);
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        uart_rx.h
+ * @brief       DMA-driven UART4 receive path for aircraft telemetry.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * UART4 RX is serviced by uDMA channel 18 in ping-pong mode. Each transfer lands one
+ * frame directly into a slot of a small ring of frame buffers, where it is checked in
+ * place, so the CPU is only interrupted once per completed frame instead of once per
+ * FIFO trigger.
+ *
+ * The slots live in a lock-free frame ring whose producer is the UART4 interrupt and
+ * whose consumer is Process_New_Aircraft_Thread. The interrupt only reports that the
+ * consumer needs waking when the ring goes from empty to non-empty, and the consumer
+ * drains every published frame on each wake-up, so a burst costs one semaphore signal
+ * rather than one per frame.
+ *
+ * Flow control is credit based since UART4 has no RTS/CTS pins. As frames are parsed
+ * the receiver sends the cumulative number of consumed frames back to the feeder, which
+ * keeps at most UART_RX_CREDIT_WINDOW frames outstanding and otherwise streams at line
+ * rate.
+ *
+***************************************************************************************/
+
+#ifndef UART_RX_H_
+#define UART_RX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "./protocol.h"
+#include "./frame_ring.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef UART_RX_USE_DMA
+#define UART_RX_USE_DMA         1    // 0 = per-byte ISR feeding the same ring
+#endif
+
+#define UART_RX_CREDIT_WINDOW   (FRAME_RING_SIZE - 2)  // two slots stay armed on the DMA
+#define UART_RX_CREDIT_BATCH    (UART_RX_CREDIT_WINDOW / 2)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void UartRx_Init(void);
+bool UartRx_HandleInterrupt(void);
+
+const ProtocolFrame_t *UartRx_PeekFrame(void);
+void UartRx_ReleaseFrame(void);
+
+bool UartRx_Restart(void);
+void UartRx_SendCredit(void);
+
+uint32_t UartRx_GetConsumedCount(void);
+uint32_t UartRx_GetOverflowCount(void);
+uint32_t UartRx_GetResyncCount(void);
+uint32_t UartRx_GetCrcErrorCount(void);
+uint32_t UartRx_GetRestartCount(void);
+uint32_t UartRx_GetRingHighWater(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* UART_RX_H_ */
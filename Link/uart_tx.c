@@ -0,0 +1,151 @@
+/***************************************************************************************
+ * @file        uart_tx.c
+ * @brief       DMA-driven UART4 transmit path for downlink frames to the feeder.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * There is a single transmit buffer. If the previous frame is still going out, the new
+ * one is dropped and counted. Every downlink frame carries absolute state rather than
+ * increments, so a dropped frame is simply superseded by the next one. On a bus, frames
+ * are held by bus_node.c until the feeder polls this unit, which sends them together.
+ * While a host has the USB port open the frames go to it instead, see usb_link.h.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./uart_tx.h"
+#include "./bus_node.h"
+#include "./usb_link.h"
+#include "System/dma_table.h"
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define UART_TX_DMA_CHANNEL     UDMA_CH19_UART4TX
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static ProtocolFrame_t tx_frame;
+static volatile uint32_t tx_dropped_count = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Hands `size` bytes to the channel. Must be called with interrupts masked and the channel idle.
+ */
+static void start_transfer(const void *bytes, uint32_t size) {
+    uDMAChannelTransferSet(UART_TX_DMA_CHANNEL | UDMA_PRI_SELECT, UDMA_MODE_BASIC,
+                           (void *)bytes, (void *)(UART4_BASE + UART_O_DR), size);
+    uDMAChannelEnable(UART_TX_DMA_CHANNEL);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up uDMA channel 19 to feed the UART4 transmit FIFO.
+ *
+ * Must be called after multimod_init() has configured UART4.
+ */
+void UartTx_Init(void) {
+    DMA_Init();
+
+    uDMAChannelAssign(UART_TX_DMA_CHANNEL);
+    uDMAChannelAttributeDisable(UART_TX_DMA_CHANNEL, UDMA_ATTR_ALTSELECT |
+                                                     UDMA_ATTR_HIGH_PRIORITY |
+                                                     UDMA_ATTR_REQMASK);
+
+    uDMAChannelControlSet(UART_TX_DMA_CHANNEL | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_4);
+
+    UARTDMAEnable(UART4_BASE, UART_DMA_TX);
+}
+
+/**
+ * @brief Returns true while the previous frame is still being transmitted.
+ */
+bool UartTx_IsBusy(void) {
+    return uDMAChannelIsEnabled(UART_TX_DMA_CHANNEL);
+}
+
+/**
+ * @brief Encodes a frame and starts transmitting it without blocking.
+ *
+ * @return bool false if the previous frame was still in flight and this one was dropped.
+ */
+bool UartTx_SendFrame(uint8_t type, const void *payload, uint8_t length) {
+    bool started = false;
+
+    // On a bus it waits for the feeder to poll this unit
+    if (BusNode_Hold(type, payload, length))
+        return true;
+
+    // The feeder reading the USB port hears nothing on UART4
+    if (UsbLink_IsOpen())
+        return UsbLink_SendFrame(type, payload, length);
+
+    // Several threads may send, claim the buffer atomically
+    bool interrupts_disabled = IntMasterDisable();
+
+    if (!UartTx_IsBusy()) {
+        Protocol_EncodeFrame(&tx_frame, type, payload, length);
+        start_transfer(&tx_frame, PROTOCOL_FRAME_SIZE);
+        started = true;
+    } else {
+        tx_dropped_count++;
+    }
+
+    if (!interrupts_disabled)
+        IntMasterEnable();
+
+    return started;
+}
+
+/**
+ * @brief Starts transmitting frames already encoded back to back, without blocking.
+ *
+ * The frames must stay untouched until UartTx_IsBusy returns false.
+ *
+ * @return bool false if the previous transfer was still in flight and these were dropped.
+ */
+bool UartTx_SendFrames(const ProtocolFrame_t *frames, uint8_t count) {
+    bool started = false;
+    bool interrupts_disabled = IntMasterDisable();
+
+    if (!UartTx_IsBusy()) {
+        start_transfer(frames, count * PROTOCOL_FRAME_SIZE);
+        started = true;
+    } else {
+        tx_dropped_count++;
+    }
+
+    if (!interrupts_disabled)
+        IntMasterEnable();
+
+    return started;
+}
+
+uint32_t UartTx_GetDroppedCount(void) {
+    return tx_dropped_count;
+}
+
+/********************************Public Functions***********************************/
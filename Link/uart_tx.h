@@ -0,0 +1,42 @@
+/***************************************************************************************
+ * @file        uart_tx.h
+ * @brief       DMA-driven UART4 transmit path for downlink frames to the feeder.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Downlink frames (credits and later status reports) use the same v2 framing as the
+ * uplink. A frame is handed to uDMA channel 19 and the caller returns immediately, so no
+ * thread ever blocks on the 115,200 baud line.
+ *
+***************************************************************************************/
+
+#ifndef UART_TX_H_
+#define UART_TX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void UartTx_Init(void);
+bool UartTx_IsBusy(void);
+bool UartTx_SendFrame(uint8_t type, const void *payload, uint8_t length);
+bool UartTx_SendFrames(const ProtocolFrame_t *frames, uint8_t count);
+
+uint32_t UartTx_GetDroppedCount(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* UART_TX_H_ */
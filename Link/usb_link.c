@@ -0,0 +1,638 @@
+/***************************************************************************************
+ * @file        usb_link.c
+ * @brief       USB CDC device port, a faster way in for the feeder than UART4.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Just enough of a USB device for one CDC ACM port, on driverlib/usb.c alone:
+ *
+ *      EP0         control, enumeration and the CDC line requests
+ *      EP1 OUT     bulk, uplink frames
+ *      EP2 IN      bulk, downlink frames, one 40-byte frame per short packet
+ *      EP3 IN      interrupt, the ACM notification endpoint, never sent on
+ *
+ * Everything runs in the USB interrupt, which shares UART4's priority, so the two
+ * producers never preempt each other. The endpoint FIFOs are the packet buffers. An OUT
+ * packet is only known complete, and its length only known, once the controller raises
+ * RxPktRdy, and reading 64 bytes out of the FIFO costs about what setting up a uDMA
+ * transfer for them would, so they are read straight through the decoder.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./usb_link.h"
+#include "./uart_rx.h"
+#include "System/arena.h"
+#include "System/log.h"
+
+#if USB_LINK_ENABLE
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/usb.h"
+#endif
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define USB_LINK_VENDOR_ID      0x1CBE  // Texas Instruments
+#define USB_LINK_PRODUCT_ID     0x0002  // their virtual serial port
+
+#define USB_LINK_OUT_EP         USB_EP_1
+#define USB_LINK_IN_EP          USB_EP_2
+#define USB_LINK_NOTIFY_EP      USB_EP_3
+#define USB_LINK_NOTIFY_SIZE    16
+
+// Standard and CDC requests, the ones answered here
+#define REQUEST_GET_STATUS          0x00
+#define REQUEST_CLEAR_FEATURE       0x01
+#define REQUEST_SET_FEATURE         0x03
+#define REQUEST_SET_ADDRESS         0x05
+#define REQUEST_GET_DESCRIPTOR      0x06
+#define REQUEST_GET_CONFIGURATION   0x08
+#define REQUEST_SET_CONFIGURATION   0x09
+#define REQUEST_GET_INTERFACE       0x0A
+#define REQUEST_SET_INTERFACE       0x0B
+#define REQUEST_SET_LINE_CODING     0x20
+#define REQUEST_GET_LINE_CODING     0x21
+#define REQUEST_SET_LINE_STATE      0x22
+#define REQUEST_SEND_BREAK          0x23
+
+#define REQUEST_TYPE_MASK           0x60
+#define REQUEST_TYPE_CLASS          0x20
+
+#define DESCRIPTOR_DEVICE           1
+#define DESCRIPTOR_CONFIGURATION    2
+#define DESCRIPTOR_STRING           3
+
+#define LINE_STATE_DTR              0x0001
+#define LINE_CODING_SIZE            7
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    EP0_IDLE,
+    EP0_TX,                     // sending the rest of a descriptor
+    EP0_RX,                     // waiting for SET_LINE_CODING's data
+    EP0_STATUS,                 // waiting for the status stage to finish
+    EP0_STALL
+} Ep0State_t;
+
+typedef struct {
+    uint8_t request_type;
+    uint8_t request;
+    uint16_t value;
+    uint16_t index;
+    uint16_t length;
+} SetupPacket_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static UsbLinkStats_t stats;
+
+#if USB_LINK_ENABLE
+
+static const uint8_t device_descriptor[] = {
+    18, DESCRIPTOR_DEVICE,
+    0x00, 0x02,                                     // USB 2.0
+    0x02, 0x00, 0x00,                               // CDC, class in the interfaces
+    USB_LINK_PACKET_SIZE,
+    USB_LINK_VENDOR_ID & 0xFF, USB_LINK_VENDOR_ID >> 8,
+    USB_LINK_PRODUCT_ID & 0xFF, USB_LINK_PRODUCT_ID >> 8,
+    0x00, 0x01,                                     // device release 1.0
+    1, 2, 0,                                        // manufacturer, product, no serial number
+    1                                               // configurations
+};
+
+static const uint8_t configuration_descriptor[] = {
+    9, DESCRIPTOR_CONFIGURATION, 67, 0, 2, 1, 0, 0x80, 50,
+
+    // Communication interface, ACM with no AT commands so nothing on the host probes it
+    9, 4, 0, 0, 1, 0x02, 0x02, 0x00, 0,
+    5, 0x24, 0x00, 0x10, 0x01,                      // header, CDC 1.10
+    5, 0x24, 0x01, 0x00, 1,                         // call management, data on interface 1
+    4, 0x24, 0x02, 0x02,                            // ACM, line coding and line state
+    5, 0x24, 0x06, 0, 1,                            // union, interface 0 controls 1
+    7, 5, 0x83, 0x03, USB_LINK_NOTIFY_SIZE, 0, 10,  // EP3 IN, interrupt
+
+    // Data interface
+    9, 4, 1, 0, 2, 0x0A, 0x00, 0x00, 0,
+    7, 5, 0x01, 0x02, USB_LINK_PACKET_SIZE, 0, 0,   // EP1 OUT, bulk
+    7, 5, 0x82, 0x02, USB_LINK_PACKET_SIZE, 0, 0    // EP2 IN, bulk
+};
+
+static const uint8_t language_descriptor[] = { 4, DESCRIPTOR_STRING, 0x09, 0x04 };  // US English
+
+static const char *const strings[] = { NULL, "University of Florida", "Aircraft Display" };
+
+static FrameRing_t *usb_ring;       // carved from the arena
+static ProtocolDecoder_t usb_decoder;
+static ProtocolFrame_t tx_frame;
+
+static Ep0State_t ep0_state = EP0_IDLE;
+static const uint8_t *ep0_data;
+static uint32_t ep0_remaining;
+static uint8_t ep0_buffer[USB_LINK_PACKET_SIZE];
+static uint32_t pending_address = 0;
+
+static uint8_t configuration = 0;
+static volatile bool open = false;
+
+// A packet was left in the OUT FIFO for want of ring slots
+static volatile bool held = false;
+
+// 115,200 8N1 until the host says otherwise, nothing here depends on it
+static uint8_t line_coding[LINE_CODING_SIZE] = { 0x00, 0xC2, 0x01, 0x00, 0, 0, 8 };
+
+#endif
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+#if USB_LINK_ENABLE
+
+/**
+ * @brief Sends the next packet of the control data stage, the last one ending it.
+ */
+static void ep0_send_next(void) {
+    uint32_t size = (ep0_remaining < USB_LINK_PACKET_SIZE) ? ep0_remaining : USB_LINK_PACKET_SIZE;
+
+    USBEndpointDataPut(USB0_BASE, USB_EP_0, (uint8_t *)ep0_data, size);
+    ep0_data += size;
+    ep0_remaining -= size;
+
+    // No reply here is a whole number of packets shorter than asked for, so none needs a zero-length packet
+    if (ep0_remaining == 0) {
+        USBEndpointDataSend(USB0_BASE, USB_EP_0, USB_TRANS_IN_LAST);
+        ep0_state = EP0_STATUS;
+    } else {
+        USBEndpointDataSend(USB0_BASE, USB_EP_0, USB_TRANS_IN);
+        ep0_state = EP0_TX;
+    }
+}
+
+/**
+ * @brief Starts the data stage of an IN request, never longer than the host asked for.
+ */
+static void ep0_send(const uint8_t *data, uint32_t size, uint16_t requested) {
+    USBDevEndpointDataAck(USB0_BASE, USB_EP_0, false);
+
+    ep0_data = data;
+    ep0_remaining = (size < requested) ? size : requested;
+    ep0_send_next();
+}
+
+/**
+ * @brief Acknowledges a request with no data stage.
+ */
+static void ep0_ack(void) {
+    USBDevEndpointDataAck(USB0_BASE, USB_EP_0, true);
+    ep0_state = EP0_STATUS;
+}
+
+static void ep0_stall(void) {
+    USBDevEndpointStall(USB0_BASE, USB_EP_0, USB_EP_DEV_OUT);
+    ep0_state = EP0_STALL;
+}
+
+/**
+ * @brief Builds string descriptor `index` from its ASCII text, in ep0_buffer.
+ *
+ * @return uint32_t The descriptor's size, 0 if there is no such string.
+ */
+static uint32_t string_descriptor(uint8_t index) {
+    if (index >= sizeof(strings) / sizeof(strings[0]) || strings[index] == NULL)
+        return 0;
+
+    uint32_t size = 2;
+    for (const char *c = strings[index]; *c && size + 2 <= sizeof(ep0_buffer); c++) {
+        ep0_buffer[size++] = (uint8_t)*c;
+        ep0_buffer[size++] = 0;
+    }
+    ep0_buffer[0] = size;
+    ep0_buffer[1] = DESCRIPTOR_STRING;
+    return size;
+}
+
+static void get_descriptor(const SetupPacket_t *setup) {
+    uint8_t index = setup->value & 0xFF;
+
+    switch (setup->value >> 8) {
+        case DESCRIPTOR_DEVICE:
+            ep0_send(device_descriptor, sizeof(device_descriptor), setup->length);
+            break;
+
+        case DESCRIPTOR_CONFIGURATION:
+            ep0_send(configuration_descriptor, sizeof(configuration_descriptor), setup->length);
+            break;
+
+        case DESCRIPTOR_STRING: {
+            if (index == 0) {
+                ep0_send(language_descriptor, sizeof(language_descriptor), setup->length);
+                break;
+            }
+            uint32_t size = string_descriptor(index);
+            if (size)
+                ep0_send(ep0_buffer, size, setup->length);
+            else
+                ep0_stall();
+            break;
+        }
+
+        default:
+            ep0_stall();
+            break;
+    }
+}
+
+/**
+ * @brief Sets up the data endpoints for a configuration, clearing their toggles and FIFOs.
+ */
+static void configure_endpoints(void) {
+    USBDevEndpointConfigSet(USB0_BASE, USB_LINK_OUT_EP, USB_LINK_PACKET_SIZE, USB_EP_MODE_BULK | USB_EP_DEV_OUT);
+    USBDevEndpointConfigSet(USB0_BASE, USB_LINK_IN_EP, USB_LINK_PACKET_SIZE, USB_EP_MODE_BULK | USB_EP_DEV_IN);
+    USBDevEndpointConfigSet(USB0_BASE, USB_LINK_NOTIFY_EP, USB_LINK_NOTIFY_SIZE, USB_EP_MODE_INT | USB_EP_DEV_IN);
+
+    USBFIFOFlush(USB0_BASE, USB_LINK_OUT_EP, USB_EP_DEV_OUT);
+    USBFIFOFlush(USB0_BASE, USB_LINK_IN_EP, USB_EP_DEV_IN);
+
+    Protocol_InitDecoder(&usb_decoder);
+    held = false;
+}
+
+static void set_open(bool now_open) {
+    if (now_open == open)
+        return;
+
+    open = now_open;
+    if (open) {
+        stats.opens++;
+        LOG_INFO(LOG_USB_OPEN, stats.opens);
+
+        // The feeder that just opened the port never saw the credit sent at boot
+        UartRx_SendCredit();
+    } else {
+        LOG_INFO(LOG_USB_CLOSED, stats.packets);
+    }
+}
+
+static void handle_setup(const SetupPacket_t *setup) {
+    static uint8_t reply[2];
+
+    if ((setup->request_type & REQUEST_TYPE_MASK) == REQUEST_TYPE_CLASS) {
+        switch (setup->request) {
+            case REQUEST_SET_LINE_CODING:
+                USBDevEndpointDataAck(USB0_BASE, USB_EP_0, false);
+                ep0_state = EP0_RX;
+                return;
+
+            case REQUEST_GET_LINE_CODING:
+                ep0_send(line_coding, LINE_CODING_SIZE, setup->length);
+                return;
+
+            // pyserial raises DTR on open and drops it on close
+            case REQUEST_SET_LINE_STATE:
+                set_open(configuration != 0 && (setup->value & LINE_STATE_DTR));
+                ep0_ack();
+                return;
+
+            case REQUEST_SEND_BREAK:
+                ep0_ack();
+                return;
+
+            default:
+                ep0_stall();
+                return;
+        }
+    }
+
+    switch (setup->request) {
+        case REQUEST_GET_STATUS:
+            reply[0] = reply[1] = 0;
+            ep0_send(reply, 2, setup->length);
+            break;
+
+        // Applied once the status stage is through, the host still talks to address 0 until then
+        case REQUEST_SET_ADDRESS:
+            pending_address = setup->value & 0x7F;
+            ep0_ack();
+            break;
+
+        case REQUEST_GET_DESCRIPTOR:
+            get_descriptor(setup);
+            break;
+
+        case REQUEST_GET_CONFIGURATION:
+            reply[0] = configuration;
+            ep0_send(reply, 1, setup->length);
+            break;
+
+        case REQUEST_SET_CONFIGURATION:
+            configuration = setup->value & 0xFF;
+            if (configuration)
+                configure_endpoints();
+            else
+                set_open(false);
+            ep0_ack();
+            break;
+
+        case REQUEST_GET_INTERFACE:
+            reply[0] = 0;
+            ep0_send(reply, 1, setup->length);
+            break;
+
+        // Halts are never set here, clearing one only has to reset the toggle
+        case REQUEST_CLEAR_FEATURE:
+        case REQUEST_SET_FEATURE:
+        case REQUEST_SET_INTERFACE:
+            ep0_ack();
+            break;
+
+        default:
+            ep0_stall();
+            break;
+    }
+}
+
+/**
+ * @brief Moves the control endpoint along, on every EP0 interrupt.
+ */
+static void service_ep0(void) {
+    uint32_t status = USBEndpointStatus(USB0_BASE, USB_EP_0);
+
+    if (status & USB_DEV_EP0_SENT_STALL) {
+        USBDevEndpointStatusClear(USB0_BASE, USB_EP_0, USB_DEV_EP0_SENT_STALL);
+        ep0_state = EP0_IDLE;
+        return;
+    }
+
+    // The host gave up on the last request and started another
+    if (status & USB_DEV_EP0_SETUP_END) {
+        USBDevEndpointStatusClear(USB0_BASE, USB_EP_0, USB_DEV_EP0_SETUP_END);
+        ep0_state = EP0_IDLE;
+    }
+
+    switch (ep0_state) {
+        case EP0_STATUS:
+            if (pending_address) {
+                USBDevAddrSet(USB0_BASE, pending_address);
+                pending_address = 0;
+            }
+            ep0_state = EP0_IDLE;
+            // The next setup packet may already be in
+            // fall through
+
+        case EP0_IDLE:
+            if (status & USB_DEV_EP0_OUT_PKTRDY) {
+                SetupPacket_t setup;
+                uint32_t size = sizeof(setup);
+
+                USBEndpointDataGet(USB0_BASE, USB_EP_0, (uint8_t *)&setup, &size);
+                if (size == sizeof(setup))
+                    handle_setup(&setup);
+                else
+                    ep0_stall();
+            }
+            break;
+
+        case EP0_TX:
+            ep0_send_next();
+            break;
+
+        case EP0_RX:
+            if (status & USB_DEV_EP0_OUT_PKTRDY) {
+                uint32_t size = LINE_CODING_SIZE;
+                USBEndpointDataGet(USB0_BASE, USB_EP_0, line_coding, &size);
+                ep0_ack();
+            }
+            break;
+
+        case EP0_STALL:
+            break;
+    }
+}
+
+/**
+ * @brief Decodes one OUT packet into the ring, if it has room for every frame the packet can finish.
+ *
+ * @return bool True if the ring went from empty to non-empty.
+ */
+static bool read_packet(void) {
+    static uint8_t packet[USB_LINK_PACKET_SIZE];
+    bool wake = false;
+
+    if (!(USBEndpointStatus(USB0_BASE, USB_LINK_OUT_EP) & USB_DEV_RX_PKT_RDY)) {
+        held = false;
+        return false;
+    }
+
+    // Left in the FIFO, the host is NAKed until UsbLink_Resume
+    if (FrameRing_Free(usb_ring) < USB_LINK_PACKET_FRAMES) {
+        if (!held)
+            stats.held++;
+        held = true;
+        return false;
+    }
+    held = false;
+
+    uint32_t size = sizeof(packet);
+    USBEndpointDataGet(USB0_BASE, USB_LINK_OUT_EP, packet, &size);
+    USBDevEndpointDataAck(USB0_BASE, USB_LINK_OUT_EP, true);
+    stats.packets++;
+
+    uint32_t offset = 0;
+    while (offset < size) {
+        bool frame_ready;
+        offset += Protocol_Decode(&usb_decoder, packet + offset, size - offset, &frame_ready);
+
+        if (frame_ready && !(usb_decoder.frame.type & PROTOCOL_FRAME_DOWNLINK)) {
+            ProtocolFrame_t *slot = FrameRing_Reserve(usb_ring);
+            if (slot != NULL) {
+                *slot = usb_decoder.frame;
+                wake |= FrameRing_Publish(usb_ring);
+            }
+        }
+    }
+
+    return wake;
+}
+
+#endif
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+#if USB_LINK_ENABLE
+
+/**
+ * @brief Brings up the device port and connects to the host.
+ *
+ * Needs the main oscillator for the USB PLL, which SysCtlClockSet already runs on. Must
+ * be called after UartRx_Init and before the scheduler is launched.
+ */
+void UsbLink_Init(void) {
+    usb_ring = Arena_Alloc(sizeof(FrameRing_t), "USB ring");
+    FrameRing_Init(usb_ring);
+    Protocol_InitDecoder(&usb_decoder);
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOD);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_USB0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_USB0));
+
+    // PD4 and PD5 are D- and D+ on the LaunchPad's device connector
+    GPIOPinTypeUSBAnalog(GPIO_PORTD_BASE, GPIO_PIN_4 | GPIO_PIN_5);
+    SysCtlUSBPLLEnable();
+    USBDevMode(USB0_BASE);
+
+    // EP0 keeps the first 64 bytes of FIFO RAM
+    USBFIFOConfigSet(USB0_BASE, USB_LINK_OUT_EP, 64, USB_FIFO_SZ_64, USB_EP_DEV_OUT);
+    USBFIFOConfigSet(USB0_BASE, USB_LINK_IN_EP, 128, USB_FIFO_SZ_64, USB_EP_DEV_IN);
+    USBFIFOConfigSet(USB0_BASE, USB_LINK_NOTIFY_EP, 192, USB_FIFO_SZ_16, USB_EP_DEV_IN);
+
+    USBIntStatusControl(USB0_BASE);
+    USBIntStatusEndpoint(USB0_BASE);
+    USBIntEnableControl(USB0_BASE, USB_INTCTRL_RESET | USB_INTCTRL_DISCONNECT);
+    USBIntEnableEndpoint(USB0_BASE, USB_INTEP_0 | USB_INTEP_DEV_OUT_1);
+
+    USBDevConnect(USB0_BASE);
+}
+
+/**
+ * @brief Services the USB interrupt: bus resets, the control endpoint and uplink packets.
+ *
+ * Also runs when UsbLink_Resume pends it, with nothing flagged, to read a held packet.
+ *
+ * @return bool True if the USB ring went from empty to non-empty, in which case the
+ *              consumer has to be woken.
+ */
+bool UsbLink_HandleInterrupt(void) {
+    uint32_t control = USBIntStatusControl(USB0_BASE);
+    uint32_t endpoints = USBIntStatusEndpoint(USB0_BASE);
+    bool wake = false;
+
+    if (control & (USB_INTCTRL_RESET | USB_INTCTRL_DISCONNECT)) {
+        ep0_state = EP0_IDLE;
+        pending_address = 0;
+        configuration = 0;
+        set_open(false);
+    }
+
+    if (endpoints & USB_INTEP_0)
+        service_ep0();
+
+    if ((endpoints & USB_INTEP_DEV_OUT_1) || held)
+        wake |= read_packet();
+
+    return wake;
+}
+
+FrameRing_t *UsbLink_GetRing(void) {
+    return usb_ring;
+}
+
+/**
+ * @brief Reads a packet held back for ring space, once the parser has freed some.
+ *
+ * Called by UartRx_ReleaseFrame for every USB slot released. The interrupt is pended
+ * rather than serviced here, so the ring keeps a single producer.
+ */
+void UsbLink_Resume(void) {
+    if (held && FrameRing_Free(usb_ring) >= USB_LINK_PACKET_FRAMES)
+        IntPendSet(INT_USB0);
+}
+
+/**
+ * @brief True while a host holds the port open, and downlink frames go to it.
+ */
+bool UsbLink_IsOpen(void) {
+    return open;
+}
+
+/**
+ * @brief Encodes a frame and queues it on the bulk IN endpoint without blocking.
+ *
+ * @return bool false if the endpoint still held the last frame and this one was dropped.
+ */
+bool UsbLink_SendFrame(uint8_t type, const void *payload, uint8_t length) {
+    bool sent = false;
+    bool masked = IntMasterDisable();
+
+    if (!(USBEndpointStatus(USB0_BASE, USB_LINK_IN_EP) & USB_DEV_TX_TXPKTRDY)) {
+        Protocol_EncodeFrame(&tx_frame, type, payload, length);
+        USBEndpointDataPut(USB0_BASE, USB_LINK_IN_EP, (uint8_t *)&tx_frame, PROTOCOL_FRAME_SIZE);
+        USBEndpointDataSend(USB0_BASE, USB_LINK_IN_EP, USB_TRANS_IN);
+        sent = true;
+    } else {
+        stats.dropped++;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+
+    return sent;
+}
+
+#else
+
+void UsbLink_Init(void) {
+}
+
+bool UsbLink_HandleInterrupt(void) {
+    return false;
+}
+
+FrameRing_t *UsbLink_GetRing(void) {
+    return NULL;
+}
+
+void UsbLink_Resume(void) {
+}
+
+bool UsbLink_IsOpen(void) {
+    return false;
+}
+
+bool UsbLink_SendFrame(uint8_t type, const void *payload, uint8_t length) {
+    return false;
+}
+
+#endif
+
+/**
+ * @brief Copies out the port's counters.
+ */
+void UsbLink_GetStats(UsbLinkStats_t *copy) {
+    *copy = stats;
+#if USB_LINK_ENABLE
+    copy->crc_errors = usb_decoder.crc_errors;
+#endif
+}
+
+/**
+ * @brief Logs the port's counters once a host has opened it, for a statistics query.
+ */
+void UsbLink_Report(void) {
+    UsbLinkStats_t copy;
+
+    UsbLink_GetStats(&copy);
+    if (copy.opens)
+        LOG_INFO(LOG_STATS_USB, UsbLink_IsOpen(), copy.packets, copy.held, copy.crc_errors, copy.dropped);
+}
+
+/********************************Public Functions***********************************/
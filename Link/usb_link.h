@@ -0,0 +1,85 @@
+/***************************************************************************************
+ * @file        usb_link.h
+ * @brief       USB CDC device port, a faster way in for the feeder than UART4.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The LaunchPad's device port enumerates as a CDC ACM serial port, /dev/ttyACM0 on the
+ * BeagleBone, carrying the same 40-byte frames as UART4. Full speed bulk packets move
+ * up to 64 bytes a millisecond frame, around a hundred times what 115,200 baud does.
+ *
+ * Uplink packets are decoded in the USB interrupt into a frame ring of their own, which
+ * UartRx_PeekFrame drains along with the UART4 ring, so the parser never knows which
+ * way a frame came in and the credits count both. A packet is only read out of the
+ * endpoint FIFO once the ring has room for every frame it can complete; until then the
+ * host is NAKed, which is flow control the UART never had.
+ *
+ * While a host holds the port open (DTR set) the downlink frames go out on the bulk IN
+ * endpoint instead of UART4, see UartTx_SendFrame. The link rate stays where it is, a
+ * rate change means nothing on USB.
+ *
+ * With USB_LINK_ENABLE at 0 nothing is set up and the port never opens.
+ *
+***************************************************************************************/
+
+#ifndef USB_LINK_H_
+#define USB_LINK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+#include "./frame_ring.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef USB_LINK_ENABLE
+#define USB_LINK_ENABLE         1    // 0 = UART4 only
+#endif
+
+#define USB_LINK_PACKET_SIZE    64   // bulk and control max packet, full speed
+
+// Frames one packet can complete, with the decoder holding all but a byte of another
+#define USB_LINK_PACKET_FRAMES  ((PROTOCOL_FRAME_SIZE - 1 + USB_LINK_PACKET_SIZE) / PROTOCOL_FRAME_SIZE)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t packets;           // bulk OUT packets read
+    uint32_t held;              // times a packet waited in the FIFO for ring space
+    uint32_t crc_errors;
+    uint32_t dropped;           // downlink frames dropped, the IN endpoint was still full
+    uint32_t opens;             // times a host opened the port
+} UsbLinkStats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void UsbLink_Init(void);
+bool UsbLink_HandleInterrupt(void);
+
+FrameRing_t *UsbLink_GetRing(void);
+void UsbLink_Resume(void);
+
+bool UsbLink_IsOpen(void);
+bool UsbLink_SendFrame(uint8_t type, const void *payload, uint8_t length);
+
+void UsbLink_GetStats(UsbLinkStats_t *copy);
+void UsbLink_Report(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* USB_LINK_H_ */
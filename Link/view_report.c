@@ -0,0 +1,75 @@
+/***************************************************************************************
+ * @file        view_report.c
+ * @brief       Tells the feeder what the display is showing, so it only sends that.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./view_report.h"
+#include "./uart_tx.h"
+#include "System/clock.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Only the display thread updates and flushes, no locking needed
+static ProtocolView_t view;
+static bool view_pending = false;
+static bool view_sent = false;
+static uint32_t view_sent_ms;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Records what the display shows, queueing a report if it changed.
+ *
+ * @param range_km          Display range.
+ * @param center_latitude   Radar center in micro-degrees.
+ * @param center_longitude  Likewise.
+ * @param selected          Whether an aircraft is selected.
+ * @param selected_icao24   Its address, ignored if nothing is selected.
+ * @param quiet             In quiet hours, asking for one keyframe per wake.
+ */
+void ViewReport_Update(uint16_t range_km, int32_t center_latitude, int32_t center_longitude,
+                       bool selected, uint32_t selected_icao24, bool quiet) {
+    uint8_t flags = (selected ? PROTOCOL_VIEW_SELECTED : 0) | (quiet ? PROTOCOL_VIEW_QUIET : 0);
+    if (!selected)
+        selected_icao24 = 0;
+
+    if (range_km != view.range_km || flags != view.flags || selected_icao24 != view.selected_icao24 ||
+        center_latitude != view.center_latitude || center_longitude != view.center_longitude) {
+        view.range_km = range_km;
+        view.center_latitude = center_latitude;
+        view.center_longitude = center_longitude;
+        view.flags = flags;
+        view.selected_icao24 = selected_icao24;
+        view_pending = true;
+    }
+
+    if (!view_sent || Clock_Millis() - view_sent_ms >= VIEW_REPORT_REFRESH_MS)
+        view_pending = true;
+}
+
+/**
+ * @brief Sends the queued report if the transmit buffer is free.
+ */
+void ViewReport_Flush(void) {
+    if (view_pending && UartTx_SendFrame(PROTOCOL_FRAME_VIEW, &view, sizeof(view))) {
+        view_pending = false;
+        view_sent = true;
+        view_sent_ms = Clock_Millis();
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,52 @@
+/***************************************************************************************
+ * @file        view_report.h
+ * @brief       Tells the feeder what the display is showing, so it only sends that.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The display thread passes the range, the radar center and the selected aircraft in
+ * after every radar frame, and a ProtocolView_t goes back to the feeder whenever any of
+ * them changes. The feeder then drops aircraft outside the range before encoding a
+ * burst, so the UART and the parser only carry what can actually be drawn, and moves its
+ * search box whenever the center does. In quiet hours the report also tells the feeder
+ * the unit is awake for its one keyframe, see System/quiet_hours.h.
+ *
+ * The report is also repeated every VIEW_REPORT_REFRESH_MS, so a feeder that restarts
+ * or lost a frame on the line catches up without the user touching anything. Like the
+ * latency report it is retried on every display frame until the transmit buffer is free.
+ *
+***************************************************************************************/
+
+#ifndef VIEW_REPORT_H_
+#define VIEW_REPORT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define VIEW_REPORT_REFRESH_MS  5000
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void ViewReport_Update(uint16_t range_km, int32_t center_latitude, int32_t center_longitude,
+                       bool selected, uint32_t selected_icao24, bool quiet);
+void ViewReport_Flush(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* VIEW_REPORT_H_ */
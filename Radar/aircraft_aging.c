@@ -0,0 +1,199 @@
+/***************************************************************************************
+ * @file        aircraft_aging.c
+ * @brief       Last-seen times of the live aircraft, aged on a timing wheel.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./aircraft_aging.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define WHEEL_MASK          (AIRCRAFT_AGING_WHEEL_SIZE - 1)
+#define BUCKET(time)        (MAX_AIRCRAFTS + (((time) >> AIRCRAFT_AGING_TICK_SHIFT) & WHEEL_MASK))
+#define DUE                 (MAX_AIRCRAFTS + AIRCRAFT_AGING_WHEEL_SIZE)
+
+#if AIRCRAFT_AGING_WHEEL_SIZE & WHEEL_MASK
+#error "AIRCRAFT_AGING_WHEEL_SIZE must be a power of 2"
+#endif
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Takes a node off whatever list it is on, leaving it linked to itself.
+ *
+ * A node that is on no list is already linked to itself, so this does nothing to it.
+ */
+static void unlink_node(AircraftAging_t *aging, int16_t node) {
+    aging->next[aging->prev[node]] = aging->next[node];
+    aging->prev[aging->next[node]] = aging->prev[node];
+    aging->next[node] = node;
+    aging->prev[node] = node;
+}
+
+/**
+ * @brief Files a slot in the bucket that comes due once `due` has passed.
+ *
+ * Times before the next bucket go in the next bucket. Times further out than the wheel
+ * goes round land in a bucket that comes due early, and are filed again from there.
+ */
+static void file_slot(AircraftAging_t *aging, int16_t slot, uint16_t due) {
+    if ((int16_t)(due - aging->cursor) < 0)
+        due = aging->cursor;
+
+    int16_t head = BUCKET(due);
+    aging->next[slot] = head;
+    aging->prev[slot] = aging->prev[head];
+    aging->next[aging->prev[head]] = slot;
+    aging->prev[head] = slot;
+}
+
+/**
+ * @brief Moves the whole of the next bucket onto the due list, which is empty.
+ */
+static void take_bucket(AircraftAging_t *aging) {
+    int16_t head = BUCKET(aging->cursor);
+
+    if (aging->next[head] != head) {
+        aging->next[DUE] = aging->next[head];
+        aging->prev[DUE] = aging->prev[head];
+        aging->prev[aging->next[DUE]] = DUE;
+        aging->next[aging->prev[DUE]] = DUE;
+        aging->next[head] = head;
+        aging->prev[head] = head;
+    }
+
+    aging->cursor += AIRCRAFT_AGING_TICK;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts every slot and bucket out empty.
+ *
+ * @param now DeadReckoning_Now().
+ */
+void AircraftAging_Init(AircraftAging_t *aging, uint16_t now) {
+    for (int16_t node = 0; node < AIRCRAFT_AGING_NODES; node++) {
+        aging->next[node] = node;
+        aging->prev[node] = node;
+    }
+    aging->cursor = now & ~(AIRCRAFT_AGING_TICK - 1);
+}
+
+/**
+ * @brief Starts aging a slot that just came into use, from `now`.
+ */
+void AircraftAging_Add(AircraftAging_t *aging, int16_t slot, uint16_t now) {
+    unlink_node(aging, slot);
+    aging->seen[slot] = now;
+    file_slot(aging, slot, now + AIRCRAFT_AGING_DIM);
+}
+
+/**
+ * @brief Stamps a slot as named by a frame at `now`.
+ *
+ * Only the time is written, the slot is filed again when its bucket comes round.
+ */
+void AircraftAging_Seen(AircraftAging_t *aging, int16_t slot, uint16_t now) {
+    aging->seen[slot] = now;
+}
+
+/**
+ * @brief Stops aging a slot, it is no longer in use.
+ */
+void AircraftAging_Remove(AircraftAging_t *aging, int16_t slot) {
+    unlink_node(aging, slot);
+}
+
+/**
+ * @brief Hands a slot's age and place in the wheel to the slot it is moved to.
+ *
+ * `to` must not be in use.
+ */
+void AircraftAging_Move(AircraftAging_t *aging, int16_t to, int16_t from) {
+    aging->seen[to] = aging->seen[from];
+
+    if (aging->next[from] == from)
+        return;
+
+    aging->next[to] = aging->next[from];
+    aging->prev[to] = aging->prev[from];
+    aging->prev[aging->next[to]] = to;
+    aging->next[aging->prev[to]] = to;
+    aging->next[from] = from;
+    aging->prev[from] = from;
+}
+
+/**
+ * @brief Runs the aging pass up to `now`, one expired slot at a time.
+ *
+ * Slots in the buckets that came due are dimmed or brightened by their age and filed
+ * again. The first one past AIRCRAFT_AGING_EVICT is taken out of the wheel and returned
+ * for the caller to remove, call again until AIRCRAFT_AGING_NONE for the rest.
+ *
+ * @param dimmed Set for each slot past AIRCRAFT_AGING_DIM, cleared for each younger one.
+ * @return int16_t The slot to remove, or AIRCRAFT_AGING_NONE when the pass is done.
+ */
+int16_t AircraftAging_Expire(AircraftAging_t *aging, uint16_t now, uint8_t *dimmed) {
+    while (1) {
+        int16_t slot = aging->next[DUE];
+
+        // A bucket only comes due once all of its time has passed
+        if (slot == DUE) {
+            if ((int16_t)(now - aging->cursor) < AIRCRAFT_AGING_TICK)
+                return AIRCRAFT_AGING_NONE;
+            take_bucket(aging);
+            continue;
+        }
+
+        unlink_node(aging, slot);
+
+        uint16_t age = now - aging->seen[slot];
+        if (age >= AIRCRAFT_AGING_EVICT)
+            return slot;
+
+        dimmed[slot] = (age >= AIRCRAFT_AGING_DIM);
+        file_slot(aging, slot, aging->seen[slot] + (dimmed[slot] ? AIRCRAFT_AGING_EVICT : AIRCRAFT_AGING_DIM));
+    }
+}
+
+/**
+ * @brief Finds the slot heard from longest ago, for making room in a full store.
+ *
+ * A scan of the time column, only worth it when the store is full.
+ *
+ * @param count   Slots in use.
+ * @param min_age Slots younger than this are never picked.
+ * @return int16_t The oldest slot at least `min_age` old, or AIRCRAFT_AGING_NONE.
+ */
+int16_t AircraftAging_Oldest(const AircraftAging_t *aging, int16_t count, uint16_t now, uint16_t min_age) {
+    int16_t oldest = AIRCRAFT_AGING_NONE;
+    uint16_t oldest_age = min_age;
+
+    for (int16_t slot = 0; slot < count; slot++) {
+        uint16_t age = now - aging->seen[slot];
+        if (age >= oldest_age) {
+            oldest = slot;
+            oldest_age = age;
+        }
+    }
+
+    return oldest;
+}
+
+/********************************Public Functions***********************************/
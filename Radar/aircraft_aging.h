@@ -0,0 +1,83 @@
+/***************************************************************************************
+ * @file        aircraft_aging.h
+ * @brief       Last-seen times of the live aircraft, aged on a timing wheel.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every frame that names a live aircraft stamps its slot with DeadReckoning_Now(). An
+ * aircraft nothing has named for AIRCRAFT_AGING_DIM is drawn dimmed, and one silent for
+ * AIRCRAFT_AGING_EVICT is removed, so a dropped or partial burst can't leave traffic on
+ * the radar forever.
+ *
+ * Slots are filed in AIRCRAFT_AGING_WHEEL_SIZE buckets by the time they are next due a
+ * look, one bucket per AIRCRAFT_AGING_TICK. A pass only takes the buckets that came due
+ * since the last one, so on an idle tick it costs a compare. Stamping a slot doesn't move
+ * it: when its bucket comes round it is filed again by its newest time, which also covers
+ * a wait longer than the wheel goes round.
+ *
+ * The bucket lists are circular and doubly linked through the slots, with a sentinel
+ * node per bucket, so a slot leaves its list in constant time without knowing which one
+ * it is on.
+ *
+***************************************************************************************/
+
+#ifndef AIRCRAFT_AGING_H_
+#define AIRCRAFT_AGING_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define AIRCRAFT_AGING_TICK_SHIFT   3       // one bucket per 8 DeadReckoning units, 0.8 s
+#define AIRCRAFT_AGING_TICK         (1 << AIRCRAFT_AGING_TICK_SHIFT)
+#define AIRCRAFT_AGING_WHEEL_SIZE   32      // buckets, a power of 2
+
+#define AIRCRAFT_AGING_DIM          250     // units without a report before an aircraft is dimmed, 25 s
+#define AIRCRAFT_AGING_EVICT        600     // and before it is removed, when dead reckoning gives up too
+
+#define AIRCRAFT_AGING_NONE         (-1)
+
+#define AIRCRAFT_AGING_NODES        (MAX_AIRCRAFTS + AIRCRAFT_AGING_WHEEL_SIZE + 1)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// Ages of the slots of the live store
+typedef struct {
+    uint16_t seen[MAX_AIRCRAFTS];       // DeadReckoning_Now() of the last frame naming the slot
+    int16_t next[AIRCRAFT_AGING_NODES]; // slots, then a sentinel per bucket and one for the due list
+    int16_t prev[AIRCRAFT_AGING_NODES];
+    uint16_t cursor;                    // start of the next bucket to come due
+} AircraftAging_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftAging_Init(AircraftAging_t *aging, uint16_t now);
+
+void AircraftAging_Add(AircraftAging_t *aging, int16_t slot, uint16_t now);
+void AircraftAging_Seen(AircraftAging_t *aging, int16_t slot, uint16_t now);
+void AircraftAging_Remove(AircraftAging_t *aging, int16_t slot);
+void AircraftAging_Move(AircraftAging_t *aging, int16_t to, int16_t from);
+
+int16_t AircraftAging_Expire(AircraftAging_t *aging, uint16_t now, uint8_t *dimmed);
+int16_t AircraftAging_Oldest(const AircraftAging_t *aging, int16_t count, uint16_t now, uint16_t min_age);
+
+/********************************Public Functions***********************************/
+
+#endif /* AIRCRAFT_AGING_H_ */
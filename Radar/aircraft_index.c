@@ -0,0 +1,126 @@
+/***************************************************************************************
+ * @file        aircraft_index.c
+ * @brief       Fixed-capacity ICAO24 hash index over an aircraft array.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./aircraft_index.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define AIRCRAFT_INDEX_MASK     (AIRCRAFT_INDEX_SIZE - 1)
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Fibonacci hash of an ICAO24 address onto a bucket.
+ *
+ * ICAO addresses are allocated in national blocks, so the low bits alone cluster badly.
+ */
+static inline uint32_t home_bucket(uint32_t icao24) {
+    return (icao24 * 2654435769u) >> (32 - AIRCRAFT_INDEX_BITS);
+}
+
+/**
+ * @brief Finds the bucket holding a key, or the empty bucket where it would go.
+ */
+static uint32_t probe(const AircraftIndex_t *index, uint32_t icao24) {
+    uint32_t bucket = home_bucket(icao24);
+
+    while (index->buckets[bucket] != AIRCRAFT_INDEX_EMPTY &&
+           index->records->icao24[index->buckets[bucket]] != icao24) {
+        bucket = (bucket + 1) & AIRCRAFT_INDEX_MASK;
+    }
+
+    return bucket;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftIndex_Init(AircraftIndex_t *index, const AircraftStore_t *records) {
+    index->records = records;
+    AircraftIndex_Clear(index);
+}
+
+void AircraftIndex_Clear(AircraftIndex_t *index) {
+    for (uint32_t i = 0; i < AIRCRAFT_INDEX_SIZE; i++) {
+        index->buckets[i] = AIRCRAFT_INDEX_EMPTY;
+    }
+}
+
+/**
+ * @brief Rebuilds the index from the first `count` records of its array.
+ */
+void AircraftIndex_Rebuild(AircraftIndex_t *index, int16_t count) {
+    AircraftIndex_Clear(index);
+
+    for (int16_t slot = 0; slot < count; slot++) {
+        AircraftIndex_Insert(index, index->records->icao24[slot], slot);
+    }
+}
+
+/**
+ * @brief Looks up an aircraft by its ICAO24 address.
+ *
+ * @return int16_t The slot in the indexed array, or AIRCRAFT_INDEX_EMPTY.
+ */
+int16_t AircraftIndex_Find(const AircraftIndex_t *index, uint32_t icao24) {
+    return index->buckets[probe(index, icao24)];
+}
+
+/**
+ * @brief Maps an address to a slot, replacing any existing mapping for that address.
+ *
+ * The record at `slot` must already hold `icao24`, since keys are read from the array.
+ */
+void AircraftIndex_Insert(AircraftIndex_t *index, uint32_t icao24, int16_t slot) {
+    index->buckets[probe(index, icao24)] = slot;
+}
+
+/**
+ * @brief Removes an address from the index.
+ *
+ * Must be called while the record still holds `icao24`. Entries after the hole are
+ * shifted back so that every key stays reachable from its home bucket.
+ */
+void AircraftIndex_Remove(AircraftIndex_t *index, uint32_t icao24) {
+    uint32_t hole = probe(index, icao24);
+
+    if (index->buckets[hole] == AIRCRAFT_INDEX_EMPTY)
+        return;
+
+    index->buckets[hole] = AIRCRAFT_INDEX_EMPTY;
+
+    uint32_t next = (hole + 1) & AIRCRAFT_INDEX_MASK;
+    while (index->buckets[next] != AIRCRAFT_INDEX_EMPTY) {
+        uint32_t home = home_bucket(index->records->icao24[index->buckets[next]]);
+
+        // Move the entry back unless its home lies cyclically in (hole, next]
+        bool reachable = (hole <= next) ? (hole < home && home <= next)
+                                        : (hole < home || home <= next);
+        if (!reachable) {
+            index->buckets[hole] = index->buckets[next];
+            index->buckets[next] = AIRCRAFT_INDEX_EMPTY;
+            hole = next;
+        }
+
+        next = (next + 1) & AIRCRAFT_INDEX_MASK;
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,67 @@
+/***************************************************************************************
+ * @file        aircraft_index.h
+ * @brief       Fixed-capacity ICAO24 hash index over an aircraft array.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Open addressing with linear probing. Buckets only hold the slot number of an aircraft,
+ * the key itself is read back from the store's address column, so an index costs two bytes per
+ * bucket and needs no heap. Removal uses backward-shift deletion, so there are no
+ * tombstones and lookups never degrade over time.
+ *
+***************************************************************************************/
+
+#ifndef AIRCRAFT_INDEX_H_
+#define AIRCRAFT_INDEX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef AIRCRAFT_INDEX_BITS
+#define AIRCRAFT_INDEX_BITS     8
+#endif
+#define AIRCRAFT_INDEX_SIZE     (1 << AIRCRAFT_INDEX_BITS)  // keep load factor under 0.5
+#define AIRCRAFT_INDEX_EMPTY    (-1)
+
+#if AIRCRAFT_INDEX_SIZE < 2 * MAX_AIRCRAFTS
+#error "AIRCRAFT_INDEX_SIZE must be at least twice MAX_AIRCRAFTS"
+#endif
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t buckets[AIRCRAFT_INDEX_SIZE];   // slot in records, or AIRCRAFT_INDEX_EMPTY
+    const AircraftStore_t *records;         // store the slots refer to
+} AircraftIndex_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftIndex_Init(AircraftIndex_t *index, const AircraftStore_t *records);
+void AircraftIndex_Clear(AircraftIndex_t *index);
+void AircraftIndex_Rebuild(AircraftIndex_t *index, int16_t count);
+
+int16_t AircraftIndex_Find(const AircraftIndex_t *index, uint32_t icao24);
+void AircraftIndex_Insert(AircraftIndex_t *index, uint32_t icao24, int16_t slot);
+void AircraftIndex_Remove(AircraftIndex_t *index, uint32_t icao24);
+
+/********************************Public Functions***********************************/
+
+#endif /* AIRCRAFT_INDEX_H_ */
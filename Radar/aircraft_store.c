@@ -0,0 +1,203 @@
+/***************************************************************************************
+ * @file        aircraft_store.c
+ * @brief       Compact struct-of-arrays aircraft table.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./aircraft_store.h"
+
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define WIRE_SCALE          10000   // wire fields are scaled by this
+#define WIRE_TO_POSITION    (AIRCRAFT_MICRODEGREES / WIRE_SCALE)
+
+#define CALLSIGN_CHARS      (AIRCRAFT_CALLSIGN_SIZE - 1)
+#define CALLSIGN_CODE_BITS  6
+#define CALLSIGN_CODE_MASK  0x3F
+#define CALLSIGN_SPACE      1
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// n / divisor == (n * magic) >> shift for every 32-bit unsigned n
+typedef struct {
+    uint32_t divisor;
+    uint32_t magic;
+    uint8_t shift;
+} Reciprocal_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static const Reciprocal_t WIRE_TO_METERS = { WIRE_SCALE, 0xD1B71759u, 45 };
+static const Reciprocal_t WIRE_TO_TENTHS = { WIRE_SCALE / 10, 0x10624DD3u, 38 };
+
+// Code to character, the rest of the table as callsign_code works it out
+static const char CALLSIGN_CHARACTERS[64] =
+    "\0 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Divides to the nearest integer and saturates to 16 bits.
+ *
+ * One long multiply instead of a divide, the rounding is away from zero as before.
+ */
+static inline int16_t narrow(int32_t value, const Reciprocal_t *reciprocal) {
+    uint32_t magnitude = (value >= 0) ? (uint32_t)value : 0u - (uint32_t)value;
+    uint64_t product = (uint64_t)(magnitude + reciprocal->divisor / 2) * reciprocal->magic;
+    uint32_t quotient = (uint32_t)(product >> reciprocal->shift);
+
+    if (quotient > INT16_MAX)
+        return (value >= 0) ? INT16_MAX : INT16_MIN;
+    return (int16_t)((value >= 0) ? (int32_t)quotient : -(int32_t)quotient);
+}
+
+static uint8_t callsign_code(char c) {
+    if (c == '\0')             return 0;
+    if (c >= '0' && c <= '9')  return 2 + (c - '0');
+    if (c >= 'A' && c <= 'Z')  return 12 + (c - 'A');
+    if (c >= 'a' && c <= 'z')  return 38 + (c - 'a');
+    return CALLSIGN_SPACE;
+}
+
+static int16_t add_saturate(int16_t value, int16_t delta) {
+    int32_t result = (int32_t)value + delta;
+
+    if (result > INT16_MAX)
+        return INT16_MAX;
+    if (result < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t)result;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void AircraftStore_Clear(AircraftStore_t *store) {
+    store->count = 0;
+}
+
+/**
+ * @brief Converts a full wire record into a slot.
+ *
+ * Reads the fields straight out of the receive slot. The callsign keeps its first 7
+ * characters, packed, and a blank one is AIRCRAFT_CALLSIGN_NONE.
+ *
+ * @param reported Time of the report, DeadReckoning_Now().
+ */
+void AircraftStore_Decode(AircraftStore_t *store, int16_t slot, const ProtocolAircraft_t *wire, uint16_t reported) {
+    AircraftStore_SetCallsign(store, slot, AircraftStore_PackCallsign(wire->callsign));
+
+    store->icao24[slot] = wire->icao24;
+    store->longitude[slot] = wire->longitude * WIRE_TO_POSITION;
+    store->latitude[slot] = wire->latitude * WIRE_TO_POSITION;
+    store->altitude[slot] = narrow(wire->altitude, &WIRE_TO_METERS);
+    store->velocity[slot] = narrow(wire->velocity, &WIRE_TO_TENTHS);
+    store->heading[slot] = narrow(wire->heading, &WIRE_TO_TENTHS);
+    store->reported[slot] = reported;
+}
+
+/**
+ * @brief Adds one delta record to a slot.
+ *
+ * @param delta One value per PROTOCOL_DELTA_* field in mask bit order, zero when absent.
+ *              The protocol's delta units match the store's except for position.
+ */
+void AircraftStore_ApplyDelta(AircraftStore_t *store, int16_t slot, const int16_t *delta) {
+    store->longitude[slot] += delta[0] * WIRE_TO_POSITION;
+    store->latitude[slot] += delta[1] * WIRE_TO_POSITION;
+    store->altitude[slot] = add_saturate(store->altitude[slot], delta[2]);
+    store->velocity[slot] = add_saturate(store->velocity[slot], delta[3]);
+    store->heading[slot] = add_saturate(store->heading[slot], delta[4]);
+}
+
+/**
+ * @brief Copies one slot over another, column by column.
+ */
+void AircraftStore_Move(AircraftStore_t *store, int16_t to, int16_t from) {
+    store->icao24[to] = store->icao24[from];
+    store->longitude[to] = store->longitude[from];
+    store->latitude[to] = store->latitude[from];
+    store->altitude[to] = store->altitude[from];
+    store->velocity[to] = store->velocity[from];
+    store->heading[to] = store->heading[from];
+    store->reported[to] = store->reported[from];
+    store->callsign[to] = store->callsign[from];
+    store->callsign_tail[to] = store->callsign_tail[from];
+}
+
+/**
+ * @brief Whether a slot has a callsign of its own rather than the N/A stand-in.
+ */
+bool AircraftStore_HasCallsign(const AircraftStore_t *store, int16_t slot) {
+    return store->callsign[slot] != AIRCRAFT_CALLSIGN_NONE;
+}
+
+/**
+ * @brief Packs up to 7 characters of a callsign, the first in the low 6 bits.
+ *
+ * @param text  Space padded or null terminated. A first character that reads as a space
+ *              makes the whole callsign AIRCRAFT_CALLSIGN_NONE.
+ */
+uint64_t AircraftStore_PackCallsign(const char *text) {
+    if (callsign_code(text[0]) <= CALLSIGN_SPACE)
+        return AIRCRAFT_CALLSIGN_NONE;
+
+    uint64_t callsign = 0;
+    for (int16_t i = 0; i < CALLSIGN_CHARS && text[i] != '\0'; i++) {
+        callsign |= (uint64_t)callsign_code(text[i]) << (CALLSIGN_CODE_BITS * i);
+    }
+    return callsign;
+}
+
+/**
+ * @brief Unpacks a callsign for display, AIRCRAFT_NO_CALLSIGN for a blank one.
+ *
+ * @param text  AIRCRAFT_CALLSIGN_SIZE bytes, null terminated.
+ */
+void AircraftStore_CallsignText(uint64_t callsign, char *text) {
+    if (callsign == AIRCRAFT_CALLSIGN_NONE) {
+        memcpy(text, AIRCRAFT_NO_CALLSIGN, AIRCRAFT_CALLSIGN_SIZE);
+        return;
+    }
+
+    for (int16_t i = 0; i < CALLSIGN_CHARS; i++) {
+        text[i] = CALLSIGN_CHARACTERS[(callsign >> (CALLSIGN_CODE_BITS * i)) & CALLSIGN_CODE_MASK];
+    }
+    text[CALLSIGN_CHARS] = '\0';
+}
+
+/**
+ * @brief Characters AircraftStore_CallsignText gives before its terminator.
+ */
+int16_t AircraftStore_CallsignLength(uint64_t callsign) {
+    if (callsign == AIRCRAFT_CALLSIGN_NONE)
+        return CALLSIGN_CHARS;
+
+    int16_t length = 0;
+    while (length < CALLSIGN_CHARS && ((callsign >> (CALLSIGN_CODE_BITS * length)) & CALLSIGN_CODE_MASK) != 0) {
+        length++;
+    }
+    return length;
+}
+
+/********************************Public Functions***********************************/
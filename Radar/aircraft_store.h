@@ -0,0 +1,158 @@
+/***************************************************************************************
+ * @file        aircraft_store.h
+ * @brief       Compact struct-of-arrays aircraft table.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every field of an aircraft lives in its own column, so a loop that only needs positions
+ * or addresses walks one dense array instead of striding over whole records. Positions are
+ * kept in micro-degrees and the other fields as 16-bit fixed point, 24 bytes per aircraft
+ * against 40 for the old record of floats, plus the time of the last position report.
+ *
+ * A callsign is kept as seven 6-bit character codes, the first in the low bits, split
+ * over a 32-bit and a 16-bit column. That is 6 bytes instead of 8, and two callsigns
+ * compare as one integer. AIRCRAFT_CALLSIGN_NONE stands for a blank one and reads back
+ * as AIRCRAFT_NO_CALLSIGN. Codes cover the digits and both cases of letters, which is
+ * everything ADS-B sends, anything else reads back as a space.
+ *
+ * Screen positions only mean something for the live table, so they are kept once in an
+ * AircraftScreen_t instead of in both the live and staging tables.
+ *
+ * SRAM per aircraft slot:
+ *
+ *      26 bytes        live store
+ *      13 bytes        ground offset, screen position, heading line, dimming, altitude
+ *                      layer, and visibility and conflict bits
+ *      2 bytes         closest approach search order
+ *      4 bytes         dead-reckoning rates
+ *      6 bytes         last-seen time and aging wheel links
+ *      4 bytes         ICAO24 index at half load
+ *      4 bytes         screen grid links
+ *      4 bytes         distance order and ranks
+ *      16 bytes        sprite the radar renderer last drew
+ *      1 byte          its place in the display list's row buckets
+ *      1 byte          burst epoch of the live slot
+ *
+ *      30 bytes        staging store and its index, AIRCRAFT_STAGING_ENABLE builds
+ *      3 bytes         conflict detector's sweep order and results, CONFLICT_DETECTION_ENABLE
+ *
+ * 81 bytes a slot by default, 8.1 KB at MAX_AIRCRAFTS = 100. Of the 32 KB, the nine
+ * thread stacks and the main stack take 9.5 KB, the strip buffer, label cache, trails,
+ * receive rings and compact dictionary 5.2 KB, code run from SRAM the 2 KB of
+ * RAMFUNC_MAX_BYTES, and the log ring, display lists, smaller statics and kernel the
+ * 7 KB of SRAM_OTHER_BYTES, which leaves room for 100 slots. Staging and conflict
+ * detection each add a thread stack as well as their bytes a slot, so a build with both
+ * holds 44. The 200 the old record of floats was sized for doesn't fit next to the
+ * stacks even with both off. System/arena.c adds it all up at compile
+ * time and fails the build past SRAM, and the stores, indexes and sprites come from
+ * System/arena.h, whose boot report gives the same budget from the build that is
+ * running.
+ *
+***************************************************************************************/
+
+#ifndef AIRCRAFT_STORE_H_
+#define AIRCRAFT_STORE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+#include "Link/protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define AIRCRAFT_CALLSIGN_SIZE      8           // 7 characters and a null terminator
+#define AIRCRAFT_MICRODEGREES       1000000     // position units per degree
+#define AIRCRAFT_VELOCITY_SCALE     10          // velocity units per m/s
+#define AIRCRAFT_HEADING_SCALE      10          // heading units per degree
+#define AIRCRAFT_NO_CALLSIGN        "N/A    "   // stands in for a blank callsign
+#define AIRCRAFT_CALLSIGN_NONE      0           // packed blank callsign
+
+#define AIRCRAFT_SCREEN_WORDS       ((MAX_AIRCRAFTS + 31) / 32)
+
+// The same scales as implied decimal digits, for printing
+#define AIRCRAFT_POSITION_DIGITS    6
+#define AIRCRAFT_VELOCITY_DIGITS    1
+#define AIRCRAFT_HEADING_DIGITS     1
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t count;                                          // slots in use
+    uint32_t icao24[MAX_AIRCRAFTS];
+    int32_t longitude[MAX_AIRCRAFTS];                       // micro-degrees
+    int32_t latitude[MAX_AIRCRAFTS];                        // micro-degrees
+    int16_t altitude[MAX_AIRCRAFTS];                        // meters
+    int16_t velocity[MAX_AIRCRAFTS];                        // 0.1 m/s
+    int16_t heading[MAX_AIRCRAFTS];                         // 0.1 degrees
+    uint16_t reported[MAX_AIRCRAFTS];                       // DeadReckoning_Now() of the last position
+    uint32_t callsign[MAX_AIRCRAFTS];                       // low 32 bits of the packed callsign
+    uint16_t callsign_tail[MAX_AIRCRAFTS];                  // high 10 bits
+} AircraftStore_t;
+
+// Where each slot of the live store lands on the radar
+typedef struct {
+    int16_t offset_x[MAX_AIRCRAFTS];                        // 1/64 km east of the radar center
+    int16_t offset_y[MAX_AIRCRAFTS];                        // 1/64 km north of it
+    int16_t x[MAX_AIRCRAFTS];
+    int16_t y[MAX_AIRCRAFTS];
+    uint8_t on_screen[MAX_AIRCRAFTS];
+    int8_t track_dx[MAX_AIRCRAFTS];                         // heading line end from x, y
+    int8_t track_dy[MAX_AIRCRAFTS];
+    uint8_t dimmed[MAX_AIRCRAFTS];                          // not heard from for AIRCRAFT_AGING_DIM
+    uint8_t layer[MAX_AIRCRAFTS];                           // AIRCRAFT_FILTER_PALETTE entry
+    uint32_t visible[AIRCRAFT_SCREEN_WORDS];                // one bit per slot, see aircraft_filter.h
+    uint32_t conflict[AIRCRAFT_SCREEN_WORDS];               // one bit per slot, see conflict_detector.h
+} AircraftScreen_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+// One-bit-per-slot columns of AircraftScreen_t
+static inline bool AircraftScreen_TestBit(const uint32_t *bits, int16_t slot) {
+    return (bits[slot >> 5] >> (slot & 31)) & 1;
+}
+
+static inline void AircraftScreen_AssignBit(uint32_t *bits, int16_t slot, bool value) {
+    if (value)
+        bits[slot >> 5] |= 1u << (slot & 31);
+    else
+        bits[slot >> 5] &= ~(1u << (slot & 31));
+}
+
+// Packed callsign of a slot, see AircraftStore_PackCallsign
+static inline uint64_t AircraftStore_Callsign(const AircraftStore_t *store, int16_t slot) {
+    return store->callsign[slot] | ((uint64_t)store->callsign_tail[slot] << 32);
+}
+
+static inline void AircraftStore_SetCallsign(AircraftStore_t *store, int16_t slot, uint64_t callsign) {
+    store->callsign[slot] = (uint32_t)callsign;
+    store->callsign_tail[slot] = (uint16_t)(callsign >> 32);
+}
+
+void AircraftStore_Clear(AircraftStore_t *store);
+void AircraftStore_Decode(AircraftStore_t *store, int16_t slot, const ProtocolAircraft_t *wire, uint16_t reported);
+void AircraftStore_ApplyDelta(AircraftStore_t *store, int16_t slot, const int16_t *delta);
+void AircraftStore_Move(AircraftStore_t *store, int16_t to, int16_t from);
+bool AircraftStore_HasCallsign(const AircraftStore_t *store, int16_t slot);
+
+uint64_t AircraftStore_PackCallsign(const char *text);
+void AircraftStore_CallsignText(uint64_t callsign, char *text);
+int16_t AircraftStore_CallsignLength(uint64_t callsign);
+
+/********************************Public Functions***********************************/
+
+#endif /* AIRCRAFT_STORE_H_ */
@@ -0,0 +1,226 @@
+/***************************************************************************************
+ * @file        closest_approach.c
+ * @brief       Closest point of approach between the selected aircraft and the rest.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * With p the other aircraft's offset from the selected one and q its velocity relative
+ * to it, the distance between them is smallest at t = -(p.q) / (q.q). Velocities are
+ * kept in Q8, so that divide comes out in whole seconds after shifting p.q up by 8.
+ * Products are taken in 64 bits, a velocity from a saturated dead-reckoning rate is far
+ * larger than anything that flies.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./closest_approach.h"
+#include "./conflict_detector.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define OFFSETS_PER_KM      (1 << PROJECTION_OFFSET_BITS)
+#define VELOCITY_SHIFT      (PROJECTION_FRACTION_BITS - CLOSEST_APPROACH_VELOCITY_BITS)
+
+// Offsets this far out may have saturated, so they say nothing about distance
+#define OFFSET_LIMIT        (PROJECTION_MAX_RANGE_KM << PROJECTION_OFFSET_BITS)
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Brings the order up to date with a store of `count` slots, see conflict_detector.c.
+ */
+static void resize_order(ClosestApproach_t *approach, int16_t count) {
+    if (count < approach->ordered) {
+        int16_t kept = 0;
+        for (int16_t i = 0; i < approach->ordered; i++) {
+            if (approach->order[i] < count)
+                approach->order[kept++] = approach->order[i];
+        }
+    }
+
+    for (int16_t slot = approach->ordered; slot < count; slot++) {
+        approach->order[slot] = slot;
+    }
+    approach->ordered = count;
+}
+
+/**
+ * @brief Insertion sort of the order by east offset, close to one pass when nearly sorted.
+ */
+static void sort_order(ClosestApproach_t *approach, const int16_t *offset_x) {
+    int16_t *order = approach->order;
+
+    for (int16_t i = 1; i < approach->ordered; i++) {
+        int16_t slot = order[i];
+        int16_t x = offset_x[slot];
+        int16_t j = i;
+
+        while (j > 0 && offset_x[order[j - 1]] > x) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = slot;
+    }
+}
+
+/**
+ * @brief First place in the order whose east offset is at least `x`.
+ */
+static int16_t lower_bound(const ClosestApproach_t *approach, const int16_t *offset_x, int16_t x) {
+    int16_t low = 0;
+    int16_t high = approach->ordered;
+
+    while (low < high) {
+        int16_t middle = (low + high) / 2;
+        if (offset_x[approach->order[middle]] < x)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+static bool tracked(const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t slot) {
+    return aircrafts->altitude[slot] >= CONFLICT_MIN_ALTITUDE_M &&
+           abs(screen->offset_x[slot]) < OFFSET_LIMIT && abs(screen->offset_y[slot]) < OFFSET_LIMIT;
+}
+
+/**
+ * @brief A slot's ground velocity in Q8 offset units per second, from its dead-reckoning rates.
+ */
+static void velocity(const Projection_t *projection, const DeadReckoning_t *motion, int16_t slot,
+                     int32_t *east, int32_t *north) {
+    *east = (int32_t)(((int64_t)motion->rate_longitude[slot] * projection->offset_longitude) >> VELOCITY_SHIFT);
+    *north = (int32_t)(((int64_t)motion->rate_latitude[slot] * projection->offset_latitude) >> VELOCITY_SHIFT);
+}
+
+static uint32_t square_root(uint64_t value) {
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void ClosestApproach_Init(ClosestApproach_t *approach) {
+    memset(approach, 0, sizeof(*approach));
+    approach->slot = CLOSEST_APPROACH_NONE;
+}
+
+/**
+ * @brief Finds the aircraft that will pass closest to the selected one.
+ *
+ * Leaves it in `slot`, `icao24`, `distance` and `seconds`, or CLOSEST_APPROACH_NONE in
+ * `slot` if nothing airborne is near enough to tell. Must be called under a read of
+ * `seq_CURRENT_AIRCRAFTS`, the result is only good if that read holds.
+ *
+ * @param selected Slot of the selected aircraft, or -1.
+ */
+void ClosestApproach_Find(ClosestApproach_t *approach, const Projection_t *projection, const DeadReckoning_t *motion,
+                          const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t selected) {
+    int16_t count = (aircrafts->count < MAX_AIRCRAFTS) ? aircrafts->count : MAX_AIRCRAFTS;
+
+    resize_order(approach, count);
+    sort_order(approach, screen->offset_x);
+    approach->slot = CLOSEST_APPROACH_NONE;
+
+    if (selected < 0 || selected >= count || !tracked(aircrafts, screen, selected))
+        return;
+
+    const int16_t *offset_x = screen->offset_x;
+    const int16_t *order = approach->order;
+    int32_t x = offset_x[selected];
+    int32_t y = screen->offset_y[selected];
+    int32_t u, v;
+    velocity(projection, motion, selected, &u, &v);
+
+    // The most the two can close on each other east-west before the horizon
+    int32_t closing = ((int32_t)(aircrafts->velocity[selected] + CLOSEST_APPROACH_MAX_SPEED * AIRCRAFT_VELOCITY_SCALE) *
+                       CLOSEST_APPROACH_HORIZON_S * OFFSETS_PER_KM) / (1000 * AIRCRAFT_VELOCITY_SCALE);
+    int32_t reach = closing + OFFSET_LIMIT;
+    uint64_t best_squared = UINT64_MAX;
+    int32_t best_seconds = 0;
+
+    // Walk outwards, always taking the nearer side, so once it is out of reach both are
+    int16_t right = lower_bound(approach, offset_x, (int16_t)x);
+    int16_t left = right - 1;
+
+    while (left >= 0 || right < count) {
+        int16_t slot;
+        if (right < count && (left < 0 || offset_x[order[right]] - x <= x - offset_x[order[left]]))
+            slot = order[right++];
+        else
+            slot = order[left--];
+
+        int32_t px = offset_x[slot] - x;
+        if (abs(px) > reach)
+            break;
+        if (slot == selected || !tracked(aircrafts, screen, slot))
+            continue;
+
+        int32_t py = screen->offset_y[slot] - y;
+        int32_t qx, qy;
+        velocity(projection, motion, slot, &qx, &qy);
+        qx -= u;
+        qy -= v;
+
+        // Only closing aircraft have a closest point ahead, the rest are closest now
+        int64_t dot = (int64_t)px * qx + (int64_t)py * qy;
+        int64_t speed_squared = (int64_t)qx * qx + (int64_t)qy * qy;
+        int32_t seconds = 0;
+        if (dot < 0 && speed_squared > 0) {
+            int64_t ahead = (-dot << CLOSEST_APPROACH_VELOCITY_BITS) / speed_squared;
+            seconds = (ahead > CLOSEST_APPROACH_HORIZON_S) ? CLOSEST_APPROACH_HORIZON_S : (int32_t)ahead;
+        }
+
+        int64_t mx = px + (((int64_t)qx * seconds) >> CLOSEST_APPROACH_VELOCITY_BITS);
+        int64_t my = py + (((int64_t)qy * seconds) >> CLOSEST_APPROACH_VELOCITY_BITS);
+        uint64_t squared = (uint64_t)(mx * mx + my * my);
+
+        if (squared < best_squared || (squared == best_squared && seconds < best_seconds)) {
+            best_squared = squared;
+            best_seconds = seconds;
+            approach->slot = slot;
+            reach = closing + (int32_t)square_root(squared);
+        }
+    }
+
+    if (approach->slot == CLOSEST_APPROACH_NONE)
+        return;
+
+    approach->icao24 = aircrafts->icao24[approach->slot];
+    approach->distance = (int32_t)square_root(best_squared);
+    approach->seconds = (int16_t)best_seconds;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        closest_approach.h
+ * @brief       Closest point of approach between the selected aircraft and the rest.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every aircraft is taken to carry on in a straight line at its reported ground speed,
+ * the same assumption dead reckoning makes. For each other aircraft the relative
+ * position and velocity give the time at which the two are closest (TCPA), clamped to
+ * between now and CLOSEST_APPROACH_HORIZON_S, and the distance between them then (CPA).
+ * The info panel shows the aircraft with the smallest CPA.
+ *
+ * Positions are the ground offsets of the last projection and velocities come from the
+ * dead-reckoning rates through the same tangent plane, so the whole search is integer
+ * math with one divide per candidate and one square root at the end.
+ *
+ * The slots are kept sorted by east offset between runs, like the conflict detector
+ * does, and the search walks outwards from the selected aircraft in that order. An
+ * aircraft further east or west than the two could close in CLOSEST_APPROACH_HORIZON_S,
+ * plus the best miss distance found so far, can't do better, so the walk stops there
+ * on each side. The reach shrinks as closer approaches turn up.
+ *
+***************************************************************************************/
+
+#ifndef CLOSEST_APPROACH_H_
+#define CLOSEST_APPROACH_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+#include "./dead_reckoning.h"
+#include "./projection.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CLOSEST_APPROACH_HORIZON_S      300     // how far ahead approaches are looked for
+#define CLOSEST_APPROACH_MAX_SPEED      350     // m/s, fastest an aircraft is taken to fly when pruning
+#define CLOSEST_APPROACH_VELOCITY_BITS  8       // velocities are Q8 ground offset units per second
+
+#define CLOSEST_APPROACH_NONE           (-1)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int16_t order[MAX_AIRCRAFTS];   // slots by east offset, from the last run
+    int16_t ordered;                // slots in order
+    int16_t slot;                   // the other aircraft, or CLOSEST_APPROACH_NONE
+    uint32_t icao24;
+    int32_t distance;               // miss distance in 1/64 km
+    int16_t seconds;                // time to it, 0 when the two are already moving apart
+} ClosestApproach_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void ClosestApproach_Init(ClosestApproach_t *approach);
+void ClosestApproach_Find(ClosestApproach_t *approach, const Projection_t *projection, const DeadReckoning_t *motion,
+                          const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t selected);
+
+/********************************Public Functions***********************************/
+
+#endif /* CLOSEST_APPROACH_H_ */
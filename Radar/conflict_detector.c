@@ -0,0 +1,163 @@
+/***************************************************************************************
+ * @file        conflict_detector.c
+ * @brief       Pairs of live aircraft closer than the separation minima, by sort and sweep.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./conflict_detector.h"
+#include "./projection.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define HORIZONTAL          (CONFLICT_HORIZONTAL_KM << PROJECTION_OFFSET_BITS)
+
+// Offsets this far out may have saturated, so they say nothing about distance
+#define OFFSET_LIMIT        (PROJECTION_MAX_RANGE_KM << PROJECTION_OFFSET_BITS)
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Brings the order up to date with a store of `count` slots.
+ *
+ * Slots are always 0 to count - 1, so dropping the ones past the end and adding the new
+ * ones at the end leaves every slot in the order exactly once.
+ */
+static void resize_order(ConflictDetector_t *detector, int16_t count) {
+    if (count < detector->ordered) {
+        int16_t kept = 0;
+        for (int16_t i = 0; i < detector->ordered; i++) {
+            if (detector->order[i] < count)
+                detector->order[kept++] = detector->order[i];
+        }
+    }
+
+    for (int16_t slot = detector->ordered; slot < count; slot++) {
+        detector->order[slot] = slot;
+    }
+    detector->ordered = count;
+}
+
+/**
+ * @brief Insertion sort of the order by east offset, close to one pass when nearly sorted.
+ */
+static void sort_order(ConflictDetector_t *detector, const int16_t *offset_x) {
+    int16_t *order = detector->order;
+
+    for (int16_t i = 1; i < detector->ordered; i++) {
+        int16_t slot = order[i];
+        int16_t x = offset_x[slot];
+        int16_t j = i;
+
+        while (j > 0 && offset_x[order[j - 1]] > x) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = slot;
+    }
+}
+
+static bool sweeps(const AircraftStore_t *aircrafts, const AircraftScreen_t *screen, int16_t slot) {
+    return aircrafts->altitude[slot] >= CONFLICT_MIN_ALTITUDE_M &&
+           abs(screen->offset_x[slot]) < OFFSET_LIMIT && abs(screen->offset_y[slot]) < OFFSET_LIMIT;
+}
+
+static void add_pair(ConflictDetector_t *detector, uint32_t icao24_a, uint32_t icao24_b) {
+    detector->total_pairs++;
+    if (detector->pair_count >= CONFLICT_MAX_PAIRS)
+        return;
+
+    ConflictPair_t *pair = &detector->pairs[detector->pair_count++];
+    pair->icao24[0] = (icao24_a < icao24_b) ? icao24_a : icao24_b;
+    pair->icao24[1] = (icao24_a < icao24_b) ? icao24_b : icao24_a;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void ConflictDetector_Init(ConflictDetector_t *detector) {
+    memset(detector, 0, sizeof(*detector));
+}
+
+/**
+ * @brief Finds every pair in conflict in the live store.
+ *
+ * Leaves the slots involved in `flagged` and the first CONFLICT_MAX_PAIRS pairs in
+ * `pairs`. Must be called under a read of `seq_CURRENT_AIRCRAFTS`, the results are only
+ * good if that read holds.
+ */
+void ConflictDetector_Run(ConflictDetector_t *detector, const AircraftStore_t *aircrafts,
+                          const AircraftScreen_t *screen) {
+    int16_t count = (aircrafts->count < MAX_AIRCRAFTS) ? aircrafts->count : MAX_AIRCRAFTS;
+
+    resize_order(detector, count);
+    sort_order(detector, screen->offset_x);
+
+    memset(detector->flagged, 0, sizeof(detector->flagged));
+    detector->pair_count = 0;
+    detector->total_pairs = 0;
+
+    const int16_t *order = detector->order;
+    for (int16_t i = 0; i < count; i++) {
+        int16_t a = order[i];
+        if (!sweeps(aircrafts, screen, a))
+            continue;
+
+        // Only the aircraft east of this one and within range of it are worth a look
+        for (int16_t j = i + 1; j < count && screen->offset_x[order[j]] - screen->offset_x[a] <= HORIZONTAL; j++) {
+            int16_t b = order[j];
+            int32_t dx = screen->offset_x[b] - screen->offset_x[a];
+            int32_t dy = screen->offset_y[b] - screen->offset_y[a];
+
+            if (abs(dy) > HORIZONTAL || abs(aircrafts->altitude[b] - aircrafts->altitude[a]) > CONFLICT_VERTICAL_M)
+                continue;
+            if (dx * dx + dy * dy > HORIZONTAL * HORIZONTAL || !sweeps(aircrafts, screen, b))
+                continue;
+
+            AircraftScreen_AssignBit(detector->flagged, a, true);
+            AircraftScreen_AssignBit(detector->flagged, b, true);
+            add_pair(detector, aircrafts->icao24[a], aircrafts->icao24[b]);
+        }
+    }
+}
+
+/**
+ * @brief Whether one of the last run's pairs wasn't in conflict at the last commit.
+ *
+ * @param pair 0 to pair_count - 1.
+ */
+bool ConflictDetector_IsNew(const ConflictDetector_t *detector, int16_t pair) {
+    const ConflictPair_t *found = &detector->pairs[pair];
+
+    for (int16_t i = 0; i < detector->alerted_count; i++) {
+        if (detector->alerted[i].icao24[0] == found->icao24[0] && detector->alerted[i].icao24[1] == found->icao24[1])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Keeps the last run's pairs as the ones the next run's are checked against.
+ */
+void ConflictDetector_Commit(ConflictDetector_t *detector) {
+    memcpy(detector->alerted, detector->pairs, detector->pair_count * sizeof(ConflictPair_t));
+    detector->alerted_count = detector->pair_count;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,82 @@
+/***************************************************************************************
+ * @file        conflict_detector.h
+ * @brief       Pairs of live aircraft closer than the separation minima, by sort and sweep.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Two airborne aircraft are in conflict when they are within CONFLICT_HORIZONTAL_KM of
+ * each other on the ground and CONFLICT_VERTICAL_M in altitude. Distances come from the
+ * ground offsets of the last projection, so they don't depend on the display range.
+ *
+ * The slots are kept sorted by their east offset from one run to the next. Aircraft
+ * only move a little between runs, so insertion sort puts them back in order in close to
+ * one pass. A sweep down the sorted list then only compares each aircraft with the ones
+ * less than CONFLICT_HORIZONTAL_KM further east, instead of every pair.
+ *
+ * A run reads the live store without locking it, under a read of
+ * `seq_CURRENT_AIRCRAFTS`, and its results only hold if that read does, the same as
+ * the selection search. Once they do, ConflictDetector_Commit makes them the ones new
+ * pairs are told apart from, so each conflict is alerted once when it starts.
+ *
+ * Only a CONFLICT_DETECTION_ENABLE build runs it. Its thread and table cost about 22
+ * slots, see aircraft_store.h.
+ *
+***************************************************************************************/
+
+#ifndef CONFLICT_DETECTOR_H_
+#define CONFLICT_DETECTOR_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CONFLICT_HORIZONTAL_KM      5
+#define CONFLICT_VERTICAL_M         300     // about 1000 ft
+#define CONFLICT_MIN_ALTITUDE_M     150     // aircraft lower than this are taken to be on the ground
+#define CONFLICT_MAX_PAIRS          32      // pairs kept for alerts, more are only counted
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t icao24[2];
+} ConflictPair_t;
+
+typedef struct {
+    int16_t order[MAX_AIRCRAFTS];               // slots by east offset, from the last run
+    int16_t ordered;                            // slots in order
+    uint32_t flagged[AIRCRAFT_SCREEN_WORDS];    // slots in at least one conflict
+    ConflictPair_t pairs[CONFLICT_MAX_PAIRS];
+    int16_t pair_count;                         // pairs kept
+    int16_t total_pairs;                        // pairs found
+    ConflictPair_t alerted[CONFLICT_MAX_PAIRS]; // pairs of the last committed run
+    int16_t alerted_count;
+} ConflictDetector_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void ConflictDetector_Init(ConflictDetector_t *detector);
+void ConflictDetector_Run(ConflictDetector_t *detector, const AircraftStore_t *aircrafts,
+                          const AircraftScreen_t *screen);
+bool ConflictDetector_IsNew(const ConflictDetector_t *detector, int16_t pair);
+void ConflictDetector_Commit(ConflictDetector_t *detector);
+
+/********************************Public Functions***********************************/
+
+#endif /* CONFLICT_DETECTOR_H_ */
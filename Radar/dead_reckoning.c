@@ -0,0 +1,94 @@
+/***************************************************************************************
+ * @file        dead_reckoning.c
+ * @brief       Extrapolates aircraft positions between reports.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./dead_reckoning.h"
+
+#include <math.h>
+
+#include "System/clock.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define UNITS_PER_SECOND    (1000 / DEAD_RECKONING_UNIT_MS)
+
+#define UNITS_PER_METER_LATITUDE    (PROJECTION_UNITS_PER_DEGREE / (PROJECTION_KM_PER_DEGREE * 1000.0f))
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+static int16_t saturate(float value) {
+    if (value > INT16_MAX)
+        return INT16_MAX;
+    if (value < INT16_MIN)
+        return INT16_MIN;
+    return (int16_t)(value + ((value >= 0) ? 0.5f : -0.5f));
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Current time in report units, for AircraftStore_t.reported.
+ *
+ * Wraps every 109 minutes at 100 ms units, ages are taken modulo the wrap.
+ */
+uint16_t DeadReckoning_Now(void) {
+    return (uint16_t)(Clock_Millis() / DEAD_RECKONING_UNIT_MS);
+}
+
+/**
+ * @brief Recomputes a slot's rates after its velocity or heading changed.
+ *
+ * The longitude rate uses the projection's scale at the center latitude, which is what
+ * the radar draws with anyway. Every scale is a multiply by a constant reciprocal.
+ */
+void DeadReckoning_SetMotion(DeadReckoning_t *motion, const Projection_t *projection,
+                             const AircraftStore_t *store, int16_t slot) {
+    float meters_per_second = store->velocity[slot] * (1.0f / AIRCRAFT_VELOCITY_SCALE);
+    float heading = store->heading[slot] * (float)(M_PI / 180.0 / AIRCRAFT_HEADING_SCALE);
+
+    // True track is clockwise from north, so north is the cosine and east the sine
+    float north = meters_per_second * cosf(heading);
+    float east = meters_per_second * sinf(heading);
+
+    motion->rate_latitude[slot] = saturate(north * UNITS_PER_METER_LATITUDE);
+    motion->rate_longitude[slot] = saturate(east * projection->units_per_meter_longitude);
+}
+
+void DeadReckoning_Move(DeadReckoning_t *motion, int16_t to, int16_t from) {
+    motion->rate_longitude[to] = motion->rate_longitude[from];
+    motion->rate_latitude[to] = motion->rate_latitude[from];
+}
+
+/**
+ * @brief Where a slot should be now, in micro-degrees.
+ *
+ * @param now DeadReckoning_Now(), read once for a whole pass over the store.
+ */
+void DeadReckoning_Position(const DeadReckoning_t *motion, const AircraftStore_t *store, int16_t slot,
+                            uint16_t now, int32_t *longitude, int32_t *latitude) {
+    int32_t age = (uint16_t)(now - store->reported[slot]);
+    if (age > DEAD_RECKONING_MAX_AGE)
+        age = DEAD_RECKONING_MAX_AGE;
+
+    *longitude = store->longitude[slot] + motion->rate_longitude[slot] * age / UNITS_PER_SECOND;
+    *latitude = store->latitude[slot] + motion->rate_latitude[slot] * age / UNITS_PER_SECOND;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,68 @@
+/***************************************************************************************
+ * @file        dead_reckoning.h
+ * @brief       Extrapolates aircraft positions between reports.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Reports arrive once a burst, about every 10 s. In between, each aircraft is advanced
+ * from its last reported position along its heading at its reported ground speed, so
+ * the radar moves at the render rate instead of jumping once a burst.
+ *
+ * Velocity and heading are turned into a rate in micro-degrees per second per axis when
+ * they change, so advancing an aircraft is one multiply-add per axis with no
+ * trigonometry, and the result goes through the normal projection at any range.
+ * Extrapolation stops after DEAD_RECKONING_MAX_AGE, an aircraft that stopped reporting
+ * is left where it would have been rather than flown off the screen.
+ *
+***************************************************************************************/
+
+#ifndef DEAD_RECKONING_H_
+#define DEAD_RECKONING_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+#include "./projection.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEAD_RECKONING_TICK_MS      100     // how often positions are advanced
+#define DEAD_RECKONING_UNIT_MS      100     // resolution of report times
+#define DEAD_RECKONING_MAX_AGE      600     // report age in units after which motion stops
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// Rates for each slot of the live store
+typedef struct {
+    int16_t rate_longitude[MAX_AIRCRAFTS];  // micro-degrees per second
+    int16_t rate_latitude[MAX_AIRCRAFTS];   // micro-degrees per second
+} DeadReckoning_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+uint16_t DeadReckoning_Now(void);
+
+void DeadReckoning_SetMotion(DeadReckoning_t *motion, const Projection_t *projection,
+                             const AircraftStore_t *store, int16_t slot);
+void DeadReckoning_Move(DeadReckoning_t *motion, int16_t to, int16_t from);
+void DeadReckoning_Position(const DeadReckoning_t *motion, const AircraftStore_t *store, int16_t slot,
+                            uint16_t now, int32_t *longitude, int32_t *latitude);
+
+/********************************Public Functions***********************************/
+
+#endif /* DEAD_RECKONING_H_ */
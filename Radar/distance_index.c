@@ -0,0 +1,248 @@
+/***************************************************************************************
+ * @file        distance_index.c
+ * @brief       Live aircraft kept in order of ground distance from the radar center.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Ground offsets are 15-bit, so a squared distance always fits an unsigned 32-bit key.
+ * The key isn't stored, it is worked out from the screen table's offsets at each
+ * compare, two multiplies instead of 4 bytes a slot. Each slot remembers its rank, so a
+ * slot that moves is found without a search. Equal distances keep the order they were
+ * in, every step is a strict compare.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./distance_index.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define GAP_COUNT       8
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Ciura's gaps, the last pass is a plain insertion sort
+static const int16_t GAPS[GAP_COUNT] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+
+static int16_t order[MAX_AIRCRAFTS];
+static int16_t slot_rank[MAX_AIRCRAFTS];
+static const int16_t *offset_x;     // the screen table's columns the keys come from
+static const int16_t *offset_y;
+static int16_t order_count;
+static bool shuffled;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint32_t distance_of(int16_t slot) {
+    int32_t x = offset_x[slot];
+    int32_t y = offset_y[slot];
+    return (uint32_t)(x * x) + (uint32_t)(y * y);
+}
+
+/**
+ * @brief Gives a slot a rank at the far end if it has none yet.
+ */
+static void append(int16_t slot) {
+    if (slot_rank[slot] != DISTANCE_INDEX_NONE)
+        return;
+
+    order[order_count] = slot;
+    slot_rank[slot] = order_count++;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Empties the order and ties it to the ground offset columns of the screen table.
+ *
+ * @param offsets_east   Offsets east of every slot, the order reads them as it goes.
+ * @param offsets_north  Offsets north of every slot.
+ */
+void DistanceIndex_Init(const int16_t *offsets_east, const int16_t *offsets_north) {
+    offset_x = offsets_east;
+    offset_y = offsets_north;
+    DistanceIndex_Clear();
+}
+
+void DistanceIndex_Clear(void) {
+    for (int16_t i = 0; i < MAX_AIRCRAFTS; i++) {
+        slot_rank[i] = DISTANCE_INDEX_NONE;
+    }
+    order_count = 0;
+    shuffled = true;
+}
+
+/**
+ * @brief Moves the order over to another store's slots, matching aircraft by address.
+ *
+ * Ranked aircraft the new store doesn't hold are dropped, the ones it holds keep their
+ * rank order under their new slots, and the rest are left for DistanceIndex_SetBatch to
+ * append. The order is stale until the new offsets are sorted.
+ *
+ * @param from      Store the order was built over, before the swap.
+ * @param to        ICAO24 index of the store taking over.
+ * @param to_count  Aircraft in that store.
+ */
+void DistanceIndex_Renumber(const AircraftStore_t *from, const AircraftIndex_t *to, int16_t to_count) {
+    int16_t count = 0;
+
+    // New slots overwrite ranks already read, never ones still to come
+    for (int16_t r = 0; r < order_count; r++) {
+        int16_t slot = AircraftIndex_Find(to, from->icao24[order[r]]);
+        if (slot != AIRCRAFT_INDEX_EMPTY)
+            order[count++] = slot;
+    }
+
+    for (int16_t i = 0; i < MAX_AIRCRAFTS; i++) {
+        slot_rank[i] = DISTANCE_INDEX_NONE;
+    }
+    for (int16_t r = 0; r < count; r++) {
+        slot_rank[order[r]] = r;
+    }
+    order_count = count;
+
+    // Each newcomer is an insertion from the far end, a few are cheaper than a Shell sort
+    shuffled = (to_count - count) > to_count / 8;
+}
+
+/**
+ * @brief Ranks any of the first `count` slots that aren't yet, for DistanceIndex_Sort.
+ *
+ * Call once their offsets have been written.
+ */
+void DistanceIndex_SetBatch(int16_t count) {
+    for (int16_t slot = 0; slot < count; slot++) {
+        append(slot);
+    }
+}
+
+/**
+ * @brief Sorts the whole order after DistanceIndex_SetBatch.
+ *
+ * Only the gap of one is needed while the order is nearly right, which is a single
+ * pass plus a step for every place an aircraft overtook another.
+ */
+void DistanceIndex_Sort(void) {
+    for (int16_t g = shuffled ? 0 : GAP_COUNT - 1; g < GAP_COUNT; g++) {
+        int16_t gap = GAPS[g];
+
+        for (int16_t i = gap; i < order_count; i++) {
+            int16_t slot = order[i];
+            uint32_t distance = distance_of(slot);
+            int16_t r = i;
+
+            while (r >= gap && distance_of(order[r - gap]) > distance) {
+                order[r] = order[r - gap];
+                r -= gap;
+            }
+            order[r] = slot;
+        }
+    }
+
+    for (int16_t r = 0; r < order_count; r++) {
+        slot_rank[order[r]] = r;
+    }
+    shuffled = false;
+}
+
+/**
+ * @brief Steps a slot along to its place after its offsets changed.
+ */
+void DistanceIndex_Update(int16_t slot) {
+    append(slot);
+
+    uint32_t distance = distance_of(slot);
+    int16_t r = slot_rank[slot];
+
+    while (r > 0 && distance_of(order[r - 1]) > distance) {
+        order[r] = order[r - 1];
+        slot_rank[order[r]] = r;
+        r--;
+    }
+    while (r < order_count - 1 && distance_of(order[r + 1]) < distance) {
+        order[r] = order[r + 1];
+        slot_rank[order[r]] = r;
+        r++;
+    }
+
+    order[r] = slot;
+    slot_rank[slot] = r;
+}
+
+/**
+ * @brief Takes a slot out of the order, the ones farther out move up a rank.
+ */
+void DistanceIndex_Remove(int16_t slot) {
+    int16_t r = slot_rank[slot];
+    if (r == DISTANCE_INDEX_NONE)
+        return;
+
+    order_count--;
+    for (; r < order_count; r++) {
+        order[r] = order[r + 1];
+        slot_rank[order[r]] = r;
+    }
+    slot_rank[slot] = DISTANCE_INDEX_NONE;
+}
+
+/**
+ * @brief Renames a slot, for an aircraft moved into a freed one. `to` must not be ranked.
+ *
+ * The caller moves the offsets along with it.
+ */
+void DistanceIndex_Move(int16_t to, int16_t from) {
+    int16_t r = slot_rank[from];
+
+    slot_rank[to] = r;
+    slot_rank[from] = DISTANCE_INDEX_NONE;
+    if (r != DISTANCE_INDEX_NONE)
+        order[r] = to;
+}
+
+int16_t DistanceIndex_Count(void) {
+    return order_count;
+}
+
+/**
+ * @brief The slot at a rank, nearest first. Always a valid slot, even read during an update.
+ */
+int16_t DistanceIndex_Slot(int16_t rank) {
+    return order[rank];
+}
+
+/**
+ * @brief How many slots are at most a squared distance from the center, by binary search.
+ *
+ * @param distance_squared  In squared 1/64 km, as ground offsets are.
+ * @return int16_t          Those slots are the ranks below it.
+ */
+int16_t DistanceIndex_Within(uint32_t distance_squared) {
+    int16_t low = 0;
+    int16_t high = order_count;
+
+    while (low < high) {
+        int16_t middle = (low + high) / 2;
+        if (distance_of(order[middle]) <= distance_squared)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,71 @@
+/***************************************************************************************
+ * @file        distance_index.h
+ * @brief       Live aircraft kept in order of ground distance from the radar center.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every live slot is ranked by the squared length of its ground offset, nearest first.
+ * The offsets are read straight from the screen table DistanceIndex_Init is given, so
+ * the index holds only the order and each slot's rank, 4 bytes a slot.
+ * Offsets don't depend on the display range, so neither does the order: a zoom leaves it
+ * alone, and what lands on the radar at any range is a prefix of it, found with one
+ * binary search, see DistanceIndex_Within.
+ *
+ * Positions only drift a little from one projection to the next, so the order is kept
+ * up by insertion, which costs little more than a pass over a nearly sorted list. One
+ * aircraft that moves is stepped along to its place with DistanceIndex_Update. A whole
+ * store that moves is ranked with DistanceIndex_SetBatch and then sorted once with
+ * DistanceIndex_Sort. Slots added since the last DistanceIndex_Clear come in
+ * out of order, so the first sort after a clear runs a Shell sort instead.
+ *
+ * A keyframe swap, in builds with AIRCRAFT_STAGING_ENABLE, renumbers every slot, but
+ * mostly holds the same aircraft a little further along. DistanceIndex_Renumber follows
+ * each ranked aircraft to its new slot by address, so the order stays nearly right and
+ * the sort after the swap is the single insertion pass again. Only when most of the new
+ * store wasn't ranked before does it fall back to the Shell sort.
+ *
+***************************************************************************************/
+
+#ifndef DISTANCE_INDEX_H_
+#define DISTANCE_INDEX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+#include "./aircraft_index.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DISTANCE_INDEX_NONE     (-1)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void DistanceIndex_Init(const int16_t *offsets_east, const int16_t *offsets_north);
+void DistanceIndex_Clear(void);
+void DistanceIndex_Renumber(const AircraftStore_t *from, const AircraftIndex_t *to, int16_t to_count);
+void DistanceIndex_SetBatch(int16_t count);
+void DistanceIndex_Sort(void);
+void DistanceIndex_Update(int16_t slot);
+void DistanceIndex_Remove(int16_t slot);
+void DistanceIndex_Move(int16_t to, int16_t from);
+
+int16_t DistanceIndex_Count(void);
+int16_t DistanceIndex_Slot(int16_t rank);
+int16_t DistanceIndex_Within(uint32_t distance_squared);
+
+/********************************Public Functions***********************************/
+
+#endif /* DISTANCE_INDEX_H_ */
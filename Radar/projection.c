@@ -0,0 +1,183 @@
+/***************************************************************************************
+ * @file        projection.c
+ * @brief       Fixed-point lat/lon to radar pixel projection.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Float math is only used when the projection is set up. The per-aircraft path is
+ * integer only: a 32x32->64 multiply (a single SMULL on the Cortex-M4) and a shift per
+ * axis for the ground offset, and a 32-bit multiply and a shift per axis to scale it.
+ * The pixel offsets are saturated to 15 bits and packed into one register, which makes
+ * the range test a single dual multiply-add, see simd.h. Saturating keeps an offset past
+ * the edge past it, so no separate box test is needed to guard the squares.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./projection.h"
+
+#include <math.h>
+
+#include "threads.h"
+#include "System/simd.h"
+#include "System/ramfunc.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define PROJECTION_HALF     (1 << (PROJECTION_FRACTION_BITS - 1))
+#define SCALE_HALF          (1 << (PROJECTION_SCALE_BITS - 1))
+#define OFFSETS_PER_KM      (1 << PROJECTION_OFFSET_BITS)
+
+/*************************************Defines***************************************/
+
+/********************************Private Functions**********************************/
+
+static int32_t to_units(float degrees) {
+    return (int32_t)lroundf(degrees * PROJECTION_UNITS_PER_DEGREE);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets up a projection around a center, see Projection_SetCenter.
+ *
+ * Projection_SetRange must be called before the first Projection_ScaleBatch.
+ *
+ * @param center_latitude   Latitude of the radar center in degrees.
+ * @param center_longitude  Longitude of the radar center in degrees.
+ * @param origin_x          Screen X of the radar center.
+ * @param origin_y          Screen Y of the radar center.
+ * @param radius_px         Radius in pixels that the display range maps to.
+ */
+void Projection_Init(Projection_t *projection, float center_latitude, float center_longitude,
+                     int16_t origin_x, int16_t origin_y, int16_t radius_px) {
+    projection->origin_x = origin_x;
+    projection->origin_y = origin_y;
+    projection->radius_px = radius_px;
+    projection->radius_squared = (int32_t)radius_px * radius_px;
+    projection->scale = 0;
+    projection->reach_squared = 0;
+
+    Projection_SetCenter(projection, to_units(center_latitude), to_units(center_longitude));
+}
+
+/**
+ * @brief Moves the radar center, keeping the screen geometry and display range.
+ *
+ * Works out the local tangent plane at the new center once, after which every position
+ * maps at the usual cost. Ground offsets and dead-reckoning rates taken before the move
+ * are stale and must be worked out again.
+ *
+ * @param center_latitude   Latitude of the radar center in micro-degrees.
+ * @param center_longitude  Longitude of the radar center in micro-degrees.
+ */
+void Projection_SetCenter(Projection_t *projection, int32_t center_latitude, int32_t center_longitude) {
+    projection->center_latitude = center_latitude;
+    projection->center_longitude = center_longitude;
+
+    // The only cosine, it only changes with the center
+    float latitude_radians = (float)center_latitude / PROJECTION_UNITS_PER_DEGREE * (M_PI / 180.0f);
+    projection->km_per_unit_longitude = PROJECTION_KM_PER_DEGREE * cosf(latitude_radians) /
+                                        PROJECTION_UNITS_PER_DEGREE;
+    projection->units_per_meter_longitude = 1.0f / (projection->km_per_unit_longitude * 1000.0f);
+
+    float one = (float)(1 << PROJECTION_FRACTION_BITS);
+    projection->offset_longitude = (int32_t)lroundf(projection->km_per_unit_longitude * OFFSETS_PER_KM * one);
+    projection->offset_latitude = (int32_t)lroundf(PROJECTION_KM_PER_DEGREE / PROJECTION_UNITS_PER_DEGREE *
+                                                   OFFSETS_PER_KM * one);
+}
+
+/**
+ * @brief Rescales the projection for a new display range.
+ *
+ * Integer only, so it is cheap enough to call on every frame of a zoom.
+ *
+ * @param range_km Distance from the center that lands on the edge of the radar, at most
+ *                 PROJECTION_MAX_RANGE_KM.
+ */
+void Projection_SetRange(Projection_t *projection, uint16_t range_km) {
+    int32_t offsets = (int32_t)range_km * OFFSETS_PER_KM;
+    projection->scale = (((int32_t)projection->radius_px << PROJECTION_SCALE_BITS) + offsets / 2) / offsets;
+
+    // Rounding moves a point less than a pixel, so one pixel past the radius is out for sure
+    uint32_t reach = ((uint32_t)(projection->radius_px + 1) << PROJECTION_SCALE_BITS) / projection->scale + 1;
+    projection->reach_squared = reach * reach;
+}
+
+/**
+ * @brief Works out the ground offsets of a run of positions from the radar center.
+ *
+ * @param longitude Longitudes in micro-degrees.
+ * @param latitude  Latitudes in micro-degrees.
+ * @param count     Number of positions.
+ * @param offset_x  Receives each offset east, in 1/64 km.
+ * @param offset_y  Receives each offset north, in 1/64 km.
+ */
+RAMFUNC void Projection_OffsetBatch(const Projection_t *projection, const int32_t *longitude, const int32_t *latitude,
+                            int16_t count, int16_t *offset_x, int16_t *offset_y) {
+    const int32_t center_longitude = projection->center_longitude;
+    const int32_t center_latitude = projection->center_latitude;
+    const int32_t offset_longitude = projection->offset_longitude;
+    const int32_t offset_latitude = projection->offset_latitude;
+
+    for (int16_t i = 0; i < count; i++) {
+        int64_t east = (int64_t)(longitude[i] - center_longitude) * offset_longitude;
+        int64_t north = (int64_t)(latitude[i] - center_latitude) * offset_latitude;
+
+        offset_x[i] = Simd_Saturate15((int32_t)((east + PROJECTION_HALF) >> PROJECTION_FRACTION_BITS));
+        offset_y[i] = Simd_Saturate15((int32_t)((north + PROJECTION_HALF) >> PROJECTION_FRACTION_BITS));
+    }
+}
+
+/**
+ * @brief Maps a run of ground offsets to radar pixels at the display range.
+ *
+ * The offsets are read as columns, and the results written as columns, so a slice of
+ * the screen table can be filled in directly.
+ *
+ * @param offset_x  Offsets east, from Projection_OffsetBatch.
+ * @param offset_y  Offsets north, from Projection_OffsetBatch.
+ * @param count     Number of offsets.
+ * @param screen_x  Receives the screen X of each offset that is in range.
+ * @param screen_y  Receives the screen Y of each offset that is in range.
+ * @param on_screen Receives 1 for each offset inside the display range, 0 otherwise.
+ * @return int16_t Number of offsets inside the display range.
+ */
+RAMFUNC int16_t Projection_ScaleBatch(const Projection_t *projection, const int16_t *offset_x, const int16_t *offset_y,
+                              int16_t count, int16_t *screen_x, int16_t *screen_y, uint8_t *on_screen) {
+    const int32_t scale = projection->scale;
+    const int32_t radius_squared = projection->radius_squared;
+    int16_t inside = 0;
+
+    for (int16_t i = 0; i < count; i++) {
+        // Round to the nearest pixel
+        int16_t dx = Simd_Saturate15((offset_x[i] * scale + SCALE_HALF) >> PROJECTION_SCALE_BITS);
+        int16_t dy = Simd_Saturate15((offset_y[i] * scale + SCALE_HALF) >> PROJECTION_SCALE_BITS);
+
+        if (Simd_LengthSquared(Simd_Pack(dx, dy)) > radius_squared) {
+            on_screen[i] = 0;
+            continue;
+        }
+
+        // Screen Y grows downwards, latitude grows upwards
+        screen_x[i] = projection->origin_x + dx;
+        screen_y[i] = projection->origin_y - dy;
+        on_screen[i] = 1;
+        inside++;
+    }
+
+    return inside;
+}
+
+/********************************Public Functions***********************************/
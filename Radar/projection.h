@@ -0,0 +1,87 @@
+/***************************************************************************************
+ * @file        projection.h
+ * @brief       Fixed-point lat/lon to radar pixel projection.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The radar uses an equirectangular projection around its center, so a pixel offset
+ * is just a scaled coordinate offset on each axis. Mapping is done in two steps. The
+ * first turns a position into its ground offset from the center, east and north in
+ * 1/64 km, one multiply per axis with the cosine of the center latitude folded in once.
+ * The second scales that offset to pixels by the one fixed-point factor the display
+ * range sets, and compares it with the squared radius, with no trigonometry or square
+ * roots.
+ *
+ * Ground offsets don't depend on the range, so callers keep them, and a range change
+ * only has to redo the second step with Projection_ScaleBatch. Offsets saturate at
+ * PROJECTION_MAX_RANGE_KM, which is always off the radar. Projection_SetRange also works
+ * out how far out an offset can be and still land on the radar once rounded, so whole
+ * runs of offsets beyond it can be left unscaled.
+ *
+ * Coordinates are taken in micro-degrees, as the aircraft store keeps them. A kilometer
+ * is thousands of micro-degrees, so the first step carries 24 fraction bits.
+ *
+***************************************************************************************/
+
+#ifndef PROJECTION_H_
+#define PROJECTION_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define PROJECTION_KM_PER_DEGREE    111.32f
+#define PROJECTION_UNITS_PER_DEGREE 1000000
+#define PROJECTION_FRACTION_BITS    24
+#define PROJECTION_OFFSET_BITS      6       // ground offsets are in 1/64 km
+#define PROJECTION_SCALE_BITS       16      // Q16 pixels per ground offset unit
+#define PROJECTION_MAX_RANGE_KM     255     // ground offsets saturate past this
+#define PROJECTION_BATCH            16      // positions dead reckoned at a time, sized for a thread stack
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int32_t center_longitude;       // micro-degrees
+    int32_t center_latitude;        // micro-degrees
+    int16_t origin_x;               // radar center on screen
+    int16_t origin_y;
+    int16_t radius_px;              // radar radius the display range maps to
+    float km_per_unit_longitude;    // shrinks with the cosine of the center latitude
+    float units_per_meter_longitude;
+    int32_t offset_longitude;       // Q24 offset units per micro-degree of longitude
+    int32_t offset_latitude;        // Q24 offset units per micro-degree of latitude
+    int32_t scale;                  // Q16 pixels per offset unit at the display range
+    int32_t radius_squared;
+    uint32_t reach_squared;         // squared ground offset past which nothing lands on the radar
+} Projection_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Projection_Init(Projection_t *projection, float center_latitude, float center_longitude,
+                     int16_t origin_x, int16_t origin_y, int16_t radius_px);
+void Projection_SetCenter(Projection_t *projection, int32_t center_latitude, int32_t center_longitude);
+void Projection_SetRange(Projection_t *projection, uint16_t range_km);
+
+void Projection_OffsetBatch(const Projection_t *projection, const int32_t *longitude, const int32_t *latitude,
+                            int16_t count, int16_t *offset_x, int16_t *offset_y);
+int16_t Projection_ScaleBatch(const Projection_t *projection, const int16_t *offset_x, const int16_t *offset_y,
+                              int16_t count, int16_t *screen_x, int16_t *screen_y, uint8_t *on_screen);
+
+/********************************Public Functions***********************************/
+
+#endif /* PROJECTION_H_ */
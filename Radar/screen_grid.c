@@ -0,0 +1,267 @@
+/***************************************************************************************
+ * @file        screen_grid.c
+ * @brief       Uniform screen-space bucket grid over the live aircraft.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * After ring k has been scanned, every cell not yet visited is at least k whole cells
+ * away from the query point on some axis, so once the best match is within k cells the
+ * search is over.
+ *
+ * Screen coordinates are well inside 15 bits, so in a cell scan each candidate's offset
+ * from the query point is one packed subtract and its squared distance one dual
+ * multiply-add, see simd.h.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./screen_grid.h"
+
+#include "MultimodDrivers/multimod.h"
+#include "System/simd.h"
+#include "System/sine_table.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define CELL_SIZE       (1 << SCREEN_GRID_CELL_SHIFT)
+#define GRID_COLUMNS    ((PANEL_WIDTH + CELL_SIZE - 1) >> SCREEN_GRID_CELL_SHIFT)
+#define GRID_ROWS       ((PANEL_HEIGHT - MIDLINE + CELL_SIZE - 1) >> SCREEN_GRID_CELL_SHIFT)
+#define GRID_CELLS      (GRID_COLUMNS * GRID_ROWS)
+
+#define MAX_RINGS       ((GRID_COLUMNS > GRID_ROWS) ? GRID_COLUMNS : GRID_ROWS)
+
+// A pixel off the direction's line costs as much as this many along it, at least 1
+#define CROSS_WEIGHT    2
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    MATCH_ANY,
+    MATCH_CONE,         // within 60 degrees of the direction
+    MATCH_HALF_PLANE    // anywhere ahead of the direction
+} Match_t;
+
+typedef struct {
+    const AircraftScreen_t *screen;
+    int16_t x;
+    int16_t y;
+    int32_t unit_x;         // Q15 direction, from SineTable_Atan2 once per query
+    int32_t unit_y;
+    int16_t exclude;
+    Match_t match;
+    int16_t best;
+    int32_t best_score;
+} Query_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static int16_t cell_head[GRID_CELLS];
+static int16_t slot_next[MAX_AIRCRAFTS];
+static int16_t slot_cell[MAX_AIRCRAFTS];
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static int16_t clamp(int16_t value, int16_t low, int16_t high) {
+    return (value < low) ? low : (value > high) ? high : value;
+}
+
+static int16_t column_of(int16_t x) {
+    return clamp(x, 0, PANEL_WIDTH - 1) >> SCREEN_GRID_CELL_SHIFT;
+}
+
+static int16_t row_of(int16_t y) {
+    return (clamp(y, MIDLINE, PANEL_HEIGHT - 1) - MIDLINE) >> SCREEN_GRID_CELL_SHIFT;
+}
+
+/**
+ * @brief How far a candidate is from what the query wants, lower is better.
+ *
+ * Plain squared distance for MATCH_ANY. Along a direction, the distance ahead plus
+ * CROSS_WEIGHT times the distance off to the side, both Q15 pixels, so an aircraft
+ * straight ahead wins over one nearer but well off to the side.
+ *
+ * @return int32_t INT32_MAX if the query doesn't take the candidate at all.
+ */
+static int32_t score(const Query_t *query, int32_t dx, int32_t dy, int32_t distance) {
+    if (query->match == MATCH_ANY)
+        return distance;
+
+    int32_t ahead = dx * query->unit_x + dy * query->unit_y;
+    if (ahead <= 0)
+        return INT32_MAX;
+
+    // cos(60) = 1/2, compared squared to stay in integers
+    if (query->match == MATCH_CONE && 4 * (int64_t)ahead * ahead < (int64_t)distance << (2 * SINE_TABLE_BITS))
+        return INT32_MAX;
+
+    int32_t side = dx * query->unit_y - dy * query->unit_x;
+    return ahead + CROSS_WEIGHT * ((side < 0) ? -side : side);
+}
+
+/**
+ * @brief The lowest score anything `reach` pixels away or farther can have.
+ *
+ * Ahead plus at least once the side is never less than the distance itself, less a
+ * little for the unit vector's rounding.
+ */
+static int32_t score_at(const Query_t *query, int32_t reach) {
+    if (query->match == MATCH_ANY)
+        return reach * reach;
+    return reach * (SINE_TABLE_ONE - 1);
+}
+
+static void scan_cell(Query_t *query, int16_t column, int16_t row) {
+    if (column < 0 || column >= GRID_COLUMNS || row < 0 || row >= GRID_ROWS)
+        return;
+
+    Simd16x2_t point = Simd_Pack(query->x, query->y);
+
+    for (int16_t slot = cell_head[row * GRID_COLUMNS + column]; slot != SCREEN_GRID_NONE; slot = slot_next[slot]) {
+        if (slot == query->exclude)
+            continue;
+
+        Simd16x2_t offset = Simd_Sub(Simd_Pack(query->screen->x[slot], query->screen->y[slot]), point);
+        int32_t distance = Simd_LengthSquared(offset);
+        int32_t candidate = score(query, Simd_Low(offset), Simd_High(offset), distance);
+
+        if (candidate < query->best_score) {
+            query->best = slot;
+            query->best_score = candidate;
+        }
+    }
+}
+
+/**
+ * @brief Scans rings of cells outward from the query point until nothing closer is left.
+ */
+static int16_t search(Query_t *query) {
+    int16_t column = column_of(query->x);
+    int16_t row = row_of(query->y);
+
+    query->best = SCREEN_GRID_NONE;
+    query->best_score = INT32_MAX;
+
+    for (int16_t ring = 0; ring < MAX_RINGS; ring++) {
+        if (ring == 0) {
+            scan_cell(query, column, row);
+        } else {
+            for (int16_t i = -ring; i <= ring; i++) {
+                scan_cell(query, column + i, row - ring);
+                scan_cell(query, column + i, row + ring);
+            }
+            for (int16_t i = -ring + 1; i <= ring - 1; i++) {
+                scan_cell(query, column - ring, row + i);
+                scan_cell(query, column + ring, row + i);
+            }
+        }
+
+        if (query->best != SCREEN_GRID_NONE && query->best_score <= score_at(query, (int32_t)ring * CELL_SIZE))
+            break;
+    }
+
+    return query->best;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void ScreenGrid_Clear(void) {
+    for (int16_t i = 0; i < GRID_CELLS; i++) {
+        cell_head[i] = SCREEN_GRID_NONE;
+    }
+    for (int16_t i = 0; i < MAX_AIRCRAFTS; i++) {
+        slot_cell[i] = SCREEN_GRID_NONE;
+    }
+}
+
+/**
+ * @brief Takes a slot out of whatever cell it is in.
+ */
+void ScreenGrid_Remove(int16_t slot) {
+    int16_t cell = slot_cell[slot];
+    if (cell == SCREEN_GRID_NONE)
+        return;
+
+    int16_t *link = &cell_head[cell];
+    while (*link != slot) {
+        link = &slot_next[*link];
+    }
+    *link = slot_next[slot];
+
+    slot_cell[slot] = SCREEN_GRID_NONE;
+}
+
+/**
+ * @brief Files a slot under the cell for its new position.
+ *
+ * Off-screen aircraft are kept out of the grid, so queries only ever return aircraft
+ * that can be seen.
+ */
+void ScreenGrid_Update(int16_t slot, bool on_screen, int16_t x, int16_t y) {
+    int16_t cell = on_screen ? (row_of(y) * GRID_COLUMNS + column_of(x)) : SCREEN_GRID_NONE;
+
+    if (cell == slot_cell[slot])
+        return;
+
+    ScreenGrid_Remove(slot);
+
+    if (cell != SCREEN_GRID_NONE) {
+        slot_next[slot] = cell_head[cell];
+        cell_head[cell] = slot;
+        slot_cell[slot] = cell;
+    }
+}
+
+/**
+ * @brief Nearest on-screen aircraft to a screen point.
+ *
+ * @param exclude Slot to skip, or SCREEN_GRID_NONE.
+ * @return int16_t The slot, or SCREEN_GRID_NONE if nothing is on screen.
+ */
+int16_t ScreenGrid_Nearest(const AircraftScreen_t *screen, int16_t x, int16_t y, int16_t exclude) {
+    Query_t query = { screen, x, y, 0, 0, exclude, MATCH_ANY };
+    return search(&query);
+}
+
+/**
+ * @brief On-screen aircraft that best matches a screen direction from a point.
+ *
+ * The direction is turned into a whole-degree angle and a unit vector once, after which
+ * each candidate costs two multiply-adds. Aircraft within 60 degrees of the direction
+ * are preferred, ranked by distance ahead plus CROSS_WEIGHT times the distance off the
+ * line. If there are none, anything ahead of the point is ranked the same way.
+ *
+ * @return int16_t The slot, or SCREEN_GRID_NONE if nothing lies that way.
+ */
+int16_t ScreenGrid_NearestInDirection(const AircraftScreen_t *screen, int16_t x, int16_t y,
+                                      int32_t direction_x, int32_t direction_y, int16_t exclude) {
+    if (direction_x == 0 && direction_y == 0)
+        return SCREEN_GRID_NONE;
+
+    int32_t degrees = SineTable_Atan2(direction_y, direction_x);
+    Query_t query = { screen, x, y, SineTable_Cos(degrees), SineTable_Sin(degrees), exclude, MATCH_CONE };
+
+    if (search(&query) != SCREEN_GRID_NONE)
+        return query.best;
+
+    query.match = MATCH_HALF_PLANE;
+    return search(&query);
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,57 @@
+/***************************************************************************************
+ * @file        screen_grid.h
+ * @brief       Uniform screen-space bucket grid over the live aircraft.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * On-screen aircraft are bucketed by projected position into 16x16 pixel cells, each
+ * cell holding a linked list of slots of the live store. An aircraft is moved between
+ * cells whenever it is projected, so the grid stays current without rebuilding.
+ *
+ * Queries scan cells in square rings around the query point and stop as soon as no
+ * farther ring can hold anything closer, so selection cost depends on how crowded the
+ * neighbourhood is rather than on MAX_AIRCRAFTS. Distances are in projected pixels, so
+ * east-west and north-south steps are weighed the same. A search along a direction
+ * weighs how far off the line a candidate is as well as how far ahead, see
+ * ScreenGrid_NearestInDirection.
+ *
+***************************************************************************************/
+
+#ifndef SCREEN_GRID_H_
+#define SCREEN_GRID_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SCREEN_GRID_CELL_SHIFT  4    // 16x16 pixel cells
+#define SCREEN_GRID_NONE        (-1)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void ScreenGrid_Clear(void);
+void ScreenGrid_Update(int16_t slot, bool on_screen, int16_t x, int16_t y);
+void ScreenGrid_Remove(int16_t slot);
+
+int16_t ScreenGrid_Nearest(const AircraftScreen_t *screen, int16_t x, int16_t y, int16_t exclude);
+int16_t ScreenGrid_NearestInDirection(const AircraftScreen_t *screen, int16_t x, int16_t y,
+                                      int32_t direction_x, int32_t direction_y, int16_t exclude);
+
+/********************************Public Functions***********************************/
+
+#endif /* SCREEN_GRID_H_ */
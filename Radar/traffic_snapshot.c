@@ -0,0 +1,333 @@
+/***************************************************************************************
+ * @file        traffic_snapshot.c
+ * @brief       Last live aircraft table kept in flash, for a warm start after a reset.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Flash is read in place, a word at a time through HWREG. A save is three calls so the
+ * caller can hold its store lock a chunk at a time rather than for the whole write:
+ * TrafficSnapshot_Begin erases the blocks, TrafficSnapshot_Append encodes and programs
+ * records, and TrafficSnapshot_Finish writes the header that makes them valid.
+ *
+ * Record layout, little-endian:
+ *
+ *      3 bytes   ICAO24 address
+ *      3 bytes   latitude from the center, 10 micro-degrees
+ *      3 bytes   longitude from the center, 10 micro-degrees
+ *      3 bytes   velocity in the low 12 bits, heading in the high 12
+ *      2 bytes   altitude
+ *      6 bytes   callsign, packed as the store keeps it, see aircraft_store.h
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./traffic_snapshot.h"
+
+#include <string.h>
+
+#include "inc/hw_types.h"
+#include "driverlib/flash.h"
+#include "driverlib/sw_crc.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define POSITION_STEP           10          // micro-degrees per record position unit
+#define POSITION_LIMIT          0x7FFFFF    // furthest a 24-bit offset reaches
+#define MOTION_LIMIT            0xFFF       // largest velocity and heading a record holds
+
+#define RECORD_WORDS            (TRAFFIC_SNAPSHOT_RECORD_SIZE / sizeof(uint32_t))
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;          // one more than the snapshot before
+    int32_t center_latitude;    // micro-degrees, record positions are relative to it
+    int32_t center_longitude;
+    uint16_t count;
+    uint16_t crc;               // CRC-16 of the records
+} SnapshotHeader_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+
+// Newest valid snapshot, newest_block is -1 if there is none
+static SnapshotHeader_t newest;
+static int16_t newest_block = -1;
+
+// Save in progress
+static SnapshotHeader_t pending;
+static int16_t pending_block = 0;
+static int16_t pending_blocks = 0;
+static int16_t pending_capacity = 0;
+static bool pending_failed = false;
+
+static uint32_t chunk[TRAFFIC_SNAPSHOT_CHUNK * RECORD_WORDS];
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint32_t block_address(int16_t block) {
+    return TRAFFIC_SNAPSHOT_BASE + (uint32_t)block * TRAFFIC_SNAPSHOT_BLOCK_SIZE;
+}
+
+static uint32_t record_address(int16_t block, int16_t record) {
+    return block_address(block) + TRAFFIC_SNAPSHOT_HEADER_SIZE + (uint32_t)record * TRAFFIC_SNAPSHOT_RECORD_SIZE;
+}
+
+static int16_t blocks_for(int16_t count) {
+    uint32_t bytes = TRAFFIC_SNAPSHOT_HEADER_SIZE + (uint32_t)count * TRAFFIC_SNAPSHOT_RECORD_SIZE;
+    return (bytes + TRAFFIC_SNAPSHOT_BLOCK_SIZE - 1) / TRAFFIC_SNAPSHOT_BLOCK_SIZE;
+}
+
+static void read_words(uint32_t address, uint32_t *words, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        words[i] = HWREG(address + i * sizeof(uint32_t));
+    }
+}
+
+static void put24(uint8_t *bytes, uint32_t value) {
+    bytes[0] = value;
+    bytes[1] = value >> 8;
+    bytes[2] = value >> 16;
+}
+
+static uint32_t get24(const uint8_t *bytes) {
+    return bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16);
+}
+
+static int32_t signed24(uint32_t value) {
+    return (int32_t)(value << 8) >> 8;
+}
+
+/**
+ * @brief Micro-degrees from the center in record units, rounded and clamped to 24 bits.
+ */
+static uint32_t position_units(int32_t position, int32_t center) {
+    int32_t offset = position - center;
+    int32_t units = (offset >= 0) ? (offset + POSITION_STEP / 2) / POSITION_STEP
+                                  : (offset - POSITION_STEP / 2) / POSITION_STEP;
+
+    if (units > POSITION_LIMIT)
+        units = POSITION_LIMIT;
+    if (units < -POSITION_LIMIT)
+        units = -POSITION_LIMIT;
+    return (uint32_t)units & 0xFFFFFF;
+}
+
+static void encode_record(const AircraftStore_t *store, int16_t slot, const SnapshotHeader_t *header,
+                          uint8_t *record) {
+    int32_t velocity = store->velocity[slot];
+    int32_t heading = store->heading[slot] % (360 * AIRCRAFT_HEADING_SCALE);
+
+    if (heading < 0)
+        heading += 360 * AIRCRAFT_HEADING_SCALE;
+    velocity = (velocity < 0) ? 0 : (velocity > MOTION_LIMIT) ? MOTION_LIMIT : velocity;
+
+    put24(&record[0], store->icao24[slot]);
+    put24(&record[3], position_units(store->latitude[slot], header->center_latitude));
+    put24(&record[6], position_units(store->longitude[slot], header->center_longitude));
+    put24(&record[9], (uint32_t)velocity | ((uint32_t)heading << 12));
+    record[12] = (uint16_t)store->altitude[slot];
+    record[13] = (uint16_t)store->altitude[slot] >> 8;
+
+    uint64_t codes = AircraftStore_Callsign(store, slot);
+    for (int32_t i = 0; i < 6; i++) {
+        record[14 + i] = codes >> (8 * i);
+    }
+}
+
+/**
+ * @brief Reads a block's header, and checks the records after it against its CRC.
+ */
+static bool read_snapshot(int16_t block, SnapshotHeader_t *header) {
+    uint32_t words[sizeof(*header) / sizeof(uint32_t)];
+    read_words(block_address(block), words, sizeof(*header) / sizeof(uint32_t));
+    memcpy(header, words, sizeof(*header));
+
+    if (header->magic != TRAFFIC_SNAPSHOT_MAGIC || header->count > TRAFFIC_SNAPSHOT_MAX_AIRCRAFT ||
+        block + blocks_for(header->count) > TRAFFIC_SNAPSHOT_BLOCKS)
+        return false;
+
+    uint16_t crc = 0;
+    for (int16_t i = 0; i < header->count; i++) {
+        uint32_t record[RECORD_WORDS];
+        read_words(record_address(block, i), record, RECORD_WORDS);
+        crc = Crc16(crc, (const uint8_t *)record, TRAFFIC_SNAPSHOT_RECORD_SIZE);
+    }
+    return crc == header->crc;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Finds the newest valid snapshot in the ring.
+ *
+ * Must be called before any other TrafficSnapshot call.
+ */
+void TrafficSnapshot_Init(void) {
+    newest_block = -1;
+
+    for (int16_t block = 0; block < TRAFFIC_SNAPSHOT_BLOCKS; block++) {
+        SnapshotHeader_t header;
+        if (!read_snapshot(block, &header))
+            continue;
+
+        if (newest_block < 0 || (int32_t)(header.sequence - newest.sequence) > 0) {
+            newest = header;
+            newest_block = block;
+        }
+    }
+}
+
+/**
+ * @brief Aircraft in the newest snapshot, 0 if there is none.
+ */
+int16_t TrafficSnapshot_Count(void) {
+    return (newest_block < 0) ? 0 : newest.count;
+}
+
+/**
+ * @brief Decodes one aircraft of the newest snapshot into a store slot.
+ *
+ * @param record    0 to TrafficSnapshot_Count() - 1.
+ * @param reported  DeadReckoning_Now() to file the position under.
+ */
+void TrafficSnapshot_Read(int16_t record, AircraftStore_t *store, int16_t slot, uint16_t reported) {
+    uint32_t words[RECORD_WORDS];
+    const uint8_t *bytes = (const uint8_t *)words;
+
+    read_words(record_address(newest_block, record), words, RECORD_WORDS);
+
+    uint32_t motion = get24(&bytes[9]);
+    store->icao24[slot] = get24(&bytes[0]);
+    store->latitude[slot] = newest.center_latitude + signed24(get24(&bytes[3])) * POSITION_STEP;
+    store->longitude[slot] = newest.center_longitude + signed24(get24(&bytes[6])) * POSITION_STEP;
+    store->velocity[slot] = motion & MOTION_LIMIT;
+    store->heading[slot] = motion >> 12;
+    store->altitude[slot] = (int16_t)(bytes[12] | (bytes[13] << 8));
+    store->reported[slot] = reported;
+
+    uint64_t codes = 0;
+    for (int32_t i = 5; i >= 0; i--) {
+        codes = (codes << 8) | bytes[14 + i];
+    }
+
+    // Older snapshots kept a blank callsign as spaces
+    if ((codes & 0x3F) <= 1)
+        codes = AIRCRAFT_CALLSIGN_NONE;
+    AircraftStore_SetCallsign(store, slot, codes);
+}
+
+/**
+ * @brief Starts a save of up to `count` aircraft, erasing the blocks it will take.
+ *
+ * The snapshot goes right after the newest one, or at the start of the ring if it
+ * doesn't fit before the end. Blocks for all of TrafficSnapshot_Append's aircraft are
+ * erased here, so allow for every one of them.
+ *
+ * @return bool False if an erase failed, the save is abandoned.
+ */
+bool TrafficSnapshot_Begin(int16_t count, int32_t center_latitude, int32_t center_longitude) {
+    if (count > TRAFFIC_SNAPSHOT_MAX_AIRCRAFT)
+        count = TRAFFIC_SNAPSHOT_MAX_AIRCRAFT;
+    if (count < 0)
+        count = 0;
+
+    pending_blocks = blocks_for(count);
+    pending_block = (newest_block < 0) ? 0 : newest_block + blocks_for(newest.count);
+    if (pending_block + pending_blocks > TRAFFIC_SNAPSHOT_BLOCKS)
+        pending_block = 0;
+
+    pending_capacity = count;
+    pending_failed = false;
+    memset(&pending, 0, sizeof(pending));
+    pending.magic = TRAFFIC_SNAPSHOT_MAGIC;
+    pending.sequence = (newest_block < 0) ? 1 : newest.sequence + 1;
+    pending.center_latitude = center_latitude;
+    pending.center_longitude = center_longitude;
+
+    // A wrapped snapshot can't reach the newest one, it is past half way round the ring
+    for (int16_t i = 0; i < pending_blocks; i++) {
+        if (FlashErase(block_address(pending_block + i)) != 0) {
+            pending_failed = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Adds store slots `first` to `first + count - 1` to the save in progress.
+ *
+ * Slots past the store's count, or past the count given to TrafficSnapshot_Begin, are
+ * left out. The store is only read, in TRAFFIC_SNAPSHOT_CHUNK slot pieces.
+ *
+ * @return int16_t Aircraft added.
+ */
+int16_t TrafficSnapshot_Append(const AircraftStore_t *store, int16_t first, int16_t count) {
+    if (first + count > store->count)
+        count = store->count - first;
+    if (pending.count + count > pending_capacity)
+        count = pending_capacity - pending.count;
+    if (pending_failed || count <= 0)
+        return 0;
+
+    for (int16_t done = 0; done < count; done += TRAFFIC_SNAPSHOT_CHUNK) {
+        int16_t records = count - done;
+        if (records > TRAFFIC_SNAPSHOT_CHUNK)
+            records = TRAFFIC_SNAPSHOT_CHUNK;
+
+        uint8_t *bytes = (uint8_t *)chunk;
+        for (int16_t i = 0; i < records; i++) {
+            encode_record(store, first + done + i, &pending, &bytes[i * TRAFFIC_SNAPSHOT_RECORD_SIZE]);
+        }
+
+        uint32_t length = records * TRAFFIC_SNAPSHOT_RECORD_SIZE;
+        if (FlashProgram(chunk, record_address(pending_block, pending.count), length) != 0) {
+            pending_failed = true;
+            return done;
+        }
+
+        pending.crc = Crc16(pending.crc, bytes, length);
+        pending.count += records;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Writes the header of the save in progress, which makes it the newest snapshot.
+ *
+ * @return bool True if the snapshot is stored.
+ */
+bool TrafficSnapshot_Finish(void) {
+    if (pending_failed)
+        return false;
+
+    if (FlashProgram((uint32_t *)&pending, block_address(pending_block), sizeof(pending)) != 0)
+        return false;
+
+    newest = pending;
+    newest_block = pending_block;
+    return true;
+}
+
+/********************************Public Functions***********************************/
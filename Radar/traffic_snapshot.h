@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        traffic_snapshot.h
+ * @brief       Last live aircraft table kept in flash, for a warm start after a reset.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The top TRAFFIC_SNAPSHOT_BLOCKS erase blocks of flash are kept out of the linker's
+ * FLASH region, see tm4c123gh6pm.cmd, and used as a ring of snapshots. Each snapshot
+ * starts on a block boundary right after the one before it, wrapping to the first block
+ * when it doesn't fit before the end, so every block is erased in turn and wear is spread
+ * over the whole ring.
+ *
+ * A snapshot is a header and one 20-byte record per aircraft, against 26 bytes in the
+ * store. Positions are 24-bit offsets from the snapshot's radar center in 10 micro-degree
+ * steps, velocity and heading share three bytes at their store scales, and the callsign
+ * is the store's own 6-bit codes, copied as they are.
+ *
+ * The records are written first and the header last, with a CRC-16 over the records, so
+ * a snapshot cut short by a reset reads as missing. TrafficSnapshot_Init picks the valid
+ * header with the highest sequence number.
+ *
+ * Erasing and programming stall every fetch from flash, interrupts included, for as
+ * long as they take. Saves are only made in the quiet time right after a burst, see
+ * Save_Snapshot_Thread.
+ *
+***************************************************************************************/
+
+#ifndef TRAFFIC_SNAPSHOT_H_
+#define TRAFFIC_SNAPSHOT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./aircraft_store.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define TRAFFIC_SNAPSHOT_BASE           0x00038000  // last 32 KB of the 256 KB flash
+#define TRAFFIC_SNAPSHOT_BLOCK_SIZE     1024        // flash erase block
+#define TRAFFIC_SNAPSHOT_BLOCKS         32
+#define TRAFFIC_SNAPSHOT_MAX_BLOCKS     8           // one snapshot at most, a quarter of the ring
+#define TRAFFIC_SNAPSHOT_MAGIC          0x50414E53  // "SNAP"
+
+#define TRAFFIC_SNAPSHOT_HEADER_SIZE    20
+#define TRAFFIC_SNAPSHOT_RECORD_SIZE    20
+#define TRAFFIC_SNAPSHOT_MAX_AIRCRAFT   ((TRAFFIC_SNAPSHOT_MAX_BLOCKS * TRAFFIC_SNAPSHOT_BLOCK_SIZE - \
+                                          TRAFFIC_SNAPSHOT_HEADER_SIZE) / TRAFFIC_SNAPSHOT_RECORD_SIZE)
+
+#define TRAFFIC_SNAPSHOT_CHUNK          8           // records encoded and programmed at a time
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void TrafficSnapshot_Init(void);
+
+int16_t TrafficSnapshot_Count(void);
+void TrafficSnapshot_Read(int16_t record, AircraftStore_t *store, int16_t slot, uint16_t reported);
+
+bool TrafficSnapshot_Begin(int16_t count, int32_t center_latitude, int32_t center_longitude);
+int16_t TrafficSnapshot_Append(const AircraftStore_t *store, int16_t first, int16_t count);
+bool TrafficSnapshot_Finish(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* TRAFFIC_SNAPSHOT_H_ */
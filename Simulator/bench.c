@@ -0,0 +1,301 @@
+/***************************************************************************************
+ * @file        bench.c
+ * @brief       Host microbenchmarks for the parser, reprojection, selection and drawing.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ *      flight_bench [-n aircraft] [-r repeats]
+ *      flight_bench -s report
+ *
+ * A keyframe burst of synthetic aircraft spread over the default range is replayed
+ * through UART4 at full speed, and the host time taken by UART4_Handler and
+ * Process_New_Aircraft_Thread is the parser's cost. The live table it leaves behind is
+ * then used to time recalculate_screen_positions, rescale_screen_positions (a zoom step),
+ * closest_aircraft_by_angle, the info panel's closest approach search and a full
+ * repaint of the radar area with the scheduler stopped.
+ *
+ * The numbers are host nanoseconds, only useful against another run on the same machine.
+ * Built with a larger MAX_AIRCRAFTS than the firmware so the scaling past 256 shows.
+ *
+ * With -s the suite in System/bench_suite.h runs instead, the same code the board runs
+ * in a BENCH_SUITE build. Its results go to the report file, one tab separated line
+ * each with a header line, and the exit status is 2 if any is over its host budget:
+ *
+ *      kernel  aircraft  ns  budget_ns  status
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "threads.h"
+#include "Link/protocol.h"
+#include "Radar/aircraft_store.h"
+#include "Radar/closest_approach.h"
+#include "Display/radar_renderer.h"
+#include "System/bench_suite.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DEFAULT_AIRCRAFT    200
+#define DEFAULT_REPEATS     200
+
+#define SPREAD_KM           45.0
+#define KM_PER_DEGREE       111.32
+
+#define MIDPOINT            2048
+#define DEFLECTION          2000
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+extern AircraftStore_t *currentAircrafts;
+extern AircraftScreen_t currentScreen;
+extern DeadReckoning_t currentMotion;
+extern Projection_t radarProjection;
+extern int16_t selectedAircraft;
+extern uint16_t display_range_km;
+
+extern const float CENTER_LATITUDE;
+extern const float CENTER_LONGITUDE;
+
+static uint32_t random_state = 1;
+
+// Joystick readings for the eight compass directions
+static const int32_t DIRECTIONS[8][2] = {
+    { MIDPOINT, MIDPOINT - DEFLECTION }, { MIDPOINT - DEFLECTION, MIDPOINT - DEFLECTION },
+    { MIDPOINT - DEFLECTION, MIDPOINT }, { MIDPOINT - DEFLECTION, MIDPOINT + DEFLECTION },
+    { MIDPOINT, MIDPOINT + DEFLECTION }, { MIDPOINT + DEFLECTION, MIDPOINT + DEFLECTION },
+    { MIDPOINT + DEFLECTION, MIDPOINT }, { MIDPOINT + DEFLECTION, MIDPOINT - DEFLECTION }
+};
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static double random_unit(void) {
+    random_state = random_state * 1103515245 + 12345;
+    return ((random_state >> 8) & 0xFFFF) / 65536.0;
+}
+
+/**
+ * @brief Encodes a keyframe burst of aircraft scattered around the radar centre.
+ */
+static uint8_t *build_burst(uint32_t count, uint32_t *length) {
+    uint8_t *stream = malloc((size_t)(count + 1) * PROTOCOL_FRAME_SIZE);
+    ProtocolFrame_t frame;
+
+    for (uint32_t i = 0; i < count; i++) {
+        double distance = SPREAD_KM * sqrt(random_unit());
+        double bearing = 2 * M_PI * random_unit();
+
+        ProtocolAircraft_t wire;
+        memset(&wire, 0, sizeof(wire));
+        wire.icao24 = 0xA00000 + i;
+        char callsign[sizeof(wire.callsign) + 1];
+        snprintf(callsign, sizeof(callsign), "SIM%04u ", i % 10000);
+        memcpy(wire.callsign, callsign, sizeof(wire.callsign));
+        wire.latitude = lround((CENTER_LATITUDE + distance * cos(bearing) / KM_PER_DEGREE) * 10000);
+        wire.longitude = lround((CENTER_LONGITUDE + distance * sin(bearing) /
+                                 (KM_PER_DEGREE * cos(CENTER_LATITUDE * M_PI / 180))) * 10000);
+        wire.altitude = (int32_t)(1000 + 11000 * random_unit()) * 10000;
+        wire.velocity = (int32_t)(80 + 170 * random_unit()) * 10000;
+        wire.heading = (int32_t)(3600 * random_unit()) * 1000;
+
+        Protocol_EncodeFrame(&frame, PROTOCOL_FRAME_AIRCRAFT, &wire, sizeof(wire));
+        memcpy(&stream[i * PROTOCOL_FRAME_SIZE], &frame, PROTOCOL_FRAME_SIZE);
+    }
+
+    ProtocolBurstEnd_t burst_end = { count, PROTOCOL_BURST_KEYFRAME, 0, 1, 0 };
+    Protocol_EncodeFrame(&frame, PROTOCOL_FRAME_BURST_END, &burst_end, sizeof(burst_end));
+    memcpy(&stream[count * PROTOCOL_FRAME_SIZE], &frame, PROTOCOL_FRAME_SIZE);
+
+    *length = (count + 1) * PROTOCOL_FRAME_SIZE;
+    return stream;
+}
+
+static uint64_t host_ns_of(const SimThreadStats_t *stats, uint32_t count, const char *name) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (strcmp(stats[i].name, name) == 0)
+            return stats[i].host_ns;
+    }
+    return 0;
+}
+
+/**
+ * @brief Runs the benchmark suite and writes its report.
+ *
+ * @return int 2 if a result is over its budget, 1 if the report can't be written.
+ */
+static int run_suite(const char *path) {
+    FILE *report = fopen(path, "w");
+    if (report == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    BenchResult_t results[BENCH_SUITE_RESULTS];
+    uint32_t count = BenchSuite_Run(results);
+    uint32_t over = 0;
+
+    fprintf(report, "kernel\taircraft\tns\tbudget_ns\tstatus\n");
+    for (uint32_t i = 0; i < count; i++) {
+        const BenchResult_t *result = &results[i];
+        bool fails = result->budget != 0 && result->time > result->budget;
+        over += fails;
+
+        char name[9];
+        sscanf(BenchSuite_Name(result->kernel), "%8s", name);
+        fprintf(report, "%s\t%u\t%u\t%u\t%s\n", name, result->aircraft, result->time, result->budget,
+                fails ? "over" : "ok");
+        printf("%-8s %4u aircraft %9u ns  budget %9u ns%s\n", name, result->aircraft, result->time,
+               result->budget, fails ? "  OVER" : "");
+    }
+
+    if (fclose(report) != 0) {
+        perror(path);
+        return 1;
+    }
+
+    if (over > 0) {
+        fprintf(stderr, "flight_bench: %u of %u over budget\n", over, count);
+        return 2;
+    }
+    return 0;
+}
+
+/********************************Private Functions**********************************/
+
+int main(int argc, char **argv) {
+    uint32_t aircraft = DEFAULT_AIRCRAFT;
+    uint32_t repeats = DEFAULT_REPEATS;
+    const char *report = NULL;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "-n") == 0)
+            aircraft = strtoul(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-r") == 0)
+            repeats = strtoul(argv[i + 1], NULL, 10);
+        else if (strcmp(argv[i], "-s") == 0)
+            report = argv[i + 1];
+    }
+
+    // The suite brings its own traffic, the firmware only needs to be up
+    if (report != NULL)
+        aircraft = 0;
+
+    if (aircraft > MAX_AIRCRAFTS) {
+        fprintf(stderr, "flight_bench: built for at most %d aircraft\n", MAX_AIRCRAFTS);
+        return 1;
+    }
+    if (repeats == 0)
+        repeats = 1;
+
+    // Parser, through the real receive path and thread
+    uint32_t length;
+    uint8_t *stream = build_burst(aircraft, &length);
+    Sim_SetCapture(stream, length);
+    Sim_SetBaud(0);
+    Sim_SetEnd(1000);
+    free(stream);
+
+    Sim_Boot();
+    G8RTOS_Launch();
+
+    SimThreadStats_t stats[SIM_MAX_THREADS];
+    uint32_t count = Sim_ThreadStats(stats, SIM_MAX_THREADS);
+    uint64_t parse_ns = host_ns_of(stats, count, "Process_New_Aircraft_Thread");
+    uint64_t swap_ns = host_ns_of(stats, count, "Update_Current_Aircrafts_Thread");
+    count = Sim_EventStats(stats, SIM_MAX_THREADS);
+    parse_ns += host_ns_of(stats, count, "UART4_Handler");
+
+    if (report != NULL)
+        return run_suite(report);
+
+    // Reprojection of the whole live table
+    uint64_t start = Sim_HostNs();
+    for (uint32_t r = 0; r < repeats; r++) {
+        recalculate_screen_positions();
+    }
+    uint64_t reproject_ns = (Sim_HostNs() - start) / repeats;
+
+    // Rescaling it for a zoom step, back and forth so every run moves the aircraft
+    uint16_t range_km = display_range_km;
+    start = Sim_HostNs();
+    for (uint32_t r = 0; r < repeats; r++) {
+        display_range_km = range_km + (r & 1);
+        rescale_screen_positions();
+    }
+    uint64_t rescale_ns = (Sim_HostNs() - start) / repeats;
+    display_range_km = range_km;
+    rescale_screen_positions();
+
+    // Selection from every on-screen aircraft in turn, in all eight directions
+    int16_t *visible = malloc(sizeof(int16_t) * (currentAircrafts->count + 1));
+    uint32_t visible_count = 0;
+    for (int16_t i = 0; i < currentAircrafts->count; i++) {
+        if (currentScreen.on_screen[i])
+            visible[visible_count++] = i;
+    }
+
+    uint64_t select_ns = 0;
+    uint64_t approach_ns = 0;
+    if (visible_count > 0) {
+        uint32_t calls = 0;
+        volatile int16_t sink = 0;
+
+        start = Sim_HostNs();
+        for (uint32_t r = 0; r < repeats; r++) {
+            for (uint32_t d = 0; d < 8; d++, calls++) {
+                selectedAircraft = visible[calls % visible_count];
+                sink = closest_aircraft_by_angle(DIRECTIONS[d][0], DIRECTIONS[d][1]);
+            }
+        }
+        select_ns = (Sim_HostNs() - start) / calls;
+        (void)sink;
+
+        // Closest approach of each on-screen aircraft in turn, as the info panel does it
+        ClosestApproach_t approach;
+        ClosestApproach_Init(&approach);
+        start = Sim_HostNs();
+        for (uint32_t r = 0; r < repeats; r++) {
+            ClosestApproach_Find(&approach, &radarProjection, &currentMotion, currentAircrafts, &currentScreen,
+                                 visible[r % visible_count]);
+        }
+        approach_ns = (Sim_HostNs() - start) / repeats;
+    }
+    free(visible);
+
+    // Whole radar area from the display list, callsigns and heading lines on
+    start = Sim_HostNs();
+    for (uint32_t r = 0; r < repeats; r++) {
+        RadarRenderer_Invalidate();
+        RadarRenderer_Prepare(currentAircrafts, &currentScreen, -1, display_range_km, true, true, false);
+        RadarRenderer_Paint();
+    }
+    uint64_t repaint_ns = (Sim_HostNs() - start) / repeats;
+
+    printf("%5u aircraft (%d live, %u on screen): parse %.0f ns/aircraft, swap %.1f us, "
+           "reproject %.1f us, rescale %.1f us, select %llu ns, cpa %.1f us, repaint %.0f us\n",
+           aircraft, currentAircrafts->count, visible_count,
+           aircraft ? (double)parse_ns / aircraft : 0.0, swap_ns / 1000.0,
+           reproject_ns / 1000.0, rescale_ns / 1000.0, (unsigned long long)select_ns, approach_ns / 1000.0,
+           repaint_ns / 1000.0);
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+/***************************************************************************************
+ * @file        replay.c
+ * @brief       Replays a UART4 capture through the firmware on the host.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ *      flight_sim [options] capture
+ *
+ *      -b baud     UART4 rate, 0 to deliver every write at once (default 115200)
+ *      -t ms       stop at this simulated time (default 2 s after the last byte)
+ *      -o file     write the final screen as a PPM
+ *      -l file     write the UART0 log records, for log_decoder.py
+ *      -u file     write the frames the firmware sent back to the feeder
+ *      -s file     keep the EEPROM and flash snapshot here from one run to the next,
+ *                  a run with a file from an earlier one starts warm
+ *      -i ms:what  scripted input, what is press, sw1, sw2, sw3, sw4, shot or stats, and a
+ *                  button can be held for a while with ms:what/hold_ms
+ *
+ * Prints the link and display counters and the host time each thread took.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "threads.h"
+#include "Link/uart_rx.h"
+#include "Radar/aircraft_store.h"
+#include "Display/frame_scheduler.h"
+#include "System/log.h"
+#include "System/arena.h"
+#include "System/stack_watch.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+extern AircraftStore_t *currentAircrafts;
+
+static const char *INPUT_NAMES[] = { "press", "sw1", "sw2", "sw3", "sw4", "shot", "stats" };
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void usage(void) {
+    fprintf(stderr, "usage: flight_sim [-b baud] [-t ms] [-o screen.ppm] [-l log.bin] [-u uplink.bin]\n"
+                    "                  [-s state.bin] [-i ms:press|sw1|sw2|sw3|sw4|shot|stats[/hold_ms]]... capture\n");
+    exit(2);
+}
+
+static bool parse_input(const char *text) {
+    char *name;
+    unsigned long ms = strtoul(text, &name, 10);
+    if (*name++ != ':')
+        return false;
+
+    unsigned long hold_ms = 0;
+    size_t length = strcspn(name, "/");
+    if (name[length] == '/') {
+        char *end;
+        hold_ms = strtoul(name + length + 1, &end, 10);
+        if (*end != '\0' || hold_ms == 0)
+            return false;
+    }
+
+    for (uint32_t i = 0; i < sizeof(INPUT_NAMES) / sizeof(INPUT_NAMES[0]); i++) {
+        if (strlen(INPUT_NAMES[i]) == length && strncmp(name, INPUT_NAMES[i], length) == 0) {
+            Sim_AddInput(ms, (SimInputType_t)i, hold_ms);
+            return true;
+        }
+    }
+    return false;
+}
+
+static FILE *open_output(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "flight_sim: cannot write %s\n", path);
+        exit(1);
+    }
+    return file;
+}
+
+static void print_times(const char *title, const SimThreadStats_t *stats, uint32_t count, uint64_t total_ns) {
+    printf("%-34s %4s %9s %10s %6s\n", title, "pri", "runs", "host us", "share");
+    for (uint32_t i = 0; i < count; i++) {
+        printf("%-34s %4u %9u %10.1f %5.1f%%\n", stats[i].name, stats[i].priority, stats[i].runs,
+               stats[i].host_ns / 1000.0, total_ns ? 100.0 * stats[i].host_ns / total_ns : 0.0);
+    }
+}
+
+/********************************Private Functions**********************************/
+
+int main(int argc, char **argv) {
+    const char *screen_path = NULL;
+    FILE *log_file = NULL;
+    FILE *uplink_file = NULL;
+    const char *state_path = NULL;
+
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc)
+            usage();
+
+        const char *value = argv[++i];
+        switch (argv[i - 1][1]) {
+            case 'b': Sim_SetBaud(strtoul(value, NULL, 10)); break;
+            case 't': Sim_SetEnd(strtoul(value, NULL, 10)); break;
+            case 'o': screen_path = value; break;
+            case 'l': log_file = open_output(value); break;
+            case 'u': uplink_file = open_output(value); break;
+            case 's': state_path = value; break;
+            case 'i': if (!parse_input(value)) usage(); break;
+            default: usage();
+        }
+    }
+    if (i + 1 != argc)
+        usage();
+
+    if (!Sim_LoadCapture(argv[i])) {
+        fprintf(stderr, "flight_sim: cannot read %s\n", argv[i]);
+        return 1;
+    }
+
+    Sim_SetLogFile(log_file);
+    Sim_SetUplinkFile(uplink_file);
+    if (state_path != NULL && Sim_LoadState(state_path))
+        printf("warm start from %s\n", state_path);
+
+    Sim_Boot();
+
+    uint64_t start_ns = Sim_HostNs();
+    G8RTOS_Launch();
+    uint64_t host_ns = Sim_HostNs() - start_ns;
+
+    // Idle_Thread had no chance to send what the last slice logged
+    while (Log_Drain());
+
+    FrameSchedulerStats_t frames;
+    FrameScheduler_GetStats(&frames);
+
+    printf("simulated %.3f s in %.3f s of host time\n", Sim_Now() / 1e6, host_ns / 1e9);
+    printf("link: %u frames parsed, %u CRC errors, %u resyncs, %u overflows%s\n",
+           UartRx_GetConsumedCount(), UartRx_GetCrcErrorCount(), UartRx_GetResyncCount(),
+           UartRx_GetOverflowCount(), Sim_CaptureDone() ? "" : ", capture not finished");
+    printf("uplink: %u credit, %u latency, %u view, %u baud frames, UART4 left at %u baud\n",
+           Sim_UplinkFrames(PROTOCOL_FRAME_CREDIT), Sim_UplinkFrames(PROTOCOL_FRAME_LATENCY),
+           Sim_UplinkFrames(PROTOCOL_FRAME_VIEW), Sim_UplinkFrames(PROTOCOL_FRAME_BAUD_REPLY),
+           Sim_FirmwareBaud());
+    printf("table: %d aircraft live\n", currentAircrafts->count);
+    printf("display: %u frames, %u motion only, %u over %u ms, worst %u ms, %llu pixels sent, %u sleeps\n",
+           frames.frames, frames.motion_frames, frames.missed, FRAME_LATENCY_MS, frames.worst_latency_ms,
+           (unsigned long long)Sim_PixelsWritten(), frames.sleeps);
+    printf("log: %u records dropped\n", Log_Dropped());
+    printf("arena: %u of %u bytes carved\n\n", Arena_Used(), Arena_Size());
+
+    SimThreadStats_t stats[SIM_MAX_THREADS];
+    uint32_t count = Sim_ThreadStats(stats, SIM_MAX_THREADS);
+    print_times("thread", stats, count, host_ns);
+
+    count = Sim_EventStats(stats, SIM_MAX_THREADS);
+    print_times("interrupt", stats, count, host_ns);
+
+    // Host frames, only good for comparing threads with each other
+    StackWatchMark_t mark;
+    printf("\n%-34s %9s %10s\n", "stack", "used", "of");
+    for (uint32_t i = 0; StackWatch_Get(i, &mark); i++) {
+        printf("%-34.8s %9u %10u\n", mark.name, mark.used, mark.size);
+    }
+
+    if (screen_path != NULL)
+        Sim_WritePpm(screen_path);
+    if (log_file != NULL)
+        fclose(log_file);
+    if (uplink_file != NULL)
+        fclose(uplink_file);
+    if (state_path != NULL && !Sim_SaveState(state_path))
+        fprintf(stderr, "flight_sim: cannot write %s\n", state_path);
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/***************************************************************************************
+ * @file        G8RTOS.h
+ * @brief       Host stand-in for the G8RTOS API, implemented by Simulator/sim_rtos.c.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Only the calls the firmware makes are declared, with the same signatures as the real
+ * kernel, so threads.c and the modules compile unchanged.
+ *
+***************************************************************************************/
+
+#ifndef G8RTOS_H_
+#define G8RTOS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef int32_t semaphore_t;
+
+typedef enum {
+    NO_ERROR                = 0,
+    THREAD_LIMIT_REACHED    = -1,
+    THREADS_INCORRECTLY_ALIVE = -2,
+    THREAD_DOES_NOT_EXIST   = -3,
+    CANNOT_KILL_LAST_THREAD = -4,
+    IRQn_INVALID            = -5,
+    HWI_PRIORITY_INVALID    = -6
+} sched_ErrCode_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+extern uint32_t SystemTime;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_Init(void);
+int32_t G8RTOS_Launch(void);
+
+sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name);
+sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t priority, int32_t IRQn);
+
+void G8RTOS_InitSemaphore(semaphore_t *s, int32_t value);
+void G8RTOS_WaitSemaphore(semaphore_t *s);
+void G8RTOS_SignalSemaphore(semaphore_t *s);
+
+void sleep(uint32_t durationMS);
+
+/********************************Public Functions***********************************/
+
+#endif /* G8RTOS_H_ */
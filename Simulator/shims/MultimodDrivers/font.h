@@ -0,0 +1,28 @@
+/***************************************************************************************
+ * @file        font.h
+ * @brief       Host stand-in for the Multimod font header.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The renderer only needs the glyph size, the glyphs themselves come from
+ * StripRenderer_Glyph.
+ *
+***************************************************************************************/
+
+#ifndef FONT_H_
+#define FONT_H_
+
+/*************************************Defines***************************************/
+
+#define FONT_WIDTH          5
+#define FONT_HEIGHT         8
+
+/*************************************Defines***************************************/
+
+#endif /* FONT_H_ */
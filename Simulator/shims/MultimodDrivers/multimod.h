@@ -0,0 +1,85 @@
+/***************************************************************************************
+ * @file        multimod.h
+ * @brief       Host stand-in for the Multimod board drivers, implemented by the simulator.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The screen calls draw into Simulator/sim_display.c, the joystick and buttons read the
+ * inputs scripted on the simulator's command line.
+ *
+***************************************************************************************/
+
+#ifndef MULTIMOD_H_
+#define MULTIMOD_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define X_MAX                   240
+#define Y_MAX                   280
+
+#define ST7789_BLACK            0x0000
+#define ST7789_WHITE            0xFFFF
+#define ST7789_BLUE             0x001F
+#define ST7789_RED              0xF800
+#define ST7789_GREEN            0x07E0
+#define ST7789_YELLOW           0xFFE0
+#define ST7789_MAGENTA          0xF81F
+#define ST7789_CYAN             0x07FF
+#define ST7789_ORANGE           0xFD20
+#define ST7789_LIGHTORANGE      0xFE00
+#define ST7789_GRAY             0x8410
+#define ST7789_LGRAY            0xC618
+
+// Active low, as read from the PCA9555
+#define SW1                     0x02
+#define SW2                     0x04
+#define SW3                     0x08
+#define SW4                     0x10
+
+#define BUTTON_INTERRUPT        INT_GPIOE
+#define BUTTONS_INT_GPIO_BASE   GPIO_PORTE_BASE
+#define BUTTONS_INT_PIN         GPIO_PIN_4
+
+#define JOYSTICK_GPIOD_INT      INT_GPIOD
+#define JOYSTICK_INT_GPIO_BASE  GPIO_PORTD_BASE
+#define JOYSTICK_INT_PIN        GPIO_PIN_2
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void multimod_init(void);
+
+void ST7789_Init(void);
+void ST7789_Fill(uint16_t color);
+void ST7789_DrawPixel(uint32_t x, uint32_t y, uint16_t color);
+void ST7789_DrawRectangle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color);
+void ST7789_DrawString(int16_t x, int16_t y, char *str, uint16_t fg, uint16_t bg);
+
+uint32_t JOYSTICK_GetXY(void);
+uint8_t JOYSTICK_GetPress(void);
+
+uint8_t MultimodButtons_Get(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* MULTIMOD_H_ */
@@ -0,0 +1,24 @@
+/***************************************************************************************
+ * @file        hw_ints.h
+ * @brief       Host stand-in for the TivaWare interrupt numbers.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+#ifndef HW_INTS_H_
+#define HW_INTS_H_
+
+#define INT_GPIOD               19
+#define INT_GPIOE               20
+#define INT_UART0               21
+#define INT_TIMER1A             37
+#define INT_SSI3                74
+#define INT_UART4               76
+
+#endif /* HW_INTS_H_ */
@@ -0,0 +1,29 @@
+/***************************************************************************************
+ * @file        hw_memmap.h
+ * @brief       Host stand-in for the TivaWare peripheral base addresses.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Nothing is mapped at these addresses on the host, they only tell the simulator's
+ * driverlib calls which peripheral is meant.
+ *
+***************************************************************************************/
+
+#ifndef HW_MEMMAP_H_
+#define HW_MEMMAP_H_
+
+#define UART0_BASE              0x4000C000
+#define UART4_BASE              0x40010000
+#define SSI3_BASE               0x4000B000
+#define GPIO_PORTD_BASE         0x40007000
+#define GPIO_PORTE_BASE         0x40024000
+#define TIMER1_BASE             0x40031000
+#define WATCHDOG0_BASE          0x40000000
+
+#endif /* HW_MEMMAP_H_ */
@@ -0,0 +1,27 @@
+/***************************************************************************************
+ * @file        hw_types.h
+ * @brief       Host stand-in for the TivaWare register access macros.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Only the flash the firmware reads in place is mapped, see Sim_Word in sim_hw.c. Any
+ * other address stops the simulator.
+ *
+***************************************************************************************/
+
+#ifndef HW_TYPES_H_
+#define HW_TYPES_H_
+
+#include <stdint.h>
+
+volatile uint32_t *Sim_Word(uint32_t address);
+
+#define HWREG(x)                (*Sim_Word(x))
+
+#endif /* HW_TYPES_H_ */
@@ -0,0 +1,19 @@
+/***************************************************************************************
+ * @file        hw_uart.h
+ * @brief       Host stand-in for the TivaWare UART register offsets.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+#ifndef HW_UART_H_
+#define HW_UART_H_
+
+#define UART_O_DR               0x000
+
+#endif /* HW_UART_H_ */
@@ -0,0 +1,122 @@
+/***************************************************************************************
+ * @file        sim.h
+ * @brief       Host simulator internals shared by the replay tool and the benchmarks.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * threads.c and the Link, Radar, Display and System modules are compiled unchanged for
+ * the host, with G8RTOS, the Multimod drivers and the handful of driverlib calls they
+ * make replaced by the files in this folder.
+ *
+ * Threads run as cooperative coroutines scheduled by priority like G8RTOS, and each one
+ * runs until it blocks or sleeps. Simulated time only moves when Idle_Thread reaches
+ * SysCtlSleep, and then jumps straight to the next thing that would wake the board: a
+ * sleeping thread, the UART4 FIFO filling up or going quiet, or a scripted input. Running
+ * code takes no simulated time, so the host time each thread spends is reported instead.
+ *
+ * Captures are the bytes the feeder sent on UART4, with the time each write started:
+ *      4 bytes   SIM_CAPTURE_MAGIC
+ *      per write, little-endian:
+ *      4 bytes   milliseconds since the capture started
+ *      2 bytes   length
+ *      length bytes
+ *
+ * A file without the magic is taken as one raw write at time 0.
+ *
+***************************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SIM_CAPTURE_MAGIC       "FTC1"
+
+#define SIM_MAX_THREADS         16
+#define SIM_MAX_EVENTS          8
+#define SIM_MAX_INPUTS          32
+
+#define SIM_UART_FIFO           16      // bytes the UART4 receive FIFO holds
+#define SIM_UART_RX_LEVEL       8       // FIFO level that raises the receive interrupt
+#define SIM_UART_TIMEOUT_BITS   32      // idle bit times before the receive timeout
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    SIM_INPUT_PRESS,            // joystick button
+    SIM_INPUT_SW1,
+    SIM_INPUT_SW2,
+    SIM_INPUT_SW3,
+    SIM_INPUT_SW4,
+    SIM_INPUT_SHOT,             // write the screen to a PPM, not a board input
+    SIM_INPUT_STATS             // a debug console query for every statistics group
+} SimInputType_t;
+
+typedef struct {
+    uint32_t ms;
+    SimInputType_t type;
+    uint32_t hold_ms;           // how long it is held down
+} SimInput_t;
+
+typedef struct {
+    const char *name;
+    uint8_t priority;
+    uint32_t runs;
+    uint64_t host_ns;
+} SimThreadStats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+// sim_rtos.c
+uint64_t Sim_Now(void);
+uint64_t Sim_HostNs(void);
+void Sim_Idle(void);
+void Sim_Stop(void);
+bool Sim_Interrupt(int32_t irq);
+uint32_t Sim_ThreadStats(SimThreadStats_t *stats, uint32_t max);
+uint32_t Sim_EventStats(SimThreadStats_t *stats, uint32_t max);
+
+// sim_hw.c
+bool Sim_LoadCapture(const char *path);
+void Sim_SetCapture(const uint8_t *bytes, uint32_t length);
+void Sim_SetBaud(uint32_t baud);
+void Sim_SetEnd(uint32_t ms);
+void Sim_AddInput(uint32_t ms, SimInputType_t type, uint32_t hold_ms);
+void Sim_SetLogFile(FILE *file);
+void Sim_SetUplinkFile(FILE *file);
+bool Sim_NextWake(uint64_t *us);
+void Sim_Service(void);
+bool Sim_CaptureDone(void);
+uint32_t Sim_UplinkFrames(uint8_t type);
+uint32_t Sim_FirmwareBaud(void);
+bool Sim_LoadState(const char *path);
+bool Sim_SaveState(const char *path);
+
+// sim_display.c
+void Sim_WritePpm(const char *path);
+uint64_t Sim_PixelsWritten(void);
+
+// sim_boot.c
+void Sim_Boot(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* SIM_H_ */
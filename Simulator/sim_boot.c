@@ -0,0 +1,116 @@
+/***************************************************************************************
+ * @file        sim_boot.c
+ * @brief       Host copy of the start-up sequence in main.c.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Keep in step with main.c. Clock and board set-up are left out, everything else is
+ * initialized and registered the same way and with the same priorities.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include "G8RTOS/G8RTOS.h"
+#include "MultimodDrivers/multimod.h"
+
+#include "threads.h"
+#include "Link/uart_rx.h"
+#include "Link/uart_tx.h"
+#include "Link/compact.h"
+#include "Link/bus_node.h"
+#include "Link/usb_link.h"
+#include "Display/panel.h"
+#include "Display/frame_scheduler.h"
+#include "Display/strip_renderer.h"
+#include "Display/radar_renderer.h"
+#include "System/clock.h"
+#include "System/soft_timer.h"
+#include "System/joystick_adc.h"
+#include "System/profiler.h"
+#include "System/site_config.h"
+#include "System/quiet_hours.h"
+#include "System/arena.h"
+#include "System/supervisor.h"
+#include "System/console.h"
+#include "System/schedule.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets the firmware up ready for G8RTOS_Launch.
+ */
+void Sim_Boot(void) {
+    multimod_init();
+    G8RTOS_Init();
+
+    SiteConfig_Init();
+    BusNode_Init();
+
+    UartTx_Init();
+    UartRx_Init();
+    Compact_Init();
+    UsbLink_Init();
+    Console_Init();
+
+    Panel_Init();
+
+    Clock_Init();
+    SoftTimer_Init();
+    JoystickAdc_Init();
+
+    Profile_Init();
+
+    FrameScheduler_Init();
+
+    QuietHours_Init();
+    init_aircraft_tables();
+
+    StripRenderer_Init();
+    RadarRenderer_Init();
+
+    Arena_Report();
+    warm_start_aircraft();
+
+    G8RTOS_InitSemaphore(&sem_DATA_READY, 0);
+    G8RTOS_InitSemaphore(&sem_BURST_COMPLETE, 0);
+    G8RTOS_InitSemaphore(&sem_CURRENT_AIRCRAFTS, 1);
+    G8RTOS_InitSemaphore(&sem_STAGING_AIRCRAFTS, 1);
+
+    G8RTOS_InitSemaphore(&sem_I2CA, 1);
+    G8RTOS_InitSemaphore(&sem_SPIA, 1);
+
+    EventGroup_Init(&range_events);
+    EventGroup_Init(&select_events);
+    EventGroup_Init(&snapshot_events);
+    EventGroup_Init(&conflict_events);
+    EventGroup_Init(&console_events);
+    init_input_timers();
+
+    Schedule_AddThreads();
+    Schedule_Check();
+
+    G8RTOS_Add_APeriodicEvent(UART4_Handler, 1, INT_UART4);
+    G8RTOS_Add_APeriodicEvent(Button_Handler, 2, BUTTON_INTERRUPT);
+    G8RTOS_Add_APeriodicEvent(Joystick_Button_Handler, 3, JOYSTICK_GPIOD_INT);
+    G8RTOS_Add_APeriodicEvent(SSI3_Handler, 4, INT_SSI3);
+    G8RTOS_Add_APeriodicEvent(Timer1A_Handler, 5, INT_TIMER1A);
+    G8RTOS_Add_APeriodicEvent(UART0_Handler, 6, INT_UART0);
+#if JOYSTICK_USE_ADC
+    G8RTOS_Add_APeriodicEvent(Joystick_Tilt_Handler, 5, INT_ADC1SS0);
+#endif
+
+    Supervisor_Init();
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,156 @@
+/***************************************************************************************
+ * @file        sim_display.c
+ * @brief       Host framebuffer standing in for the display panel.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Calls land in an RGB565 array the size of the panel DISPLAY_PANEL selects, in the
+ * same coordinates as the panel: y = 0 is the bottom row, and a blit's first buffer row
+ * is its top. Sim_WritePpm saves the array the right way up. Every pixel written is
+ * counted, which is what the SPI bus would have had to carry.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include "MultimodDrivers/multimod.h"
+#include "MultimodDrivers/font.h"
+#include "Display/panel.h"
+#include "Display/strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint16_t screen[PANEL_HEIGHT][PANEL_WIDTH];
+static uint64_t pixels_written = 0;
+static PanelPower_t panel_power = PANEL_POWER_ON;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void put_pixel(int32_t x, int32_t y, uint16_t color) {
+    if (x >= 0 && x < PANEL_WIDTH && y >= 0 && y < PANEL_HEIGHT) {
+        screen[y][x] = color;
+        pixels_written++;
+    }
+}
+
+static void fill(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    for (int32_t row = y; row < y + h; row++) {
+        for (int32_t column = x; column < x + w; column++) {
+            put_pixel(column, row, color);
+        }
+    }
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Saves the screen as a binary PPM, top row first.
+ */
+void Sim_WritePpm(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "sim: cannot write %s\n", path);
+        return;
+    }
+
+    fprintf(file, "P6\n%d %d\n255\n", PANEL_WIDTH, PANEL_HEIGHT);
+    for (int32_t y = PANEL_HEIGHT - 1; y >= 0; y--) {
+        for (int32_t x = 0; x < PANEL_WIDTH; x++) {
+            uint16_t color = screen[y][x];
+            uint8_t rgb[3] = {
+                (uint8_t)(((color >> 11) & 0x1F) * 255 / 31),
+                (uint8_t)(((color >> 5) & 0x3F) * 255 / 63),
+                (uint8_t)((color & 0x1F) * 255 / 31)
+            };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+
+    fclose(file);
+}
+
+uint64_t Sim_PixelsWritten(void) {
+    return pixels_written;
+}
+
+void ST7789_Init(void) {
+}
+
+void ST7789_Fill(uint16_t color) {
+    fill(0, 0, PANEL_WIDTH, PANEL_HEIGHT, color);
+}
+
+void ST7789_DrawPixel(uint32_t x, uint32_t y, uint16_t color) {
+    put_pixel(x, y, color);
+}
+
+void ST7789_DrawRectangle(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color) {
+    fill(x, y, w, h, color);
+}
+
+/**
+ * @brief Text with its bottom row at y, one FONT_WIDTH + 1 cell per character.
+ */
+void ST7789_DrawString(int16_t x, int16_t y, char *str, uint16_t fg, uint16_t bg) {
+    for (; *str != '\0'; str++, x += FONT_WIDTH + 1) {
+        const uint8_t *glyph = StripRenderer_Glyph(*str);
+
+        for (int16_t column = 0; column <= FONT_WIDTH; column++) {
+            uint8_t bits = (column < FONT_WIDTH) ? glyph[column] : 0;
+
+            // Bit 0 is the top row of the glyph
+            for (int16_t row = 0; row < FONT_HEIGHT; row++) {
+                put_pixel(x + column, y + FONT_HEIGHT - 1 - row, (bits & (1 << row)) ? fg : bg);
+            }
+        }
+    }
+}
+
+void Panel_Init(void) {
+}
+
+void Panel_HandleInterrupt(void) {
+}
+
+void Panel_FillRectangle(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fill(x, y, w, h, color);
+}
+
+void Panel_BlitRectangle(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    for (int32_t row = 0; row < h; row++) {
+        for (int32_t column = 0; column < w; column++) {
+            put_pixel(x + column, y + h - 1 - row, pixels[row * w + column]);
+        }
+    }
+}
+
+// Every blit lands where it says, batched or not
+void Panel_BeginBatch(int16_t x, int16_t y, int16_t w, int16_t h) {
+}
+
+void Panel_EndBatch(void) {
+}
+
+// The framebuffer keeps its pixels through a sleep, as the panel's own RAM does
+void Panel_SetPower(PanelPower_t power) {
+    if (power != panel_power)
+        printf("panel %s at %.3f s\n", power == PANEL_POWER_ON ? "on" : power == PANEL_POWER_DIM ? "dimmed" : "asleep",
+               Sim_Now() / 1e6);
+    panel_power = power;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,830 @@
+/***************************************************************************************
+ * @file        sim_hw.c
+ * @brief       Host versions of the peripherals the firmware touches.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * UART4 replays a capture into the firmware's byte-at-a-time receive path
+ * (UART_RX_USE_DMA = 0) at the chosen baud rate, raising the receive interrupt when the
+ * FIFO reaches its trigger level or the line goes quiet. A baud rate of 0 delivers every
+ * write the moment it starts, a FIFO at a time. UART0 log records and the uplink frames
+ * go to files for log_decoder.py and friends.
+ *
+ * Scripted inputs press the joystick button or a switch, for INPUT_HOLD_MS unless the
+ * script says otherwise, and raise its interrupt if the firmware has it enabled at that
+ * moment.
+ *
+ * Timer 1A is modelled as the one-shot the software timers use: loading and enabling it
+ * schedules INT_TIMER1A that many system clock cycles later, rounded up to a microsecond.
+ *
+ * Watchdog 0 counts down from its load value twice once enabled, and running out the
+ * second time stops the simulation with a message, as the reset would on the board.
+ *
+ * The Hibernation module's RTC counts from 0 at the start of the run, until the firmware
+ * sets it. Hibernating stops the simulation, with the time the RTC would wake it at.
+ *
+ * The DWT cycle counter reads the host's clock in nanoseconds, which is what the
+ * benchmark suite times with on the host (BENCH_SUITE_HOST).
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "MultimodDrivers/multimod.h"
+#include "Link/protocol.h"
+#include "Link/uart_tx.h"
+#include "Link/bus_node.h"
+#include "System/clock.h"
+#include "Radar/traffic_snapshot.h"
+
+#include "driverlib/uart.h"
+#include "driverlib/timer.h"
+#include "driverlib/eeprom.h"
+#include "driverlib/flash.h"
+#include "driverlib/watchdog.h"
+#include "driverlib/hibernate.h"
+#include "inc/hw_types.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define INPUT_HOLD_MS       100
+#define JOYSTICK_NEUTRAL    (2048 | (2048u << 16))
+
+// Debug and trace registers, as in profiler.c
+#define SIM_DEMCR           0xE000EDFC
+#define SIM_DWT_CTRL        0xE0001000
+#define SIM_DWT_CYCCNT      0xE0001004
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t ms;            // when the feeder started the write
+    uint32_t offset;        // first byte in capture
+    uint32_t length;
+    uint64_t start_us;      // when its first byte is on the line, after earlier writes
+} SimWrite_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint8_t *capture = NULL;
+static uint32_t capture_length = 0;
+
+static SimWrite_t *writes = NULL;
+static uint32_t write_count = 0;
+static bool writes_scheduled = false;
+
+static uint32_t baud = 115200;
+
+// What the firmware last programmed UART4 to
+static uint32_t firmware_baud = 115200;
+static uint64_t end_us = 0;
+
+// Next capture byte the firmware reads, and where the FIFO it's reading from ends
+static uint32_t rx_read = 0;
+static uint32_t rx_fifo_end = 0;
+
+static bool int_masked = false;
+
+static SimInput_t inputs[SIM_MAX_INPUTS];
+static uint32_t input_count = 0;
+static uint32_t input_next = 0;
+
+static uint64_t press_until_us = 0;
+static uint64_t switches_until_us = 0;
+static uint8_t switches = 0;
+
+static bool joystick_int_enabled = true;
+static bool buttons_int_enabled = true;
+
+static uint32_t timer1_load = 0;
+static bool timer1_running = false;
+static uint64_t timer1_due_us = 0;
+
+// Query frame on its way in on UART0
+static ProtocolFrame_t console_frame;
+static uint32_t console_read = PROTOCOL_FRAME_SIZE;
+
+static uint32_t watchdog_load = 0;
+static bool watchdog_running = false;
+static uint64_t watchdog_reset_us = 0;
+
+// RTC seconds at the start of the run, and the battery-backed words
+static uint32_t rtc_base_s = 0;
+static uint32_t rtc_match_s = 0;
+static uint32_t hibernate_data[16];
+
+// 2 KB of EEPROM and the snapshot ring, erased unless Sim_LoadState fills them in
+static uint32_t eeprom[2048 / sizeof(uint32_t)];
+static uint32_t flash[TRAFFIC_SNAPSHOT_BLOCKS * TRAFFIC_SNAPSHOT_BLOCK_SIZE / sizeof(uint32_t)];
+static bool memories_erased = false;
+
+// DEMCR and DWT_CTRL take whatever is written, CYCCNT is filled in on each read
+static uint32_t debug_control;
+static uint32_t dwt_control;
+static uint32_t dwt_cycles;
+
+static FILE *log_file = NULL;
+static FILE *uplink_file = NULL;
+static uint32_t uplink_frames[256];
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void erase_memories(void) {
+    if (memories_erased)
+        return;
+
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    memset(flash, 0xFF, sizeof(flash));
+    memories_erased = true;
+}
+
+static uint64_t byte_us(uint64_t bytes) {
+    return baud ? (bytes * 10 * 1000000) / baud : 0;
+}
+
+/**
+ * @brief Lays the writes out on the line, each starting once the one before has gone.
+ */
+static void schedule_writes(void) {
+    uint64_t line_free_us = 0;
+
+    for (uint32_t i = 0; i < write_count; i++) {
+        uint64_t start_us = (uint64_t)writes[i].ms * 1000;
+        writes[i].start_us = (start_us > line_free_us) ? start_us : line_free_us;
+        line_free_us = writes[i].start_us + byte_us(writes[i].length);
+    }
+
+    writes_scheduled = true;
+}
+
+/**
+ * @brief When a capture byte has been fully received.
+ */
+static uint64_t arrival_us(uint32_t index) {
+    uint32_t low = 0, high = write_count - 1;
+
+    while (low < high) {
+        uint32_t middle = (low + high + 1) / 2;
+        if (writes[middle].offset <= index)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    return writes[low].start_us + byte_us(index - writes[low].offset + 1);
+}
+
+/**
+ * @brief When the next receive interrupt fires, at the FIFO trigger level or when the
+ *        line has been quiet for the timeout with bytes waiting.
+ */
+static bool next_rx_interrupt(uint64_t *us) {
+    if (rx_read >= capture_length)
+        return false;
+
+    uint64_t timeout_us = byte_us(1) * SIM_UART_TIMEOUT_BITS / 10;
+    uint32_t level = rx_read + SIM_UART_RX_LEVEL - 1;
+
+    for (uint32_t i = rx_read; i < capture_length; i++) {
+        uint64_t at = arrival_us(i);
+
+        if (i == level) {
+            *us = at;
+            return true;
+        }
+
+        if (i + 1 == capture_length || arrival_us(i + 1) > at + timeout_us) {
+            *us = at + timeout_us;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void raise_input(const SimInput_t *input) {
+    uint64_t until = Sim_Now() + (uint64_t)input->hold_ms * 1000;
+
+    switch (input->type) {
+        case SIM_INPUT_PRESS:
+            press_until_us = until;
+            if (joystick_int_enabled)
+                Sim_Interrupt(JOYSTICK_GPIOD_INT);
+            else
+                fprintf(stderr, "sim: joystick press at %u ms ignored, interrupt disabled\n", input->ms);
+            break;
+
+        case SIM_INPUT_SHOT: {
+            char path[32];
+            snprintf(path, sizeof(path), "screen-%u.ppm", input->ms);
+            Sim_WritePpm(path);
+            break;
+        }
+
+        case SIM_INPUT_STATS: {
+            ProtocolStatsQuery_t query = { .groups = PROTOCOL_STATS_ALL };
+            Protocol_EncodeFrame(&console_frame, PROTOCOL_FRAME_STATS, &query, sizeof(query));
+            console_read = 0;
+            Sim_Interrupt(INT_UART0);
+            break;
+        }
+
+        default:
+            if (Sim_Now() >= switches_until_us)
+                switches = 0;
+            switches |= SW1 << (input->type - SIM_INPUT_SW1);
+            switches_until_us = until;
+            if (buttons_int_enabled)
+                Sim_Interrupt(BUTTON_INTERRUPT);
+            else
+                fprintf(stderr, "sim: switch at %u ms ignored, interrupt disabled\n", input->ms);
+            break;
+    }
+}
+
+static int compare_inputs(const void *a, const void *b) {
+    const SimInput_t *x = a, *y = b;
+    return (x->ms > y->ms) - (x->ms < y->ms);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Reads a capture file, see sim.h for the format.
+ */
+bool Sim_LoadCapture(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return false;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *raw = malloc(size > 0 ? size : 1);
+    bool ok = fread(raw, 1, size, file) == (size_t)size;
+    fclose(file);
+    if (!ok) {
+        free(raw);
+        return false;
+    }
+
+    if (size < 4 || memcmp(raw, SIM_CAPTURE_MAGIC, 4) != 0) {
+        Sim_SetCapture(raw, size);
+        free(raw);
+        return true;
+    }
+
+    // Split into the bytes on the line and the writes they came in
+    capture = malloc(size);
+    writes = malloc(sizeof(SimWrite_t) * (size / 6 + 1));
+    capture_length = 0;
+    write_count = 0;
+
+    long at = 4;
+    while (at + 6 <= size) {
+        uint32_t ms = raw[at] | (raw[at + 1] << 8) | (raw[at + 2] << 16) | ((uint32_t)raw[at + 3] << 24);
+        uint32_t length = raw[at + 4] | (raw[at + 5] << 8);
+        at += 6;
+        if (at + length > size)
+            length = size - at;
+
+        writes[write_count++] = (SimWrite_t){ ms, capture_length, length, 0 };
+        memcpy(&capture[capture_length], &raw[at], length);
+        capture_length += length;
+        at += length;
+    }
+
+    free(raw);
+    writes_scheduled = false;
+    return true;
+}
+
+/**
+ * @brief Uses a buffer as the capture, one write at time 0.
+ */
+void Sim_SetCapture(const uint8_t *bytes, uint32_t length) {
+    free(capture);
+    free(writes);
+
+    capture = malloc(length ? length : 1);
+    memcpy(capture, bytes, length);
+    capture_length = length;
+
+    writes = malloc(sizeof(SimWrite_t));
+    writes[0] = (SimWrite_t){ 0, 0, length, 0 };
+    write_count = 1;
+    writes_scheduled = false;
+    rx_read = 0;
+}
+
+void Sim_SetBaud(uint32_t rate) {
+    baud = rate;
+    writes_scheduled = false;
+}
+
+/**
+ * @brief Sets when the run stops, 0 for two seconds after the last capture byte.
+ */
+void Sim_SetEnd(uint32_t ms) {
+    end_us = (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief Schedules a scripted input.
+ *
+ * @param hold_ms How long the button stays down, 0 for INPUT_HOLD_MS.
+ */
+void Sim_AddInput(uint32_t ms, SimInputType_t type, uint32_t hold_ms) {
+    if (input_count < SIM_MAX_INPUTS) {
+        inputs[input_count++] = (SimInput_t){ ms, type, hold_ms ? hold_ms : INPUT_HOLD_MS };
+        qsort(inputs, input_count, sizeof(SimInput_t), compare_inputs);
+    }
+}
+
+void Sim_SetLogFile(FILE *file) {
+    log_file = file;
+}
+
+void Sim_SetUplinkFile(FILE *file) {
+    uplink_file = file;
+}
+
+/**
+ * @brief Earliest time the simulated hardware has something to do.
+ */
+bool Sim_NextWake(uint64_t *us) {
+    if (!writes_scheduled) {
+        schedule_writes();
+        if (end_us == 0)
+            end_us = (capture_length ? arrival_us(capture_length - 1) : 0) + 2000000;
+    }
+
+    uint64_t wake = end_us;
+    uint64_t at;
+
+    if (next_rx_interrupt(&at) && at < wake)
+        wake = at;
+
+    if (input_next < input_count && (uint64_t)inputs[input_next].ms * 1000 < wake)
+        wake = (uint64_t)inputs[input_next].ms * 1000;
+
+    if (timer1_running && timer1_due_us < wake)
+        wake = timer1_due_us;
+
+    if (watchdog_running && watchdog_reset_us < wake)
+        wake = watchdog_reset_us;
+
+    *us = wake;
+    return true;
+}
+
+/**
+ * @brief Raises every interrupt that is due at the current time.
+ */
+void Sim_Service(void) {
+    uint64_t now = Sim_Now();
+    uint64_t at;
+
+    if (next_rx_interrupt(&at) && at <= now) {
+        rx_fifo_end = rx_read + SIM_UART_FIFO;
+
+        // Nobody to read it, the bytes are lost like an overrun
+        if (!Sim_Interrupt(INT_UART4)) {
+            while (rx_read < capture_length && arrival_us(rx_read) <= now)
+                rx_read++;
+        }
+    }
+
+    while (input_next < input_count && (uint64_t)inputs[input_next].ms * 1000 <= now)
+        raise_input(&inputs[input_next++]);
+
+    // A one-shot stops when it times out
+    if (timer1_running && timer1_due_us <= now) {
+        timer1_running = false;
+        Sim_Interrupt(INT_TIMER1A);
+    }
+
+    if (watchdog_running && watchdog_reset_us <= now) {
+        fprintf(stderr, "flight_sim: watchdog reset at %u ms\n", (unsigned)(now / 1000));
+        Sim_Stop();
+    }
+
+    if (now >= end_us)
+        Sim_Stop();
+}
+
+bool Sim_CaptureDone(void) {
+    return rx_read >= capture_length;
+}
+
+uint32_t Sim_UplinkFrames(uint8_t type) {
+    return uplink_frames[type];
+}
+
+/**
+ * @brief Fills the EEPROM and the snapshot ring in from a file Sim_SaveState wrote.
+ *
+ * @return bool False if there is no such file, the memories are left erased.
+ */
+bool Sim_LoadState(const char *path) {
+    FILE *file = fopen(path, "rb");
+    bool loaded = file != NULL && fread(eeprom, sizeof(eeprom), 1, file) == 1 &&
+                  fread(flash, sizeof(flash), 1, file) == 1;
+
+    if (file != NULL)
+        fclose(file);
+
+    // A short file leaves nothing half loaded
+    memories_erased = loaded;
+    erase_memories();
+    return loaded;
+}
+
+bool Sim_SaveState(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+
+    bool saved = fwrite(eeprom, sizeof(eeprom), 1, file) == 1 && fwrite(flash, sizeof(flash), 1, file) == 1;
+    return fclose(file) == 0 && saved;
+}
+
+volatile uint32_t *Sim_Word(uint32_t address) {
+    if (address == SIM_DEMCR)
+        return &debug_control;
+    if (address == SIM_DWT_CTRL)
+        return &dwt_control;
+    if (address == SIM_DWT_CYCCNT) {
+        dwt_cycles = (uint32_t)Sim_HostNs();
+        return &dwt_cycles;
+    }
+
+    erase_memories();
+
+    if (address < TRAFFIC_SNAPSHOT_BASE || address >= TRAFFIC_SNAPSHOT_BASE + sizeof(flash) || (address & 3)) {
+        fprintf(stderr, "flight_sim: HWREG(0x%08X) is not mapped\n", (unsigned)address);
+        abort();
+    }
+    return &flash[(address - TRAFFIC_SNAPSHOT_BASE) / sizeof(uint32_t)];
+}
+
+/*
+ * driverlib
+ */
+
+bool IntMasterDisable(void) {
+    bool previous = int_masked;
+    int_masked = true;
+    return previous;
+}
+
+bool IntMasterEnable(void) {
+    bool previous = int_masked;
+    int_masked = false;
+    return previous;
+}
+
+void SysCtlSleep(void) {
+    Sim_Idle();
+}
+
+uint32_t SysCtlClockGet(void) {
+    return 80000000;
+}
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral) {
+    (void)ui32Peripheral;
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral) {
+    (void)ui32Peripheral;
+    return true;
+}
+
+uint32_t EEPROMInit(void) {
+    erase_memories();
+    return EEPROM_INIT_OK;
+}
+
+void EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count) {
+    memcpy(pui32Data, (uint8_t *)eeprom + ui32Address, ui32Count);
+}
+
+uint32_t EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count) {
+    memcpy((uint8_t *)eeprom + ui32Address, pui32Data, ui32Count);
+    return 0;
+}
+
+int32_t FlashErase(uint32_t ui32Address) {
+    if (ui32Address % TRAFFIC_SNAPSHOT_BLOCK_SIZE)
+        return -1;
+
+    memset((void *)Sim_Word(ui32Address), 0xFF, TRAFFIC_SNAPSHOT_BLOCK_SIZE);
+    return 0;
+}
+
+// Programming only clears bits, as on the part, so writing a word twice shows up
+int32_t FlashProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count) {
+    if ((ui32Address & 3) || (ui32Count & 3))
+        return -1;
+
+    for (uint32_t i = 0; i < ui32Count / sizeof(uint32_t); i++) {
+        *Sim_Word(ui32Address + i * sizeof(uint32_t)) &= pui32Data[i];
+    }
+    return 0;
+}
+
+uint32_t SysCtlResetCauseGet(void) {
+    return SYSCTL_CAUSE_POR;
+}
+
+void SysCtlResetCauseClear(uint32_t ui32Causes) {
+    (void)ui32Causes;
+}
+
+// Two timeouts from now, the first only raises the interrupt
+static void watchdog_restart(void) {
+    uint64_t cycles_per_us = SysCtlClockGet() / 1000000;
+    watchdog_reset_us = Sim_Now() + 2 * ((uint64_t)watchdog_load + cycles_per_us - 1) / cycles_per_us;
+}
+
+void WatchdogReloadSet(uint32_t ui32Base, uint32_t ui32LoadVal) {
+    watchdog_load = ui32LoadVal;
+    watchdog_restart();
+}
+
+void WatchdogResetEnable(uint32_t ui32Base) {
+    (void)ui32Base;
+}
+
+void WatchdogStallEnable(uint32_t ui32Base) {
+    (void)ui32Base;
+}
+
+void WatchdogEnable(uint32_t ui32Base) {
+    watchdog_running = true;
+    watchdog_restart();
+}
+
+void WatchdogIntClear(uint32_t ui32Base) {
+    watchdog_restart();
+}
+
+uint32_t HibernateIsActive(void) {
+    return 0;
+}
+
+void HibernateEnableExpClk(uint32_t ui32HibClk) {
+    (void)ui32HibClk;
+}
+
+void HibernateClockConfig(uint32_t ui32Config) {
+    (void)ui32Config;
+}
+
+void HibernateRTCEnable(void) {
+}
+
+uint32_t HibernateRTCGet(void) {
+    return rtc_base_s + (uint32_t)(Sim_Now() / 1000000);
+}
+
+void HibernateRTCSet(uint32_t ui32RTCValue) {
+    rtc_base_s = ui32RTCValue - (uint32_t)(Sim_Now() / 1000000);
+}
+
+void HibernateRTCMatchSet(uint32_t ui32Match, uint32_t ui32Value) {
+    (void)ui32Match;
+    rtc_match_s = ui32Value;
+}
+
+void HibernateDataSet(uint32_t *pui32Data, uint32_t ui32Count) {
+    memcpy(hibernate_data, pui32Data, ui32Count * sizeof(uint32_t));
+}
+
+void HibernateDataGet(uint32_t *pui32Data, uint32_t ui32Count) {
+    memcpy(pui32Data, hibernate_data, ui32Count * sizeof(uint32_t));
+}
+
+uint32_t HibernateIntStatus(bool bMasked) {
+    (void)bMasked;
+    return 0;
+}
+
+void HibernateIntClear(uint32_t ui32IntFlags) {
+    (void)ui32IntFlags;
+}
+
+void HibernateWakeSet(uint32_t ui32WakeFlags) {
+    (void)ui32WakeFlags;
+}
+
+void HibernateRequest(void) {
+    printf("hibernating at %.3f s, RTC %u, until RTC %u\n", Sim_Now() / 1e6, HibernateRTCGet(), rtc_match_s);
+    Sim_Stop();
+}
+
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config) {
+    (void)ui32Base;
+    (void)ui32Config;
+}
+
+void TimerLoadSet(uint32_t ui32Base, uint32_t ui32Timer, uint32_t ui32Value) {
+    if (ui32Base == TIMER1_BASE)
+        timer1_load = ui32Value;
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer) {
+    if (ui32Base == TIMER1_BASE) {
+        uint64_t cycles_per_us = SysCtlClockGet() / 1000000;
+        timer1_due_us = Sim_Now() + (timer1_load + cycles_per_us - 1) / cycles_per_us;
+        timer1_running = true;
+    }
+}
+
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer) {
+    if (ui32Base == TIMER1_BASE)
+        timer1_running = false;
+}
+
+void TimerIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags) {
+    (void)ui32Base;
+    (void)ui32IntFlags;
+}
+
+void TimerIntClear(uint32_t ui32Base, uint32_t ui32IntFlags) {
+    (void)ui32Base;
+    (void)ui32IntFlags;
+}
+
+void GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags) {
+    if (ui32Port == JOYSTICK_INT_GPIO_BASE && (ui32IntFlags & JOYSTICK_INT_PIN))
+        joystick_int_enabled = true;
+    if (ui32Port == BUTTONS_INT_GPIO_BASE && (ui32IntFlags & BUTTONS_INT_PIN))
+        buttons_int_enabled = true;
+}
+
+void GPIOIntDisable(uint32_t ui32Port, uint32_t ui32IntFlags) {
+    if (ui32Port == JOYSTICK_INT_GPIO_BASE && (ui32IntFlags & JOYSTICK_INT_PIN))
+        joystick_int_enabled = false;
+    if (ui32Port == BUTTONS_INT_GPIO_BASE && (ui32IntFlags & BUTTONS_INT_PIN))
+        buttons_int_enabled = false;
+}
+
+void GPIOIntClear(uint32_t ui32Port, uint32_t ui32IntFlags) {
+    (void)ui32Port;
+    (void)ui32IntFlags;
+}
+
+bool UARTCharsAvail(uint32_t ui32Base) {
+    if (ui32Base == UART0_BASE)
+        return console_read < PROTOCOL_FRAME_SIZE;
+
+    return ui32Base == UART4_BASE && rx_read < capture_length && rx_read < rx_fifo_end &&
+           arrival_us(rx_read) <= Sim_Now();
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base) {
+    if (!UARTCharsAvail(ui32Base))
+        return -1;
+    if (ui32Base == UART0_BASE)
+        return ((const uint8_t *)&console_frame)[console_read++];
+    return capture[rx_read++];
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData) {
+    if (ui32Base == UART0_BASE && log_file != NULL)
+        fputc(ucData, log_file);
+    return true;
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags) {
+    (void)ui32Base;
+    (void)ui32IntFlags;
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked) {
+    (void)bMasked;
+    return (ui32Base == UART4_BASE || ui32Base == UART0_BASE) ? (UART_INT_RX | UART_INT_RT) : 0;
+}
+
+bool UARTBusy(uint32_t ui32Base) {
+    return false;
+}
+
+/**
+ * @brief Only noted, the capture keeps its own timing since it can't answer the handshake.
+ */
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config) {
+    if (ui32Base == UART4_BASE)
+        firmware_baud = ui32Baud;
+}
+
+uint32_t Sim_FirmwareBaud(void) {
+    return firmware_baud;
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags) {
+    (void)ui32Base;
+    (void)ui32IntFlags;
+}
+
+void UARTRxErrorClear(uint32_t ui32Base) {
+    (void)ui32Base;
+}
+
+/*
+ * Multimod inputs
+ */
+
+void multimod_init(void) {
+}
+
+uint32_t JOYSTICK_GetXY(void) {
+    return JOYSTICK_NEUTRAL;
+}
+
+uint8_t JOYSTICK_GetPress(void) {
+    return Sim_Now() < press_until_us;
+}
+
+uint8_t MultimodButtons_Get(void) {
+    if (Sim_Now() >= switches_until_us)
+        switches = 0;
+    return (uint8_t)~switches;
+}
+
+/*
+ * Firmware modules with a host version
+ */
+
+void Clock_Init(void) {
+}
+
+uint32_t Clock_Millis(void) {
+    return (uint32_t)(Sim_Now() / 1000);
+}
+
+uint32_t Clock_Micros(void) {
+    return (uint32_t)Sim_Now();
+}
+
+void UartTx_Init(void) {
+}
+
+bool UartTx_IsBusy(void) {
+    return false;
+}
+
+bool UartTx_SendFrame(uint8_t type, const void *payload, uint8_t length) {
+    if (BusNode_Hold(type, payload, length))
+        return true;
+
+    ProtocolFrame_t frame;
+    Protocol_EncodeFrame(&frame, type, payload, length);
+
+    uplink_frames[type]++;
+    if (uplink_file != NULL)
+        fwrite(&frame, 1, PROTOCOL_FRAME_SIZE, uplink_file);
+
+    return true;
+}
+
+bool UartTx_SendFrames(const ProtocolFrame_t *frames, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        uplink_frames[frames[i].type]++;
+        if (uplink_file != NULL)
+            fwrite(&frames[i], 1, PROTOCOL_FRAME_SIZE, uplink_file);
+    }
+    return true;
+}
+
+uint32_t UartTx_GetDroppedCount(void) {
+    return 0;
+}
+
+/********************************Public Functions***********************************/
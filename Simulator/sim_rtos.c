@@ -0,0 +1,356 @@
+/***************************************************************************************
+ * @file        sim_rtos.c
+ * @brief       Cooperative host scheduler standing in for G8RTOS.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Every thread gets its own ucontext stack. The scheduler always runs the highest
+ * priority thread that is neither blocked nor asleep, round robin among equals, and a
+ * thread keeps the CPU until it waits on a semaphore or sleeps. Semaphores follow the
+ * G8RTOS counting rules, a signal readies the first waiter after the running thread.
+ *
+ * Before G8RTOS_Launch and after it returns the semaphore calls only keep count,
+ * so the benchmarks can call thread helpers directly.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "inc/hw_ints.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define STACK_SIZE          (256 * 1024)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    void (*entry)(void);
+    const char *name;
+    uint8_t priority;
+    ucontext_t context;
+    void *stack;
+    semaphore_t *blocked;       // semaphore being waited on, NULL when not blocked
+    bool asleep;
+    uint64_t wake_us;
+    uint32_t runs;
+    uint64_t host_ns;
+} SimThread_t;
+
+typedef struct {
+    void (*handler)(void);
+    int32_t irq;
+    uint8_t priority;
+    uint32_t runs;
+    uint64_t host_ns;
+} SimEvent_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+uint32_t SystemTime = 0;
+
+static SimThread_t threads[SIM_MAX_THREADS];
+static uint32_t thread_count = 0;
+
+static SimEvent_t events[SIM_MAX_EVENTS];
+static uint32_t event_count = 0;
+
+static ucontext_t scheduler;
+static SimThread_t *running = NULL;
+static uint32_t last_run = 0;
+
+static bool launched = false;
+static bool stopping = false;
+
+static uint64_t now_us = 0;
+
+// Interrupt time taken inside the slice that is running, charged to the handler instead
+static uint64_t slice_interrupt_ns = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static bool is_ready(const SimThread_t *thread) {
+    return thread->blocked == NULL && (!thread->asleep || thread->wake_us <= now_us);
+}
+
+/**
+ * @brief Picks the highest priority ready thread, starting after the last one that ran.
+ */
+static SimThread_t *pick_thread(void) {
+    SimThread_t *best = NULL;
+
+    for (uint32_t k = 1; k <= thread_count; k++) {
+        SimThread_t *thread = &threads[(last_run + k) % thread_count];
+        if (is_ready(thread) && (best == NULL || thread->priority < best->priority))
+            best = thread;
+    }
+
+    return best;
+}
+
+static void yield(void) {
+    swapcontext(&running->context, &scheduler);
+}
+
+static void start_thread(void) {
+    running->entry();
+
+    // Firmware threads never return, treat it like a fault
+    fprintf(stderr, "sim: thread %s returned\n", running->name);
+    Sim_Stop();
+    yield();
+}
+
+static const char *event_name(int32_t irq) {
+    switch (irq) {
+        case INT_UART4:     return "UART4_Handler";
+        case INT_UART0:     return "UART0_Handler";
+        case INT_GPIOE:     return "Button_Handler";
+        case INT_GPIOD:     return "Joystick_Button_Handler";
+        case INT_SSI3:      return "SSI3_Handler";
+        case INT_TIMER1A:   return "Timer1A_Handler";
+        default:            return "IRQ";
+    }
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+void G8RTOS_Init(void) {
+    thread_count = 0;
+    event_count = 0;
+    now_us = 0;
+    SystemTime = 0;
+}
+
+sched_ErrCode_t G8RTOS_AddThread(void (*threadToAdd)(void), uint8_t priority, char *name) {
+    if (thread_count >= SIM_MAX_THREADS)
+        return THREAD_LIMIT_REACHED;
+
+    SimThread_t *thread = &threads[thread_count++];
+    memset(thread, 0, sizeof(*thread));
+    thread->entry = threadToAdd;
+    thread->name = name;
+    thread->priority = priority;
+
+    return NO_ERROR;
+}
+
+sched_ErrCode_t G8RTOS_Add_APeriodicEvent(void (*AthreadToAdd)(void), uint8_t priority, int32_t IRQn) {
+    if (event_count >= SIM_MAX_EVENTS)
+        return THREAD_LIMIT_REACHED;
+
+    SimEvent_t *event = &events[event_count++];
+    memset(event, 0, sizeof(*event));
+    event->handler = AthreadToAdd;
+    event->irq = IRQn;
+    event->priority = priority;
+
+    return NO_ERROR;
+}
+
+/**
+ * @brief Runs the threads until Sim_Stop, then returns unlike the real kernel.
+ */
+int32_t G8RTOS_Launch(void) {
+    for (uint32_t i = 0; i < thread_count; i++) {
+        SimThread_t *thread = &threads[i];
+
+        thread->stack = malloc(STACK_SIZE);
+        getcontext(&thread->context);
+        thread->context.uc_stack.ss_sp = thread->stack;
+        thread->context.uc_stack.ss_size = STACK_SIZE;
+        thread->context.uc_link = &scheduler;
+        makecontext(&thread->context, start_thread, 0);
+    }
+
+    launched = true;
+    stopping = false;
+
+    while (!stopping) {
+        SimThread_t *thread = pick_thread();
+        if (thread == NULL) {
+            fprintf(stderr, "sim: no thread can run\n");
+            break;
+        }
+
+        thread->asleep = false;
+        thread->runs++;
+        last_run = thread - threads;
+        running = thread;
+
+        slice_interrupt_ns = 0;
+        uint64_t start = Sim_HostNs();
+        swapcontext(&scheduler, &thread->context);
+        thread->host_ns += Sim_HostNs() - start - slice_interrupt_ns;
+
+        running = NULL;
+    }
+
+    // The thread stacks are left to the process exit, every thread is parked mid-loop
+    launched = false;
+    return 0;
+}
+
+void G8RTOS_InitSemaphore(semaphore_t *s, int32_t value) {
+    *s = value;
+}
+
+void G8RTOS_WaitSemaphore(semaphore_t *s) {
+    (*s)--;
+    if (*s >= 0)
+        return;
+
+    if (running == NULL) {
+        fprintf(stderr, "sim: semaphore wait would block outside a thread\n");
+        abort();
+    }
+
+    running->blocked = s;
+    yield();
+}
+
+void G8RTOS_SignalSemaphore(semaphore_t *s) {
+    (*s)++;
+    if (*s > 0 || thread_count == 0)
+        return;
+
+    uint32_t from = (running != NULL) ? (uint32_t)(running - threads) : thread_count - 1;
+    for (uint32_t k = 1; k <= thread_count; k++) {
+        SimThread_t *thread = &threads[(from + k) % thread_count];
+        if (thread->blocked == s) {
+            thread->blocked = NULL;
+            return;
+        }
+    }
+}
+
+void sleep(uint32_t durationMS) {
+    if (running == NULL)
+        return;
+
+    running->asleep = true;
+    running->wake_us = now_us + (uint64_t)durationMS * 1000;
+    yield();
+}
+
+/**
+ * @brief Simulated time since G8RTOS_Init, in microseconds.
+ */
+uint64_t Sim_Now(void) {
+    return now_us;
+}
+
+uint64_t Sim_HostNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+/**
+ * @brief What WFI does on the board, called from SysCtlSleep in Idle_Thread.
+ *
+ * Moves time on to the next wake-up, raises the interrupts that are due then and lets
+ * the scheduler run whatever became ready.
+ */
+void Sim_Idle(void) {
+    uint64_t wake_us;
+    bool waking = Sim_NextWake(&wake_us);
+
+    for (uint32_t i = 0; i < thread_count; i++) {
+        if (threads[i].asleep && (!waking || threads[i].wake_us < wake_us)) {
+            wake_us = threads[i].wake_us;
+            waking = true;
+        }
+    }
+
+    if (!waking) {
+        Sim_Stop();
+    } else if (wake_us > now_us) {
+        now_us = wake_us;
+        SystemTime = now_us / 1000;
+    }
+
+    Sim_Service();
+
+    if (running != NULL)
+        yield();
+}
+
+/**
+ * @brief Ends G8RTOS_Launch once the running thread gives the CPU up.
+ */
+void Sim_Stop(void) {
+    stopping = true;
+}
+
+/**
+ * @brief Calls the handler registered for an interrupt, if there is one.
+ */
+bool Sim_Interrupt(int32_t irq) {
+    for (uint32_t i = 0; i < event_count; i++) {
+        if (events[i].irq == irq) {
+            uint64_t start = Sim_HostNs();
+            events[i].handler();
+            uint64_t elapsed = Sim_HostNs() - start;
+
+            events[i].runs++;
+            events[i].host_ns += elapsed;
+            slice_interrupt_ns += elapsed;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t Sim_ThreadStats(SimThreadStats_t *stats, uint32_t max) {
+    uint32_t count = (thread_count < max) ? thread_count : max;
+
+    for (uint32_t i = 0; i < count; i++) {
+        stats[i].name = threads[i].name;
+        stats[i].priority = threads[i].priority;
+        stats[i].runs = threads[i].runs;
+        stats[i].host_ns = threads[i].host_ns;
+    }
+
+    return count;
+}
+
+uint32_t Sim_EventStats(SimThreadStats_t *stats, uint32_t max) {
+    uint32_t count = (event_count < max) ? event_count : max;
+
+    for (uint32_t i = 0; i < count; i++) {
+        stats[i].name = event_name(events[i].irq);
+        stats[i].priority = events[i].priority;
+        stats[i].runs = events[i].runs;
+        stats[i].host_ns = events[i].host_ns;
+    }
+
+    return count;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,173 @@
+/***************************************************************************************
+ * @file        arena.c
+ * @brief       One static region the large firmware buffers are carved from at boot.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * ARENA_BYTES below is the budget: one line per block, in the order they are carved.
+ * On the target the SRAM line of the report comes from section sizes the linker
+ * command file exports.
+ *
+ * The arena, the per-slot tables outside it, the thread stacks, the RAMFUNC_MAX_BYTES
+ * tm4c123gh6pm.cmd sets aside for code run from SRAM and SRAM_OTHER_BYTES for everything
+ * else are checked against SRAM_BYTES at compile time, so a bigger MAX_AIRCRAFTS or block
+ * that would not fit on the board fails the build, the simulator's included.
+ * SRAM_OTHER_BYTES is the rest of .bss and .data, about 6 KB of it the log ring, display
+ * lists and smaller statics, the rest for the G8RTOS TCBs, semaphores and FIFOs. The
+ * footprint table in Radar/aircraft_store.h works from the same figures.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./arena.h"
+#include "./log.h"
+
+#include <string.h>
+
+#include "threads.h"
+#include "./schedule.h"
+#include "./stack_watch.h"
+#include "./bench_suite.h"
+#include "./ramfunc.h"
+#include "Radar/aircraft_store.h"
+#include "Radar/aircraft_index.h"
+#include "Radar/dead_reckoning.h"
+#include "Radar/aircraft_aging.h"
+#include "Radar/conflict_detector.h"
+#include "Radar/closest_approach.h"
+#include "Link/frame_ring.h"
+#include "Link/usb_link.h"
+#include "Display/label_cache.h"
+#include "Display/track_history.h"
+#include "Display/display_list.h"
+#include "Display/radar_renderer.h"
+#include "Display/strip_renderer.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ARENA_BYTES     (ARENA_BLOCK((1 + AIRCRAFT_STAGING_ENABLE) * sizeof(AircraftStore_t)) +  /* live and staging stores */ \
+                         ARENA_BLOCK((1 + AIRCRAFT_STAGING_ENABLE) * sizeof(AircraftIndex_t)) +  /* their ICAO24 indexes */ \
+                         ARENA_BLOCK(sizeof(FrameRing_t)) +                                      /* UART4 receive ring */ \
+                         ARENA_BLOCK(PROTOCOL_COMPACT_ENTRIES * sizeof(uint32_t)) +              /* compact dictionary */ \
+                         ARENA_BLOCK(USB_LINK_ENABLE * sizeof(FrameRing_t)) +                    /* USB receive ring */ \
+                         ARENA_BLOCK(LABEL_CACHE_ENTRIES * sizeof(LabelCacheEntry_t)) +          /* callsign bitmaps */ \
+                         ARENA_BLOCK(TRACK_HISTORY_RINGS * sizeof(Trail_t)) +                    /* trail pool */ \
+                         ARENA_BLOCK(MAX_AIRCRAFTS * sizeof(RadarSprite_t)) +                    /* sprites last drawn */ \
+                         ARENA_BLOCK(MAX_AIRCRAFTS * sizeof(DisplaySlot_t)) +                    /* their row buckets */ \
+                         ARENA_BLOCK(STRIP_PIXELS * sizeof(uint16_t)))                           /* strip buffer */
+
+#define SRAM_BYTES      0x8000
+
+#define SRAM_TABLE_BYTES    (sizeof(AircraftScreen_t) + sizeof(DeadReckoning_t) + sizeof(AircraftAging_t) + \
+                             CONFLICT_DETECTION_ENABLE * sizeof(ConflictDetector_t) + sizeof(ClosestApproach_t) + \
+                             MAX_AIRCRAFTS * (4 * sizeof(int16_t) + sizeof(uint8_t)))   /* distance order and ranks, grid links, epochs */
+#define SRAM_STACK_BYTES    ((SCHEDULE_THREAD_COUNT + BENCH_SUITE) * STACK_WATCH_BOARD_BYTES + STACK_WATCH_MAIN_BYTES)
+#define SRAM_OTHER_BYTES    7168
+
+// Board stacks in the simulator too, only its bench build goes past what the board holds
+#if !BENCH_SUITE_HOST
+_Static_assert(ARENA_BYTES + SRAM_TABLE_BYTES + SRAM_STACK_BYTES + RAMFUNC_MAX_BYTES + SRAM_OTHER_BYTES <= SRAM_BYTES,
+               "MAX_AIRCRAFTS and the arena blocks do not fit in SRAM next to the stacks");
+#endif
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    char owner[ARENA_NAME_SIZE];
+    uint32_t bytes;
+} ArenaBlock_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint64_t region[ARENA_BYTES / sizeof(uint64_t)];
+static uint32_t used = 0;
+
+static ArenaBlock_t blocks[ARENA_MAX_BLOCKS];
+static uint32_t block_count = 0;
+
+#if defined(ccs)
+// Section sizes from tm4c123gh6pm.cmd, the symbol's address is the size
+extern uint8_t __vtable_size;
+extern uint8_t __data_size;
+extern uint8_t __bss_size;
+extern uint8_t __sysmem_size;
+extern uint8_t __stack_size;
+extern uint8_t __ramfunc_size;
+#endif
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Carves a zeroed block for `owner` out of the region.
+ *
+ * Only to be called during boot, before G8RTOS_Launch. Blocks are never freed.
+ *
+ * @param owner Up to 7 characters, named in Arena_Report.
+ * @return void* The block, aligned to ARENA_ALIGN, or NULL if ARENA_BYTES has no room.
+ */
+void *Arena_Alloc(uint32_t bytes, const char *owner) {
+    uint32_t size = ARENA_BLOCK(bytes);
+
+    if (size > sizeof(region) - used) {
+        char name[ARENA_NAME_SIZE] = { 0 };
+        strncpy(name, owner, ARENA_NAME_SIZE - 1);
+        LOG_ERROR(LOG_ARENA_FULL, LOG_TEXT(name), LOG_TEXT(name + 4), bytes, sizeof(region) - used);
+        return NULL;
+    }
+
+    void *block = (uint8_t *)region + used;
+    used += size;
+
+    if (block_count < ARENA_MAX_BLOCKS) {
+        strncpy(blocks[block_count].owner, owner, ARENA_NAME_SIZE - 1);
+        blocks[block_count].bytes = size;
+        block_count++;
+    }
+
+    return block;
+}
+
+uint32_t Arena_Used(void) {
+    return used;
+}
+
+uint32_t Arena_Size(void) {
+    return sizeof(region);
+}
+
+/**
+ * @brief Logs each block, the region's total and, on the target, the rest of SRAM.
+ */
+void Arena_Report(void) {
+    for (uint32_t i = 0; i < block_count; i++) {
+        const char *name = blocks[i].owner;
+        LOG_INFO(LOG_ARENA_BLOCK, LOG_TEXT(name), LOG_TEXT(name + 4), blocks[i].bytes);
+    }
+    LOG_INFO(LOG_ARENA, used, sizeof(region));
+
+#if defined(ccs)
+    uint32_t data = (uint32_t)&__vtable_size + (uint32_t)&__data_size;
+    uint32_t bss = (uint32_t)&__bss_size + (uint32_t)&__sysmem_size;
+    uint32_t stack = (uint32_t)&__stack_size;
+    uint32_t code = (uint32_t)&__ramfunc_size;
+
+    LOG_INFO(LOG_SRAM, data, bss, stack, code, SRAM_BYTES - data - bss - stack - code);
+#endif
+}
+
+/********************************Public Functions***********************************/
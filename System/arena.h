@@ -0,0 +1,60 @@
+/***************************************************************************************
+ * @file        arena.h
+ * @brief       One static region the large firmware buffers are carved from at boot.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The aircraft stores and their indexes, the receive frame rings, the label cache, the
+ * trail pool, the renderer's sprites and the strip buffer all take their memory from
+ * here instead of from arrays of their own. Each block is handed out once, from an
+ * init function that runs before G8RTOS_Launch, and is never given back, so there is
+ * no fragmentation and no locking. Blocks start zeroed, like the arrays they replace.
+ *
+ * The region is sized at build time for exactly those blocks, in arena.c, so moving
+ * MAX_AIRCRAFTS or a pool size moves the region with it. A new consumer needs its line
+ * there too, otherwise Arena_Alloc logs the shortfall and returns NULL.
+ *
+ * Arena_Report logs what each owner took, the region's total, and on the target what
+ * the rest of SRAM holds, so features can be traded against the 32 KB with real numbers.
+ *
+***************************************************************************************/
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define ARENA_ALIGN         8       // every block starts on a doubleword
+#define ARENA_MAX_BLOCKS    12      // owners the report can name
+#define ARENA_NAME_SIZE     8       // 7 characters and a null terminator
+
+// Bytes a block of `bytes` takes from the region
+#define ARENA_BLOCK(bytes)  (((uint32_t)(bytes) + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1))
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void *Arena_Alloc(uint32_t bytes, const char *owner);
+
+uint32_t Arena_Used(void);
+uint32_t Arena_Size(void);
+
+void Arena_Report(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* ARENA_H_ */
@@ -0,0 +1,64 @@
+/***************************************************************************************
+ * @file        bench_budgets.h
+ * @brief       Checked-in time budgets for the benchmark suite, see bench_suite.h.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The board budgets are what the frame rate and the link leave each step at 80 MHz,
+ * not past measurements: a full redraw fits one FRAME_INTERVAL_MS and a moved one, with
+ * a tenth of the aircraft moved, a quarter of it. From 200 aircraft up the moved ones
+ * leave more than RADAR_RENDERER_MAX_DAMAGE regions and the renderer repaints, so there
+ * it gets the full redraw's budget. A selection answers within a quarter of a
+ * millisecond and the info panel within 10 ms. Decode, swap and reprojection are
+ * budgeted per aircraft, so that a burst is parsed and published well inside one
+ * DEAD_RECKONING_TICK_MS. A rescale gets a hundred cycles an aircraft, a range change
+ * has to stay a multiply per axis.
+ *
+ * The host budgets are four times the median of 30 runs of make bench-check on a
+ * desktop, rounded up to two figures. That also clears the slowest of those runs by
+ * half again, so only a real regression trips them. Raise one in the same commit that
+ * makes a step slower on purpose, with the reason.
+ *
+***************************************************************************************/
+
+#ifndef BENCH_BUDGETS_H_
+#define BENCH_BUDGETS_H_
+
+/*************************************Defines***************************************/
+
+// X(kernel, aircraft, board DWT cycles, host nanoseconds)
+#define BENCH_BUDGETS(X) \
+    X(BENCH_DECODE,       50,     150000,     35000) \
+    X(BENCH_DECODE,       200,    600000,     140000) \
+    X(BENCH_DECODE,       500,    1500000,    350000) \
+    X(BENCH_SWAP,         50,     125000,     19000) \
+    X(BENCH_SWAP,         200,    500000,     53000) \
+    X(BENCH_SWAP,         500,    1250000,    120000) \
+    X(BENCH_REPROJECT,    50,     50000,      3000) \
+    X(BENCH_REPROJECT,    200,    200000,     11000) \
+    X(BENCH_REPROJECT,    500,    500000,     26000) \
+    X(BENCH_RESCALE,      50,     5000,       2500) \
+    X(BENCH_RESCALE,      200,    20000,      9000) \
+    X(BENCH_RESCALE,      500,    50000,      22000) \
+    X(BENCH_SELECT,       50,     20000,      1500) \
+    X(BENCH_SELECT,       200,    20000,      2000) \
+    X(BENCH_SELECT,       500,    20000,      2000) \
+    X(BENCH_REDRAW,       50,     4000000,    570000) \
+    X(BENCH_REDRAW,       200,    4000000,    1300000) \
+    X(BENCH_REDRAW,       500,    4000000,    2400000) \
+    X(BENCH_MOVED,        50,     1000000,    150000) \
+    X(BENCH_MOVED,        200,    4000000,    950000) \
+    X(BENCH_MOVED,        500,    4000000,    2400000) \
+    X(BENCH_INFO,         50,     800000,     29000) \
+    X(BENCH_INFO,         200,    800000,     40000) \
+    X(BENCH_INFO,         500,    800000,     56000)
+
+/*************************************Defines***************************************/
+
+#endif /* BENCH_BUDGETS_H_ */
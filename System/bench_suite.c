@@ -0,0 +1,388 @@
+/***************************************************************************************
+ * @file        bench_suite.c
+ * @brief       Timings of the whole pipeline at several traffic levels, against budgets.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Only the timed calls sit between the two counter reads. Frames are encoded one at a
+ * time on the way in, so a burst of any size needs no buffer of its own, and the
+ * aircraft for the moved redraw are moved before its clock starts.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./bench_suite.h"
+#include "./bench_budgets.h"
+#include "./log.h"
+#include "./stack_watch.h"
+
+#include "threads.h"
+#include "Link/protocol.h"
+#include "Radar/aircraft_index.h"
+#include "Radar/aircraft_store.h"
+#include "Radar/dead_reckoning.h"
+#include "Radar/projection.h"
+#include "Display/radar_renderer.h"
+
+#include "inc/hw_types.h"
+
+/************************************Includes***************************************/
+
+#if BENCH_SUITE
+
+// The decode and swap kernels time the staged keyframe path
+#if !AIRCRAFT_STAGING_ENABLE
+#error "BENCH_SUITE needs AIRCRAFT_STAGING_ENABLE=1"
+#endif
+
+/*************************************Defines***************************************/
+
+// Debug and trace registers, as in profiler.c
+#define BENCH_DEMCR             0xE000EDFC
+#define BENCH_DEMCR_TRCENA      0x01000000
+#define BENCH_DWT_CTRL          0xE0001000
+#define BENCH_DWT_CYCCNTENA     0x00000001
+#define BENCH_DWT_CYCCNT        0xE0001004
+
+#define CYCLES()                HWREG(BENCH_DWT_CYCCNT)
+
+#define SPREAD                  4000    // degrees * 10000 either side of the center, about 45 km
+#define MOVED_EVERY             10      // one aircraft in this many moves for the moved redraw
+#define MOVED_STEP              9000    // micro-degrees of latitude, about a kilometre
+#define JOYSTICK_MIDPOINT       2048
+#define JOYSTICK_DEFLECTION     2000
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+extern AircraftStore_t *currentAircrafts;
+extern AircraftStore_t *stagingAircrafts;
+extern AircraftIndex_t *stagingIndex;
+extern AircraftScreen_t currentScreen;
+extern Projection_t radarProjection;
+extern int16_t selectedAircraft;
+extern uint16_t display_range_km;
+
+#define BENCH_KERNEL_NAME(id, name) name,
+static const char NAMES[BENCH_KERNEL_COUNT][9] = { BENCH_KERNELS(BENCH_KERNEL_NAME) };
+#undef BENCH_KERNEL_NAME
+
+#define BENCH_BUDGET_ROW(kernel, aircraft, cycles, host_ns) \
+    { kernel, aircraft, BENCH_SUITE_HOST ? host_ns : cycles },
+static const struct {
+    BenchKernel_t kernel;
+    uint16_t aircraft;
+    uint32_t budget;
+} BUDGETS[] = { BENCH_BUDGETS(BENCH_BUDGET_ROW) };
+#undef BENCH_BUDGET_ROW
+
+static const uint16_t SIZES[BENCH_SUITE_SIZE_COUNT] = BENCH_SUITE_SIZES;
+
+// Joystick readings for the eight compass directions
+static const int32_t DIRECTIONS[8][2] = {
+    { JOYSTICK_MIDPOINT, JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION },
+    { JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION },
+    { JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT },
+    { JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION },
+    { JOYSTICK_MIDPOINT, JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION },
+    { JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION },
+    { JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT },
+    { JOYSTICK_MIDPOINT + JOYSTICK_DEFLECTION, JOYSTICK_MIDPOINT - JOYSTICK_DEFLECTION }
+};
+
+static ProtocolFrame_t frame;
+static ProtocolDecoder_t decoder;
+static int16_t visible[BENCH_SUITE_SELECTIONS];
+static uint32_t random_state;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static int32_t random_spread(void) {
+    random_state = random_state * 1103515245 + 12345;
+    return (int32_t)((random_state >> 8) % (2 * SPREAD + 1)) - SPREAD;
+}
+
+/**
+ * @brief Encodes the i-th synthetic aircraft, the same one every burst.
+ */
+static void encode_aircraft(uint16_t i) {
+    ProtocolAircraft_t wire = { 0xB00000 + i, "BN      ", 0, 0, 0, 0, 0 };
+
+    random_state = i + 1;
+    for (uint16_t digits = i, c = 5; c >= 2; c--, digits /= 10)
+        wire.callsign[c] = '0' + digits % 10;
+
+    wire.latitude = radarProjection.center_latitude / 100 + random_spread();
+    wire.longitude = radarProjection.center_longitude / 100 + random_spread();
+    wire.altitude = (1000 + (random_state >> 8) % 11000) * 10000;
+    wire.velocity = (80 + (random_state >> 12) % 170) * 10000;
+    wire.heading = ((random_state >> 4) % 3600) * 1000;
+
+    Protocol_EncodeFrame(&frame, PROTOCOL_FRAME_AIRCRAFT, &wire, sizeof(wire));
+}
+
+static void clear_staging(void) {
+    G8RTOS_WaitSemaphore(&sem_STAGING_AIRCRAFTS);
+    AircraftStore_Clear(stagingAircrafts);
+    AircraftIndex_Clear(stagingIndex);
+    G8RTOS_SignalSemaphore(&sem_STAGING_AIRCRAFTS);
+}
+
+/**
+ * @brief A keyframe burst of count aircraft through the decoder into the staging store.
+ *
+ * @return uint32_t Time in the decoder and stage_aircraft only.
+ */
+static uint32_t decode_burst(uint16_t count) {
+    uint32_t total = 0;
+
+    clear_staging();
+    Protocol_InitDecoder(&decoder);
+
+    for (uint16_t i = 0; i < count; i++) {
+        encode_aircraft(i);
+
+        uint32_t start = CYCLES();
+        bool ready = false;
+        Protocol_Decode(&decoder, (const uint8_t *)&frame, PROTOCOL_FRAME_SIZE, &ready);
+        if (ready)
+            stage_aircraft((const ProtocolAircraft_t *)decoder.frame.payload);
+        total += CYCLES() - start;
+    }
+
+    return total;
+}
+
+static uint32_t time_swap(uint16_t count) {
+    decode_burst(count);
+
+    uint32_t start = CYCLES();
+    publish_staged_aircraft();
+    return CYCLES() - start;
+}
+
+static uint32_t time_reproject(void) {
+    uint32_t start = CYCLES();
+    recalculate_screen_positions();
+    return CYCLES() - start;
+}
+
+/**
+ * @brief One selection call, averaged over eight directions from each of the visible aircraft.
+ */
+static uint32_t time_select(uint16_t visible_count) {
+    if (visible_count == 0)
+        return 0;
+
+    volatile int16_t sink = 0;
+    uint32_t start = CYCLES();
+    for (uint16_t v = 0; v < visible_count; v++) {
+        selectedAircraft = visible[v];
+        for (uint32_t d = 0; d < 8; d++)
+            sink = closest_aircraft_by_angle(DIRECTIONS[d][0], DIRECTIONS[d][1]);
+    }
+    uint32_t cycles = CYCLES() - start;
+    (void)sink;
+
+    selectedAircraft = -1;
+    return cycles / (visible_count * 8u);
+}
+
+static uint32_t time_redraw(bool full) {
+    G8RTOS_WaitSemaphore(&sem_SPIA);
+
+    uint32_t start = CYCLES();
+    if (full)
+        RadarRenderer_Invalidate();
+    RadarRenderer_Prepare(currentAircrafts, &currentScreen, -1, display_range_km, true, true, false);
+    RadarRenderer_Paint();
+    uint32_t cycles = CYCLES() - start;
+
+    G8RTOS_SignalSemaphore(&sem_SPIA);
+    return cycles;
+}
+
+/**
+ * @brief A redraw after one aircraft in MOVED_EVERY moved a kilometre, at the same range.
+ *
+ * Dead reckoning and a delta burst move a few aircraft at a time, a zoom moves them all
+ * and is the full redraw's case. The moved ones are projected again the way dead
+ * reckoning does it, north on even runs and back south on odd ones.
+ */
+static uint32_t time_moved(uint32_t run) {
+    int32_t step = (run & 1) ? -MOVED_STEP : MOVED_STEP;
+    uint16_t now = DeadReckoning_Now();
+
+    G8RTOS_WaitSemaphore(&sem_CURRENT_AIRCRAFTS);
+    Seqlock_WriteBegin(&seq_CURRENT_AIRCRAFTS);
+    for (int16_t i = 0; i < currentAircrafts->count; i += MOVED_EVERY) {
+        currentAircrafts->latitude[i] += step;
+        project_aircraft(i, now);
+    }
+    Seqlock_WriteEnd(&seq_CURRENT_AIRCRAFTS);
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+
+    return time_redraw(false);
+}
+
+/**
+ * @brief A zoom in or out of a kilometre, by run, and back to the suite's range untimed.
+ */
+static uint32_t time_rescale(uint16_t range_km, uint32_t run) {
+    display_range_km = range_km + (run & 1 ? 1 : -1);
+
+    uint32_t start = CYCLES();
+    rescale_screen_positions();
+    uint32_t cycles = CYCLES() - start;
+
+    display_range_km = range_km;
+    rescale_screen_positions();
+    return cycles;
+}
+
+static uint32_t time_info(uint16_t visible_count, uint32_t run) {
+    if (visible_count == 0)
+        return 0;
+
+    selectedAircraft = visible[run % visible_count];
+    uint32_t start = CYCLES();
+    draw_aircraft_info();
+    uint32_t cycles = CYCLES() - start;
+
+    selectedAircraft = -1;
+    return cycles;
+}
+
+/**
+ * @brief Every kernel at one size, the fewest cycles of BENCH_SUITE_RUNS for each.
+ */
+static void run_size(uint16_t count, uint32_t best[BENCH_KERNEL_COUNT]) {
+    for (uint32_t k = 0; k < BENCH_KERNEL_COUNT; k++)
+        best[k] = UINT32_MAX;
+
+    uint16_t range_km = display_range_km;
+    uint16_t visible_count = 0;
+
+    for (uint32_t run = 0; run < BENCH_SUITE_RUNS; run++) {
+        uint32_t times[BENCH_KERNEL_COUNT];
+
+        times[BENCH_DECODE] = decode_burst(count);
+        times[BENCH_SWAP] = time_swap(count);
+        times[BENCH_REPROJECT] = time_reproject();
+
+        // The aircraft on screen to select from, only known once the burst is projected
+        visible_count = 0;
+        for (int16_t i = 0; i < currentAircrafts->count && visible_count < BENCH_SUITE_SELECTIONS; i++) {
+            if (currentScreen.on_screen[i])
+                visible[visible_count++] = i;
+        }
+
+        times[BENCH_SELECT] = time_select(visible_count);
+        times[BENCH_REDRAW] = time_redraw(true);
+        times[BENCH_MOVED] = time_moved(run);
+        times[BENCH_RESCALE] = time_rescale(range_km, run);
+        times[BENCH_INFO] = time_info(visible_count, run);
+
+        for (uint32_t k = 0; k < BENCH_KERNEL_COUNT; k++) {
+            if (times[k] < best[k])
+                best[k] = times[k];
+        }
+    }
+
+    display_range_km = range_km;
+    rescale_screen_positions();
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+const char *BenchSuite_Name(BenchKernel_t kernel) {
+    return NAMES[kernel];
+}
+
+/**
+ * @brief The checked-in budget of a kernel at a size, 0 if it has none.
+ */
+uint32_t BenchSuite_Budget(BenchKernel_t kernel, uint16_t aircraft) {
+    for (uint32_t i = 0; i < sizeof(BUDGETS) / sizeof(BUDGETS[0]); i++) {
+        if (BUDGETS[i].kernel == kernel && BUDGETS[i].aircraft == aircraft)
+            return BUDGETS[i].budget;
+    }
+    return 0;
+}
+
+/**
+ * @brief Times every kernel at every size, logs each result against its budget.
+ *
+ * The stores are left holding the last size's traffic. Call from a thread, or from the
+ * simulator with the scheduler stopped.
+ *
+ * @param results   Room for BENCH_SUITE_RESULTS.
+ * @return uint32_t Results written, sizes over MAX_AIRCRAFTS have none.
+ */
+uint32_t BenchSuite_Run(BenchResult_t *results) {
+    uint32_t count = 0;
+
+    HWREG(BENCH_DEMCR) |= BENCH_DEMCR_TRCENA;
+    HWREG(BENCH_DWT_CTRL) |= BENCH_DWT_CYCCNTENA;
+
+    for (uint32_t s = 0; s < BENCH_SUITE_SIZE_COUNT; s++) {
+        uint16_t aircraft = SIZES[s];
+        if (aircraft > MAX_AIRCRAFTS) {
+            LOG_INFO(LOG_BENCH_SKIPPED, aircraft, MAX_AIRCRAFTS);
+            continue;
+        }
+
+        uint32_t best[BENCH_KERNEL_COUNT];
+        run_size(aircraft, best);
+
+        for (uint32_t k = 0; k < BENCH_KERNEL_COUNT; k++) {
+            BenchResult_t *result = &results[count++];
+            result->kernel = (BenchKernel_t)k;
+            result->aircraft = aircraft;
+            result->time = best[k];
+            result->budget = BenchSuite_Budget(result->kernel, aircraft);
+
+            if (result->budget != 0 && result->time > result->budget) {
+                LOG_WARN(LOG_BENCH_OVER, LOG_TEXT(NAMES[k]), LOG_TEXT(NAMES[k] + 4), aircraft,
+                         result->time, result->budget);
+            } else {
+                LOG_INFO(LOG_BENCH, LOG_TEXT(NAMES[k]), LOG_TEXT(NAMES[k] + 4), aircraft,
+                         result->time, result->budget);
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Runs the suite once after boot, see bench_suite.h. Added by main in a BENCH_SUITE build.
+ */
+void BenchSuite_Thread(void) {
+    static BenchResult_t results[BENCH_SUITE_RESULTS];
+
+    StackWatch_RegisterThread("Bench");
+
+    sleep(BENCH_SUITE_DELAY_MS);
+    BenchSuite_Run(results);
+
+    while (1) {
+        sleep(BENCH_SUITE_DELAY_MS);
+    }
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* BENCH_SUITE */
@@ -0,0 +1,118 @@
+/***************************************************************************************
+ * @file        bench_suite.h
+ * @brief       Timings of the whole pipeline at several traffic levels, against budgets.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * For each of BENCH_SUITE_SIZES aircraft, BenchSuite_Run fills the stores with synthetic
+ * traffic around the radar center and times, best of BENCH_SUITE_RUNS:
+ *
+ *      decode      a keyframe burst through Protocol_Decode and stage_aircraft, CRCs included
+ *      swap        publish_staged_aircraft, the burst made live and projected
+ *      reproj      recalculate_screen_positions over the live store
+ *      rescale     rescale_screen_positions for a one kilometre zoom, cached offsets only
+ *      select      one closest_aircraft_by_angle call, averaged over eight directions
+ *      redraw      the whole radar area, RadarRenderer_Invalidate, Prepare and Paint
+ *      moved       Prepare and Paint after one aircraft in ten moved a kilometre
+ *      info        draw_aircraft_info for a new selection, closest approach included
+ *
+ * Each result is logged with its budget from bench_budgets.h, as LOG_BENCH or, over
+ * budget, LOG_BENCH_OVER, and copied out for the caller.
+ *
+ * On the board the times are DWT cycles. A BENCH_SUITE build adds BenchSuite_Thread,
+ * which runs the suite once a few seconds after boot, with the feeder unplugged so no
+ * burst lands in the middle. Paints wait for their DMA with interrupts on, so the best
+ * of several runs is what is kept. Sizes over MAX_AIRCRAFTS are skipped. The suite
+ * times the staged keyframe path, and the thread's stack and the staging store don't fit
+ * next to the default table, so the board build is made with -DBENCH_SUITE=1
+ * -DAIRCRAFT_STAGING_ENABLE=1 -DMAX_AIRCRAFTS=50, which the SRAM check in arena.c holds it to.
+ *
+ * In the simulator, flight_bench -s calls BenchSuite_Run directly, the DWT counter
+ * counts host nanoseconds there and the host column of the budgets applies.
+ *
+***************************************************************************************/
+
+#ifndef BENCH_SUITE_H_
+#define BENCH_SUITE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef BENCH_SUITE
+#define BENCH_SUITE             0
+#endif
+
+// 1 = counts are host nanoseconds from the simulator, see the host budgets
+#ifndef BENCH_SUITE_HOST
+#define BENCH_SUITE_HOST        0
+#endif
+
+#define BENCH_SUITE_RUNS        8
+#define BENCH_SUITE_DELAY_MS    3000    // boot drawing and the warm start settle first
+#define BENCH_SUITE_SELECTIONS  16      // aircraft each selection run starts from
+
+#define BENCH_SUITE_SIZES       { 50, 200, 500 }
+#define BENCH_SUITE_SIZE_COUNT  3
+
+// Name of each kernel, padded to eight characters for two LOG_TEXT words
+#define BENCH_KERNELS(X) \
+    X(BENCH_DECODE,     "decode  ") \
+    X(BENCH_SWAP,       "swap    ") \
+    X(BENCH_REPROJECT,  "reproj  ") \
+    X(BENCH_RESCALE,    "rescale ") \
+    X(BENCH_SELECT,     "select  ") \
+    X(BENCH_REDRAW,     "redraw  ") \
+    X(BENCH_MOVED,      "moved   ") \
+    X(BENCH_INFO,       "info    ")
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+#define BENCH_KERNEL_ID(id, name) id,
+
+typedef enum {
+    BENCH_KERNELS(BENCH_KERNEL_ID)
+    BENCH_KERNEL_COUNT
+} BenchKernel_t;
+
+#undef BENCH_KERNEL_ID
+
+typedef struct {
+    BenchKernel_t kernel;
+    uint16_t aircraft;
+    uint32_t time;              // DWT cycles, or host nanoseconds with BENCH_SUITE_HOST
+    uint32_t budget;            // 0 when there is none
+} BenchResult_t;
+
+#define BENCH_SUITE_RESULTS     (BENCH_KERNEL_COUNT * BENCH_SUITE_SIZE_COUNT)
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+#if BENCH_SUITE
+
+const char *BenchSuite_Name(BenchKernel_t kernel);
+uint32_t BenchSuite_Budget(BenchKernel_t kernel, uint16_t aircraft);
+
+uint32_t BenchSuite_Run(BenchResult_t *results);
+void BenchSuite_Thread(void);
+
+#endif
+
+/********************************Public Functions***********************************/
+
+#endif /* BENCH_SUITE_H_ */
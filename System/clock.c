@@ -0,0 +1,64 @@
+/***************************************************************************************
+ * @file        clock.c
+ * @brief       Free-running millisecond clock.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./clock.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static uint32_t cycles_per_ms = 1;
+static uint32_t cycles_per_us = 1;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts the clock counting up from zero.
+ *
+ * Must be called after the system clock is set and before the scheduler is launched.
+ */
+void Clock_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER5);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_WTIMER5));
+
+    cycles_per_ms = SysCtlClockGet() / 1000;
+    cycles_per_us = SysCtlClockGet() / 1000000;
+
+    TimerConfigure(WTIMER5_BASE, TIMER_CFG_PERIODIC_UP);
+    TimerLoadSet64(WTIMER5_BASE, UINT64_MAX);
+    TimerEnable(WTIMER5_BASE, TIMER_A);
+}
+
+/**
+ * @brief Milliseconds since Clock_Init.
+ */
+uint32_t Clock_Millis(void) {
+    return (uint32_t)(TimerValueGet64(WTIMER5_BASE) / cycles_per_ms);
+}
+
+/**
+ * @brief Microseconds since Clock_Init, wrapping after about 71 minutes.
+ */
+uint32_t Clock_Micros(void) {
+    return (uint32_t)(TimerValueGet64(WTIMER5_BASE) / cycles_per_us);
+}
+
+/********************************Public Functions***********************************/
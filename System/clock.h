@@ -0,0 +1,37 @@
+/***************************************************************************************
+ * @file        clock.h
+ * @brief       Free-running millisecond clock.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Wide Timer 5 counts system clock cycles in 64-bit mode and never interrupts, so reading
+ * the time costs a register read and a divide. The millisecond count wraps after about
+ * 49 days, differences between two readings stay correct across the wrap.
+ *
+***************************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void Clock_Init(void);
+uint32_t Clock_Millis(void);
+uint32_t Clock_Micros(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,91 @@
+/***************************************************************************************
+ * @file        console.c
+ * @brief       Statistics queries from the PC on the UART0 debug console.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Queries are rare and short, so the receive FIFO is drained a byte at a time on the
+ * receive and receive-timeout interrupts rather than by DMA.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./console.h"
+#include "Link/protocol.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static ProtocolDecoder_t decoder;
+static volatile uint32_t pending = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts listening for queries on UART0.
+ *
+ * Must be called after multimod_init() has configured UART0 and before the scheduler
+ * is launched.
+ */
+void Console_Init(void) {
+    Protocol_InitDecoder(&decoder);
+
+    UARTIntClear(UART0_BASE, UART_INT_RX | UART_INT_RT);
+    UARTIntEnable(UART0_BASE, UART_INT_RX | UART_INT_RT);
+}
+
+/**
+ * @brief Services the UART0 receive interrupt.
+ *
+ * @return bool True if a query is waiting to be answered.
+ */
+bool Console_HandleInterrupt(void) {
+    uint32_t status = UARTIntStatus(UART0_BASE, true);
+    UARTIntClear(UART0_BASE, status);
+
+    while (UARTCharsAvail(UART0_BASE)) {
+        uint8_t byte = UARTCharGetNonBlocking(UART0_BASE);
+        bool frame_ready;
+
+        Protocol_Decode(&decoder, &byte, 1, &frame_ready);
+
+        if (frame_ready && decoder.frame.type == PROTOCOL_FRAME_STATS &&
+            decoder.frame.length >= sizeof(ProtocolStatsQuery_t)) {
+            const ProtocolStatsQuery_t *query = (const ProtocolStatsQuery_t *)decoder.frame.payload;
+            pending |= query->groups & PROTOCOL_STATS_ALL;
+        }
+    }
+
+    return pending != 0;
+}
+
+/**
+ * @brief Takes the groups asked for since the last call.
+ *
+ * @return uint32_t PROTOCOL_STATS_* groups, 0 if there is no query.
+ */
+uint32_t Console_TakeQuery(void) {
+    bool masked = IntMasterDisable();
+    uint32_t groups = pending;
+    pending = 0;
+    if (!masked)
+        IntMasterEnable();
+
+    return groups;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,52 @@
+/***************************************************************************************
+ * @file        console.h
+ * @brief       Statistics queries from the PC on the UART0 debug console.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * UART0 carries the binary log out. In the other direction BeagleBoneScripts/stats.py
+ * sends PROTOCOL_FRAME_STATS frames, framed and checked like the telemetry on UART4,
+ * each naming the groups of counters it wants. The UART0 interrupt decodes them and ORs
+ * the groups into a pending set, and Report_Stats_Thread answers with one log record
+ * per counter line, followed by LOG_STATS_END:
+ *
+ *      traffic     live, staged and drawn aircraft, conflicts and parse rate
+ *      link        frame rate, errors and restarts from link_health.h
+ *      frames      render frames, their time and latency from frame_scheduler.h
+ *      locks       locks taken, how many waited and for how long, per lock
+ *      queues      high-water marks of the receive and log rings, frames dropped
+ *      stacks      stack high water from stack_watch.h
+ *      cpu         each context's share of the last PROFILE_REPORT_MS window
+ *
+ * Nothing is logged on a timer any more, so a board nobody is watching spends nothing
+ * on statistics, and the log only carries events in between. Queries that arrive
+ * before the last one was answered are folded into it.
+ *
+***************************************************************************************/
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void Console_Init(void);
+bool Console_HandleInterrupt(void);
+
+uint32_t Console_TakeQuery(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* CONSOLE_H_ */
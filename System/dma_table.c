@@ -0,0 +1,56 @@
+/***************************************************************************************
+ * @file        dma_table.c
+ * @brief       Shared uDMA channel control table.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./dma_table.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Primary and alternate control structures for all 32 channels
+#pragma DATA_ALIGN(dma_control_table, 1024)
+static tDMAControlTable dma_control_table[64];
+
+static bool dma_initialized = false;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Enables the uDMA controller and installs the shared control table.
+ *
+ * Safe to call from every driver that uses DMA; only the first call does any work.
+ * Must be called before the scheduler is launched.
+ */
+void DMA_Init(void) {
+    if (dma_initialized) {
+        return;
+    }
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA));
+
+    uDMAEnable();
+    uDMAControlBaseSet(dma_control_table);
+
+    dma_initialized = true;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,35 @@
+/***************************************************************************************
+ * @file        dma_table.h
+ * @brief       Shared uDMA channel control table.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The uDMA controller uses a single 1024-byte aligned control table for every channel.
+ * Each driver that needs a DMA channel calls DMA_Init(), which enables the controller
+ * and installs the table exactly once.
+ *
+***************************************************************************************/
+
+#ifndef DMA_TABLE_H_
+#define DMA_TABLE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void DMA_Init(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* DMA_TABLE_H_ */
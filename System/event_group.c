@@ -0,0 +1,162 @@
+/***************************************************************************************
+ * @file        event_group.c
+ * @brief       Event flags a thread can wait on, any or all of them, with a timeout.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * `signalled` keeps the semaphore at one signal at most. A setter signals only while the
+ * waiter is blocked on flags that are now there and no signal is pending, and the waiter
+ * takes any pending signal before it returns, so the next wait starts from zero.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./event_group.h"
+#include "./clock.h"
+
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/********************************Private Functions**********************************/
+
+static bool satisfied(uint32_t present, uint32_t flags, bool all) {
+    return all ? (present & flags) == flags : (present & flags) != 0;
+}
+
+/**
+ * @brief Takes a signal a setter left after the waiter stopped waiting for it.
+ *
+ * Only called with `wanted` at 0, so no new signal can come in meanwhile.
+ */
+static void drain(EventGroup_t *group) {
+    if (group->signalled) {
+        group->signalled = false;
+        G8RTOS_WaitSemaphore(&group->wake);
+    }
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts a group with every flag clear.
+ *
+ * Must be called before the scheduler is launched.
+ */
+void EventGroup_Init(EventGroup_t *group) {
+    group->flags = 0;
+    group->wanted = 0;
+    group->wanted_all = false;
+    group->signalled = false;
+    G8RTOS_InitSemaphore(&group->wake, 0);
+}
+
+/**
+ * @brief Sets flags and wakes the waiter if that is what it waits for.
+ *
+ * Safe to call from an interrupt.
+ *
+ * @return uint32_t The flags before this call.
+ */
+uint32_t EventGroup_Set(EventGroup_t *group, uint32_t flags) {
+    bool wake = false;
+    bool masked = IntMasterDisable();
+
+    uint32_t previous = group->flags;
+    group->flags = previous | flags;
+
+    if (group->wanted != 0 && !group->signalled &&
+        satisfied(group->flags, group->wanted, group->wanted_all)) {
+        group->signalled = true;
+        wake = true;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+
+    if (wake)
+        G8RTOS_SignalSemaphore(&group->wake);
+
+    return previous;
+}
+
+/**
+ * @brief Clears flags.
+ *
+ * @return uint32_t The flags before this call, so a clear of all of them takes them.
+ */
+uint32_t EventGroup_Clear(EventGroup_t *group, uint32_t flags) {
+    bool masked = IntMasterDisable();
+
+    uint32_t previous = group->flags;
+    group->flags = previous & ~flags;
+
+    if (!masked)
+        IntMasterEnable();
+
+    return previous;
+}
+
+uint32_t EventGroup_Get(const EventGroup_t *group) {
+    return group->flags;
+}
+
+/**
+ * @brief Waits for any or all of `flags`, for up to `timeout_ms`.
+ *
+ * Only the thread that owns the group may wait on it.
+ *
+ * @param flags         The flags to wait for.
+ * @param options       EVENT_GROUP_ANY or EVENT_GROUP_ALL, and EVENT_GROUP_CLEAR to clear
+ *                      them on the way out.
+ * @param timeout_ms    Longest wait, 0 to only check, or EVENT_GROUP_FOREVER.
+ * @return uint32_t Which of `flags` were set, 0 if the wait timed out.
+ */
+uint32_t EventGroup_Wait(EventGroup_t *group, uint32_t flags, uint8_t options, uint32_t timeout_ms) {
+    bool all = (options & EVENT_GROUP_ALL) != 0;
+    uint32_t start = Clock_Millis();
+
+    while (1) {
+        bool masked = IntMasterDisable();
+
+        uint32_t present = group->flags;
+        bool done = satisfied(present, flags, all);
+        if (done && (options & EVENT_GROUP_CLEAR))
+            group->flags = present & ~flags;
+
+        group->wanted = done ? 0 : flags;
+        group->wanted_all = all;
+
+        if (!masked)
+            IntMasterEnable();
+
+        if (done) {
+            drain(group);
+            return present & flags;
+        }
+
+        uint32_t waited = Clock_Millis() - start;
+        if (timeout_ms == EVENT_GROUP_FOREVER) {
+            G8RTOS_WaitSemaphore(&group->wake);
+            group->signalled = false;
+        } else if (waited < timeout_ms) {
+            uint32_t left = timeout_ms - waited;
+            sleep((left < EVENT_GROUP_SLICE_MS) ? left : EVENT_GROUP_SLICE_MS);
+        } else {
+            group->wanted = 0;
+            drain(group);
+            return 0;
+        }
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,73 @@
+/***************************************************************************************
+ * @file        event_group.h
+ * @brief       Event flags a thread can wait on, any or all of them, with a timeout.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A group is a word of flags. Setting a flag that is already set does nothing, so any
+ * number of wake-ups before the waiter runs cost it one pass, where a counting semaphore
+ * would run it once per signal. One wait can also cover several sources, each with its
+ * own flag.
+ *
+ * Built from one G8RTOS semaphore per group, which is only ever signalled once per wait.
+ * That limits a group to one waiting thread, the thread that owns it. Flags may be set
+ * from any thread or interrupt. A wait with a timeout sleeps in EVENT_GROUP_SLICE_MS
+ * steps instead of blocking, since the kernel has no timed semaphore wait.
+ *
+***************************************************************************************/
+
+#ifndef EVENT_GROUP_H_
+#define EVENT_GROUP_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "G8RTOS/G8RTOS.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define EVENT_GROUP_FOREVER     0xFFFFFFFF  // timeout of a wait that only flags can end
+#define EVENT_GROUP_SLICE_MS    5           // how often a timed wait checks its flags
+
+// EventGroup_Wait options
+#define EVENT_GROUP_ANY         0x00        // wake on any of the flags
+#define EVENT_GROUP_ALL         0x01        // wake once every flag is set
+#define EVENT_GROUP_CLEAR       0x02        // clear the flags waited for on waking
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    volatile uint32_t flags;
+    volatile uint32_t wanted;       // flags the waiter is blocked on, 0 if it isn't
+    volatile bool wanted_all;
+    volatile bool signalled;        // `wake` holds a signal the waiter hasn't taken
+    semaphore_t wake;
+} EventGroup_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void EventGroup_Init(EventGroup_t *group);
+
+uint32_t EventGroup_Set(EventGroup_t *group, uint32_t flags);
+uint32_t EventGroup_Clear(EventGroup_t *group, uint32_t flags);
+uint32_t EventGroup_Get(const EventGroup_t *group);
+
+uint32_t EventGroup_Wait(EventGroup_t *group, uint32_t flags, uint8_t options, uint32_t timeout_ms);
+
+/********************************Public Functions***********************************/
+
+#endif /* EVENT_GROUP_H_ */
@@ -0,0 +1,122 @@
+/***************************************************************************************
+ * @file        format.c
+ * @brief       Integer-only number to text conversion.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./format.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static const uint32_t POWERS_OF_TEN[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Writes the digits of magnitude, zero padded to at least min_digits.
+ *
+ * @return Number of characters written, not counting the terminator.
+ */
+static uint32_t write_digits(uint32_t magnitude, uint32_t min_digits, char *buffer) {
+    char reversed[10];
+    uint32_t count = 0;
+
+    do {
+        reversed[count++] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    uint32_t length = 0;
+    while (count + length < min_digits)
+        buffer[length++] = '0';
+    while (count)
+        buffer[length++] = reversed[--count];
+
+    buffer[length] = '\0';
+    return length;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Prints a signed integer in decimal.
+ *
+ * @param buffer At least FORMAT_INT_SIZE bytes.
+ * @return Number of characters written, not counting the terminator.
+ */
+uint32_t Format_Int(int32_t value, char *buffer) {
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    uint32_t length = 0;
+    if (value < 0)
+        buffer[length++] = '-';
+
+    return length + write_digits(magnitude, 1, buffer + length);
+}
+
+/**
+ * @brief Prints a scaled integer as a decimal number.
+ *
+ * @param value    Integer holding the number times 10^decimals.
+ * @param decimals Implied decimal digits in value, at most 9.
+ * @param places   Decimal places to print, at most FORMAT_MAX_PLACES.
+ * @param buffer   At least FORMAT_FIXED_SIZE bytes.
+ * @return Number of characters written, not counting the terminator.
+ */
+uint32_t Format_Fixed(int32_t value, uint8_t decimals, uint8_t places, char *buffer) {
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+    if (places > FORMAT_MAX_PLACES)
+        places = FORMAT_MAX_PLACES;
+
+    // Round off the digits that won't be printed, or pad with zeros if there are too few
+    uint32_t fraction = places;
+    if (decimals > places) {
+        uint32_t divisor = POWERS_OF_TEN[decimals - places];
+        magnitude = magnitude / divisor + ((magnitude % divisor) >= (divisor + 1) / 2);
+    } else {
+        fraction = decimals;
+    }
+
+    // Don't print -0.0 for something that only rounded to zero
+    uint32_t length = 0;
+    if (value < 0 && magnitude)
+        buffer[length++] = '-';
+
+    char digits[11];
+    uint32_t count = write_digits(magnitude, fraction + 1, digits);
+    uint32_t whole = count - fraction;
+
+    for (uint32_t i = 0; i < whole; i++)
+        buffer[length++] = digits[i];
+
+    if (places) {
+        buffer[length++] = '.';
+        for (uint32_t i = whole; i < count; i++)
+            buffer[length++] = digits[i];
+        for (uint32_t i = fraction; i < places; i++)
+            buffer[length++] = '0';
+    }
+
+    buffer[length] = '\0';
+    return length;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,45 @@
+/***************************************************************************************
+ * @file        format.h
+ * @brief       Integer-only number to text conversion.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Aircraft fields are kept as scaled integers, so they can be printed straight from the
+ * store without a trip through float, pow and snprintf. Format_Fixed takes a value with a
+ * number of implied decimal digits, such as micro-degrees with 6, and prints it with as
+ * many decimal places as asked for, rounding half away from zero.
+ *
+***************************************************************************************/
+
+#ifndef FORMAT_H_
+#define FORMAT_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define FORMAT_INT_SIZE     12      // sign, 10 digits and the terminator
+#define FORMAT_FIXED_SIZE   20      // sign, 10 digits, point, up to 7 places and the terminator
+#define FORMAT_MAX_PLACES   7
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+uint32_t Format_Int(int32_t value, char *buffer);
+uint32_t Format_Fixed(int32_t value, uint8_t decimals, uint8_t places, char *buffer);
+
+/********************************Public Functions***********************************/
+
+#endif /* FORMAT_H_ */
@@ -0,0 +1,168 @@
+/***************************************************************************************
+ * @file        joystick_adc.c
+ * @brief       Joystick sampling on ADC1, with the deadzone watched in hardware.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The X axis is AIN0 on PE3 and the Y axis AIN1 on PE2. Readings are packed like
+ * JOYSTICK_GetXY's, X in the lower 16 bits and Y in the upper.
+ *
+ * The low comparators use the low-band hysteresis mode: they interrupt once when the
+ * sample drops below the outer threshold and re-arm once it rises above the inner one.
+ * The high comparators are the mirror image, which leaves the band between the two inner
+ * thresholds as the neutral region seen by the hardware.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./joystick_adc.h"
+
+#if JOYSTICK_USE_ADC
+#include "inc/hw_memmap.h"
+#include "driverlib/adc.h"
+#include "driverlib/gpio.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+#else
+#include "MultimodDrivers/multimod.h"
+#endif
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define JOYSTICK_X_CHANNEL      ADC_CTL_CH0
+#define JOYSTICK_Y_CHANNEL      ADC_CTL_CH1
+
+#define WATCH_SEQUENCE          0    // timer-triggered, comparators only
+#define READ_SEQUENCE           1    // processor-triggered reads
+
+#define OUTER_LOW               (JOYSTICK_MIDPOINT - JOYSTICK_DEADZONE)
+#define INNER_LOW               (JOYSTICK_MIDPOINT - JOYSTICK_DEADZONE / 2)
+#define INNER_HIGH              (JOYSTICK_MIDPOINT + JOYSTICK_DEADZONE / 2)
+#define OUTER_HIGH              (JOYSTICK_MIDPOINT + JOYSTICK_DEADZONE)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+#if JOYSTICK_USE_ADC
+
+/**
+ * @brief Starts ADC1 watching the deadzone and readies the read sequence.
+ *
+ * Must be called after multimod_init and before the scheduler is launched. The
+ * comparator interrupt is registered with G8RTOS like the others, see
+ * Joystick_Tilt_Handler.
+ */
+void JoystickAdc_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER2);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOE);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_ADC1));
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER2));
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOE));
+
+    GPIOPinTypeADC(GPIO_PORTE_BASE, GPIO_PIN_3 | GPIO_PIN_2);
+
+    ADCHardwareOversampleConfigure(ADC1_BASE, JOYSTICK_OVERSAMPLE);
+
+    // Reads go ahead of the background checks
+    ADCSequenceDisable(ADC1_BASE, READ_SEQUENCE);
+    ADCSequenceConfigure(ADC1_BASE, READ_SEQUENCE, ADC_TRIGGER_PROCESSOR, 0);
+    ADCSequenceStepConfigure(ADC1_BASE, READ_SEQUENCE, 0, JOYSTICK_X_CHANNEL);
+    ADCSequenceStepConfigure(ADC1_BASE, READ_SEQUENCE, 1, JOYSTICK_Y_CHANNEL | ADC_CTL_IE | ADC_CTL_END);
+    ADCSequenceEnable(ADC1_BASE, READ_SEQUENCE);
+
+    // One comparator either side of the deadzone on each axis
+    ADCComparatorConfigure(ADC1_BASE, 0, ADC_COMP_TRIG_NONE | ADC_COMP_INT_LOW_HONCE);
+    ADCComparatorConfigure(ADC1_BASE, 1, ADC_COMP_TRIG_NONE | ADC_COMP_INT_HIGH_HONCE);
+    ADCComparatorConfigure(ADC1_BASE, 2, ADC_COMP_TRIG_NONE | ADC_COMP_INT_LOW_HONCE);
+    ADCComparatorConfigure(ADC1_BASE, 3, ADC_COMP_TRIG_NONE | ADC_COMP_INT_HIGH_HONCE);
+    ADCComparatorRegionSet(ADC1_BASE, 0, OUTER_LOW, INNER_LOW);
+    ADCComparatorRegionSet(ADC1_BASE, 1, INNER_HIGH, OUTER_HIGH);
+    ADCComparatorRegionSet(ADC1_BASE, 2, OUTER_LOW, INNER_LOW);
+    ADCComparatorRegionSet(ADC1_BASE, 3, INNER_HIGH, OUTER_HIGH);
+    for (uint32_t comparator = 0; comparator < 4; comparator++)
+        ADCComparatorReset(ADC1_BASE, comparator, true, true);
+
+    ADCSequenceDisable(ADC1_BASE, WATCH_SEQUENCE);
+    ADCSequenceConfigure(ADC1_BASE, WATCH_SEQUENCE, ADC_TRIGGER_TIMER, 1);
+    ADCSequenceStepConfigure(ADC1_BASE, WATCH_SEQUENCE, 0, JOYSTICK_X_CHANNEL | ADC_CTL_CMP0);
+    ADCSequenceStepConfigure(ADC1_BASE, WATCH_SEQUENCE, 1, JOYSTICK_X_CHANNEL | ADC_CTL_CMP1);
+    ADCSequenceStepConfigure(ADC1_BASE, WATCH_SEQUENCE, 2, JOYSTICK_Y_CHANNEL | ADC_CTL_CMP2);
+    ADCSequenceStepConfigure(ADC1_BASE, WATCH_SEQUENCE, 3, JOYSTICK_Y_CHANNEL | ADC_CTL_CMP3 | ADC_CTL_END);
+    ADCComparatorIntClear(ADC1_BASE, ADCComparatorIntStatus(ADC1_BASE));
+    ADCComparatorIntEnable(ADC1_BASE, WATCH_SEQUENCE);
+    ADCSequenceEnable(ADC1_BASE, WATCH_SEQUENCE);
+
+    // Timer 2A only triggers the sequence, it never interrupts
+    TimerConfigure(TIMER2_BASE, TIMER_CFG_PERIODIC);
+    TimerLoadSet(TIMER2_BASE, TIMER_A, SysCtlClockGet() / JOYSTICK_ADC_RATE_HZ - 1);
+    TimerControlTrigger(TIMER2_BASE, TIMER_A, true);
+    TimerEnable(TIMER2_BASE, TIMER_A);
+}
+
+/**
+ * @brief Samples both axes once.
+ *
+ * Waits out one conversion of each axis, JOYSTICK_OVERSAMPLE samples apiece, and a
+ * background check if one is in progress. Only call it from one thread.
+ *
+ * @return uint32_t X in the lower 16 bits, Y in the upper.
+ */
+uint32_t JoystickAdc_GetXY(void) {
+    uint32_t samples[4];
+
+    ADCIntClear(ADC1_BASE, READ_SEQUENCE);
+    ADCProcessorTrigger(ADC1_BASE, READ_SEQUENCE);
+    while (!ADCIntStatus(ADC1_BASE, READ_SEQUENCE, false));
+
+    ADCSequenceDataGet(ADC1_BASE, READ_SEQUENCE, samples);
+    return (samples[0] & 0xFFFF) | (samples[1] << 16);
+}
+
+/**
+ * @brief Clears the comparator interrupt.
+ *
+ * @return bool True if the stick left the deadzone since the last call.
+ */
+bool JoystickAdc_HandleInterrupt(void) {
+    uint32_t status = ADCComparatorIntStatus(ADC1_BASE);
+    ADCComparatorIntClear(ADC1_BASE, status);
+    return status != 0;
+}
+
+#else
+
+void JoystickAdc_Init(void) {
+}
+
+uint32_t JoystickAdc_GetXY(void) {
+    return JOYSTICK_GetXY();
+}
+
+bool JoystickAdc_HandleInterrupt(void) {
+    return false;
+}
+
+#endif
+
+/**
+ * @brief Whether a reading is inside the deadzone on both axes.
+ */
+bool JoystickAdc_IsNeutral(uint32_t xy) {
+    int32_t x = xy & 0xFFFF;
+    int32_t y = (xy >> 16) & 0xFFFF;
+
+    return x > OUTER_LOW && x < OUTER_HIGH && y > OUTER_LOW && y < OUTER_HIGH;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,62 @@
+/***************************************************************************************
+ * @file        joystick_adc.h
+ * @brief       Joystick sampling on ADC1, with the deadzone watched in hardware.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * ADC1 reads the same two joystick inputs as JOYSTICK_GetXY, which keeps ADC0, with
+ * JOYSTICK_OVERSAMPLE times hardware averaging on every sample.
+ *
+ * Sequence 0 samples both axes JOYSTICK_ADC_RATE_HZ times a second off Timer 2A and hands
+ * them to the digital comparators only, one below and one above the deadzone per axis.
+ * The sequence 0 interrupt fires once when the stick leaves the deadzone, and the
+ * comparators re-arm when it comes back past half the deadzone, so a stick at rest
+ * costs no CPU time at all. Sequence 1 is triggered by JoystickAdc_GetXY for a reading,
+ * so a read costs one conversion of each axis.
+ *
+ * With JOYSTICK_USE_ADC at 0 nothing is set up, JoystickAdc_GetXY reads through
+ * JOYSTICK_GetXY and the interrupt never fires, so the joystick has to be polled.
+ *
+***************************************************************************************/
+
+#ifndef JOYSTICK_ADC_H_
+#define JOYSTICK_ADC_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef JOYSTICK_USE_ADC
+#define JOYSTICK_USE_ADC        1    // 0 = poll JOYSTICK_GetXY
+#endif
+
+#define JOYSTICK_MIDPOINT       (4096 / 2)
+#define JOYSTICK_DEADZONE       900  // counts either side of the midpoint that read as neutral
+
+#define JOYSTICK_OVERSAMPLE     16   // hardware averaging, a power of 2 up to 64
+#define JOYSTICK_ADC_RATE_HZ    1000 // deadzone checks per second
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void JoystickAdc_Init(void);
+uint32_t JoystickAdc_GetXY(void);
+bool JoystickAdc_IsNeutral(uint32_t xy);
+
+bool JoystickAdc_HandleInterrupt(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* JOYSTICK_ADC_H_ */
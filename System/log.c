@@ -0,0 +1,177 @@
+/***************************************************************************************
+ * @file        log.c
+ * @brief       Binary debug log, buffered in RAM and sent from the idle thread.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./log.h"
+#include "./clock.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LOG_RING_MASK       (LOG_RING_WORDS - 1)
+
+#define LOG_HEADER(id, argc, millis)    (((uint32_t)(id) & 0xFF) | ((uint32_t)(argc) << 8) | \
+                                         ((uint32_t)(millis) << 12))
+#define LOG_HEADER_ARGC(header)         (((header) >> 8) & 0x0F)
+
+#define LOG_RECORD_BYTES    (1 + 4 * (1 + LOG_MAX_ARGS))
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+// Free-running word counts, head is only moved by writers with interrupts masked and tail
+// only by the drain, so a record is never overwritten before it has been sent
+static uint32_t ring[LOG_RING_WORDS];
+static volatile uint32_t head = 0;
+static volatile uint32_t tail = 0;
+
+static volatile uint32_t dropped = 0;
+static uint32_t dropped_reported = 0;
+static uint32_t high_water = 0;
+
+// Record being sent, copied out of the ring so its words can be reused straight away
+static uint8_t out[LOG_RECORD_BYTES];
+static uint32_t out_length = 0;
+static uint32_t out_sent = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint32_t put_word(uint32_t at, uint32_t word) {
+    out[at++] = word & 0xFF;
+    out[at++] = (word >> 8) & 0xFF;
+    out[at++] = (word >> 16) & 0xFF;
+    out[at++] = word >> 24;
+    return at;
+}
+
+/**
+ * @brief Moves the next record into the output buffer.
+ *
+ * @return False if there is nothing left to send.
+ */
+static bool load_record(void) {
+    uint32_t length = 0;
+    out[length++] = LOG_SYNC;
+
+    if (tail != head) {
+        uint32_t at = tail;
+        uint32_t header = ring[at++ & LOG_RING_MASK];
+        uint32_t argc = LOG_HEADER_ARGC(header);
+
+        length = put_word(length, header);
+        for (uint32_t i = 0; i < argc; i++)
+            length = put_word(length, ring[at++ & LOG_RING_MASK]);
+
+        tail = at;
+    } else {
+
+        // Reported last, there may be no room in the ring to queue it
+        uint32_t lost = dropped - dropped_reported;
+        if (!lost)
+            return false;
+
+        dropped_reported += lost;
+        length = put_word(length, LOG_HEADER(LOG_DROPPED, 1, Clock_Millis()));
+        length = put_word(length, lost);
+    }
+
+    out_length = length;
+    out_sent = 0;
+    return true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Queues one record, use the LOG_* macros rather than calling this directly.
+ *
+ * Safe from any thread or interrupt. Drops the record if the ring is full.
+ *
+ * @param words Message ID followed by its arguments.
+ * @param count Number of words, at least one.
+ */
+void Log_Write(const uint32_t *words, uint32_t count) {
+    uint32_t argc = count - 1;
+    if (argc > LOG_MAX_ARGS)
+        argc = LOG_MAX_ARGS;
+
+    // Stamped inside the critical section so records stay in time order
+    bool masked = IntMasterDisable();
+    uint32_t header = LOG_HEADER(words[0], argc, Clock_Millis());
+
+    if (LOG_RING_WORDS - (head - tail) < argc + 1) {
+        dropped++;
+    } else {
+        uint32_t at = head;
+        ring[at++ & LOG_RING_MASK] = header;
+        for (uint32_t i = 1; i <= argc; i++)
+            ring[at++ & LOG_RING_MASK] = words[i];
+        head = at;
+
+        if (head - tail > high_water)
+            high_water = head - tail;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Sends queued records to UART0 until its transmit FIFO is full.
+ *
+ * Never waits on the UART, so the idle thread can go back to sleep and carry on after
+ * the next interrupt. The FIFO holds more than a millisecond of bytes at 115200 baud, so
+ * draining once per tick keeps the line busy. A count of dropped records follows the
+ * records that made it.
+ *
+ * @return True if there is more to send.
+ */
+bool Log_Drain(void) {
+    while (true) {
+        if (out_sent == out_length && !load_record())
+            return false;
+
+        while (out_sent < out_length) {
+            if (!UARTCharPutNonBlocking(UART0_BASE, out[out_sent]))
+                return true;
+            out_sent++;
+        }
+    }
+}
+
+/**
+ * @brief Returns how many records have been dropped for lack of room since boot.
+ */
+uint32_t Log_Dropped(void) {
+    return dropped;
+}
+
+/**
+ * @brief Returns the most words the ring has held at once since boot.
+ */
+uint32_t Log_HighWater(void) {
+    return high_water;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,106 @@
+/***************************************************************************************
+ * @file        log.h
+ * @brief       Binary debug log, buffered in RAM and sent from the idle thread.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Logging a message copies its ID and raw argument words into a ring with interrupts
+ * masked, which takes well under a microsecond and never waits on the console. No
+ * formatting happens on the target. Idle_Thread drains the ring to UART0 a FIFO at a
+ * time whenever nothing else wants the CPU, and BeagleBoneScripts/log_decoder.py turns
+ * the records back into text with the formats in log_messages.h. When the ring is full
+ * new records are dropped and counted rather than stalling the caller.
+ *
+ * Each record on UART0 is:
+ *      1 byte    LOG_SYNC
+ *      4 bytes   header, little-endian: message ID in bits 0..7, argument count in
+ *                bits 8..11, Clock_Millis in bits 12..31
+ *      4 bytes   per argument, little-endian
+ *
+ * Messages above LOG_LEVEL compile to nothing, arguments included.
+ *
+***************************************************************************************/
+
+#ifndef LOG_H_
+#define LOG_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "./log_messages.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL           LOG_LEVEL_DEBUG
+#endif
+
+#define LOG_RING_WORDS      128     // 512 bytes, must be a power of two
+#define LOG_MAX_ARGS        15
+#define LOG_SYNC            0xA5
+
+// Packs four characters starting at text into one argument word for %s
+#define LOG_TEXT(text)      ((uint32_t)(uint8_t)(text)[0]         | ((uint32_t)(uint8_t)(text)[1] << 8) | \
+                             ((uint32_t)(uint8_t)(text)[2] << 16) | ((uint32_t)(uint8_t)(text)[3] << 24))
+
+// The message ID goes in front of the arguments, so the record is built in one array
+#define LOG_WRITE(...)      do { \
+                                const uint32_t log_words_[] = { __VA_ARGS__ }; \
+                                Log_Write(log_words_, sizeof(log_words_) / sizeof(log_words_[0])); \
+                            } while (0)
+
+#define LOG_DISCARD(...)    do { } while (0)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...)      LOG_WRITE(__VA_ARGS__)
+#else
+#define LOG_ERROR(...)      LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...)       LOG_WRITE(__VA_ARGS__)
+#else
+#define LOG_WARN(...)       LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...)       LOG_WRITE(__VA_ARGS__)
+#else
+#define LOG_INFO(...)       LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...)      LOG_WRITE(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...)      LOG_DISCARD(__VA_ARGS__)
+#endif
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void Log_Write(const uint32_t *words, uint32_t count);
+bool Log_Drain(void);
+
+uint32_t Log_Dropped(void);
+uint32_t Log_HighWater(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* LOG_H_ */
@@ -0,0 +1,114 @@
+/***************************************************************************************
+ * @file        log_messages.h
+ * @brief       Table of every message the firmware can log.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A message's ID is its position in this table, and only the ID and raw argument words
+ * are sent. BeagleBoneScripts/log_decoder.py reads this file to turn records back into
+ * text, so the format strings never take up flash. Add new messages at the end to keep
+ * old captures decodable.
+ *
+ * Each conversion takes one 32-bit argument word:
+ *      %d      signed integer
+ *      %u      unsigned integer
+ *      %x      hexadecimal
+ *      %s      four characters packed with LOG_TEXT, trailing NULs dropped
+ *      %qN     signed fixed point with N decimal places, e.g. %q4 for the wire's x10000
+ *
+***************************************************************************************/
+
+#ifndef LOG_MESSAGES_H_
+#define LOG_MESSAGES_H_
+
+/*************************************Defines***************************************/
+
+#define LOG_MESSAGES(X) \
+    X(LOG_DROPPED,              "Log dropped %u records") \
+    X(LOG_AIRCRAFT,             "Call Sign: %s%s\tLongitude: %q4\tLatitude: %q4\tAltitude: %q4\tVelocity: %q4\tTrue Track: %q4") \
+    X(LOG_CURRENT_OVERFLOW,     "Current array overflow!") \
+    X(LOG_STAGING_OVERFLOW,     "Staging array overflow!") \
+    X(LOG_BURST_LOST,           "Burst lost %d frames!") \
+    X(LOG_BURST_COMPLETE,       "BURST SEND COMPLETE!") \
+    X(LOG_JOYSTICK_PRESS,       "press_status: %d") \
+    X(LOG_JOYSTICK_XY,          "X pos: %d \tY pos: %d") \
+    X(LOG_RANGE_UP,             "SW1: +10km Search Range") \
+    X(LOG_RANGE_DOWN,           "SW2: -10km Search Range") \
+    X(LOG_TOGGLE_TRAILS,        "SW3+SW4: Toggle Trails") \
+    X(LOG_TOGGLE_TRACK,         "SW3: Toggle True Track") \
+    X(LOG_TOGGLE_CALLSIGN,      "SW4: Toggle CallSign") \
+    X(LOG_PROFILE,              "Profile %s%s: %q1%% busy, max run %u us, %u runs, %u preempted") \
+    X(LOG_BURST_LATENCY,        "Burst %u: received in %u ms, live after %u ms, drawn after %u ms") \
+    X(LOG_LINK_RATE,            "Link rate raised to %u baud") \
+    X(LOG_LINK_FALLBACK,        "Link rate %u failed, %u of %u test frames") \
+    X(LOG_LINK_SILENT,          "Link silent at %u baud, back to default") \
+    X(LOG_CENTER,               "Center moved to %q6, %q6, stored %u") \
+    X(LOG_CENTER_REJECTED,      "Center %q6, %q6 rejected") \
+    X(LOG_WARM_START,           "Warm start with %u aircraft from the last snapshot") \
+    X(LOG_SNAPSHOT_SAVED,       "Snapshot of %u aircraft saved") \
+    X(LOG_SNAPSHOT_FAILED,      "Snapshot save failed") \
+    X(LOG_AGED_OUT,             "%u aircraft aged out") \
+    X(LOG_FILTER,               "Filter %d to %d m, %q1 m/s and up, flags %u") \
+    X(LOG_CONFLICT,             "Conflict between %x and %x") \
+    X(LOG_ARENA_BLOCK,          "Arena %s%s: %u bytes") \
+    X(LOG_ARENA,                "Arena %u of %u bytes used") \
+    X(LOG_ARENA_FULL,           "Arena full, %s%s wanted %u bytes with %u left") \
+    X(LOG_SRAM,                 "SRAM %u bytes data, %u bss, %u stack, %u code, %u free") \
+    X(LOG_STACK,                "Stack %s%s: %u of %u bytes used") \
+    X(LOG_RAMFUNC_BENCH,        "Bench %s%s: %u cycles, RAMFUNC_ENABLE=%u") \
+    X(LOG_LINK_HEALTH,          "Link %u frames/s, %u CRC errors, %u resyncs, %u overflows, %u restarts, last burst %u ms ago") \
+    X(LOG_LINK_DESYNC,          "Link desync, %u errors and no frame in %u ms, receiver restarted") \
+    X(LOG_LINK_STALL,           "Link stalled, no frame for %u ms, receiver restarted") \
+    X(LOG_WATCHDOG_STUCK,       "Watchdog: %s%s busy for %u ms, letting the watchdog reset") \
+    X(LOG_WATCHDOG_RESET,       "Reset by the watchdog, %s%s was stuck") \
+    X(LOG_STATS_TRAFFIC,        "Traffic %u live, %u staged, %u drawn, %u conflicts, %u frames/s parsed") \
+    X(LOG_STATS_FRAMES,         "Frames %u drawn, %u us average, %u us worst, %u ms worst latency, %u missed") \
+    X(LOG_STATS_LOCK,           "Lock %s%s: %u locks, %u waited, %u us waiting, %u us worst") \
+    X(LOG_STATS_QUEUES,         "Queues: receive ring %u of %u, log %u of %u words, %u records dropped, %u frames unsent") \
+    X(LOG_STATS_END,            "Stats %x done") \
+    X(LOG_STATS_POWER,          "Frames %u motion only, panel asleep %u times, now %u") \
+    X(LOG_SCHEDULE,             "Quiet hours %u to %u min past midnight, waking every %u s") \
+    X(LOG_SCHEDULE_REJECTED,    "Schedule %u to %u min, UTC offset %d min rejected") \
+    X(LOG_HIBERNATE,            "Hibernating for %u s") \
+    X(LOG_QUIET_WAKE,           "Woke for the quiet hours update at RTC %u") \
+    X(LOG_BUS_NODE,             "On the bus as node %u at %u baud") \
+    X(LOG_BUS_NODE_STORED,      "Bus node %u at %u baud stored, from the next boot") \
+    X(LOG_BUS_NODE_REJECTED,    "Bus node %u rejected") \
+    X(LOG_STATS_BUS,            "Bus node %u: %u polls answered, %u frames for other nodes skipped") \
+    X(LOG_USB_OPEN,             "Feeder on the USB port, opened %u times") \
+    X(LOG_USB_CLOSED,           "USB port closed after %u packets, back to UART4") \
+    X(LOG_STATS_USB,            "USB: open %u, %u packets, %u held for ring space, %u CRC errors, %u frames dropped") \
+    X(LOG_BENCH,                "Bench %s%s at %u aircraft: %u, budget %u") \
+    X(LOG_BENCH_OVER,           "Bench %s%s at %u aircraft: %u, over its budget of %u") \
+    X(LOG_BENCH_SKIPPED,        "Bench at %u aircraft skipped, MAX_AIRCRAFTS is %u") \
+    X(LOG_STATS_DETAIL,         "Radar detail %u, %u frames degraded, %u over budget, %u us worst") \
+    X(LOG_SCHEDULE_THREAD,      "Schedule %s%s: priority %u, every %u ms, %u us budget, %u us worst response") \
+    X(LOG_SCHEDULE_MISS,        "Schedule %s%s: priority %u, every %u ms, %u us budget, response %u us misses its period") \
+    X(LOG_SCHEDULE_TOTAL,       "Schedule: %u periodic threads at %u per mille, rate-monotonic bound %u, %u pairs out of rate-monotonic order") \
+    X(LOG_SCHEDULE_LATE,        "Schedule: %u periodic releases started late") \
+    X(LOG_STACK_UNGUARDED,      "Stack %s%s has no guard, every MPU region is taken") \
+    X(LOG_STACK_OVERFLOW,       "Stack %s%s overflowed into its guard at 0x%x, stack pointer 0x%x, resetting") \
+    X(LOG_STACK_OVERFLOW_RESET, "Reset after stack %s%s overflowed into its guard at 0x%x")
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+#define LOG_MESSAGE_ID(name, format) name,
+
+typedef enum {
+    LOG_MESSAGES(LOG_MESSAGE_ID)
+    LOG_MESSAGE_COUNT
+} LogMessage_t;
+
+#undef LOG_MESSAGE_ID
+
+/***********************************Structures**************************************/
+
+#endif /* LOG_MESSAGES_H_ */
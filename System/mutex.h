@@ -0,0 +1,73 @@
+/***************************************************************************************
+ * @file        mutex.h
+ * @brief       Wait statistics for the locks on the aircraft tables and the SPI bus.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The locks are G8RTOS binary semaphores. The kernel has no priority inheritance or
+ * ceiling, so a holder can still be preempted by middle-priority threads while a higher
+ * one waits on it. What keeps that short is how the locks are used: Display_Thread reads
+ * the live store through seq_CURRENT_AIRCRAFTS and never takes its lock, a writer holds
+ * it for a pass or two over the table at most, and sem_SPIA is held for one paint.
+ *
+ * Mutex_LockCounted waits on such a semaphore and times the wait into a MutexStats_t,
+ * for the debug console. A lock that took longer than MUTEX_WAIT_US found the semaphore
+ * taken, or was preempted on its way in, and counts as a wait. The counters are only
+ * written with the semaphore held.
+ *
+***************************************************************************************/
+
+#ifndef MUTEX_H_
+#define MUTEX_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "./clock.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define MUTEX_WAIT_US       2
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t locks;
+    uint32_t waits;         // locks that took longer than MUTEX_WAIT_US
+    uint32_t wait_us;       // all waits together
+    uint32_t worst_wait_us;
+} MutexStats_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+static inline void Mutex_LockCounted(semaphore_t *lock, MutexStats_t *stats) {
+    uint32_t start = Clock_Micros();
+    G8RTOS_WaitSemaphore(lock);
+    uint32_t waited = Clock_Micros() - start;
+
+    stats->locks++;
+    if (waited > MUTEX_WAIT_US) {
+        stats->waits++;
+        stats->wait_us += waited;
+        if (waited > stats->worst_wait_us)
+            stats->worst_wait_us = waited;
+    }
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* MUTEX_H_ */
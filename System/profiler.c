@@ -0,0 +1,314 @@
+/***************************************************************************************
+ * @file        profiler.c
+ * @brief       Per-thread and per-interrupt CPU time from the DWT cycle counter.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./profiler.h"
+#include "./log.h"
+
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+/************************************Includes***************************************/
+
+#if PROFILE_ENABLE
+
+/*************************************Defines***************************************/
+
+// Debug and trace registers, not covered by hw_nvic.h
+#define PROFILE_DEMCR           0xE000EDFC
+#define PROFILE_DEMCR_TRCENA    0x01000000
+#define PROFILE_DWT_CTRL        0xE0001000
+#define PROFILE_DWT_CYCCNTENA   0x00000001
+#define PROFILE_DWT_CYCCNT      0xE0001004
+
+#define CYCLES()                HWREG(PROFILE_DWT_CYCCNT)
+
+#define NAME_SIZE               8
+
+// The thread function's own frame sits above the marker in Profile_RegisterThread
+#define STACK_SLACK             256
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t busy;          // cycles spent running
+    uint32_t max_slice;     // longest single run
+    uint32_t runs;          // slices for threads, entries for interrupts
+    uint32_t preempted;     // runs cut short by SysTick or a nested interrupt
+} ProfileCounters_t;
+
+typedef struct {
+    uint8_t context;
+    uint32_t start;
+    uint32_t nested;        // cycles taken by interrupts nested inside this one
+} ProfileIsrFrame_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+// For profiler_hooks.asm, which jumps on to whatever handled these before
+void (*profile_original_pendsv)(void);
+void (*profile_original_systick)(void);
+
+extern void Profile_PendSV_Handler(void);
+extern void Profile_SysTick_Handler(void);
+
+static const char NAMES[PROFILE_CONTEXTS][NAME_SIZE] = {
+    "Process", "Swap", "Extrap", "Display", "Select", "Range", "Report", "Link", "Snapsht", "Conflct", "Idle", "Other",
+    "UART4", "Buttons", "Joystck", "SSI3", "Timer1A", "ADC1", "UART0", "USB0"
+};
+
+static ProfileCounters_t counters[PROFILE_CONTEXTS];
+
+// The last complete window, kept until a query asks for it
+static ProfileCounters_t sampled[PROFILE_CONTEXTS];
+static uint32_t sampled_window = 0;
+
+// Longest slice of each context over every window since boot
+static uint32_t worst_slice[PROFILE_CONTEXTS];
+
+// Just above the highest stack address each thread uses, 0 until it registers
+static uint32_t stack_tops[PROFILE_THREADS];
+
+static bool hooked = false;
+static uint32_t cycles_per_us = 1;
+static uint32_t window_start = 0;
+
+// The slice running right now
+static uint32_t slice_start = 0;
+static uint32_t slice_isr_cycles = 0;
+static bool slice_ticked = false;
+
+static ProfileIsrFrame_t isr_stack[PROFILE_MAX_NESTING];
+static uint32_t isr_depth = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Finds the thread a stack pointer belongs to.
+ *
+ * Stacks grow down, so it's the registered thread with the closest top at or above it.
+ */
+static ProfileContext_t thread_for_stack(uint32_t stack_pointer) {
+    ProfileContext_t context = PROFILE_OTHER;
+    uint32_t closest = UINT32_MAX;
+
+    for (uint32_t i = 0; i < PROFILE_THREADS; i++) {
+        if (stack_tops[i] >= stack_pointer && stack_tops[i] - stack_pointer < closest) {
+            closest = stack_tops[i] - stack_pointer;
+            context = (ProfileContext_t)i;
+        }
+    }
+
+    return context;
+}
+
+static void count_run(ProfileCounters_t *counter, uint32_t cycles, bool preempted) {
+    counter->busy += cycles;
+    counter->runs++;
+    if (cycles > counter->max_slice)
+        counter->max_slice = cycles;
+    if (preempted)
+        counter->preempted++;
+}
+
+/**
+ * @brief Puts the switch hooks in front of the scheduler's handlers.
+ *
+ * G8RTOS registers its handlers when it launches, so this waits for the first thread.
+ */
+static void install_hooks(void) {
+    void (**vectors)(void) = (void (**)(void))HWREG(NVIC_VTABLE);
+
+    profile_original_pendsv = vectors[FAULT_PENDSV];
+    profile_original_systick = vectors[FAULT_SYSTICK];
+
+    slice_start = CYCLES();
+    slice_isr_cycles = 0;
+    slice_ticked = false;
+
+    IntRegister(FAULT_PENDSV, Profile_PendSV_Handler);
+    IntRegister(FAULT_SYSTICK, Profile_SysTick_Handler);
+    hooked = true;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts the DWT cycle counter.
+ *
+ * Must be called after the system clock is set.
+ */
+void Profile_Init(void) {
+    HWREG(PROFILE_DEMCR) |= PROFILE_DEMCR_TRCENA;
+    HWREG(PROFILE_DWT_CYCCNT) = 0;
+    HWREG(PROFILE_DWT_CTRL) |= PROFILE_DWT_CYCCNTENA;
+
+    cycles_per_us = SysCtlClockGet() / 1000000;
+    window_start = CYCLES();
+}
+
+/**
+ * @brief Tells the profiler which stack belongs to the calling thread.
+ *
+ * Call once at the top of the thread function, before its loop.
+ */
+void Profile_RegisterThread(ProfileContext_t context) {
+    volatile uint32_t marker = 0;
+
+    bool masked = IntMasterDisable();
+
+    if (context < PROFILE_THREADS)
+        stack_tops[context] = (uint32_t)&marker + STACK_SLACK;
+    if (!hooked)
+        install_hooks();
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Marks the start of an interrupt handler's work.
+ */
+void Profile_IsrEnter(ProfileContext_t context) {
+    bool masked = IntMasterDisable();
+
+    if (isr_depth < PROFILE_MAX_NESTING) {
+        isr_stack[isr_depth].context = context;
+        isr_stack[isr_depth].start = CYCLES();
+        isr_stack[isr_depth].nested = 0;
+    }
+    isr_depth++;
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Marks the end of the innermost handler started with Profile_IsrEnter.
+ */
+void Profile_IsrExit(void) {
+    bool masked = IntMasterDisable();
+
+    isr_depth--;
+    if (isr_depth < PROFILE_MAX_NESTING) {
+        ProfileIsrFrame_t *frame = &isr_stack[isr_depth];
+        uint32_t elapsed = CYCLES() - frame->start;
+
+        count_run(&counters[frame->context], elapsed - frame->nested, frame->nested != 0);
+
+        // Whatever this interrupted doesn't get charged for it
+        if (isr_depth > 0)
+            isr_stack[isr_depth - 1].nested += elapsed;
+        else
+            slice_isr_cycles += elapsed;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Ends the running thread's slice, called from the PendSV hook.
+ *
+ * @param stack_pointer Stack pointer of the thread being switched out.
+ */
+void Profile_ContextSwitch(uint32_t stack_pointer) {
+    bool masked = IntMasterDisable();
+
+    uint32_t now = CYCLES();
+    uint32_t elapsed = now - slice_start;
+    uint32_t busy = (elapsed > slice_isr_cycles) ? elapsed - slice_isr_cycles : 0;
+
+    count_run(&counters[thread_for_stack(stack_pointer)], busy, slice_ticked);
+
+    slice_start = now;
+    slice_isr_cycles = 0;
+    slice_ticked = false;
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Notes a scheduler tick, called from the SysTick hook.
+ *
+ * The tick pends the switch, so the slice it ends was preempted.
+ */
+void Profile_Tick(void) {
+    slice_ticked = true;
+}
+
+/**
+ * @brief Ends the current window, keeping it for Profile_Report, and starts a new one.
+ *
+ * Call every PROFILE_REPORT_MS, whether or not anyone asks for a report.
+ */
+void Profile_Sample(void) {
+    bool masked = IntMasterDisable();
+
+    uint32_t now = CYCLES();
+    sampled_window = now - window_start;
+    window_start = now;
+
+    for (uint32_t i = 0; i < PROFILE_CONTEXTS; i++) {
+        sampled[i] = counters[i];
+        counters[i] = (ProfileCounters_t){ 0 };
+        if (sampled[i].max_slice > worst_slice[i])
+            worst_slice[i] = sampled[i].max_slice;
+    }
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Logs every context's share of the last complete window.
+ */
+void Profile_Report(void) {
+    if (sampled_window == 0)
+        return;
+
+    for (uint32_t i = 0; i < PROFILE_CONTEXTS; i++) {
+        if (!sampled[i].runs)
+            continue;
+
+        // Per mille of the window, printed as a percentage with one decimal
+        uint32_t busy = (uint32_t)(((uint64_t)sampled[i].busy * 1000) / sampled_window);
+
+        LOG_INFO(LOG_PROFILE, LOG_TEXT(NAMES[i]), LOG_TEXT(NAMES[i] + 4), busy,
+                 sampled[i].max_slice / cycles_per_us, sampled[i].runs, sampled[i].preempted);
+    }
+}
+
+/**
+ * @brief Longest single slice a context ran for in any complete window, in microseconds.
+ */
+uint32_t Profile_WorstSliceUs(ProfileContext_t context) {
+    return worst_slice[context] / cycles_per_us;
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* PROFILE_ENABLE */
@@ -0,0 +1,111 @@
+/***************************************************************************************
+ * @file        profiler.h
+ * @brief       Per-thread and per-interrupt CPU time from the DWT cycle counter.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The G8RTOS PendSV and SysTick handlers are chained behind small hooks in
+ * profiler_hooks.asm, found through the vector table at run time, so every context
+ * switch is timestamped with DWT CYCCNT without touching the scheduler. The cycles since
+ * the previous switch, less any interrupt time inside them, are charged to the thread
+ * whose stack the switch happened on. A slice that ends right after a SysTick counts as
+ * preempted, anything else gave the CPU up by blocking or sleeping.
+ *
+ * Each thread calls Profile_RegisterThread when it starts so its stack can be recognised,
+ * and each interrupt handler brackets its work with Profile_IsrEnter/Profile_IsrExit.
+ * Profile_Sample closes a window every PROFILE_REPORT_MS and starts the next, and
+ * Profile_Report logs one line per context of the last closed window when the debug
+ * console asks for it, see console.h. With PROFILE_ENABLE set to 0 all of it compiles out.
+ *
+***************************************************************************************/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE      1
+#endif
+
+#define PROFILE_REPORT_MS   5000    // window length, must stay under 53 s at 80 MHz
+#define PROFILE_MAX_NESTING 8       // interrupts that can be nested inside each other
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    PROFILE_PROCESS,            // Process_New_Aircraft_Thread
+    PROFILE_SWAP,               // Update_Current_Aircrafts_Thread
+    PROFILE_EXTRAPOLATE,        // Extrapolate_Aircrafts_Thread
+    PROFILE_DISPLAY,            // Display_Thread
+    PROFILE_SELECT,             // Select_Aircraft_Thread
+    PROFILE_RANGE,              // Update_Search_Range
+    PROFILE_REPORT,             // Report_Stats_Thread
+    PROFILE_LINK,               // Link_Rate_Thread
+    PROFILE_SNAPSHOT,           // Save_Snapshot_Thread
+    PROFILE_CONFLICT,           // Detect_Conflicts_Thread
+    PROFILE_IDLE,               // Idle_Thread, including time asleep in WFI
+    PROFILE_OTHER,              // switches on a stack nobody registered
+    PROFILE_ISR_UART4,
+    PROFILE_ISR_BUTTONS,
+    PROFILE_ISR_JOYSTICK,
+    PROFILE_ISR_SSI3,
+    PROFILE_ISR_TIMER1A,
+    PROFILE_ISR_ADC1,
+    PROFILE_ISR_UART0,
+    PROFILE_ISR_USB0,
+    PROFILE_CONTEXTS
+} ProfileContext_t;
+
+#define PROFILE_THREADS     PROFILE_ISR_UART4   // contexts below this are threads
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+#if PROFILE_ENABLE
+
+void Profile_Init(void);
+void Profile_RegisterThread(ProfileContext_t context);
+
+void Profile_IsrEnter(ProfileContext_t context);
+void Profile_IsrExit(void);
+
+void Profile_Sample(void);
+void Profile_Report(void);
+uint32_t Profile_WorstSliceUs(ProfileContext_t context);
+
+// Called from profiler_hooks.asm only
+void Profile_ContextSwitch(uint32_t stack_pointer);
+void Profile_Tick(void);
+
+#else
+
+#define Profile_Init()                      ((void)0)
+#define Profile_RegisterThread(context)     ((void)0)
+#define Profile_IsrEnter(context)           ((void)0)
+#define Profile_IsrExit()                   ((void)0)
+#define Profile_Sample()                    ((void)0)
+#define Profile_Report()                    ((void)0)
+#define Profile_WorstSliceUs(context)       0u
+
+#endif
+
+/********************************Public Functions***********************************/
+
+#endif /* PROFILER_H_ */
@@ -0,0 +1,73 @@
+;***************************************************************************************
+; @file        profiler_hooks.asm
+; @brief       Context switch hooks for the profiler, chained in front of G8RTOS.
+;
+; @project     Final Project: Aircraft Display System
+;              Real-time display and management of aircraft data on a radar screen.
+;
+; @author      Cannon Spencer
+; @date        October 14, 2026
+; @university  University of Florida
+;
+; @details
+; Both hooks call into profiler.c and then branch to the handler they replaced, with the
+; stack and R4-R11 exactly as the exception left them, so the scheduler's context save
+; sees nothing different. R0-R3 and R12 are already stacked by the hardware.
+;
+;***************************************************************************************
+
+    .cdecls C, NOLIST, "profiler.h"
+
+    .if PROFILE_ENABLE
+
+    .thumb
+    .text
+    .align 4
+
+    .ref Profile_ContextSwitch
+    .ref Profile_Tick
+    .ref profile_original_pendsv
+    .ref profile_original_systick
+
+    .def Profile_PendSV_Handler
+    .def Profile_SysTick_Handler
+
+PendSVOriginal      .field  profile_original_pendsv, 32
+SysTickOriginal     .field  profile_original_systick, 32
+
+
+; Hands the outgoing thread's stack pointer to Profile_ContextSwitch
+Profile_PendSV_Handler: .asmfunc
+
+    ; EXC_RETURN bit 2 says which stack the thread was using
+    TST     LR, #4
+    ITE     EQ
+    MRSEQ   R0, MSP
+    MRSNE   R0, PSP
+
+    PUSH    {R4, LR}
+    BL      Profile_ContextSwitch
+    POP     {R4, LR}
+
+    LDR     R12, PendSVOriginal
+    LDR     R12, [R12]
+    BX      R12
+
+    .endasmfunc
+
+
+Profile_SysTick_Handler: .asmfunc
+
+    PUSH    {R4, LR}
+    BL      Profile_Tick
+    POP     {R4, LR}
+
+    LDR     R12, SysTickOriginal
+    LDR     R12, [R12]
+    BX      R12
+
+    .endasmfunc
+
+    .endif
+
+    .end
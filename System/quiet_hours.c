@@ -0,0 +1,235 @@
+/***************************************************************************************
+ * @file        quiet_hours.c
+ * @brief       Wall clock and quiet-hours hibernation on the Hibernation module.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Writes to the Hibernation module's registers wait for its slow clock, a few tens of
+ * microseconds each, so the RTC is only set when the feeder's clock has drifted from it.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./quiet_hours.h"
+#include "./log.h"
+
+#include <time.h>
+
+#include "G8RTOS/G8RTOS.h"
+#include "driverlib/hibernate.h"
+#include "driverlib/sysctl.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define MINUTES_PER_DAY         1440
+#define MAX_UTC_OFFSET_MIN      (14 * 60)
+
+// The RTC is left alone unless it is this far off the feeder's clock
+#define CLOCK_TOLERANCE_S       2
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+// The battery-backed words, see HibernateDataSet
+typedef struct {
+    uint32_t magic;
+    uint32_t window;            // quiet_start_min in the low half, quiet_end_min above
+    int32_t utc_offset_min;
+    uint32_t period_s;
+    uint32_t check;
+} ScheduleRecord_t;
+
+#define SCHEDULE_WORDS          (sizeof(ScheduleRecord_t) / sizeof(uint32_t))
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static ScheduleRecord_t schedule;
+static bool schedule_valid = false;
+
+static uint32_t wake_causes = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static uint32_t check_of(const ScheduleRecord_t *record) {
+    return ~(record->magic ^ record->window ^ (uint32_t)record->utc_offset_min ^ record->period_s);
+}
+
+static uint16_t start_min(void) {
+    return schedule.window & 0xFFFF;
+}
+
+static uint16_t end_min(void) {
+    return schedule.window >> 16;
+}
+
+/**
+ * @brief Seconds since local midnight.
+ */
+static uint32_t local_seconds(void) {
+    int64_t local = (int64_t)HibernateRTCGet() + (int64_t)schedule.utc_offset_min * 60;
+    int64_t day = (int64_t)MINUTES_PER_DAY * 60;
+
+    return (uint32_t)(((local % day) + day) % day);
+}
+
+/**
+ * @brief Seconds from now to the next time the local clock reads `minute`, never 0.
+ */
+static uint32_t seconds_until(uint16_t minute) {
+    int32_t seconds = (int32_t)minute * 60 - (int32_t)local_seconds();
+    if (seconds <= 0)
+        seconds += MINUTES_PER_DAY * 60;
+    return (uint32_t)seconds;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Starts the RTC, or finds it running, and reads back the schedule.
+ *
+ * Must be called before the scheduler is launched, and before anything asks whether it
+ * is quiet.
+ */
+void QuietHours_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_HIBERNATE);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_HIBERNATE));
+
+    // Already running means this boot may be a wake, and the battery-backed words are good
+    bool running = HibernateIsActive();
+    if (running) {
+        wake_causes = HibernateIntStatus(false);
+        HibernateIntClear(wake_causes);
+    }
+
+    HibernateEnableExpClk(SysCtlClockGet());
+    if (!running) {
+        HibernateClockConfig(HIBERNATE_OSC_LOWDRIVE);
+        HibernateRTCEnable();
+        return;
+    }
+
+    HibernateDataGet((uint32_t *)&schedule, SCHEDULE_WORDS);
+    schedule_valid = schedule.magic == QUIET_HOURS_MAGIC && schedule.check == check_of(&schedule);
+
+    if (QuietHours_WokeScheduled())
+        LOG_INFO(LOG_QUIET_WAKE, HibernateRTCGet());
+}
+
+/**
+ * @brief Sets the clock and the quiet hours a PROTOCOL_FRAME_SCHEDULE carries.
+ *
+ * A period shorter than QUIET_HOURS_MIN_PERIOD_S is raised to it. Call it from a thread.
+ *
+ * @return bool False if the schedule made no sense and was ignored.
+ */
+bool QuietHours_Set(const ProtocolSchedule_t *wire) {
+    if (wire->quiet_start_min >= MINUTES_PER_DAY || wire->quiet_end_min >= MINUTES_PER_DAY ||
+        wire->utc_offset_min > MAX_UTC_OFFSET_MIN || wire->utc_offset_min < -MAX_UTC_OFFSET_MIN) {
+        LOG_WARN(LOG_SCHEDULE_REJECTED, wire->quiet_start_min, wire->quiet_end_min, wire->utc_offset_min);
+        return false;
+    }
+
+    uint32_t now = HibernateRTCGet();
+    if (now - wire->utc_seconds + CLOCK_TOLERANCE_S > 2 * CLOCK_TOLERANCE_S)
+        HibernateRTCSet(wire->utc_seconds);
+
+    ScheduleRecord_t record = {
+        QUIET_HOURS_MAGIC,
+        wire->quiet_start_min | ((uint32_t)wire->quiet_end_min << 16),
+        wire->utc_offset_min,
+        (wire->period_s < QUIET_HOURS_MIN_PERIOD_S) ? QUIET_HOURS_MIN_PERIOD_S : wire->period_s,
+        0
+    };
+    record.check = check_of(&record);
+
+    // Sent with every keyframe, only a change is written and logged
+    if (schedule_valid && record.window == schedule.window && record.utc_offset_min == schedule.utc_offset_min &&
+        record.period_s == schedule.period_s)
+        return true;
+
+    schedule = record;
+    schedule_valid = true;
+    HibernateDataSet((uint32_t *)&schedule, SCHEDULE_WORDS);
+    LOG_INFO(LOG_SCHEDULE, start_min(), end_min(), schedule.period_s);
+    return true;
+}
+
+/**
+ * @brief True in the quiet hours, false outside them or with no schedule.
+ */
+bool QuietHours_IsQuiet(void) {
+    if (!schedule_valid || start_min() == end_min())
+        return false;
+
+    uint16_t minute = local_seconds() / 60;
+    if (start_min() < end_min())
+        return minute >= start_min() && minute < end_min();
+    return minute >= start_min() || minute < end_min();
+}
+
+/**
+ * @brief Milliseconds until the quiet hours next start or end, 0 if they never do.
+ */
+uint32_t QuietHours_MsUntilChange(void) {
+    if (!schedule_valid || start_min() == end_min())
+        return 0;
+
+    return seconds_until(QuietHours_IsQuiet() ? end_min() : start_min()) * 1000;
+}
+
+/**
+ * @brief True if this boot is the RTC waking the unit from hibernation.
+ */
+bool QuietHours_WokeScheduled(void) {
+    return (wake_causes & HIBERNATE_INT_RTC_MATCH_0) != 0;
+}
+
+/**
+ * @brief True if this boot is a press on the WAKE pin ending a hibernation.
+ */
+bool QuietHours_WokeByPin(void) {
+    return (wake_causes & HIBERNATE_INT_PIN_WAKE) != 0;
+}
+
+/**
+ * @brief Hibernates until the next wake, or the end of the quiet hours if that is sooner.
+ *
+ * Everything worth keeping must be in flash already, and the panel asleep. Call it from
+ * a thread, it never returns: the unit comes back through a reset.
+ */
+void QuietHours_Hibernate(void) {
+    uint32_t sleep_s = schedule.period_s;
+    uint32_t until_end_s = seconds_until(end_min());
+    if (until_end_s < sleep_s)
+        sleep_s = until_end_s;
+
+    LOG_INFO(LOG_HIBERNATE, sleep_s);
+
+    HibernateRTCMatchSet(0, HibernateRTCGet() + sleep_s);
+    HibernateIntClear(HIBERNATE_INT_RTC_MATCH_0 | HIBERNATE_INT_PIN_WAKE);
+    HibernateWakeSet(HIBERNATE_WAKE_RTC | HIBERNATE_WAKE_PIN);
+    HibernateRequest();
+
+    // Power goes within a few cycles of the slow clock
+    while (1) {
+        sleep(1000);
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,71 @@
+/***************************************************************************************
+ * @file        quiet_hours.h
+ * @brief       Wall clock and quiet-hours hibernation on the Hibernation module.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The Hibernation module's RTC counts seconds off the 32.768 kHz crystal and keeps going
+ * through hibernation and resets, as long as VBAT holds. The feeder sets it from its own
+ * clock with a PROTOCOL_FRAME_SCHEDULE frame, which also carries the quiet hours: a span
+ * of local time, and how often the unit wakes during it. The schedule is kept in the
+ * module's battery-backed words, so it outlives the hibernation that loses SRAM.
+ *
+ * In quiet hours the unit spends most of its time hibernating, with the panel asleep:
+ *
+ *      1. The RTC match wakes it one period after it went down, which is a reset. The
+ *         warm start puts the last saved picture back.
+ *      2. Its view reports carry PROTOCOL_VIEW_QUIET, and the feeder answers each wake
+ *         with one keyframe instead of its usual stream.
+ *      3. Once the burst is live and drawn it is saved to flash, and the unit goes back
+ *         down. A wake that gets no burst gives up after QUIET_HOURS_AWAKE_MS.
+ *
+ * A wake is never closer than QUIET_HOURS_MIN_PERIOD_S, the same rate the traffic
+ * snapshot is saved at during the day, so the flash wears no faster. Input in quiet
+ * hours holds the unit up for QUIET_HOURS_HOLD_MS. The joystick and buttons can't wake
+ * a hibernating unit, only a button on the WAKE pin can.
+ *
+***************************************************************************************/
+
+#ifndef QUIET_HOURS_H_
+#define QUIET_HOURS_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Link/protocol.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define QUIET_HOURS_MIN_PERIOD_S    300     // shortest time between wakes, see above
+#define QUIET_HOURS_AWAKE_MS        30000   // a wake that gets no burst goes back down after this
+#define QUIET_HOURS_HOLD_MS         60000   // input keeps the unit up this long in quiet hours
+
+#define QUIET_HOURS_MAGIC           0x54495551  // "QUIT", first battery-backed word
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void QuietHours_Init(void);
+bool QuietHours_Set(const ProtocolSchedule_t *schedule);
+
+bool QuietHours_IsQuiet(void);
+uint32_t QuietHours_MsUntilChange(void);
+bool QuietHours_WokeScheduled(void);
+bool QuietHours_WokeByPin(void);
+
+void QuietHours_Hibernate(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* QUIET_HOURS_H_ */
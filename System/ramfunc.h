@@ -0,0 +1,63 @@
+/***************************************************************************************
+ * @file        ramfunc.h
+ * @brief       Placement of hot code in SRAM and of lookup tables in aligned flash.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * At 80 MHz the core runs twice as fast as the flash, so a tight loop fetched from flash
+ * stalls whenever it leaves the prefetch buffer. Functions marked RAMFUNC go in
+ * .TI.ramfunc instead, which tm4c123gh6pm.cmd loads into flash and runs from SRAM. ResetISR
+ * copies them over before the C runtime starts, so they are in place before main and
+ * before any interrupt. Calls between flash and SRAM are farther apart than a BL reaches,
+ * and the linker puts in the trampolines for them.
+ *
+ * Only the UART4 receive path, the frame decoder, the projection batches and the strip
+ * renderer's fill loops are marked. Every byte of them is a byte less for the arena, and
+ * Arena_Report counts them in its SRAM line. RAMFUNC_ENABLE=0 leaves everything in flash.
+ *
+ * They run from SRAM_CODE, the top RAMFUNC_MAX_BYTES of SRAM, which tm4c123gh6pm.cmd
+ * keeps out of the range the data and stacks go in. More marked code than that fails
+ * the link instead of crowding out the stacks, and System/arena.c takes the whole range
+ * out of its SRAM budget. The functions above build to about 1.7 KB for the simulator,
+ * the rest is for the trampolines and the DMA receive path the simulator leaves out.
+ *
+ * Tables marked FLASH_LUT go in .lut, on a 32-byte boundary, so each starts a fresh flash
+ * fetch and the small ones take as few as they can.
+ *
+ * Neither does anything in the host simulator.
+ *
+***************************************************************************************/
+
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+/*************************************Defines***************************************/
+
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE      1
+#endif
+
+#define RAMFUNC_MAX_BYTES   2048    // SRAM_CODE in tm4c123gh6pm.cmd, keep the two in step
+#define FLASH_LUT_ALIGN     32
+
+#if defined(ccs) && RAMFUNC_ENABLE
+#define RAMFUNC             __attribute__((ramfunc))
+#else
+#define RAMFUNC
+#endif
+
+#if defined(ccs)
+#define FLASH_LUT           __attribute__((section(".lut"), aligned(FLASH_LUT_ALIGN)))
+#else
+#define FLASH_LUT
+#endif
+
+/*************************************Defines***************************************/
+
+#endif /* RAMFUNC_H_ */
@@ -0,0 +1,162 @@
+/***************************************************************************************
+ * @file        ramfunc_bench.c
+ * @brief       Boot-time cycle counts of the kernels ramfunc.h places in SRAM.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./ramfunc_bench.h"
+#include "./ramfunc.h"
+#include "./log.h"
+
+#include "Link/protocol.h"
+#include "Radar/projection.h"
+#include "Display/strip_renderer.h"
+#include "Display/screen_geometry.h"
+
+#include "inc/hw_types.h"
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+#if RAMFUNC_BENCH
+
+/*************************************Defines***************************************/
+
+// Debug and trace registers, as in profiler.c
+#define BENCH_DEMCR             0xE000EDFC
+#define BENCH_DEMCR_TRCENA      0x01000000
+#define BENCH_DWT_CTRL          0xE0001000
+#define BENCH_DWT_CYCCNTENA     0x00000001
+#define BENCH_DWT_CYCCNT        0xE0001004
+
+#define CYCLES()                HWREG(BENCH_DWT_CYCCNT)
+
+#define CANVAS_SIZE             17
+#define FILL_RADIUS             8
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static ProtocolFrame_t frames[RAMFUNC_BENCH_FRAMES];
+static ProtocolDecoder_t decoder;
+
+static Projection_t projection;
+static int32_t longitude[RAMFUNC_BENCH_POINTS];
+static int32_t latitude[RAMFUNC_BENCH_POINTS];
+static int16_t offset_x[RAMFUNC_BENCH_POINTS];
+static int16_t offset_y[RAMFUNC_BENCH_POINTS];
+static int16_t screen_x[RAMFUNC_BENCH_POINTS];
+static int16_t screen_y[RAMFUNC_BENCH_POINTS];
+static uint8_t on_screen[RAMFUNC_BENCH_POINTS];
+
+static uint16_t pixels[CANVAS_SIZE * CANVAS_SIZE];
+static const StripCanvas_t canvas = { pixels, { 0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1 }, CANVAS_SIZE };
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static void decode(void) {
+    const uint8_t *data = (const uint8_t *)frames;
+    uint32_t length = sizeof(frames);
+    bool ready;
+
+    Protocol_InitDecoder(&decoder);
+    while (length > 0) {
+        uint32_t consumed = Protocol_Decode(&decoder, data, length, &ready);
+        data += consumed;
+        length -= consumed;
+    }
+}
+
+static void offset(void) {
+    Projection_OffsetBatch(&projection, longitude, latitude, RAMFUNC_BENCH_POINTS, offset_x, offset_y);
+}
+
+static void scale(void) {
+    Projection_ScaleBatch(&projection, offset_x, offset_y, RAMFUNC_BENCH_POINTS, screen_x, screen_y, on_screen);
+}
+
+static void fill(void) {
+    StripCanvas_FillCircle(&canvas, FILL_RADIUS, FILL_RADIUS, FILL_RADIUS, 0xFFFF);
+}
+
+/**
+ * @brief Fewest cycles a kernel took in RAMFUNC_BENCH_RUNS runs, so the first run's
+ *        cold prefetch and any stray stall don't count.
+ */
+static uint32_t best_of(void (*kernel)(void)) {
+    uint32_t best = UINT32_MAX;
+
+    for (uint32_t run = 0; run < RAMFUNC_BENCH_RUNS; run++) {
+        bool masked = IntMasterDisable();
+        uint32_t start = CYCLES();
+        kernel();
+        uint32_t cycles = CYCLES() - start;
+        if (!masked)
+            IntMasterEnable();
+
+        if (cycles < best)
+            best = cycles;
+    }
+
+    return best;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Times each kernel and logs the results.
+ *
+ * Call from main once the clock is set, before the scheduler is launched.
+ */
+void RamfuncBench_Run(void) {
+    HWREG(BENCH_DEMCR) |= BENCH_DEMCR_TRCENA;
+    HWREG(BENCH_DWT_CTRL) |= BENCH_DWT_CYCCNTENA;
+
+    for (uint32_t i = 0; i < RAMFUNC_BENCH_FRAMES; i++) {
+        ProtocolAircraft_t aircraft = { 0xA00000 + i, "BENCH  ", -823533 + 100 * i, 296465 - 100 * i,
+                                        30000000, 2500000, 900000 };
+        Protocol_EncodeFrame(&frames[i], PROTOCOL_FRAME_AIRCRAFT, &aircraft, sizeof(aircraft));
+    }
+
+    // A spread of positions across 100 km around Gainesville
+    Projection_Init(&projection, 29.6465f, -82.3533f, RADAR_CENTER_X, RADAR_CENTER_Y, RADAR_RADIUS_PX);
+    Projection_SetRange(&projection, 50);
+    for (int32_t i = 0; i < RAMFUNC_BENCH_POINTS; i++) {
+        longitude[i] = -82353300 + (i - RAMFUNC_BENCH_POINTS / 2) * 31000;
+        latitude[i] = 29646500 + ((i * 7) % RAMFUNC_BENCH_POINTS - RAMFUNC_BENCH_POINTS / 2) * 27000;
+    }
+    offset();
+
+    const struct {
+        const char *name;
+        void (*kernel)(void);
+    } KERNELS[] = {
+        { "decode  ", decode },
+        { "offset  ", offset },
+        { "scale   ", scale },
+        { "fill    ", fill },
+    };
+
+    for (uint32_t i = 0; i < sizeof(KERNELS) / sizeof(KERNELS[0]); i++) {
+        LOG_INFO(LOG_RAMFUNC_BENCH, LOG_TEXT(KERNELS[i].name), LOG_TEXT(KERNELS[i].name + 4),
+                 best_of(KERNELS[i].kernel), RAMFUNC_ENABLE);
+    }
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* RAMFUNC_BENCH */
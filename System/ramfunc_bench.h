@@ -0,0 +1,52 @@
+/***************************************************************************************
+ * @file        ramfunc_bench.h
+ * @brief       Boot-time cycle counts of the kernels ramfunc.h places in SRAM.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * With RAMFUNC_BENCH set to 1, main times each kernel on fixed input before the scheduler
+ * starts and logs the best of RAMFUNC_BENCH_RUNS runs in DWT cycles, with interrupts
+ * masked. Building once with RAMFUNC_ENABLE=1 and once with 0 and comparing the two logs
+ * gives the difference SRAM makes:
+ *
+ *      decode      4 aircraft frames through Protocol_Decode, CRC included
+ *      offset      Projection_OffsetBatch over RAMFUNC_BENCH_POINTS positions
+ *      scale       Projection_ScaleBatch over the same offsets
+ *      fill        a radius 8 StripCanvas_FillCircle, the spans the strip renderer draws
+ *
+ * The buffers only exist in that build. Without it RamfuncBench_Run compiles to nothing.
+ *
+***************************************************************************************/
+
+#ifndef RAMFUNC_BENCH_H_
+#define RAMFUNC_BENCH_H_
+
+/*************************************Defines***************************************/
+
+#ifndef RAMFUNC_BENCH
+#define RAMFUNC_BENCH           0
+#endif
+
+#define RAMFUNC_BENCH_RUNS      16
+#define RAMFUNC_BENCH_POINTS    32
+#define RAMFUNC_BENCH_FRAMES    4
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+#if RAMFUNC_BENCH
+void RamfuncBench_Run(void);
+#else
+#define RamfuncBench_Run()      ((void)0)
+#endif
+
+/********************************Public Functions***********************************/
+
+#endif /* RAMFUNC_BENCH_H_ */
@@ -0,0 +1,200 @@
+/***************************************************************************************
+ * @file        schedule.c
+ * @brief       Thread priorities, periods and execution budgets in one table, and a
+ *              fixed-priority schedulability check over them.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Times are kept in microseconds through the analysis, a response iteration adds whole
+ * releases of the threads above, so it only ever grows and stops at the period.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./schedule.h"
+
+#include "G8RTOS/G8RTOS.h"
+#include "System/clock.h"
+#include "System/log.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define BOUND_COUNT     12
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    ProfileContext_t context;
+    uint8_t priority;
+    uint32_t period_ms;
+    uint32_t wcet_us;
+    const char *name;
+} ScheduleThread_t;
+
+#define SCHEDULE_THREAD(thread, context, priority, period_ms, wcet_us, name) \
+    { context, priority, period_ms, wcet_us, name },
+
+static const ScheduleThread_t THREADS[] = {
+    SCHEDULE_THREADS(SCHEDULE_THREAD)
+};
+
+#undef SCHEDULE_THREAD
+
+#define THREAD_COUNT    (sizeof(THREADS) / sizeof(THREADS[0]))
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+// n(2^(1/n) - 1) in per mille, the utilization n threads are always schedulable under
+static const uint16_t BOUNDS[BOUND_COUNT] = { 1000, 828, 780, 757, 743, 735, 729, 724, 721, 718, 715, 714 };
+
+static uint32_t late_releases = 0;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Worst response of one thread, or the first iteration past its period.
+ */
+static uint32_t response_time(uint32_t i, const uint32_t *wcet_us) {
+    uint32_t deadline = THREADS[i].period_ms * 1000;
+    uint32_t response = wcet_us[i];
+
+    while (1) {
+        uint32_t next = wcet_us[i];
+
+        for (uint32_t j = 0; j < THREAD_COUNT; j++) {
+            if (j == i || THREADS[j].period_ms == 0 || THREADS[j].priority > THREADS[i].priority)
+                continue;
+
+            uint32_t period_us = THREADS[j].period_ms * 1000;
+            next += ((response + period_us - 1) / period_us) * wcet_us[j];
+        }
+
+        if (next == response || next > deadline)
+            return next;
+        response = next;
+    }
+}
+
+/**
+ * @brief Logs every periodic thread's worst response and the totals, for a set of execution times.
+ */
+static void analyse(const uint32_t *wcet_us) {
+    uint32_t threads = 0;
+    uint32_t utilization = 0;
+    uint32_t inversions = 0;
+
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        const ScheduleThread_t *thread = &THREADS[i];
+        if (thread->period_ms == 0)
+            continue;
+
+        threads++;
+        utilization += wcet_us[i] / thread->period_ms;
+
+        // Rate-monotonic order has the shorter period at the higher priority
+        for (uint32_t j = 0; j < THREAD_COUNT; j++) {
+            if (THREADS[j].period_ms != 0 && thread->period_ms < THREADS[j].period_ms &&
+                thread->priority > THREADS[j].priority)
+                inversions++;
+        }
+
+        uint32_t response = response_time(i, wcet_us);
+        if (response > thread->period_ms * 1000) {
+            LOG_WARN(LOG_SCHEDULE_MISS, LOG_TEXT(thread->name), LOG_TEXT(thread->name + 4), thread->priority,
+                     thread->period_ms, wcet_us[i], response);
+        } else {
+            LOG_INFO(LOG_SCHEDULE_THREAD, LOG_TEXT(thread->name), LOG_TEXT(thread->name + 4), thread->priority,
+                     thread->period_ms, wcet_us[i], response);
+        }
+    }
+
+    if (threads == 0)
+        return;
+
+    uint32_t bound = BOUNDS[((threads < BOUND_COUNT) ? threads : BOUND_COUNT) - 1];
+    LOG_INFO(LOG_SCHEDULE_TOTAL, threads, utilization, bound, inversions);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Adds every thread in SCHEDULE_THREADS to G8RTOS at its priority, in table order.
+ */
+void Schedule_AddThreads(void) {
+#define SCHEDULE_ADD(thread, context, priority, period_ms, wcet_us, name) \
+    G8RTOS_AddThread(thread, priority, #thread);
+
+    SCHEDULE_THREADS(SCHEDULE_ADD)
+
+#undef SCHEDULE_ADD
+}
+
+/**
+ * @brief Response-time analysis of the budgets in SCHEDULE_THREADS, logged at boot.
+ */
+void Schedule_Check(void) {
+    uint32_t wcet_us[THREAD_COUNT];
+
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        wcet_us[i] = THREADS[i].wcet_us;
+    }
+    analyse(wcet_us);
+}
+
+/**
+ * @brief The same analysis with the longest slice each thread was measured at since boot.
+ */
+void Schedule_Report(void) {
+#if PROFILE_ENABLE
+    uint32_t wcet_us[THREAD_COUNT];
+
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        wcet_us[i] = Profile_WorstSliceUs(THREADS[i].context);
+    }
+    analyse(wcet_us);
+#endif
+
+    LOG_INFO(LOG_SCHEDULE_LATE, late_releases);
+}
+
+/**
+ * @brief Sleeps until the next release of a periodic thread.
+ *
+ * Releases are `period_ms` apart from the first call on. One that is already past when
+ * the thread gets here is counted late, and the grid starts over from now.
+ */
+void Schedule_WaitPeriod(SchedulePeriod_t *period, uint32_t period_ms) {
+    uint32_t now = Clock_Millis();
+
+    if (!period->started) {
+        period->next_ms = now;
+        period->started = true;
+    }
+
+    period->next_ms += period_ms;
+    if ((int32_t)(period->next_ms - now) < 0) {
+        late_releases++;
+        period->next_ms = now + period_ms;
+    }
+
+    sleep(period->next_ms - now);
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,124 @@
+/***************************************************************************************
+ * @file        schedule.h
+ * @brief       Thread priorities, periods and execution budgets in one table, and a
+ *              fixed-priority schedulability check over them.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * SCHEDULE_THREADS is the one place a thread's G8RTOS priority is set, lower numbers
+ * running first. Next to it are the period the thread is released at, or for a thread
+ * woken by an event the shortest time between wake-ups, and the worst-case execution
+ * time budgeted for one release. Threads with a period of 0 run in the background and
+ * are left out of the analysis.
+ *
+ *      Process     drains the receive ring, sized for 20 ms of frames at 1.5 Mbaud
+ *      Swap        publishes a keyframe, then sleeps 100 ms before the next one,
+ *                  AIRCRAFT_STAGING_ENABLE builds only
+ *      Extrap      dead reckons and ages the live store every tick
+ *      Range       rescales on every zoom step while a button is held
+ *      Display     one frame, the radar within RADAR_RENDERER_BUDGET_US
+ *      Select      samples the joystick while an aircraft is selected
+ *      Link        the link rate handshake and the receiver health checks
+ *      Conflict    a sort-and-sweep pass between bursts, CONFLICT_DETECTION_ENABLE builds only
+ *
+ * Schedule_Check runs response-time analysis at boot: each thread's worst response is
+ * its own budget plus every release of the threads at its priority or above that can
+ * fall inside it, iterated until it settles, and it has to settle within the thread's
+ * period. Threads sharing a priority are round-robin, so they count against each other.
+ * It logs each thread's response, the total utilization against the rate-monotonic
+ * bound for that many threads, and how many pairs of threads have their priorities the
+ * other way round from their periods.
+ *
+ * Schedule_Report does the same with the longest slice the profiler measured for each
+ * thread since boot in place of its budget, PROFILE_ENABLE builds only. A slice ends
+ * at any block or preemption, so a release cut in two reads short, see profiler.h.
+ * Interrupt time isn't modelled, the profiler shows it separately.
+ *
+ * Schedule_WaitPeriod releases a periodic thread on a fixed grid instead of sleeping a
+ * period after each run, so the period doesn't stretch by the work done in it.
+ *
+***************************************************************************************/
+
+#ifndef SCHEDULE_H_
+#define SCHEDULE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "threads.h"
+#include "Display/frame_scheduler.h"
+#include "Display/radar_renderer.h"
+#include "Link/link_rate.h"
+#include "Radar/dead_reckoning.h"
+#include "System/profiler.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SCHEDULE_INGEST_MS      20      // longest the receive ring is left to fill during a burst
+#define SCHEDULE_SWAP_MS        100     // Update_Current_Aircrafts_Thread's sleep after a publish
+
+// X(thread, profiler context, priority, period ms, WCET us, name padded to eight characters)
+// Threads only some builds have
+#if AIRCRAFT_STAGING_ENABLE
+#define SCHEDULE_SWAP_THREAD(X) \
+    X(Update_Current_Aircrafts_Thread,  PROFILE_SWAP,        2,   SCHEDULE_SWAP_MS,        8000,   "Swap    ")
+#else
+#define SCHEDULE_SWAP_THREAD(X)
+#endif
+
+#if CONFLICT_DETECTION_ENABLE
+#define SCHEDULE_CONFLICT_THREAD(X) \
+    X(Detect_Conflicts_Thread,          PROFILE_CONFLICT,    252, CONFLICT_PERIOD_MS,      20000,  "Conflct ")
+#else
+#define SCHEDULE_CONFLICT_THREAD(X)
+#endif
+
+#define SCHEDULE_THREADS(X) \
+    X(Idle_Thread,                      PROFILE_IDLE,        255, 0,                       0,      "Idle    ") \
+    X(Process_New_Aircraft_Thread,      PROFILE_PROCESS,     1,   SCHEDULE_INGEST_MS,      3000,   "Process ") \
+    SCHEDULE_SWAP_THREAD(X) \
+    X(Extrapolate_Aircrafts_Thread,     PROFILE_EXTRAPOLATE, 4,   DEAD_RECKONING_TICK_MS,  4000,   "Extrap  ") \
+    X(Report_Stats_Thread,              PROFILE_REPORT,      254, 0,                       0,      "Report  ") \
+    X(Update_Search_Range,              PROFILE_RANGE,       5,   ZOOM_FRAME_MS,           1000,   "Range   ") \
+    X(Display_Thread,                   PROFILE_DISPLAY,     4,   FRAME_INTERVAL_MS,       RADAR_RENDERER_BUDGET_US, "Display ") \
+    X(Select_Aircraft_Thread,           PROFILE_SELECT,      3,   INPUT_POLL_MS,           500,    "Select  ") \
+    X(Link_Rate_Thread,                 PROFILE_LINK,        5,   LINK_RATE_POLL_MS,       200,    "Link    ") \
+    X(Save_Snapshot_Thread,             PROFILE_SNAPSHOT,    253, 0,                       0,      "Snapsht ") \
+    SCHEDULE_CONFLICT_THREAD(X)
+
+#define SCHEDULE_ONE(thread, context, priority, period_ms, wcet_us, name)   + 1
+#define SCHEDULE_THREAD_COUNT   (0 SCHEDULE_THREADS(SCHEDULE_ONE))   // each with a STACK_WATCH_THREAD_BYTES stack
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t next_ms;           // next release
+    bool started;
+} SchedulePeriod_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Schedule_AddThreads(void);
+
+void Schedule_Check(void);
+void Schedule_Report(void);
+
+void Schedule_WaitPeriod(SchedulePeriod_t *period, uint32_t period_ms);
+
+/********************************Public Functions***********************************/
+
+#endif /* SCHEDULE_H_ */
@@ -0,0 +1,64 @@
+/***************************************************************************************
+ * @file        seqlock.c
+ * @brief       Sequence counter that lets readers take a table without locking it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The M4 has one core and no data cache, so program order is all the ordering needed.
+ * Keeping these calls out of line stops the compiler moving table accesses across them.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./seqlock.h"
+
+#include "G8RTOS/G8RTOS.h"
+
+/************************************Includes***************************************/
+
+/********************************Public Functions***********************************/
+
+void Seqlock_Init(seqlock_t *lock) {
+    lock->sequence = 0;
+}
+
+void Seqlock_WriteBegin(seqlock_t *lock) {
+    lock->sequence++;
+}
+
+void Seqlock_WriteEnd(seqlock_t *lock) {
+    lock->sequence++;
+}
+
+/**
+ * @brief Starts a read, once no write is in progress.
+ *
+ * @return uint32_t The counter to hand to Seqlock_ReadRetry.
+ */
+uint32_t Seqlock_ReadBegin(const seqlock_t *lock) {
+    uint32_t start;
+
+    // Give a preempted writer the CPU back
+    while ((start = lock->sequence) & 1)
+        sleep(1);
+
+    return start;
+}
+
+/**
+ * @brief Ends a read.
+ *
+ * @return bool True if a write happened since Seqlock_ReadBegin, read again.
+ */
+bool Seqlock_ReadRetry(const seqlock_t *lock, uint32_t start) {
+    return lock->sequence != start;
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,55 @@
+/***************************************************************************************
+ * @file        seqlock.h
+ * @brief       Sequence counter that lets readers take a table without locking it.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Writers bump the counter before and after every change, so it is odd while one is in
+ * progress. A reader notes the counter, reads what it needs, and reads again if the
+ * counter moved in the meantime. Writers never wait for readers, and readers never wait
+ * for each other. Writers still have to be serialized among themselves, by whatever lock
+ * already guards the table.
+ *
+ * A reader that finds a write in progress has preempted a lower priority writer, which
+ * can't finish while the reader spins, so Seqlock_ReadBegin sleeps until it has. Write
+ * sections must therefore never block, and never be entered from an interrupt.
+ *
+***************************************************************************************/
+
+#ifndef SEQLOCK_H_
+#define SEQLOCK_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    volatile uint32_t sequence;
+} seqlock_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void Seqlock_Init(seqlock_t *lock);
+
+void Seqlock_WriteBegin(seqlock_t *lock);
+void Seqlock_WriteEnd(seqlock_t *lock);
+
+uint32_t Seqlock_ReadBegin(const seqlock_t *lock);
+bool Seqlock_ReadRetry(const seqlock_t *lock, uint32_t start);
+
+/********************************Public Functions***********************************/
+
+#endif /* SEQLOCK_H_ */
@@ -0,0 +1,106 @@
+/***************************************************************************************
+ * @file        simd.h
+ * @brief       Packed 16-bit arithmetic on the Cortex-M4 DSP instructions.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A Simd16x2_t holds two signed 16-bit lanes in one register, the first in the lower
+ * half. Where the compiler offers the ACLE SIMD32 intrinsics, a lane-wise subtract is one
+ * SSUB16 and the sum of both lanes' products one SMUAD, which gives a squared distance
+ * from a packed offset in a single cycle. Anywhere else, the host simulator included, the
+ * same functions are done a lane at a time with identical results.
+ *
+ * SMUAD only stays in range while one product can be -32768 squared, so offsets that can
+ * reach both extremes are saturated to 15 bits with Simd_Saturate15 first.
+ *
+***************************************************************************************/
+
+#ifndef SIMD_H_
+#define SIMD_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define SIMD_NATIVE             1
+#else
+#define SIMD_NATIVE             0
+#endif
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef uint32_t Simd16x2_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+static inline Simd16x2_t Simd_Pack(int16_t low, int16_t high) {
+    return (uint16_t)low | ((uint32_t)(uint16_t)high << 16);
+}
+
+static inline int16_t Simd_Low(Simd16x2_t packed) {
+    return (int16_t)(packed & 0xFFFF);
+}
+
+static inline int16_t Simd_High(Simd16x2_t packed) {
+    return (int16_t)(packed >> 16);
+}
+
+/**
+ * @brief Clamps a value to [-16384, 16383].
+ */
+static inline int16_t Simd_Saturate15(int32_t value) {
+#if SIMD_NATIVE
+    return (int16_t)__ssat(value, 15);
+#else
+    return value < -16384 ? -16384 : value > 16383 ? 16383 : (int16_t)value;
+#endif
+}
+
+/**
+ * @brief Lane-wise a - b, saturating.
+ */
+static inline Simd16x2_t Simd_Sub(Simd16x2_t a, Simd16x2_t b) {
+#if SIMD_NATIVE
+    return (Simd16x2_t)__qsub16((int16x2_t)a, (int16x2_t)b);
+#else
+    int32_t low = (int32_t)Simd_Low(a) - Simd_Low(b);
+    int32_t high = (int32_t)Simd_High(a) - Simd_High(b);
+    low = low < INT16_MIN ? INT16_MIN : low > INT16_MAX ? INT16_MAX : low;
+    high = high < INT16_MIN ? INT16_MIN : high > INT16_MAX ? INT16_MAX : high;
+    return Simd_Pack((int16_t)low, (int16_t)high);
+#endif
+}
+
+/**
+ * @brief Sum of the lane-wise products, a.low * b.low + a.high * b.high.
+ */
+static inline int32_t Simd_Dot(Simd16x2_t a, Simd16x2_t b) {
+#if SIMD_NATIVE
+    return __smuad((int16x2_t)a, (int16x2_t)b);
+#else
+    return (int32_t)Simd_Low(a) * Simd_Low(b) + (int32_t)Simd_High(a) * Simd_High(b);
+#endif
+}
+
+/**
+ * @brief Squared length of a packed offset, for offsets saturated to 15 bits.
+ */
+static inline int32_t Simd_LengthSquared(Simd16x2_t offset) {
+    return Simd_Dot(offset, offset);
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* SIMD_H_ */
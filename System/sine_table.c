@@ -0,0 +1,114 @@
+/***************************************************************************************
+ * @file        sine_table.c
+ * @brief       Fixed-point sine, cosine and angle from a quarter-wave table in flash.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./sine_table.h"
+#include "./ramfunc.h"
+
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+// round(sin(d) * SINE_TABLE_ONE) for d = 0 to 90 degrees
+FLASH_LUT static const int16_t QUARTER_WAVE[91] = {
+        0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+     5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+    16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+    21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+    25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+    28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+    30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+    32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+    32767
+};
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sine of a whole number of degrees, any sign or size.
+ *
+ * @return int16_t Q15, SINE_TABLE_ONE for 1.0.
+ */
+int16_t SineTable_Sin(int32_t degrees) {
+    degrees %= 360;
+    if (degrees < 0)
+        degrees += 360;
+
+    if (degrees <= 90)
+        return QUARTER_WAVE[degrees];
+    if (degrees <= 180)
+        return QUARTER_WAVE[180 - degrees];
+    if (degrees <= 270)
+        return -QUARTER_WAVE[degrees - 180];
+    return -QUARTER_WAVE[360 - degrees];
+}
+
+int16_t SineTable_Cos(int32_t degrees) {
+    return SineTable_Sin(degrees + 90);
+}
+
+/**
+ * @brief Angle of a vector to the nearest whole degree.
+ *
+ * The vector is folded into the first octant, where the angle is the first degree whose
+ * tangent reaches the slope, or the one before it if that is closer.
+ *
+ * @return int32_t 0 to 359, counterclockwise from +x towards +y, so SineTable_Cos of it
+ *                 points along x and SineTable_Sin along y. 0 for a zero vector.
+ */
+int32_t SineTable_Atan2(int32_t y, int32_t x) {
+    int64_t along = (x < 0) ? -(int64_t)x : x;
+    int64_t across = (y < 0) ? -(int64_t)y : y;
+
+    bool steep = across > along;
+    if (steep) {
+        int64_t swap = along;
+        along = across;
+        across = swap;
+    }
+
+    // tan(d) >= across / along, kept as a cross multiply
+    int32_t low = 0;
+    int32_t high = 45;
+    while (low < high) {
+        int32_t middle = (low + high) / 2;
+        if (along * QUARTER_WAVE[middle] >= across * QUARTER_WAVE[90 - middle])
+            high = middle;
+        else
+            low = middle + 1;
+    }
+
+    int32_t degrees = low;
+    if (degrees > 0) {
+        int64_t over = along * QUARTER_WAVE[degrees] - across * QUARTER_WAVE[90 - degrees];
+        int64_t under = across * QUARTER_WAVE[91 - degrees] - along * QUARTER_WAVE[degrees - 1];
+        if (under < over)
+            degrees--;
+    }
+
+    if (steep)
+        degrees = 90 - degrees;
+    if (x < 0)
+        degrees = 180 - degrees;
+    if (y < 0)
+        degrees = 360 - degrees;
+    return (degrees == 360) ? 0 : degrees;
+}
+
+/********************************Public Functions***********************************/
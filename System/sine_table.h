@@ -0,0 +1,46 @@
+/***************************************************************************************
+ * @file        sine_table.h
+ * @brief       Fixed-point sine, cosine and angle from a quarter-wave table in flash.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * 91 entries cover 0 to 90 degrees at 1 degree steps, and the other three quadrants are
+ * folded onto them, so a lookup is a modulo, a compare or two and a load. Results are
+ * Q15, SINE_TABLE_ONE for 1.0, which is plenty for anything drawn in whole pixels.
+ *
+ * SineTable_Atan2 goes the other way with the same table, a binary search of the first
+ * 45 degrees for the tangent, so a direction turns into whole degrees with no division.
+ *
+***************************************************************************************/
+
+#ifndef SINE_TABLE_H_
+#define SINE_TABLE_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SINE_TABLE_BITS     15
+#define SINE_TABLE_ONE      ((1 << SINE_TABLE_BITS) - 1)
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+int16_t SineTable_Sin(int32_t degrees);
+int16_t SineTable_Cos(int32_t degrees);
+int32_t SineTable_Atan2(int32_t y, int32_t x);
+
+/********************************Public Functions***********************************/
+
+#endif /* SINE_TABLE_H_ */
@@ -0,0 +1,224 @@
+/***************************************************************************************
+ * @file        site_config.c
+ * @brief       Per-unit settings kept in the on-chip EEPROM.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * EEPROMProgram busy-waits a few hundred microseconds a word, so a store is only made
+ * when something changed, never on a schedule, and one that changes nothing is skipped.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./site_config.h"
+
+#include <string.h>
+
+#include "driverlib/eeprom.h"
+#include "driverlib/sysctl.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define DISPLAY_TRACK           0x00010000  // DisplayRecord_t settings, above the range
+#define DISPLAY_CALLSIGN        0x00020000
+#define DISPLAY_TRAILS          0x00040000
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    uint32_t magic;
+    int32_t center_latitude;
+    int32_t center_longitude;
+    uint32_t check;
+} SiteRecord_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t settings;          // range_km in the low half, DISPLAY_* above
+    uint32_t check;
+} DisplayRecord_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t node;
+    uint32_t baud;
+    uint32_t check;
+} BusRecord_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static bool eeprom_ready = false;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Check word of a record, the last of its `count` words.
+ */
+static uint32_t check_of(const uint32_t *words, uint32_t count) {
+    uint32_t check = 0;
+    for (uint32_t i = 0; i + 1 < count; i++) {
+        check ^= words[i];
+    }
+    return ~check;
+}
+
+/**
+ * @brief Reads a record and tells whether it holds valid settings.
+ */
+static bool read_record(uint32_t address, uint32_t magic, uint32_t *words, uint32_t count) {
+    if (!eeprom_ready)
+        return false;
+
+    EEPROMRead(words, address, count * sizeof(uint32_t));
+    return words[0] == magic && words[count - 1] == check_of(words, count);
+}
+
+/**
+ * @brief Fills in a record's check word and writes it, unless it is stored already.
+ */
+static bool write_record(uint32_t address, uint32_t *words, uint32_t count) {
+    uint32_t stored[sizeof(SiteRecord_t) / sizeof(uint32_t)];
+
+    if (!eeprom_ready)
+        return false;
+
+    words[count - 1] = check_of(words, count);
+
+    // Every program wears the EEPROM, skip one that changes nothing
+    if (read_record(address, words[0], stored, count) && memcmp(stored, words, count * sizeof(uint32_t)) == 0)
+        return true;
+
+    return EEPROMProgram(words, address, count * sizeof(uint32_t)) == 0;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Powers up the EEPROM and recovers it from an interrupted write.
+ *
+ * Must be called before the scheduler is launched.
+ *
+ * @return bool False if the EEPROM can't be used, every load then fails.
+ */
+bool SiteConfig_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EEPROM0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_EEPROM0));
+
+    eeprom_ready = (EEPROMInit() == EEPROM_INIT_OK);
+    return eeprom_ready;
+}
+
+/**
+ * @brief Reads the stored radar center.
+ *
+ * @return bool False if nothing valid is stored, `config` is left untouched.
+ */
+bool SiteConfig_Load(SiteConfig_t *config) {
+    SiteRecord_t record;
+
+    if (!read_record(SITE_CONFIG_ADDRESS, SITE_CONFIG_MAGIC, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t)))
+        return false;
+
+    config->center_latitude = record.center_latitude;
+    config->center_longitude = record.center_longitude;
+    return true;
+}
+
+/**
+ * @brief Writes the radar center, if it differs from the stored one.
+ *
+ * Blocks for the write. Call it from a thread, never an interrupt.
+ *
+ * @return bool True if the center is stored.
+ */
+bool SiteConfig_Store(const SiteConfig_t *config) {
+    SiteRecord_t record = { SITE_CONFIG_MAGIC, config->center_latitude, config->center_longitude, 0 };
+
+    return write_record(SITE_CONFIG_ADDRESS, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t));
+}
+
+/**
+ * @brief Reads the stored display settings.
+ *
+ * @return bool False if nothing valid is stored, `settings` is left untouched.
+ */
+bool SiteConfig_LoadDisplay(DisplaySettings_t *settings) {
+    DisplayRecord_t record;
+
+    if (!read_record(SITE_DISPLAY_ADDRESS, SITE_DISPLAY_MAGIC, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t)))
+        return false;
+
+    settings->range_km = record.settings & 0xFFFF;
+    settings->show_track = (record.settings & DISPLAY_TRACK) != 0;
+    settings->show_callsign = (record.settings & DISPLAY_CALLSIGN) != 0;
+    settings->show_trails = (record.settings & DISPLAY_TRAILS) != 0;
+    return true;
+}
+
+/**
+ * @brief Writes the display settings, if they differ from the stored ones.
+ *
+ * Blocks for the write. Call it from a thread, never an interrupt.
+ *
+ * @return bool True if the settings are stored.
+ */
+bool SiteConfig_StoreDisplay(const DisplaySettings_t *settings) {
+    DisplayRecord_t record = { SITE_DISPLAY_MAGIC, settings->range_km, 0 };
+
+    if (settings->show_track)
+        record.settings |= DISPLAY_TRACK;
+    if (settings->show_callsign)
+        record.settings |= DISPLAY_CALLSIGN;
+    if (settings->show_trails)
+        record.settings |= DISPLAY_TRAILS;
+
+    return write_record(SITE_DISPLAY_ADDRESS, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t));
+}
+
+/**
+ * @brief Reads the stored bus node and rate.
+ *
+ * @return bool False if nothing valid is stored, `settings` is left untouched.
+ */
+bool SiteConfig_LoadBus(BusSettings_t *settings) {
+    BusRecord_t record;
+
+    if (!read_record(SITE_BUS_ADDRESS, SITE_BUS_MAGIC, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t)))
+        return false;
+
+    settings->node = (uint8_t)record.node;
+    settings->baud = record.baud;
+    return true;
+}
+
+/**
+ * @brief Writes the bus node and rate, if they differ from the stored ones.
+ *
+ * Blocks for the write. Call it from a thread, never an interrupt.
+ *
+ * @return bool True if the settings are stored.
+ */
+bool SiteConfig_StoreBus(const BusSettings_t *settings) {
+    BusRecord_t record = { SITE_BUS_MAGIC, settings->node, settings->baud, 0 };
+
+    return write_record(SITE_BUS_ADDRESS, (uint32_t *)&record, sizeof(record) / sizeof(uint32_t));
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,84 @@
+/***************************************************************************************
+ * @file        site_config.h
+ * @brief       Per-unit settings kept in the on-chip EEPROM.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The radar center is written once per site, by the feeder's `--center` option, and
+ * read at every boot, so one firmware build serves every site. The display settings,
+ * range and what is drawn, are written whenever the buttons change them, so a reset
+ * comes back looking the way it was left. A blank or damaged record reads as missing, and
+ * the caller falls back to its built-in defaults. The bus node, for a unit sharing its
+ * feeder with others, is written once when the unit is set up.
+ *
+ * Each record is a magic word, its settings and a check word over the others. The two
+ * are in separate 64-byte EEPROM blocks, so the often written display record never
+ * wears the block holding the center.
+ *
+***************************************************************************************/
+
+#ifndef SITE_CONFIG_H_
+#define SITE_CONFIG_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SITE_CONFIG_ADDRESS     0x000       // EEPROM byte address, word aligned
+#define SITE_CONFIG_MAGIC       0x45544953  // "SITE"
+
+#define SITE_DISPLAY_ADDRESS    0x040       // next EEPROM block
+#define SITE_DISPLAY_MAGIC      0x50534944  // "DISP"
+
+#define SITE_BUS_ADDRESS        0x080       // block after that
+#define SITE_BUS_MAGIC          0x45444F4E  // "NODE"
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    int32_t center_latitude;    // micro-degrees
+    int32_t center_longitude;   // micro-degrees
+} SiteConfig_t;
+
+typedef struct {
+    uint16_t range_km;
+    bool show_track;
+    bool show_callsign;
+    bool show_trails;
+} DisplaySettings_t;
+
+typedef struct {
+    uint8_t node;               // PROTOCOL_BUS_NONE off a bus
+    uint32_t baud;
+} BusSettings_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+bool SiteConfig_Init(void);
+bool SiteConfig_Load(SiteConfig_t *config);
+bool SiteConfig_Store(const SiteConfig_t *config);
+
+bool SiteConfig_LoadDisplay(DisplaySettings_t *settings);
+bool SiteConfig_StoreDisplay(const DisplaySettings_t *settings);
+
+bool SiteConfig_LoadBus(BusSettings_t *settings);
+bool SiteConfig_StoreBus(const BusSettings_t *settings);
+
+/********************************Public Functions***********************************/
+
+#endif /* SITE_CONFIG_H_ */
@@ -0,0 +1,219 @@
+/***************************************************************************************
+ * @file        soft_timer.c
+ * @brief       One-shot and periodic software timers run from a single hardware timer.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * The list is only touched with interrupts masked. The handler takes one due timer off it
+ * at a time and fires it unmasked, so a callback or a higher priority interrupt may start
+ * or stop timers, the same one included, while the handler is still working through them.
+ *
+ * Timer 1A counts from the moment it is loaded, and deadlines are rounded down to the
+ * millisecond, so it never interrupts before the head of the list is due.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./soft_timer.h"
+#include "./clock.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+/************************************Includes***************************************/
+
+/*********************************Global Variables**********************************/
+
+static SoftTimer_t *armed_list = NULL;
+static uint32_t cycles_per_ms = 1;
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+static bool due(uint32_t deadline_ms, uint32_t now_ms) {
+    return (int32_t)(deadline_ms - now_ms) <= 0;
+}
+
+/**
+ * @brief Links a timer in by deadline, after any with the same one. Interrupts masked.
+ */
+static void insert(SoftTimer_t *timer) {
+    SoftTimer_t **link = &armed_list;
+    while (*link != NULL && (int32_t)((*link)->deadline_ms - timer->deadline_ms) <= 0)
+        link = &(*link)->next;
+
+    timer->next = *link;
+    *link = timer;
+    timer->armed = true;
+}
+
+/**
+ * @brief Unlinks a timer if it is armed. Interrupts masked.
+ */
+static void unlink(SoftTimer_t *timer) {
+    if (!timer->armed)
+        return;
+
+    SoftTimer_t **link = &armed_list;
+    while (*link != timer)
+        link = &(*link)->next;
+
+    *link = timer->next;
+    timer->next = NULL;
+    timer->armed = false;
+}
+
+/**
+ * @brief Loads Timer 1A for the head of the list, or stops it if nothing is armed.
+ *
+ * Interrupts masked. A head that is already due gets the shortest load, so its interrupt
+ * still comes through the handler.
+ */
+static void program_hardware(void) {
+    TimerDisable(TIMER1_BASE, TIMER_A);
+
+    if (armed_list == NULL)
+        return;
+
+    uint32_t now = Clock_Millis();
+    uint32_t wait_ms = due(armed_list->deadline_ms, now) ? 0 : armed_list->deadline_ms - now;
+    if (wait_ms > SOFT_TIMER_MAX_WAIT_MS)
+        wait_ms = SOFT_TIMER_MAX_WAIT_MS;
+
+    TimerLoadSet(TIMER1_BASE, TIMER_A, wait_ms ? wait_ms * cycles_per_ms : 1);
+    TimerEnable(TIMER1_BASE, TIMER_A);
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Sets Timer 1A up as a one-shot with its timeout interrupt enabled.
+ *
+ * Must be called after Clock_Init and before the scheduler is launched. The interrupt is
+ * registered with G8RTOS like the others, see Timer1A_Handler.
+ */
+void SoftTimer_Init(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER1));
+
+    cycles_per_ms = SysCtlClockGet() / 1000;
+    armed_list = NULL;
+
+    TimerConfigure(TIMER1_BASE, TIMER_CFG_ONE_SHOT);
+    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+    TimerIntEnable(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+}
+
+/**
+ * @brief Fills a timer in, disarmed.
+ *
+ * @param callback  Called from the timer interrupt on expiry, or NULL.
+ * @param group     Group to set `flags` in on expiry, or NULL.
+ */
+void SoftTimer_Create(SoftTimer_t *timer, SoftTimerCallback_t callback, EventGroup_t *group, uint32_t flags) {
+    timer->next = NULL;
+    timer->deadline_ms = 0;
+    timer->period_ms = 0;
+    timer->armed = false;
+    timer->callback = callback;
+    timer->group = group;
+    timer->flags = flags;
+}
+
+/**
+ * @brief Arms a timer to expire in `delay_ms`, then every `period_ms` if that isn't 0.
+ *
+ * Restarts a timer that is already armed. A delay of 0 expires as soon as the handler
+ * can run.
+ */
+void SoftTimer_Start(SoftTimer_t *timer, uint32_t delay_ms, uint32_t period_ms) {
+    bool masked = IntMasterDisable();
+
+    unlink(timer);
+    timer->deadline_ms = Clock_Millis() + delay_ms;
+    timer->period_ms = period_ms;
+    insert(timer);
+
+    if (armed_list == timer)
+        program_hardware();
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Disarms a timer. Nothing happens if it isn't armed.
+ */
+void SoftTimer_Stop(SoftTimer_t *timer) {
+    bool masked = IntMasterDisable();
+
+    bool was_head = (armed_list == timer);
+    unlink(timer);
+
+    if (was_head)
+        program_hardware();
+
+    if (!masked)
+        IntMasterEnable();
+}
+
+bool SoftTimer_IsArmed(const SoftTimer_t *timer) {
+    return timer->armed;
+}
+
+/**
+ * @brief Fires every timer that is due and loads Timer 1A for the next one.
+ *
+ * Called from the Timer 1A interrupt.
+ */
+void SoftTimer_HandleInterrupt(void) {
+    TimerIntClear(TIMER1_BASE, TIMER_TIMA_TIMEOUT);
+
+    while (1) {
+        bool masked = IntMasterDisable();
+
+        uint32_t now = Clock_Millis();
+        SoftTimer_t *timer = armed_list;
+
+        if (timer == NULL || !due(timer->deadline_ms, now)) {
+            program_hardware();
+            if (!masked)
+                IntMasterEnable();
+            return;
+        }
+
+        unlink(timer);
+        if (timer->period_ms) {
+            timer->deadline_ms += timer->period_ms;
+            if (due(timer->deadline_ms, now))
+                timer->deadline_ms = now + timer->period_ms;
+            insert(timer);
+        }
+
+        SoftTimerCallback_t callback = timer->callback;
+        EventGroup_t *group = timer->group;
+        uint32_t flags = timer->flags;
+
+        if (!masked)
+            IntMasterEnable();
+
+        if (group != NULL)
+            EventGroup_Set(group, flags);
+        if (callback != NULL)
+            callback();
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,76 @@
+/***************************************************************************************
+ * @file        soft_timer.h
+ * @brief       One-shot and periodic software timers run from a single hardware timer.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 14, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Armed timers are kept in a list ordered by deadline, and Timer 1A is loaded as a
+ * one-shot for the earliest of them, so it only interrupts when a timer is due and not on
+ * every tick. Deadlines are in Clock_Millis time, and compare correctly across its wrap.
+ *
+ * On expiry a timer sets its flags in an event group, calls its callback, or both. The
+ * callback runs in the timer interrupt, so it must be short and may only make calls that
+ * are safe there, like GPIOIntEnable or EventGroup_Set. A periodic timer keeps its phase,
+ * and skips the periods it missed rather than firing for each one.
+ *
+ * Timers may be started and stopped from any thread or interrupt. Starting an armed timer
+ * restarts it. Timers are statically allocated, SoftTimer_Create only fills one in.
+ *
+***************************************************************************************/
+
+#ifndef SOFT_TIMER_H_
+#define SOFT_TIMER_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "./event_group.h"
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define SOFT_TIMER_MAX_WAIT_MS  50000   // longest one-shot load, short of the 32-bit limit
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef void (*SoftTimerCallback_t)(void);
+
+typedef struct SoftTimer_s {
+    struct SoftTimer_s *next;       // next armed timer, by deadline
+    uint32_t deadline_ms;
+    uint32_t period_ms;             // 0 for a one-shot
+    bool armed;
+
+    SoftTimerCallback_t callback;   // called in the timer interrupt, or NULL
+    EventGroup_t *group;            // flags set on expiry, or NULL
+    uint32_t flags;
+} SoftTimer_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void SoftTimer_Init(void);
+
+void SoftTimer_Create(SoftTimer_t *timer, SoftTimerCallback_t callback, EventGroup_t *group, uint32_t flags);
+void SoftTimer_Start(SoftTimer_t *timer, uint32_t delay_ms, uint32_t period_ms);
+void SoftTimer_Stop(SoftTimer_t *timer);
+bool SoftTimer_IsArmed(const SoftTimer_t *timer);
+
+void SoftTimer_HandleInterrupt(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* SOFT_TIMER_H_ */
@@ -0,0 +1,174 @@
+/***************************************************************************************
+ * @file        stack_guard.c
+ * @brief       MPU guard regions at the bottom of the thread stacks, and the fault that
+ *              names the one that ran into its guard.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * A region's base has to be aligned to its size, so a guard starts at the first 32-byte
+ * boundary at or above the bottom it is given, inside the stack, never below it. A
+ * stacking fault leaves no faulting address, the stack pointer is used instead.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./stack_guard.h"
+#include "./log.h"
+
+#include <string.h>
+
+#if defined(ccs)
+#include "inc/hw_types.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/mpu.h"
+#include "driverlib/sysctl.h"
+#endif
+
+/************************************Includes***************************************/
+
+#if defined(ccs)
+
+/*************************************Defines***************************************/
+
+// Upper half of the overflow record, the lower half is free
+#define OVERFLOW_MAGIC          0x53470000
+#define OVERFLOW_MAGIC_MASK     0xFFFF0000
+
+// Left alone by the C runtime's zero fill, so the record outlives the reset
+#define NOINIT                  __attribute__((noinit))
+
+#define GUARD_FLAGS             (MPU_RGN_SIZE_32B | MPU_RGN_PERM_NOEXEC | MPU_RGN_PERM_PRV_RO_USR_RO | MPU_RGN_ENABLE)
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    char name[STACK_GUARD_NAME_SIZE];
+    uintptr_t base;
+} StackGuardRegion_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static StackGuardRegion_t guards[STACK_GUARD_REGIONS];
+static uint32_t guard_count = 0;
+
+static NOINIT volatile uint32_t overflow_record;
+static NOINIT volatile uint32_t overflow_address;
+static NOINIT char overflow_name[STACK_GUARD_NAME_SIZE];
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief The guard closest to an address, or null before any were added.
+ */
+static const StackGuardRegion_t *nearest_guard(uintptr_t address) {
+    const StackGuardRegion_t *nearest = 0;
+    uintptr_t closest = UINTPTR_MAX;
+
+    for (uint32_t i = 0; i < guard_count; i++) {
+        uintptr_t distance = (address >= guards[i].base) ? address - guards[i].base : guards[i].base - address;
+        if (distance < closest) {
+            closest = distance;
+            nearest = &guards[i];
+        }
+    }
+
+    return nearest;
+}
+
+/********************************Private Functions**********************************/
+
+#endif /* ccs */
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Logs a stack overflow from before the reset and turns the guards on.
+ *
+ * Call from main before G8RTOS_Launch. Guards added before this wait for it, the ones
+ * added after take effect straight away.
+ */
+void StackGuard_Init(void) {
+#if defined(ccs)
+    if ((overflow_record & OVERFLOW_MAGIC_MASK) == OVERFLOW_MAGIC) {
+        LOG_WARN(LOG_STACK_OVERFLOW_RESET, LOG_TEXT(overflow_name), LOG_TEXT(overflow_name + 4), overflow_address);
+    }
+    overflow_record = 0;
+
+    // MemManage faults are taken instead of escalating to a hard fault
+    IntEnable(FAULT_MPU);
+
+    // Everything outside the guards keeps the default memory map
+    MPUEnable(MPU_CONFIG_PRIV_DEFAULT);
+#endif
+}
+
+/**
+ * @brief Makes the bottom of a stack a guard region, while there are regions left.
+ *
+ * Must be called with interrupts masked, as StackWatch does.
+ *
+ * @param name      Up to 7 characters, named if the guard is hit.
+ * @param bottom    Lowest address of the stack.
+ */
+void StackGuard_Add(const char *name, uintptr_t bottom) {
+#if defined(ccs)
+    if (guard_count >= STACK_GUARD_REGIONS) {
+        LOG_INFO(LOG_STACK_UNGUARDED, LOG_TEXT(name), LOG_TEXT(name + 4));
+        return;
+    }
+
+    StackGuardRegion_t *guard = &guards[guard_count];
+    strncpy(guard->name, name, STACK_GUARD_NAME_SIZE - 1);
+    guard->base = (bottom + STACK_GUARD_BYTES - 1) & ~(uintptr_t)(STACK_GUARD_BYTES - 1);
+
+    MPURegionSet(guard_count, guard->base, GUARD_FLAGS);
+    guard_count++;
+#else
+    (void)name;
+    (void)bottom;
+#endif
+}
+
+/**
+ * @brief Names the stack that hit its guard, notes it for after the reset, and resets.
+ *
+ * Entered from StackGuard_FaultHandler with the MPU already off.
+ *
+ * @param stack_pointer Stack pointer of the context that faulted.
+ */
+void StackGuard_Fault(uint32_t stack_pointer) {
+#if defined(ccs)
+    uint32_t status = HWREG(NVIC_FAULT_STAT);
+    uintptr_t address = (status & NVIC_FAULT_STAT_MMARV) ? HWREG(NVIC_MM_ADDR) : stack_pointer;
+
+    const StackGuardRegion_t *guard = nearest_guard(address);
+    const char *name = guard ? guard->name : "no one";
+
+    LOG_ERROR(LOG_STACK_OVERFLOW, LOG_TEXT(name), LOG_TEXT(name + 4), address, stack_pointer);
+
+    memcpy(overflow_name, name, STACK_GUARD_NAME_SIZE);
+    overflow_address = address;
+    overflow_record = OVERFLOW_MAGIC;
+
+    SysCtlReset();
+#else
+    (void)stack_pointer;
+#endif
+}
+
+/********************************Public Functions***********************************/
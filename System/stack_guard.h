@@ -0,0 +1,64 @@
+/***************************************************************************************
+ * @file        stack_guard.h
+ * @brief       MPU guard regions at the bottom of the thread stacks, and the fault that
+ *              names the one that ran into its guard.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * StackWatch_Init and StackWatch_RegisterThread hand each stack they paint to
+ * StackGuard_Add, which makes its lowest STACK_GUARD_BYTES a read-only MPU region. The
+ * painted pattern underneath is left as it was, so the high-water marks still read it.
+ * A push into the guard raises a MemManage fault on the spot, before anything past
+ * the end of the stack is overwritten, where painting would only have shown it at the
+ * next report, if whatever it overwrote hadn't brought the system down first.
+ *
+ * The guards never move, so a context switch costs nothing extra, but there are only
+ * STACK_GUARD_REGIONS of them: the main stack and the first threads to start, which
+ * are the highest priority ones. A stack that starts after they are all taken is logged
+ * as unguarded and left to the paint alone.
+ *
+ * The fault is taken in stack_guard_fault.asm, which turns the MPU off before anything
+ * is pushed, since the stack it would push on may be the one that is full. The stack
+ * is named from the guard nearest the faulting address, logged, and noted in SRAM that
+ * survives the reset that follows. StackGuard_Init logs it again after the reset, like
+ * the supervisor's stuck thread, and turns the guards on.
+ *
+ * The host simulator has no MPU, there all of this does nothing.
+ *
+***************************************************************************************/
+
+#ifndef STACK_GUARD_H_
+#define STACK_GUARD_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define STACK_GUARD_BYTES       32      // smallest MPU region
+#define STACK_GUARD_REGIONS     8       // MPU regions on the TM4C123
+#define STACK_GUARD_NAME_SIZE   8
+
+/*************************************Defines***************************************/
+
+/********************************Public Functions***********************************/
+
+void StackGuard_Init(void);
+void StackGuard_Add(const char *name, uintptr_t bottom);
+
+// Called from stack_guard_fault.asm only
+void StackGuard_Fault(uint32_t stack_pointer);
+
+/********************************Public Functions***********************************/
+
+#endif /* STACK_GUARD_H_ */
@@ -0,0 +1,49 @@
+;***************************************************************************************
+; @file        stack_guard_fault.asm
+; @brief       MemManage fault entry for the stack guards, see stack_guard.h.
+;
+; @project     Final Project: Aircraft Display System
+;              Real-time display and management of aircraft data on a radar screen.
+;
+; @author      Cannon Spencer
+; @date        October 15, 2026
+; @university  University of Florida
+;
+; @details
+; A push into a guard faults with the stack pointer already inside it, so the MPU goes
+; off before the handler pushes anything of its own. What StackGuard_Fault then pushes
+; lands past the end of the stack, which no longer matters, it resets.
+;
+;***************************************************************************************
+
+    .thumb
+    .text
+    .align 4
+
+    .ref StackGuard_Fault
+
+    .def StackGuard_FaultHandler
+
+MPUControl          .field  0xE000ED94, 32
+
+
+; Turns the MPU off and hands the faulting stack pointer to StackGuard_Fault
+StackGuard_FaultHandler: .asmfunc
+
+    LDR     R0, MPUControl
+    MOVS    R1, #0
+    STR     R1, [R0]
+    DSB
+    ISB
+
+    ; EXC_RETURN bit 2 says which stack the faulting context was using
+    TST     LR, #4
+    ITE     EQ
+    MRSEQ   R0, MSP
+    MRSNE   R0, PSP
+
+    B       StackGuard_Fault
+
+    .endasmfunc
+
+    .end
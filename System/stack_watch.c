@@ -0,0 +1,154 @@
+/***************************************************************************************
+ * @file        stack_watch.c
+ * @brief       Stack high-water marks from painting the unused part of each stack.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Painting runs with interrupts masked, since an exception frame pushed below the caller
+ * in the middle of it would be painted over.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./stack_watch.h"
+#include "./log.h"
+#include "./stack_guard.h"
+
+#include <string.h>
+
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    char name[STACK_WATCH_NAME_SIZE];
+    uint32_t *bottom;       // lowest painted word
+    uintptr_t top;          // just above the highest address the stack uses
+    uint32_t size;
+} StackWatchEntry_t;
+
+/***********************************Structures**************************************/
+
+/*********************************Global Variables**********************************/
+
+static StackWatchEntry_t stacks[STACK_WATCH_MAX_STACKS];
+static uint32_t stack_count = 0;
+
+#if defined(ccs)
+// Start of the main stack, from the linker
+extern uint32_t __stack;
+#endif
+
+/*********************************Global Variables**********************************/
+
+/********************************Private Functions**********************************/
+
+/**
+ * @brief Paints from `bottom` up to `guard` below the caller's `marker`, notes the stack and guards it.
+ *
+ * Must be called with interrupts masked.
+ */
+static void paint(const char *name, uint32_t *bottom, uintptr_t top, uint32_t size, const volatile uint32_t *marker) {
+    if (stack_count >= STACK_WATCH_MAX_STACKS)
+        return;
+
+    uint32_t *end = (uint32_t *)(((uintptr_t)marker - STACK_WATCH_GUARD) & ~(uintptr_t)3);
+    for (uint32_t *word = bottom; word < end; word++) {
+        *word = STACK_WATCH_PAINT;
+    }
+
+    StackWatchEntry_t *entry = &stacks[stack_count++];
+    strncpy(entry->name, name, STACK_WATCH_NAME_SIZE - 1);
+    entry->bottom = bottom;
+    entry->top = top;
+    entry->size = size;
+
+    StackGuard_Add(name, (uintptr_t)bottom);
+}
+
+static uint32_t deepest(const StackWatchEntry_t *entry) {
+    const uint32_t *word = entry->bottom;
+
+    while ((uintptr_t)word < entry->top && *word == STACK_WATCH_PAINT) {
+        word++;
+    }
+
+    return entry->top - (uintptr_t)word;
+}
+
+/********************************Private Functions**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Paints the free part of the main stack.
+ *
+ * Call from main, before G8RTOS_Launch. The host simulator has no main stack of its own
+ * to watch, so there it does nothing.
+ */
+void StackWatch_Init(void) {
+#if defined(ccs)
+    volatile uint32_t marker = 0;
+
+    bool masked = IntMasterDisable();
+    paint("Main", &__stack, (uintptr_t)&__stack + STACK_WATCH_MAIN_BYTES, STACK_WATCH_MAIN_BYTES, &marker);
+    if (!masked)
+        IntMasterEnable();
+#endif
+}
+
+/**
+ * @brief Paints the free part of the calling thread's stack.
+ *
+ * Call once at the top of the thread function, before its loop.
+ *
+ * @param name Up to 7 characters, named in StackWatch_Report.
+ */
+void StackWatch_RegisterThread(const char *name) {
+    volatile uint32_t marker = 0;
+
+    uintptr_t top = (uintptr_t)&marker + STACK_WATCH_SLACK;
+    uint32_t *bottom = (uint32_t *)((top - STACK_WATCH_THREAD_BYTES) & ~(uintptr_t)3);
+
+    bool masked = IntMasterDisable();
+    paint(name, bottom, top, STACK_WATCH_THREAD_BYTES, &marker);
+    if (!masked)
+        IntMasterEnable();
+}
+
+/**
+ * @brief Deepest use so far of the `index`th stack registered.
+ *
+ * @return bool False once `index` is past the last one.
+ */
+bool StackWatch_Get(uint32_t index, StackWatchMark_t *mark) {
+    if (index >= stack_count)
+        return false;
+
+    memcpy(mark->name, stacks[index].name, STACK_WATCH_NAME_SIZE);
+    mark->used = deepest(&stacks[index]);
+    mark->size = stacks[index].size;
+    return true;
+}
+
+/**
+ * @brief Logs the deepest use of every stack so far.
+ */
+void StackWatch_Report(void) {
+    StackWatchMark_t mark;
+
+    for (uint32_t i = 0; StackWatch_Get(i, &mark); i++) {
+        LOG_INFO(LOG_STACK, LOG_TEXT(mark.name), LOG_TEXT(mark.name + 4), mark.used, mark.size);
+    }
+}
+
+/********************************Public Functions***********************************/
@@ -0,0 +1,79 @@
+/***************************************************************************************
+ * @file        stack_watch.h
+ * @brief       Stack high-water marks from painting the unused part of each stack.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Each thread calls StackWatch_RegisterThread when it starts, which fills the part of its
+ * stack below the caller with STACK_WATCH_PAINT. Whatever the thread later pushes
+ * overwrites the pattern, so the lowest word that no longer holds it marks the deepest
+ * the stack has ever been. StackWatch_Init does the same for the main stack, which the
+ * interrupt handlers run on once the scheduler has launched.
+ *
+ * G8RTOS doesn't say where a thread's stack ends, so it is taken as the kernel's stack
+ * size below the top, and the top as STACK_WATCH_SLACK above the caller, as the profiler
+ * does. Painting stops that far short of the real bottom, never past it, as long as the
+ * thread function's own frame fits in the slack. The figures are counted from that top,
+ * so they run high by up to the slack and guard, and a thread that has barely run shows
+ * about 384 bytes.
+ *
+ * StackWatch_Report logs one line per stack when the debug console asks, see console.h.
+ * Each stack painted is also handed to StackGuard_Add, so its bottom faults on the first
+ * push past it, see stack_guard.h.
+ *
+***************************************************************************************/
+
+#ifndef STACK_WATCH_H_
+#define STACK_WATCH_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#define STACK_WATCH_BOARD_BYTES     1024    // G8RTOS STACKSIZE in bytes, keep in step with the kernel
+
+#ifndef STACK_WATCH_THREAD_BYTES
+#define STACK_WATCH_THREAD_BYTES    STACK_WATCH_BOARD_BYTES     // the simulator's stacks are larger
+#endif
+
+#define STACK_WATCH_MAIN_BYTES      512     // __STACK_TOP less __stack in tm4c123gh6pm.cmd
+#define STACK_WATCH_SLACK           256     // thread function's frame above the caller
+#define STACK_WATCH_GUARD           128     // left unpainted below the caller's own locals
+#define STACK_WATCH_MAX_STACKS      14
+#define STACK_WATCH_NAME_SIZE       8       // 7 characters and a null terminator
+#define STACK_WATCH_PAINT           0xC5C5C5C5
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef struct {
+    char name[STACK_WATCH_NAME_SIZE];
+    uint32_t used;      // deepest use so far, in bytes
+    uint32_t size;
+} StackWatchMark_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+void StackWatch_Init(void);
+void StackWatch_RegisterThread(const char *name);
+
+bool StackWatch_Get(uint32_t index, StackWatchMark_t *mark);
+void StackWatch_Report(void);
+
+/********************************Public Functions***********************************/
+
+#endif /* STACK_WATCH_H_ */
@@ -0,0 +1,134 @@
+/***************************************************************************************
+ * @file        supervisor.c
+ * @brief       Hardware watchdog, fed only while the ingest and render threads make progress.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Busy and Idle are single word stores from their own thread. Supervisor_Service reads
+ * `busy` before `busy_since`, and Busy writes them the other way around, so a thread that
+ * wakes up in between only looks as if it started later.
+ *
+***************************************************************************************/
+
+/************************************Includes***************************************/
+
+#include "./supervisor.h"
+#include "./clock.h"
+#include "./log.h"
+
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/watchdog.h"
+
+/************************************Includes***************************************/
+
+#if SUPERVISOR_ENABLE
+
+/*************************************Defines***************************************/
+
+// Upper half of the stuck record, the lower half names the task
+#define STUCK_MAGIC         0x57440000
+#define STUCK_MAGIC_MASK    0xFFFF0000
+
+// Left alone by the C runtime's zero fill, so the record outlives the reset
+#if defined(ccs)
+#define NOINIT              __attribute__((noinit))
+#else
+#define NOINIT
+#endif
+
+/*************************************Defines***************************************/
+
+/*********************************Global Variables**********************************/
+
+static const char TASK_NAMES[SUPERVISOR_TASKS][8] = { "Ingest", "Render" };
+
+static volatile bool busy[SUPERVISOR_TASKS];
+static volatile uint32_t busy_since[SUPERVISOR_TASKS];
+
+static uint32_t reload;
+static bool starving = false;
+
+static NOINIT volatile uint32_t stuck_record;
+
+/*********************************Global Variables**********************************/
+
+/********************************Public Functions***********************************/
+
+/**
+ * @brief Logs why the last reset happened and starts the watchdog.
+ *
+ * Call from main just before G8RTOS_Launch, so booting doesn't count against the timeout.
+ */
+void Supervisor_Init(void) {
+    uint32_t cause = SysCtlResetCauseGet();
+
+    if (cause & SYSCTL_CAUSE_WDOG0) {
+        uint32_t task = stuck_record & ~STUCK_MAGIC_MASK;
+        const char *name = ((stuck_record & STUCK_MAGIC_MASK) == STUCK_MAGIC && task < SUPERVISOR_TASKS)
+                           ? TASK_NAMES[task] : "no one";
+        LOG_WARN(LOG_WATCHDOG_RESET, LOG_TEXT(name), LOG_TEXT(name + 4));
+    }
+    SysCtlResetCauseClear(cause);
+    stuck_record = 0;
+
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WDOG0);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_WDOG0));
+
+    reload = SysCtlClockGet() / 1000 * SUPERVISOR_TIMEOUT_MS;
+    WatchdogReloadSet(WATCHDOG0_BASE, reload);
+    WatchdogResetEnable(WATCHDOG0_BASE);
+
+    // Halting at a breakpoint doesn't reset the board
+    WatchdogStallEnable(WATCHDOG0_BASE);
+    WatchdogEnable(WATCHDOG0_BASE);
+}
+
+/**
+ * @brief The calling thread woke up with work to do.
+ */
+void Supervisor_Busy(SupervisorTask_t task) {
+    busy_since[task] = Clock_Millis();
+    busy[task] = true;
+}
+
+/**
+ * @brief The calling thread is about to block until there is more work.
+ */
+void Supervisor_Idle(SupervisorTask_t task) {
+    busy[task] = false;
+}
+
+/**
+ * @brief Feeds the watchdog unless a supervised thread is stuck. Call every LINK_RATE_POLL_MS.
+ */
+void Supervisor_Service(void) {
+    if (starving)
+        return;
+
+    uint32_t now = Clock_Millis();
+
+    for (uint32_t task = 0; task < SUPERVISOR_TASKS; task++) {
+        if (busy[task] && now - busy_since[task] >= SUPERVISOR_BUSY_LIMIT_MS) {
+            LOG_ERROR(LOG_WATCHDOG_STUCK, LOG_TEXT(TASK_NAMES[task]), LOG_TEXT(TASK_NAMES[task] + 4),
+                      now - busy_since[task]);
+            stuck_record = STUCK_MAGIC | task;
+            starving = true;
+            return;
+        }
+    }
+
+    // Writing the load value restarts the count and clears a first timeout
+    WatchdogReloadSet(WATCHDOG0_BASE, reload);
+    WatchdogIntClear(WATCHDOG0_BASE);
+}
+
+/********************************Public Functions***********************************/
+
+#endif /* SUPERVISOR_ENABLE */
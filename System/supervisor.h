@@ -0,0 +1,87 @@
+/***************************************************************************************
+ * @file        supervisor.h
+ * @brief       Hardware watchdog, fed only while the ingest and render threads make progress.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        October 15, 2026
+ * @university  University of Florida
+ *
+ * @details
+ * Each supervised thread calls Supervisor_Busy when it wakes up with work and
+ * Supervisor_Idle before it blocks for more. Blocking is never a fault, the parser can
+ * wait as long as the feeder is quiet, but a thread that stays busy for
+ * SUPERVISOR_BUSY_LIMIT_MS is stuck, on a lock that is never released or in a loop that
+ * never ends.
+ *
+ * Supervisor_Service runs in Link_Rate_Thread and feeds watchdog 0 as long as neither
+ * thread is stuck. Once one is, it is logged and the watchdog is left to run out. It
+ * times out after SUPERVISOR_TIMEOUT_MS and resets the MCU on the second timeout, so a
+ * stuck thread is reset within about three times that. Anything at a higher priority
+ * that keeps Link_Rate_Thread from running at all ends the same way.
+ *
+ * A link that stops delivering is not a stuck thread, link_health.h restarts the
+ * receiver for that without a reset.
+ *
+ * The stuck thread is also noted in SRAM that the C runtime doesn't clear, and
+ * Supervisor_Init logs it after the reset, since the log written before it may never
+ * have left the ring. Setting SUPERVISOR_ENABLE to 0 compiles all of this out.
+ *
+***************************************************************************************/
+
+#ifndef SUPERVISOR_H_
+#define SUPERVISOR_H_
+
+/************************************Includes***************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************Includes***************************************/
+
+/*************************************Defines***************************************/
+
+#ifndef SUPERVISOR_ENABLE
+#define SUPERVISOR_ENABLE           1
+#endif
+
+#define SUPERVISOR_TIMEOUT_MS       1000    // first watchdog timeout, it resets on the second
+#define SUPERVISOR_BUSY_LIMIT_MS    2000
+
+/*************************************Defines***************************************/
+
+/***********************************Structures**************************************/
+
+typedef enum {
+    SUPERVISOR_INGEST,      // Process_New_Aircraft_Thread
+    SUPERVISOR_RENDER,      // Display_Thread
+    SUPERVISOR_TASKS
+} SupervisorTask_t;
+
+/***********************************Structures**************************************/
+
+/********************************Public Functions***********************************/
+
+#if SUPERVISOR_ENABLE
+
+void Supervisor_Init(void);
+
+void Supervisor_Busy(SupervisorTask_t task);
+void Supervisor_Idle(SupervisorTask_t task);
+
+void Supervisor_Service(void);
+
+#else
+
+#define Supervisor_Init()           ((void)0)
+#define Supervisor_Busy(task)       ((void)0)
+#define Supervisor_Idle(task)       ((void)0)
+#define Supervisor_Service()        ((void)0)
+
+#endif
+
+/********************************Public Functions***********************************/
+
+#endif /* SUPERVISOR_H_ */
@@ -1,80 +1,172 @@
-/***************************************************************************************
- * @file        main.c
- * @brief       Initializes system components and starts the RTOS scheduler.
- *
- * @project     Final Project: Aircraft Display System
- *              Real-time display and management of aircraft data on a radar screen.
- *
- * @author      Cannon Spencer
- * @date        November 10, 2024
- * @university  University of Florida
- *
- * @version     1.0.1
- *
- * @details
- * This file is part of the Final Project: Aircraft Display System. The goal of this project
- * is to implement a radar system that displays aircraft positions and allows user interaction
- * using a joystick and buttons. This module initializes the hardware, threads, and
- * semaphore resources before starting the G8RTOS scheduler.
- *
-***************************************************************************************\
-
-/************************************Includes***************************************/
-
-#include "G8RTOS/G8RTOS.h"
-#include "./MultimodDrivers/multimod.h"
-
-#include "./threads.h"
-#include "driverlib/interrupt.h"
-
-/************************************Includes***************************************/
-
-/************************************MAIN*******************************************/
-
-int main(void){
-    SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
-
-    multimod_init();
-    G8RTOS_Init();
-
-    // Initialize semaphores
-    G8RTOS_InitSemaphore(&sem_DATA_READY, 0);
-    G8RTOS_InitSemaphore(&sem_BURST_COMPLETE, 0);
-    G8RTOS_InitSemaphore(&sem_CURRENT_AIRCRAFTS, 1);
-    G8RTOS_InitSemaphore(&sem_STAGING_AIRCRAFTS, 1);
-
-    G8RTOS_InitSemaphore(&sem_MAIN_DISPLAY, 1);
-    G8RTOS_InitSemaphore(&sem_INFO_DISPLAY, 1);
-
-    G8RTOS_InitSemaphore(&sem_I2CA, 1);
-    G8RTOS_InitSemaphore(&sem_SPIA, 1);
-    G8RTOS_InitSemaphore(&sem_UART, 1);
-    G8RTOS_InitSemaphore(&sem_PCA9555_Debounce, 0);
-    G8RTOS_InitSemaphore(&sem_Joystick_Debounce, 0);
-
-    // Add threads
-    G8RTOS_AddThread(Idle_Thread, 255, "Idle");
-    G8RTOS_AddThread(Process_New_Aircraft_Thread, 1, "Process_New_Aircraft_Thread");
-    G8RTOS_AddThread(Update_Current_Aircrafts_Thread, 2, "Update_Current_Aircrafts_Thread");
-    G8RTOS_AddThread(Update_Search_Range, 5, "Update_Search_Range");
-    G8RTOS_AddThread(Display_Aircraft_Info_Thread, 6, "Display_Aircraft_Info_Thread");
-    G8RTOS_AddThread(Display_Aircrafts_Thread, 4, "Display_Aircrafts_Thread");
-    G8RTOS_AddThread(Select_Aircraft_Thread, 3, "Select_Aircraft_Thread");
-
-
-    // Add FIFOs
-    G8RTOS_InitFIFO(DATA_FIFO);
-
-    // Add aperiodic threads
-    G8RTOS_Add_APeriodicEvent(UART4_Handler, 1, INT_UART4);
-    G8RTOS_Add_APeriodicEvent(Button_Handler, 2, BUTTON_INTERRUPT);
-    G8RTOS_Add_APeriodicEvent(Joystick_Button_Handler, 3, JOYSTICK_GPIOD_INT);
-
-    // Launch RTOS
-    G8RTOS_Launch();
-
-    // Shouldn't ever make it here
-    while(1);
-}
-
-/************************************MAIN*******************************************/
+/***************************************************************************************
+ * @file        main.c
+ * @brief       Initializes system components and starts the RTOS scheduler.
+ *
+ * @project     Final Project: Aircraft Display System
+ *              Real-time display and management of aircraft data on a radar screen.
+ *
+ * @author      Cannon Spencer
+ * @date        November 10, 2024
+ * @university  University of Florida
+ *
+ * @version     1.0.1
+ *
+ * @details
+ * This file is part of the Final Project: Aircraft Display System. The goal of this project
+ * is to implement a radar system that displays aircraft positions and allows user interaction
+ * using a joystick and buttons. This module initializes the hardware, threads, and
+ * semaphore resources before starting the G8RTOS scheduler.
+ *
+***************************************************************************************\
+
+/************************************Includes***************************************/
+
+#include "G8RTOS/G8RTOS.h"
+#include "./MultimodDrivers/multimod.h"
+
+#include "./threads.h"
+#include "./Link/uart_rx.h"
+#include "./Link/uart_tx.h"
+#include "./Link/compact.h"
+#include "./Link/bus_node.h"
+#include "./Link/usb_link.h"
+#include "./Display/panel.h"
+#include "./Display/frame_scheduler.h"
+#include "./Display/strip_renderer.h"
+#include "./Display/radar_renderer.h"
+#include "./System/clock.h"
+#include "./System/soft_timer.h"
+#include "./System/joystick_adc.h"
+#include "./System/profiler.h"
+#include "./System/site_config.h"
+#include "./System/quiet_hours.h"
+#include "./System/arena.h"
+#include "./System/stack_watch.h"
+#include "./System/stack_guard.h"
+#include "./System/supervisor.h"
+#include "./System/console.h"
+#include "./System/ramfunc_bench.h"
+#include "./System/bench_suite.h"
+#include "./System/schedule.h"
+#include "driverlib/interrupt.h"
+
+/************************************Includes***************************************/
+
+/************************************MAIN*******************************************/
+
+int main(void){
+    SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ);
+
+    // Fill the free main stack, the interrupt handlers' once the scheduler runs
+    StackWatch_Init();
+
+    multimod_init();
+    G8RTOS_Init();
+
+    // Radar center and bus node for this unit, on the EEPROM
+    SiteConfig_Init();
+
+    // On a bus, replies wait for the feeder's polls and the link stays at the bus rate
+    BusNode_Init();
+
+    // Take over UART4 once multimod_init has set the port up
+    UartTx_Init();
+    UartRx_Init();
+
+    // Entry to address dictionary for compact frames, carved after the receive ring
+    Compact_Init();
+
+    // The same frames over the USB device port, when a host opens it
+    UsbLink_Init();
+
+    // Statistics queries coming in on the debug UART
+    Console_Init();
+
+    // Pixel DMA on the display bus
+    Panel_Init();
+
+    // Time base for dead reckoning
+    Clock_Init();
+
+    // Debounce and input timers, on Timer 1A
+    SoftTimer_Init();
+
+    // Joystick deadzone watch and reads on ADC1
+    JoystickAdc_Init();
+
+    // Cycle counter for the profiler
+    Profile_Init();
+
+    // Redraw requests are folded into frames from here on
+    FrameScheduler_Init();
+
+    // Wall clock and quiet hours, on the Hibernation module
+    QuietHours_Init();
+
+    init_aircraft_tables();
+
+    // Strip buffer, sprites, label cache and trails, from the arena like the stores
+    StripRenderer_Init();
+    RadarRenderer_Init();
+
+    // What every buffer took, and what SRAM has left
+    Arena_Report();
+
+    // Cycles of the kernels run from SRAM, in a RAMFUNC_BENCH build
+    RamfuncBench_Run();
+
+    // Last picture from before the reset, until the first burst
+    warm_start_aircraft();
+
+    // Initialize semaphores
+    G8RTOS_InitSemaphore(&sem_DATA_READY, 0);
+    G8RTOS_InitSemaphore(&sem_BURST_COMPLETE, 0);
+    G8RTOS_InitSemaphore(&sem_CURRENT_AIRCRAFTS, 1);
+    G8RTOS_InitSemaphore(&sem_STAGING_AIRCRAFTS, 1);
+
+    G8RTOS_InitSemaphore(&sem_I2CA, 1);
+    G8RTOS_InitSemaphore(&sem_SPIA, 1);
+
+    EventGroup_Init(&range_events);
+    EventGroup_Init(&select_events);
+    EventGroup_Init(&snapshot_events);
+    EventGroup_Init(&conflict_events);
+    EventGroup_Init(&console_events);
+    init_input_timers();
+
+    // Add threads, at the priorities schedule.h gives them, and check their periods fit
+    Schedule_AddThreads();
+    Schedule_Check();
+#if BENCH_SUITE
+    G8RTOS_AddThread(BenchSuite_Thread, 0, "BenchSuite_Thread");
+#endif
+
+
+    // Add aperiodic threads
+    G8RTOS_Add_APeriodicEvent(UART4_Handler, 1, INT_UART4);
+    G8RTOS_Add_APeriodicEvent(Button_Handler, 2, BUTTON_INTERRUPT);
+    G8RTOS_Add_APeriodicEvent(Joystick_Button_Handler, 3, JOYSTICK_GPIOD_INT);
+    G8RTOS_Add_APeriodicEvent(SSI3_Handler, 4, INT_SSI3);
+    G8RTOS_Add_APeriodicEvent(Timer1A_Handler, 5, INT_TIMER1A);
+    G8RTOS_Add_APeriodicEvent(UART0_Handler, 6, INT_UART0);
+#if USB_LINK_ENABLE
+    G8RTOS_Add_APeriodicEvent(USB0_Handler, 1, INT_USB0);
+#endif
+#if JOYSTICK_USE_ADC
+    G8RTOS_Add_APeriodicEvent(Joystick_Tilt_Handler, 5, INT_ADC1SS0);
+#endif
+
+    // Watchdog from here on, fed by Link_Rate_Thread
+    Supervisor_Init();
+
+    // Stack guards on, the main stack's is set and each thread's follows as it starts
+    StackGuard_Init();
+
+    // Launch RTOS
+    G8RTOS_Launch();
+
+    // Shouldn't ever make it here
+    while(1);
+}
+
+/************************************MAIN*******************************************/
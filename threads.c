@@ -23,11 +23,50 @@
 #include "./threads.h"
 #include "./MultimodDrivers/multimod.h"
 #include "./MultimodDrivers/font.h"
+#include "./Link/uart_rx.h"
+#include "./Link/burst_latency.h"
+#include "./Link/view_report.h"
+#include "./Link/link_rate.h"
+#include "./Link/link_health.h"
+#include "./Link/uart_tx.h"
+#include "./Link/compact.h"
+#include "./Link/bus_node.h"
+#include "./Link/usb_link.h"
+#include "./Radar/aircraft_store.h"
+#include "./Radar/aircraft_index.h"
+#include "./Radar/aircraft_aging.h"
+#include "./Radar/conflict_detector.h"
+#include "./Radar/closest_approach.h"
+#include "./Radar/projection.h"
+#include "./Radar/dead_reckoning.h"
+#include "./Radar/screen_grid.h"
+#include "./Radar/distance_index.h"
+#include "./Radar/traffic_snapshot.h"
+#include "./Display/radar_renderer.h"
+#include "./Display/aircraft_filter.h"
+#include "./Display/info_panel.h"
+#include "./Display/panel.h"
+#include "./Display/frame_scheduler.h"
+#include "./System/log.h"
+#include "./System/format.h"
+#include "./System/profiler.h"
+#include "./System/arena.h"
+#include "./System/stack_watch.h"
+#include "./System/supervisor.h"
+#include "./System/ramfunc.h"
+#include "./System/seqlock.h"
+#include "./System/event_group.h"
+#include "./System/soft_timer.h"
+#include "./System/joystick_adc.h"
+#include "./System/schedule.h"
+#include "./System/clock.h"
+#include "./System/console.h"
+#include "./System/site_config.h"
+#include "./System/quiet_hours.h"
+#include "driverlib/sysctl.h"
 
-#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
-#include <math.h>
 #include <string.h>
 #include <float.h>
 
@@ -37,33 +76,324 @@ uint16_t display_range_km = 50;
 
 uint16_t display_track = true;
 uint16_t display_callsign = true;
+uint16_t display_trails = false;
 
-// Staging array and counter
-AircraftData_t stagingAircrafts[MAX_AIRCRAFTS];
-int stagingAircraftCount = 0;
+// Aircraft stores and their ICAO24 lookups, carved from the arena by init_aircraft_tables.
+// With staging, the live and staging roles are swapped by pointer at the end of each keyframe burst
 
-// Live array and counter
-AircraftData_t currentAircrafts[MAX_AIRCRAFTS];
-int currentAircraftCount = 0;
+#if AIRCRAFT_STAGING_ENABLE
+// Staging store
+AircraftStore_t *stagingAircrafts;
+AircraftIndex_t *stagingIndex;
+#endif
+
+// Live store, where each of its aircraft is on the radar, and how long since each was heard from
+AircraftStore_t *currentAircrafts;
+AircraftIndex_t *currentIndex;
+AircraftScreen_t currentScreen;
+DeadReckoning_t currentMotion;
+AircraftAging_t currentAging;
+
+#if CONFLICT_DETECTION_ENABLE
+// Pairs of live aircraft too close together, worked out by Detect_Conflicts_Thread
+ConflictDetector_t conflictDetector;
+#endif
+
+// Which aircraft passes closest to the selected one, worked out for the info panel
+ClosestApproach_t selectedApproach;
 
 // Index to "Selected" Aircraft
 int16_t selectedAircraft = -1;
 
+// The live store still holds the snapshot from before the last reset, no burst has replaced it yet
+bool trafficStale = false;
+
+// Burst each live aircraft was last upserted in, for retiring the ones a progressive keyframe left out
+uint8_t currentEpoch[MAX_AIRCRAFTS];
+uint8_t liveEpoch = 0;
+
+// Built-in radar center, for a unit with none in its EEPROM
 const float CENTER_LATITUDE = 29.6465;
 const float CENTER_LONGITUDE = -82.3533;
 
+// Lat/lon to pixel mapping, rescaled whenever display_range_km changes and re-anchored with the center
+Projection_t radarProjection;
+
+// Input debounce, hold-off and sampling, run from Timer 1A instead of sleeping the input threads
+static SoftTimer_t buttonsDebounce;
+static SoftTimer_t buttonsHoldoff;
+static SoftTimer_t joystickDebounce;
+static SoftTimer_t joystickHoldoff;
+static SoftTimer_t joystickSample;
+static SoftTimer_t zoomStep;
+
+// When Save_Snapshot_Thread next looks at the quiet hours
+static SoftTimer_t quietCheck;
+
+// How often each lock was taken and waited for, for the debug console
+static MutexStats_t currentLockStats;
+static MutexStats_t stagingLockStats;
+static MutexStats_t spiLockStats;
+static const char LOCK_NAMES[3][8] = { "Current", "Staging", "SPI" };
+
 
 /********************************Public Functions***********************************/
 
-void float_to_string(float value, char *buffer, int decimal_places) {
-    int32_t int_part = (int32_t)value;
-    int32_t decimal_part = abs((int32_t)((value - int_part) * pow(10, decimal_places)));
+/**
+ * @brief Carves out and prepares the aircraft stores, their ICAO24 indexes and the radar projection.
+ *
+ * The radar is centered, and the display set up, the way the site configuration says,
+ * or with the built-in defaults if it says nothing. Must be called after Clock_Init and
+ * SiteConfig_Init, and before the scheduler is launched.
+ */
+void init_aircraft_tables(void) {
+    AircraftStore_t *stores = Arena_Alloc((1 + AIRCRAFT_STAGING_ENABLE) * sizeof(AircraftStore_t), "Stores");
+    AircraftIndex_t *indexes = Arena_Alloc((1 + AIRCRAFT_STAGING_ENABLE) * sizeof(AircraftIndex_t), "Indexes");
+    currentAircrafts = &stores[0];
+    currentIndex = &indexes[0];
+
+#if AIRCRAFT_STAGING_ENABLE
+    stagingAircrafts = &stores[1];
+    stagingIndex = &indexes[1];
+    AircraftStore_Clear(stagingAircrafts);
+    AircraftIndex_Init(stagingIndex, stagingAircrafts);
+#endif
+    AircraftStore_Clear(currentAircrafts);
+    AircraftIndex_Init(currentIndex, currentAircrafts);
+    AircraftAging_Init(&currentAging, DeadReckoning_Now());
+    AircraftFilter_Init();
+#if CONFLICT_DETECTION_ENABLE
+    ConflictDetector_Init(&conflictDetector);
+#endif
+    ClosestApproach_Init(&selectedApproach);
+    ScreenGrid_Clear();
+    DistanceIndex_Init(currentScreen.offset_x, currentScreen.offset_y);
+    Seqlock_Init(&seq_CURRENT_AIRCRAFTS);
+
+    // Come back looking the way the unit was left
+    DisplaySettings_t settings;
+    if (SiteConfig_LoadDisplay(&settings) &&
+        settings.range_km >= DISPLAY_MIN_RANGE_KM && settings.range_km <= DISPLAY_MAX_RANGE_KM) {
+        display_range_km = settings.range_km;
+        display_track = settings.show_track;
+        display_callsign = settings.show_callsign;
+        display_trails = settings.show_trails;
+    }
+
+    Projection_Init(&radarProjection, CENTER_LATITUDE, CENTER_LONGITUDE,
+                    RADAR_CENTER_X, RADAR_CENTER_Y, RADAR_RADIUS_PX);
+    Projection_SetRange(&radarProjection, display_range_km);
+
+    SiteConfig_t site;
+    if (SiteConfig_Load(&site))
+        Projection_SetCenter(&radarProjection, site.center_latitude, site.center_longitude);
+}
+
+static void rearm_buttons(void) {
+    GPIOIntEnable(GPIO_PORTE_BASE, BUTTONS_INT_PIN);
+}
+
+static void rearm_joystick(void) {
+    GPIOIntClear(JOYSTICK_INT_GPIO_BASE, JOYSTICK_INT_PIN);
+    GPIOIntEnable(GPIO_PORTD_BASE, JOYSTICK_INT_PIN);
+}
+
+/**
+ * @brief Sets up the software timers that debounce and pace the buttons and joystick.
+ *
+ * The debounce timers wake the input threads once a press has settled, the hold-off
+ * timers turn the input interrupts back on from the timer interrupt, joystickSample
+ * paces the tilt sampling while an aircraft is selected and zoomStep a held zoom.
+ * quietCheck, not an input timer, is the next time the quiet hours need a look.
+ *
+ * Must be called after the event groups are initialized and before the scheduler is launched.
+ */
+void init_input_timers(void) {
+    SoftTimer_Create(&buttonsDebounce, NULL, &range_events, EVENT_BUTTONS);
+    SoftTimer_Create(&buttonsHoldoff, rearm_buttons, NULL, 0);
+    SoftTimer_Create(&joystickDebounce, NULL, &select_events, EVENT_JOYSTICK_PRESS);
+    SoftTimer_Create(&joystickHoldoff, rearm_joystick, NULL, 0);
+    SoftTimer_Create(&joystickSample, NULL, &select_events, EVENT_JOYSTICK_SAMPLE);
+    SoftTimer_Create(&zoomStep, NULL, &range_events, EVENT_ZOOM);
+    SoftTimer_Create(&quietCheck, NULL, &snapshot_events, EVENT_QUIET_CHECK);
+}
 
-    snprintf(buffer, FLOAT_BUFF_SIZE, "%d.%0*d", int_part, decimal_places, decimal_part);
+/**
+ * @brief Takes the live store for writing.
+ *
+ * Writers serialize on `sem_CURRENT_AIRCRAFTS` and bump `seq_CURRENT_AIRCRAFTS` around
+ * the change, so readers that skip the lock know to read again.
+ */
+static void lock_current_aircrafts(void) {
+    Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+    Seqlock_WriteBegin(&seq_CURRENT_AIRCRAFTS);
 }
 
-void int_to_string(int32_t value, char *buffer) {
-    snprintf(buffer, INT_BUFF_SIZE, "%d", value);
+static void unlock_current_aircrafts(void) {
+    Seqlock_WriteEnd(&seq_CURRENT_AIRCRAFTS);
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+}
+
+/**
+ * @brief Recomputes what follows from a live slot's velocity and heading.
+ *
+ * The dead-reckoning rates and the heading line are only worked out here, when the data
+ * changes, rather than on every frame. Must be called with the live store locked for writing.
+ */
+static void update_vectors(int16_t index) {
+    DeadReckoning_SetMotion(&currentMotion, &radarProjection, currentAircrafts, index);
+    RadarRenderer_SetTrack(&currentScreen, index, currentAircrafts->heading[index]);
+}
+
+/**
+ * @brief Files a freshly projected aircraft in the screen grid.
+ *
+ * Aircraft the display filter hides are left out, like off-screen ones. If the aircraft
+ * went off-screen or hidden while selected the selection is cleared. Must be called with
+ * the live store locked for writing.
+ */
+static void place_aircraft(int16_t index) {
+    bool shown = currentScreen.on_screen[index] && AircraftFilter_IsVisible(&currentScreen, index);
+
+    if (!shown && index == selectedAircraft) {
+        selectedAircraft = -1;
+        FrameScheduler_Request(FRAME_INFO);
+    }
+
+    ScreenGrid_Update(index, shown, currentScreen.x[index], currentScreen.y[index]);
+}
+
+
+/**
+ * @brief Maps every live aircraft's ground offset to the radar at the current scale.
+ *
+ * Must be called with the live store locked for writing.
+ */
+static void scale_all_aircraft(void) {
+    Projection_ScaleBatch(&radarProjection, currentScreen.offset_x, currentScreen.offset_y, currentAircrafts->count,
+                          currentScreen.x, currentScreen.y, currentScreen.on_screen);
+
+    for (int16_t i = 0; i < currentAircrafts->count; i++) {
+        place_aircraft(i);
+    }
+}
+
+
+/**
+ * @brief Maps the aircraft nearest the center to the radar at the current scale.
+ *
+ * The rest are left as they were, off the radar. Must be called with the live store
+ * locked for writing.
+ *
+ * @param count Ranks of the distance index to scale, from DistanceIndex_Within.
+ */
+static void scale_nearest_aircraft(int16_t count) {
+    for (int16_t rank = 0; rank < count; rank++) {
+        int16_t index = DistanceIndex_Slot(rank);
+        Projection_ScaleBatch(&radarProjection, &currentScreen.offset_x[index], &currentScreen.offset_y[index], 1,
+                              &currentScreen.x[index], &currentScreen.y[index], &currentScreen.on_screen[index]);
+        place_aircraft(index);
+    }
+}
+
+
+/**
+ * @brief Projects a single aircraft onto the radar from its real-world coordinates.
+ *
+ * The aircraft is drawn where dead reckoning puts it at `now`, not where it was last
+ * reported. Aircraft outside the display range are marked as off-screen, and if that
+ * aircraft was selected the selection is cleared. Must be called with
+ * the live store locked for writing.
+ *
+ * @param index Slot of the aircraft in `currentAircrafts`.
+ * @param now   DeadReckoning_Now().
+ */
+void project_aircraft(int16_t index, uint16_t now) {
+    int32_t longitude, latitude;
+    DeadReckoning_Position(&currentMotion, currentAircrafts, index, now, &longitude, &latitude);
+
+    // Check Display Range and Map to Screen Coordinates
+    Projection_OffsetBatch(&radarProjection, &longitude, &latitude, 1,
+                           &currentScreen.offset_x[index], &currentScreen.offset_y[index]);
+    Projection_ScaleBatch(&radarProjection, &currentScreen.offset_x[index], &currentScreen.offset_y[index], 1,
+                          &currentScreen.x[index], &currentScreen.y[index], &currentScreen.on_screen[index]);
+    DistanceIndex_Update(index);
+    place_aircraft(index);
+}
+
+
+/**
+ * @brief Projects every aircraft in the live store at the current display range.
+ *
+ * Positions are dead reckoned a batch at a time and their ground offsets worked out
+ * straight into the screen table, which is then scaled to pixels in one pass. Must be
+ * called with the live store locked for writing.
+ */
+void project_all_aircraft(void) {
+
+    // The range may have changed, the scale is the only part that depends on it
+    Projection_SetRange(&radarProjection, display_range_km);
+
+    uint16_t now = DeadReckoning_Now();
+    int32_t longitude[PROJECTION_BATCH];
+    int32_t latitude[PROJECTION_BATCH];
+
+    for (int16_t first = 0; first < currentAircrafts->count; first += PROJECTION_BATCH) {
+        int16_t count = currentAircrafts->count - first;
+        if (count > PROJECTION_BATCH)
+            count = PROJECTION_BATCH;
+
+        for (int16_t i = 0; i < count; i++) {
+            DeadReckoning_Position(&currentMotion, currentAircrafts, first + i, now, &longitude[i], &latitude[i]);
+        }
+
+        Projection_OffsetBatch(&radarProjection, longitude, latitude, count,
+                               &currentScreen.offset_x[first], &currentScreen.offset_y[first]);
+    }
+
+    // Everyone drifted a little, so the distance order only needs touching up
+    DistanceIndex_SetBatch(currentAircrafts->count);
+    DistanceIndex_Sort();
+
+    scale_all_aircraft();
+}
+
+
+/**
+ * @brief Fills the live store with the traffic snapshot saved before the last reset.
+ *
+ * The last picture is on the first frame, marked stale until a burst replaces it, and
+ * its aircraft carry on by dead reckoning from where they were saved. They age from the
+ * boot like any others, a link that stays down clears them out. Must be called
+ * after init_aircraft_tables and Clock_Init, and before the scheduler is launched.
+ */
+void warm_start_aircraft(void) {
+    TrafficSnapshot_Init();
+
+    uint16_t now = DeadReckoning_Now();
+    int16_t records = TrafficSnapshot_Count();
+
+    for (int16_t i = 0; i < records && currentAircrafts->count < MAX_AIRCRAFTS; i++) {
+        int16_t index = currentAircrafts->count;
+        TrafficSnapshot_Read(i, currentAircrafts, index, now);
+
+        // A save that raced a burst can hold an aircraft twice
+        if (AircraftIndex_Find(currentIndex, currentAircrafts->icao24[index]) != AIRCRAFT_INDEX_EMPTY)
+            continue;
+
+        AircraftIndex_Insert(currentIndex, currentAircrafts->icao24[index], index);
+        AircraftAging_Add(&currentAging, index, now);
+        AircraftFilter_Apply(currentAircrafts, &currentScreen, index);
+        currentAircrafts->count++;
+        update_vectors(index);
+    }
+
+    if (currentAircrafts->count == 0)
+        return;
+
+    trafficStale = true;
+    project_all_aircraft();
+    LOG_INFO(LOG_WARM_START, currentAircrafts->count);
 }
 
 
@@ -74,93 +404,170 @@ void int_to_string(int32_t value, char *buffer) {
  * display screen. Aircraft outside the display range are marked as off-screen. The display range
  * and the center of the map are taken into account.
  *
- * The function locks the currentAircrafts array with a semaphore to ensure thread-safe access.
+ * Each aircraft costs a couple of integer multiply-adds, so a full reprojection is cheap
+ * even with a full table. A range change doesn't need one, see rescale_screen_positions.
+ *
+ * The function locks the currentAircrafts store for writing to ensure thread-safe access.
  */
 void recalculate_screen_positions(void) {
-    const int16_t radar_top = 70;
-    const int16_t radar_bottom = 279;
-    const int16_t radar_height = radar_bottom - radar_top + 1;
-    const int16_t radar_center_x = X_MAX / 2;
-    const int16_t radar_center_y = radar_top + (radar_height / 2);
-    float max_pixel_radius = 100.0f;
-
-    G8RTOS_WaitSemaphore(&sem_CURRENT_AIRCRAFTS);
-    for (int i = 0; i < currentAircraftCount; i++) {
-        AircraftData_t *aircraft = &currentAircrafts[i];
-
-        // Calculate Differences
-        float delta_latitude = aircraft->latitude - CENTER_LATITUDE;
-        float delta_longitude = aircraft->longitude - CENTER_LONGITUDE;
-
-        // Convert to Distances
-        float latitude_in_radians = CENTER_LATITUDE * (M_PI / 180.0f);
-        float km_per_degree_lat = 111.32f;
-        float km_per_degree_lon = 111.32f * cosf(latitude_in_radians);
-
-        float distance_latitude_km = delta_latitude * km_per_degree_lat;
-        float distance_longitude_km = delta_longitude * km_per_degree_lon;
-
-        // Calculate Distance and Angle
-        float distance_from_center = sqrtf(distance_latitude_km * distance_latitude_km +
-                                           distance_longitude_km * distance_longitude_km);
-
-        float angle = atan2f(distance_latitude_km, distance_longitude_km);
-
-        // Check Display Range
-        if (distance_from_center > display_range_km) {
-            aircraft->on_screen = false;
-            if (i == selectedAircraft) {
-                selectedAircraft = -1;
-                G8RTOS_SignalSemaphore(&sem_INFO_DISPLAY);
-            }
-            continue;
-        } else {
-            aircraft->on_screen = true;
-        }
+    lock_current_aircrafts();
+
+    project_all_aircraft();
+
+    // Relinquish control of array
+    unlock_current_aircrafts();
+}
+
+
+/**
+ * @brief Moves every aircraft to where it lands at a new display range.
+ *
+ * Only the ground offsets from the last projection are rescaled, with no dead reckoning
+ * or geo math, so the aircraft stay where they were last drawn and just move in or out
+ * with the zoom. The next projection refreshes them as usual.
+ *
+ * Aircraft too far out to be on the radar at either range are off it before and after,
+ * so only the ones the distance index puts within the larger reach are touched.
+ *
+ * The function locks the currentAircrafts store for writing to ensure thread-safe access.
+ */
+void rescale_screen_positions(void) {
+    lock_current_aircrafts();
+
+    uint32_t reach_squared = radarProjection.reach_squared;
+    Projection_SetRange(&radarProjection, display_range_km);
+    if (radarProjection.reach_squared > reach_squared)
+        reach_squared = radarProjection.reach_squared;
+
+    // With everything in reach one pass over the columns beats going rank by rank
+    int16_t within = DistanceIndex_Within(reach_squared);
+    if (within < currentAircrafts->count)
+        scale_nearest_aircraft(within);
+    else
+        scale_all_aircraft();
+
+    unlock_current_aircrafts();
+}
+
+
+/**
+ * @brief Moves the radar center, and every aircraft with it.
+ *
+ * Projection_SetCenter works out the tangent plane at the new center once, then one pass
+ * over the live store redoes the dead-reckoning rates, which depend on it, and a second
+ * reprojects. Trails are started over, their points are relative to the old center.
+ *
+ * The function locks the currentAircrafts store for writing to ensure thread-safe access.
+ *
+ * @param latitude  New center in micro-degrees.
+ * @param longitude Likewise.
+ */
+void recenter_radar(int32_t latitude, int32_t longitude) {
+    lock_current_aircrafts();
+
+    Projection_SetCenter(&radarProjection, latitude, longitude);
+    for (int16_t i = 0; i < currentAircrafts->count; i++) {
+        DeadReckoning_SetMotion(&currentMotion, &radarProjection, currentAircrafts, i);
+    }
+    project_all_aircraft();
 
-        // Map to Screen Coordinates
-        float scale = max_pixel_radius / display_range_km;
-        float pixel_distance = distance_from_center * scale;
+    unlock_current_aircrafts();
+
+    RadarRenderer_Invalidate();
+    FrameScheduler_Request(FRAME_RADAR);
+    EventGroup_Set(&conflict_events, EVENT_TRAFFIC_CHANGED);
+}
 
-        int16_t screen_x = radar_center_x + (int16_t)(pixel_distance * cosf(angle));
-        int16_t screen_y = radar_center_y - (int16_t)(pixel_distance * sinf(angle));
 
-        aircraft->screen_x = abs(screen_x);
-        aircraft->screen_y = abs(screen_y);
+/**
+ * @brief Re-anchors the radar where a PROTOCOL_FRAME_CENTER says, and stores it if asked.
+ *
+ * Centers beyond 85 degrees of latitude are refused, the longitude scale falls apart
+ * close to the poles.
+ */
+static void apply_center(const ProtocolCenter_t *center) {
+    const int32_t MAX_LATITUDE = 85 * PROJECTION_UNITS_PER_DEGREE;
+    const int32_t MAX_LONGITUDE = 180 * PROJECTION_UNITS_PER_DEGREE;
 
-        /*UARTprintf("CallSign: %s\t", aircraft->callsign);
-        UARTprintf("X: %d\tY: %d\t", screen_x, screen_y);
+    if (abs(center->latitude) > MAX_LATITUDE || abs(center->longitude) > MAX_LONGITUDE) {
+        LOG_WARN(LOG_CENTER_REJECTED, center->latitude, center->longitude);
+        return;
+    }
 
-        char float_buffer[FLOAT_BUFF_SIZE];
-        float_to_string(distance_from_center, float_buffer, 2);
-        UARTprintf("Distance from center: %s km\t", float_buffer);
-        UARTprintf("Display Range: %d km\t", display_range_km);
+    recenter_radar(center->latitude, center->longitude);
 
-        float_to_string(pixel_distance, float_buffer, 2);
-        UARTprintf("Pixel Distance: %s\t", float_buffer);
+    bool stored = false;
+    if (center->flags & PROTOCOL_CENTER_STORE) {
+        SiteConfig_t site = { center->latitude, center->longitude };
+        stored = SiteConfig_Store(&site);
+    }
+    LOG_INFO(LOG_CENTER, center->latitude, center->longitude, stored);
+}
 
-        float_to_string(delta_longitude, float_buffer, 2);
-        UARTprintf("Delta Lon: %s\t", float_buffer);
 
-        float_to_string(delta_latitude, float_buffer, 2);
-        UARTprintf("Delta Lat: %s\t", float_buffer);
+/**
+ * @brief Switches to the display filter a PROTOCOL_FRAME_FILTER carries.
+ *
+ * The feeder sends it ahead of every keyframe, an unchanged filter costs nothing. A new
+ * one is applied to every live aircraft once and the screen grid refiled to match, at
+ * their last projected positions.
+ */
+static void apply_filter(const ProtocolFilter_t *wire) {
+    AircraftFilter_t filter = { wire->min_altitude, wire->max_altitude, wire->min_velocity, wire->flags };
 
-        float_to_string(aircraft->latitude, float_buffer, 2);
-        UARTprintf("Lat: %s\t", float_buffer);
+    lock_current_aircrafts();
 
-        float_to_string(aircraft->longitude, float_buffer, 2);
-        UARTprintf("Lon: %s\n", float_buffer);*/
+    bool changed = AircraftFilter_Set(&filter);
+    if (changed) {
+        for (int16_t i = 0; i < currentAircrafts->count; i++) {
+            AircraftFilter_Apply(currentAircrafts, &currentScreen, i);
+            place_aircraft(i);
+        }
     }
 
-    // Relinquish control of array
-    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+    unlock_current_aircrafts();
+
+    if (changed) {
+        LOG_INFO(LOG_FILTER, filter.min_altitude, filter.max_altitude, filter.min_velocity, filter.flags);
+        FrameScheduler_Request(FRAME_RADAR);
+    }
 }
 
 
 
+/**
+ * @brief Finds the aircraft drawn nearest the radar center.
+ *
+ * The distance index is walked from the center out, so this is the first one shown,
+ * nearly always rank 0. Called under a read of `seq_CURRENT_AIRCRAFTS`, the result is
+ * only good if that read holds.
+ *
+ * @return int16_t Its index, or -1 if nothing is on screen.
+ */
+int16_t closest_aircraft_to_center(void) {
+    int16_t count = DistanceIndex_Count();
+
+    // A writer may be halfway through the index, never walk past the store
+    if (count > MAX_AIRCRAFTS)
+        count = MAX_AIRCRAFTS;
+
+    for (int16_t rank = 0; rank < count; rank++) {
+        int16_t index = DistanceIndex_Slot(rank);
+        if (currentScreen.on_screen[index] && AircraftFilter_IsVisible(&currentScreen, index))
+            return index;
+    }
+    return -1;
+}
+
+
 /**
  * @brief Finds the index of the closest aircraft, prioritizing direction but always selecting an on-screen aircraft.
  *
+ * The joystick deflection is turned into a direction on screen and the screen grid is
+ * searched outward from the selected aircraft, so candidates are compared by how far
+ * ahead and how far off that direction they are projected. Called under a read of `seq_CURRENT_AIRCRAFTS`, the result is only good if
+ * that read holds.
+ *
  * @param joystick_dx Joystick X position.
  * @param joystick_dy Joystick Y position.
  * @return int16_t The index of the closest aircraft to the joystick's direction,
@@ -169,232 +576,716 @@ void recalculate_screen_positions(void) {
 int16_t closest_aircraft_by_angle(int32_t joystick_dx, int32_t joystick_dy) {
     const int16_t MIDPOINT = 4096 / 2;
 
+    // A writer may clear the selection while this runs, so it is read once
+    int16_t selected = selectedAircraft;
+
     // Ensure there's a selected aircraft
-    if (selectedAircraft == -1) {
+    if (selected == -1) {
         return -1;
     }
 
-    // Compute joystick deltas from midpoint
-    int32_t dx = joystick_dx - MIDPOINT;
-    int32_t dy = joystick_dy - MIDPOINT;
+    // Compute joystick deltas from midpoint, the X axis reads east as negative and the Y
+    // axis reads north as negative, which on screen is +x and -y respectively
+    int32_t direction_x = MIDPOINT - joystick_dx;
+    int32_t direction_y = joystick_dy - MIDPOINT;
+
+    int16_t closestIndex = ScreenGrid_NearestInDirection(&currentScreen, currentScreen.x[selected],
+                                                         currentScreen.y[selected],
+                                                         direction_x, direction_y, selected);
+
+    // Leave previous selection if there's nothing in that direction
+    if(closestIndex == SCREEN_GRID_NONE)
+        return selected;
+
+    return closestIndex;
+}
+
+
 
-    float refLatitude = currentAircrafts[selectedAircraft].latitude;
-    float refLongitude = currentAircrafts[selectedAircraft].longitude;
 
-    // Determine direction
-    int8_t goingWest = (abs(dx) > abs(dy)) && (dx > 0);
-    int8_t goingEast = (abs(dx) > abs(dy)) && (dx < 0);
-    int8_t goingSouth = (abs(dy) > abs(dx)) && (dy > 0);
-    int8_t goingNorth = (abs(dy) > abs(dx)) && (dy < 0);
+/**
+ * @brief Logs a full aircraft record from the wire to the debug console.
+ *
+ * Only the raw fields are queued, the host formats them.
+ *
+ * @param wire Record inside a received frame.
+ */
+void log_aircraft(const ProtocolAircraft_t *wire) {
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+
+    // Packed straight from the frame, an empty or invalid callsign shows as N/A
+    const char *callsign = (wire->callsign[0] == ' ') ? "N/A    " : wire->callsign;
 
-    int16_t closestIndex = -1;
-    float minDifference = FLT_MAX;
+    // The 7 ASCII chars fill two whole words once the eighth is cut
+    LOG_DEBUG(LOG_AIRCRAFT, LOG_TEXT(callsign), LOG_TEXT(callsign + 4) & 0x00FFFFFF,
+              wire->longitude, wire->latitude, wire->altitude, wire->velocity, wire->heading);
+#endif
+}
 
-    // For the selected direction, determine closest aircraft
-    for (int i = 0; i < currentAircraftCount; i++) {
-        if (i == selectedAircraft) continue;
 
-        AircraftData_t *aircraft = &currentAircrafts[i];
-        if (!aircraft->on_screen) continue;
+/**
+ * @brief Stamps a live aircraft as heard from, and brightens it if it had gone quiet.
+ *
+ * Must be called with the live store locked for writing.
+ */
+static void mark_seen(int16_t index, uint16_t now) {
+    AircraftAging_Seen(&currentAging, index, now);
+    currentScreen.dimmed[index] = false;
+}
 
-        float deltaLon = aircraft->longitude - refLongitude;
-        float deltaLat = aircraft->latitude - refLatitude;
 
-        if (goingEast && deltaLon > 0.0f) {
-            if (deltaLon < minDifference) {
-                minDifference = deltaLon;
-                closestIndex = i;
+/**
+ * @brief Applies a packed list of delta records to the live store in place.
+ *
+ * Aircraft the firmware doesn't know about are skipped, the next keyframe brings them in.
+ * Must be called with the live store locked for writing.
+ *
+ * @param records Packed delta records, see protocol.h.
+ * @param length  Number of payload bytes in use.
+ */
+void apply_delta_records(const uint8_t *records, uint8_t length) {
+    uint32_t offset = 0;
+
+    while (offset + PROTOCOL_DELTA_HEADER_SIZE <= length) {
+        uint32_t icao24 = records[offset] | (records[offset + 1] << 8) | (records[offset + 2] << 16);
+        uint8_t mask = records[offset + 3];
+        offset += PROTOCOL_DELTA_HEADER_SIZE;
+
+        // Pull out every delta present, in mask bit order
+        int16_t delta[PROTOCOL_DELTA_FIELDS] = {0};
+        for (int32_t field = 0; field < PROTOCOL_DELTA_FIELDS; field++) {
+            if ((mask & (1 << field)) && offset + 2 <= length) {
+                delta[field] = (int16_t)(records[offset] | (records[offset + 1] << 8));
+                offset += 2;
             }
         }
-        else if (goingWest && deltaLon < 0.0f) {
-            float diff = fabsf(deltaLon);
-            if (diff < minDifference) {
-                minDifference = diff;
-                closestIndex = i;
-            }
+
+        int16_t index = AircraftIndex_Find(currentIndex, icao24);
+        if (index == AIRCRAFT_INDEX_EMPTY)
+            continue;
+
+        uint16_t now = DeadReckoning_Now();
+        AircraftStore_ApplyDelta(currentAircrafts, index, delta);
+        mark_seen(index, now);
+
+        // A new position restarts dead reckoning from there, a new vector changes its rate
+        if (mask & (PROTOCOL_DELTA_LONGITUDE | PROTOCOL_DELTA_LATITUDE))
+            currentAircrafts->reported[index] = now;
+        if (mask & (PROTOCOL_DELTA_VELOCITY | PROTOCOL_DELTA_HEADING))
+            update_vectors(index);
+
+        // The filter only looks at altitude and speed, an aircraft it hides or shows again moves in the grid
+        if (mask & (PROTOCOL_DELTA_ALTITUDE | PROTOCOL_DELTA_VELOCITY))
+            AircraftFilter_Apply(currentAircrafts, &currentScreen, index);
+
+        if (mask & (PROTOCOL_DELTA_LONGITUDE | PROTOCOL_DELTA_LATITUDE |
+                    PROTOCOL_DELTA_VELOCITY | PROTOCOL_DELTA_HEADING))
+            project_aircraft(index, now);
+        else if (mask & PROTOCOL_DELTA_ALTITUDE)
+            place_aircraft(index);
+    }
+}
+
+
+/**
+ * @brief Removes one aircraft from the live store.
+ *
+ * The last aircraft is moved into the freed slot, so the selection index follows it.
+ * Must be called with the live store locked for writing.
+ */
+void remove_current_aircraft(int16_t index) {
+    int16_t last = currentAircrafts->count - 1;
+
+    if (index == selectedAircraft) {
+        selectedAircraft = -1;
+        FrameScheduler_Request(FRAME_INFO);
+    } else if (last == selectedAircraft) {
+        selectedAircraft = index;
+    }
+
+    AircraftIndex_Remove(currentIndex, currentAircrafts->icao24[index]);
+    AircraftAging_Remove(&currentAging, index);
+    ScreenGrid_Remove(index);
+    DistanceIndex_Remove(index);
+
+    // Move the last aircraft into the hole and point its index entry and grid cell at the new slot
+    if (index != last) {
+        AircraftStore_Move(currentAircrafts, index, last);
+        AircraftIndex_Insert(currentIndex, currentAircrafts->icao24[index], index);
+        DeadReckoning_Move(&currentMotion, index, last);
+        AircraftAging_Move(&currentAging, index, last);
+        currentEpoch[index] = currentEpoch[last];
+
+        currentScreen.offset_x[index] = currentScreen.offset_x[last];
+        currentScreen.offset_y[index] = currentScreen.offset_y[last];
+        currentScreen.x[index] = currentScreen.x[last];
+        currentScreen.y[index] = currentScreen.y[last];
+        currentScreen.on_screen[index] = currentScreen.on_screen[last];
+        currentScreen.track_dx[index] = currentScreen.track_dx[last];
+        currentScreen.track_dy[index] = currentScreen.track_dy[last];
+        currentScreen.dimmed[index] = currentScreen.dimmed[last];
+        AircraftScreen_AssignBit(currentScreen.conflict, index, AircraftScreen_TestBit(currentScreen.conflict, last));
+        AircraftFilter_Apply(currentAircrafts, &currentScreen, index);
+        ScreenGrid_Remove(last);
+        DistanceIndex_Move(index, last);
+        place_aircraft(index);
+    }
+
+    // The next aircraft to take the last slot starts out of conflict
+    AircraftScreen_AssignBit(currentScreen.conflict, last, false);
+    currentAircrafts->count--;
+}
+
+
+/**
+ * @brief Frees a slot in a full live store by removing the aircraft quiet the longest.
+ *
+ * Only aircraft quiet for AIRCRAFT_AGING_DIM or more are given up, the rest are still
+ * being reported. Must be called with the live store locked for writing.
+ *
+ * @return bool True if a slot was freed, it is the one at the end of the store.
+ */
+static bool recycle_quiet_slot(uint16_t now) {
+    int16_t oldest = AircraftAging_Oldest(&currentAging, currentAircrafts->count, now, AIRCRAFT_AGING_DIM);
+    if (oldest == AIRCRAFT_AGING_NONE)
+        return false;
+
+    remove_current_aircraft(oldest);
+    return true;
+}
+
+
+/**
+ * @brief Inserts or replaces one aircraft in the live store and projects it.
+ *
+ * A full store makes room by dropping the aircraft heard from longest ago, if that one
+ * has been quiet long enough to be dimmed. Must be called with the live store locked for writing.
+ */
+void upsert_current_aircraft(const ProtocolAircraft_t *wire) {
+    uint16_t now = DeadReckoning_Now();
+    int16_t index = AircraftIndex_Find(currentIndex, wire->icao24);
+
+    if (index == AIRCRAFT_INDEX_EMPTY) {
+        if (currentAircrafts->count >= MAX_AIRCRAFTS && !recycle_quiet_slot(now)) {
+            LOG_WARN(LOG_CURRENT_OVERFLOW);
+            return;
         }
-        else if (goingNorth && deltaLat > 0.0f) {
-            if (deltaLat < minDifference) {
-                minDifference = deltaLat;
-                closestIndex = i;
+        index = currentAircrafts->count++;
+        AircraftStore_Decode(currentAircrafts, index, wire, now);
+        AircraftIndex_Insert(currentIndex, wire->icao24, index);
+        AircraftAging_Add(&currentAging, index, now);
+        currentScreen.dimmed[index] = false;
+    } else {
+        AircraftStore_Decode(currentAircrafts, index, wire, now);
+        mark_seen(index, now);
+    }
+    currentEpoch[index] = liveEpoch;
+
+    AircraftFilter_Apply(currentAircrafts, &currentScreen, index);
+    update_vectors(index);
+
+    project_aircraft(index, now);
+}
+
+
+/**
+ * @brief Upserts every aircraft in a COMPACT payload into the live store.
+ *
+ * A record sent by dictionary entry keeps the callsign the live store holds. If the
+ * aircraft has left the store since, it is counted as a miss instead, and the feeder
+ * defines it again. Must be called with the live store locked for writing.
+ */
+void apply_compact_records(const uint8_t *payload, uint8_t length) {
+    CompactReader_t reader;
+    ProtocolAircraft_t wire;
+    bool named;
+
+    Compact_Begin(&reader, payload, length);
+    while (Compact_Next(&reader, &wire, &named)) {
+        if (!named) {
+            int16_t index = AircraftIndex_Find(currentIndex, wire.icao24);
+            if (index == AIRCRAFT_INDEX_EMPTY) {
+                Compact_Miss();
+                continue;
             }
-        }
-        else if (goingSouth && deltaLat < 0.0f) {
-            float diff = fabsf(deltaLat);
-            if (diff < minDifference) {
-                minDifference = diff;
-                closestIndex = i;
+            uint64_t callsign = AircraftStore_Callsign(currentAircrafts, index);
+            if (callsign != AIRCRAFT_CALLSIGN_NONE) {
+                char text[AIRCRAFT_CALLSIGN_SIZE];
+                AircraftStore_CallsignText(callsign, text);
+                memcpy(wire.callsign, text, AIRCRAFT_CALLSIGN_SIZE - 1);
             }
         }
+
+        log_aircraft(&wire);
+        upsert_current_aircraft(&wire);
     }
+}
 
-    // Leave previous selection if there's nothing in that direction
-    if(closestIndex == -1)
-        return selectedAircraft;
 
-    return closestIndex;
+/**
+ * @brief Removes aircraft the feeder no longer reports from the live store.
+ *
+ * Must be called with the live store locked for writing.
+ */
+void apply_removals(const uint8_t *payload, uint8_t length) {
+    uint8_t count = payload[0];
+
+    for (uint8_t i = 0; i < count && 1 + (i + 1) * PROTOCOL_ICAO24_SIZE <= length; i++) {
+        const uint8_t *address = &payload[1 + i * PROTOCOL_ICAO24_SIZE];
+        uint32_t icao24 = address[0] | (address[1] << 8) | (address[2] << 16);
+
+        int16_t index = AircraftIndex_Find(currentIndex, icao24);
+        if (index != AIRCRAFT_INDEX_EMPTY)
+            remove_current_aircraft(index);
+    }
 }
 
 
+/**
+ * @brief Ends a progressive keyframe: retires every live aircraft it didn't upsert.
+ *
+ * The burst's upserts were drawn as they arrived, nearest first, instead of waiting for
+ * a swap. Walking down from the end means the aircraft moved into a freed slot has
+ * already been checked. Must be called with the live store locked for writing.
+ */
+void retire_stale_aircraft(void) {
+    for (int16_t i = currentAircrafts->count - 1; i >= 0; i--) {
+        if (currentEpoch[i] != liveEpoch)
+            remove_current_aircraft(i);
+    }
 
+    // Everything left was upserted in this burst, so a skipped aircraft is always one behind
+    liveEpoch++;
+}
 
-/*************************************Threads***************************************/
 
-void Idle_Thread(void) { while(1); }
+/**
+ * @brief Dims the live aircraft that went quiet and removes the ones quiet for too long.
+ *
+ * Only the aging buckets that came due are looked at, see aircraft_aging.h. Must be
+ * called with the live store locked for writing.
+ */
+static void age_aircraft(void) {
+    uint16_t now = DeadReckoning_Now();
+    int16_t removed = 0;
+    int16_t slot;
+
+    while ((slot = AircraftAging_Expire(&currentAging, now, currentScreen.dimmed)) != AIRCRAFT_AGING_NONE) {
+        remove_current_aircraft(slot);
+        removed++;
+    }
 
+    if (removed > 0)
+        LOG_INFO(LOG_AGED_OUT, removed);
+}
 
 
+/**
+ * @brief A hash of what the radar shows of the live aircraft: their pixels, and which are dimmed.
+ *
+ * Must be called with the live store locked.
+ */
+static uint32_t screen_signature(void) {
+    uint32_t hash = 2166136261u ^ (uint16_t)currentAircrafts->count;
+
+    for (int16_t i = 0; i < currentAircrafts->count; i++) {
+        uint32_t pixel = ((uint32_t)(uint16_t)currentScreen.x[i] << 16) | (uint16_t)currentScreen.y[i];
+        hash = (hash ^ pixel ^ ((uint32_t)currentScreen.on_screen[i] << 1) ^ currentScreen.dimmed[i]) * 16777619u;
+    }
+    return hash;
+}
+
 
 /**
- * @brief Displays aircraft positions and information on the screen.
+ * @brief Marks a burst as live: the next frame shows it, and nothing on screen is stale.
  *
- * This thread is responsible for rendering the map display, including range circles and
- * the aircraft positions. It reads the aircraft data from `currentAircrafts` and displays
- * their positions on the screen.
+ * Also lets Save_Snapshot_Thread know the link has gone quiet, and Detect_Conflicts_Thread
+ * that there is new traffic to check.
+ */
+static void burst_published(void) {
+    BurstLatency_Published();
+    trafficStale = false;
+    EventGroup_Set(&snapshot_events, EVENT_PUBLISHED);
+    EventGroup_Set(&conflict_events, EVENT_TRAFFIC_CHANGED);
+}
+
+
+/**
+ * @brief Writes the live store to the flash snapshot ring, for the next warm start.
  *
- * Aircraft positions are calculated based on their real-world coordinates and the display range.
+ * The erases go ahead with the store unlocked, then the aircraft are written a chunk at
+ * a time under the lock. A burst landing part way through can leave an aircraft out or
+ * in twice, the warm start copes with both.
  */
-void Display_Aircrafts_Thread(void) {
-    const int32_t MAX_SIZE = (Y_MAX - MIDLINE) / 2 - 1;
-    const int32_t MIN_SIZE = MAX_SIZE / 2;
-    const int32_t CENTER_X = X_MAX / 2;
-    const int32_t CENTER_Y = (Y_MAX + MIDLINE) / 2;
+static void save_snapshot(void) {
+    Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+    int16_t count = currentAircrafts->count;
+    int32_t center_latitude = radarProjection.center_latitude;
+    int32_t center_longitude = radarProjection.center_longitude;
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+
+    if (!TrafficSnapshot_Begin(count, center_latitude, center_longitude)) {
+        LOG_WARN(LOG_SNAPSHOT_FAILED);
+        return;
+    }
+
+    int16_t saved = 0;
+    for (int16_t first = 0; first < count; first += TRAFFIC_SNAPSHOT_CHUNK) {
+        Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+        saved += TrafficSnapshot_Append(currentAircrafts, first, TRAFFIC_SNAPSHOT_CHUNK);
+        G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+    }
+
+    if (TrafficSnapshot_Finish())
+        LOG_INFO(LOG_SNAPSHOT_SAVED, saved);
+    else
+        LOG_WARN(LOG_SNAPSHOT_FAILED);
+}
+
+
+/**
+ * @brief True in the quiet hours, unless someone used the controls in the last QUIET_HOURS_HOLD_MS.
+ */
+static bool quiet_hours_due(void) {
+    return QuietHours_IsQuiet() && FrameScheduler_InputIdleMs() >= QUIET_HOURS_HOLD_MS;
+}
+
+
+/**
+ * @brief Puts the panel to sleep and hibernates, see quiet_hours.h. Never returns.
+ *
+ * The last frame is let finish first. The SPI lock is kept, so the display thread can't
+ * wake the panel on the way down.
+ */
+static void hibernate(void) {
+    FrameScheduler_Flush();
+    Mutex_LockCounted(&sem_SPIA, &spiLockStats);
+    Panel_SetPower(PANEL_POWER_SLEEP);
+    QuietHours_Hibernate();
+}
+
+
+/**
+ * @brief Hibernates if the quiet hours call for it, or sets quietCheck for when they might.
+ *
+ * A wake from hibernation is given QUIET_HOURS_AWAKE_MS for its burst, which hibernates
+ * again from Save_Snapshot_Thread as soon as it is saved.
+ */
+static void check_quiet_hours(void) {
+    uint32_t wait_ms;
+
+    if (!QuietHours_IsQuiet()) {
+        wait_ms = QuietHours_MsUntilChange();
+    } else if (FrameScheduler_InputIdleMs() < QUIET_HOURS_HOLD_MS) {
+        wait_ms = QUIET_HOURS_HOLD_MS - FrameScheduler_InputIdleMs();
+    } else if (QuietHours_WokeScheduled() && Clock_Millis() < QUIET_HOURS_AWAKE_MS) {
+        wait_ms = QUIET_HOURS_AWAKE_MS - Clock_Millis();
+    } else {
+        // The flash holds the picture already if nothing came in since the warm start
+        if (!trafficStale)
+            save_snapshot();
+        hibernate();
+        return;
+    }
+
+    // No schedule, nothing to check until one comes in
+    if (wait_ms)
+        SoftTimer_Start(&quietCheck, wait_ms, 0);
+    else
+        SoftTimer_Stop(&quietCheck);
+}
+
+
 
-    while(1){
 
-        // Wait for an update event to be signaled
-        G8RTOS_WaitSemaphore(&sem_MAIN_DISPLAY);
+#if CONFLICT_DETECTION_ENABLE
+/**
+ * @brief Hands the conflicts a detector run found to the renderer.
+ *
+ * Only the bits are written, and only if they changed.
+ *
+ * @param sequence  From the Seqlock_ReadBegin the run went under.
+ * @return bool False if the store changed since, run again.
+ */
+static bool commit_conflicts(uint32_t sequence) {
+    Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+
+    bool current = !Seqlock_ReadRetry(&seq_CURRENT_AIRCRAFTS, sequence);
+    bool changed = current && memcmp(currentScreen.conflict, conflictDetector.flagged, sizeof(currentScreen.conflict));
+    if (changed) {
+        Seqlock_WriteBegin(&seq_CURRENT_AIRCRAFTS);
+        memcpy(currentScreen.conflict, conflictDetector.flagged, sizeof(currentScreen.conflict));
+        Seqlock_WriteEnd(&seq_CURRENT_AIRCRAFTS);
+    }
+
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+
+    if (changed)
+        FrameScheduler_Request(FRAME_RADAR);
+    return current;
+}
+#endif
+
 
-        // Main background
-        ST7789_DrawRectangle(0, MIDLINE, X_MAX, Y_MAX, ST7789_BLACK);
 
-        // Draw major/minor radius
-        ST7789_DrawCircle(CENTER_X, CENTER_Y, MAX_SIZE, ST7789_LIGHTORANGE);
-        ST7789_DrawCircle(CENTER_X, CENTER_Y, MIN_SIZE, ST7789_LIGHTORANGE);
-        ST7789_FillCircle(CENTER_X, CENTER_Y,        5, ST7789_LIGHTORANGE);
 
-        // Append current display ranges to the radar circles
-        char buffer[INT_BUFF_SIZE];
-        int_to_string(display_range_km, buffer);
-        char *str= strcat(buffer, " km");
-        ST7789_DrawString((X_MAX - (strlen(str) * (FONT_WIDTH + 1))) / 2, Y_MAX - 15, str, ST7789_LIGHTORANGE, ST7789_BLACK);
+/*************************************Threads***************************************/
 
-        int_to_string(display_range_km / 2, buffer);
-        str= strcat(buffer, " km");
-        ST7789_DrawString((X_MAX - (strlen(str) * (FONT_WIDTH + 1))) / 2, Y_MAX - 68, str, ST7789_LIGHTORANGE, ST7789_BLACK);
+/**
+ * @brief Sleeps the CPU whenever nothing else is running.
+ *
+ * Queued log records are pushed into the UART FIFO first, then WFI stops the core clock
+ * until the next interrupt. The scheduler tick is one of those, so this also wakes every
+ * tick to top the FIFO up, and any thread whose sleep ran out runs right after it as
+ * before. Peripherals keep their run-mode clocks while the core sleeps.
+ *
+ * This is not tickless idle. G8RTOS keeps SysTick and the threads' sleep counts to
+ * itself, so the tick can't be stretched to the next deadline from here.
+ */
+void Idle_Thread(void) {
+    Profile_RegisterThread(PROFILE_IDLE);
+    StackWatch_RegisterThread("Idle");
 
-        // Loop through all current aircrafts, display it on the screen if needed
-        G8RTOS_WaitSemaphore(&sem_CURRENT_AIRCRAFTS);
-        for (int i = 0; i < currentAircraftCount; i++) {
-            AircraftData_t *aircraft = &currentAircrafts[i];
-            if (aircraft->on_screen) {
+    while(1) {
+        Log_Drain();
+        SysCtlSleep();
+    }
+}
 
-                // Calculations for the endpoints of a line representing the heading of the aircraft
-                int16_t d = 30;
-                int16_t x1 = aircraft->screen_x;
-                int16_t y1 = aircraft->screen_y;
-                int16_t dx = x1 + d * cos((90 - aircraft->heading) * 0.0174533);
-                int16_t dy = y1 + d * sin((90 - aircraft->heading) * 0.0174533);
 
-                //UARTprintf("Printing:: Callsign: %s\tX: %d\tY: %d\n", aircraft->callsign, aircraft->screen_x, aircraft->screen_y);
 
 
-                // Use a different color if the aircraft is selected
-                if(i == selectedAircraft){
-                    // Draw aircraft symbol
-                    ST7789_FillCircle(aircraft->screen_x, aircraft->screen_y, 5, ST7789_MAGENTA);
+/**
+ * @brief Draws the radar from the live store.
+ *
+ * Only the parts of the radar that changed since the last frame are repainted. The store
+ * is read without locking it and only while the frame is worked out, never while its
+ * pixels are sent. The renderer keeps what it read, so a frame that raced a writer isn't
+ * read again but followed by another one.
+ */
+static void draw_radar(void) {
+    uint32_t burst_sequence;
 
-                    // Draw callsign next to the aircraft
-                    if(display_callsign)
-                        ST7789_DrawString(aircraft->screen_x + 7, aircraft->screen_y - 5, aircraft->callsign, ST7789_WHITE, ST7789_BLACK);
+    uint32_t sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+    bool shows_burst = BurstLatency_ClaimDraw(&burst_sequence);
 
-                    // Draw the heading line
-                    if(display_track)
-                        ST7789_DrawDottedLine(x1, y1, dx, dy, ST7789_MAGENTA, 3);
+    const AircraftStore_t *aircrafts = currentAircrafts;
+    int16_t selected = selectedAircraft;
+    RadarRenderer_SetStale(trafficStale);
+    RadarRenderer_Prepare(aircrafts, &currentScreen, selected,
+                          display_range_km, display_callsign, display_track, display_trails);
+    uint32_t selected_icao24 = (selected != -1) ? aircrafts->icao24[selected] : 0;
+
+    bool torn = Seqlock_ReadRetry(&seq_CURRENT_AIRCRAFTS, sequence);
+
+    Mutex_LockCounted(&sem_SPIA, &spiLockStats);
+    RadarRenderer_Paint();
+    G8RTOS_SignalSemaphore(&sem_SPIA);
+
+    if (torn) {
+        FrameScheduler_Request(FRAME_RADAR);
+        return;
+    }
+
+    // Range, center and selection changes are always redrawn, so this sees every one of them
+    ViewReport_Update(display_range_km, radarProjection.center_latitude, radarProjection.center_longitude,
+                      selected != -1, selected_icao24, quiet_hours_due());
+
+    // Blits wait for their DMA to finish, so the pixels are on the panel by now
+    if (shows_burst)
+        BurstLatency_Drawn(burst_sequence);
+}
+
+
+
+/**
+ * @brief Formats the closest approach line of the information panel.
+ *
+ * Reads like "CPA UAL123 2.4 KM IN 140 S", with the other aircraft's callsign, or its
+ * ICAO24 address if it has none.
+ */
+static void format_approach(const AircraftStore_t *aircrafts, const ClosestApproach_t *approach, char *line) {
+    if (approach->slot == CLOSEST_APPROACH_NONE) {
+        strcpy(line, "CPA N/A");
+        return;
+    }
+
+    char *end = line;
+    memcpy(end, "CPA ", 4);
+    end += 4;
+
+    if (AircraftStore_HasCallsign(aircrafts, approach->slot)) {
+        AircraftStore_CallsignText(AircraftStore_Callsign(aircrafts, approach->slot), end);
+        end += AIRCRAFT_CALLSIGN_SIZE - 1;
+        while (end[-1] == ' ' || end[-1] == '\0')
+            end--;
+    } else {
+        for (int32_t shift = 20; shift >= 0; shift -= 4) {
+            *end++ = "0123456789ABCDEF"[(approach->icao24 >> shift) & 0xF];
+        }
+    }
+
+    // 1/64 km to tenths of a kilometer
+    *end++ = ' ';
+    end += Format_Fixed((approach->distance * 10 + (1 << (PROJECTION_OFFSET_BITS - 1))) >> PROJECTION_OFFSET_BITS,
+                        1, 1, end);
+    memcpy(end, " KM IN ", 7);
+    end += 7;
+    end += Format_Int(approach->seconds, end);
+    strcpy(end, " S");
+}
 
-                } else {
-                    // Draw aircraft symbol
-                    ST7789_FillCircle(aircraft->screen_x, aircraft->screen_y, 3, ST7789_BLUE);
 
-                    // Draw callsign next to the aircraft
-                    if(display_callsign)
-                        ST7789_DrawString(aircraft->screen_x + 5, aircraft->screen_y - 5, aircraft->callsign, ST7789_WHITE, ST7789_BLACK);
 
-                    // Draw the heading line
-                    if(display_track)
-                        ST7789_DrawDottedLine(x1, y1, dx, dy, ST7789_BLUE, 3);
-                }
+/**
+ * @brief Draws the information panel for the selected aircraft.
+ *
+ * The top portion of the screen shows the selected aircraft's call sign, latitude,
+ * longitude, altitude, velocity, and heading, and which aircraft will pass closest to it
+ * in the next CLOSEST_APPROACH_HORIZON_S, how close and when. The panel is only redrawn
+ * when the selection or the traffic changes, so that is all the closest approach is
+ * worked out for. Only the characters that changed since the last time are sent, see
+ * info_panel.h.
+ */
+void draw_aircraft_info(void) {
+    char CallSign[AIRCRAFT_CALLSIGN_SIZE];
+    char Longitude[FORMAT_FIXED_SIZE];
+    char Latitude[FORMAT_FIXED_SIZE];
+    char Altitude[FORMAT_FIXED_SIZE];
+    char Velocity[FORMAT_FIXED_SIZE];
+    char TrueTrack[FORMAT_FIXED_SIZE];
+    char Approach[4 + AIRCRAFT_CALLSIGN_SIZE + FORMAT_FIXED_SIZE + 7 + FORMAT_INT_SIZE + 2];
+    int16_t selected;
+    uint32_t selected_icao24 = 0;
+    uint32_t sequence;
+
+    // Copied out without locking the store, and again if a writer got in the way
+    do {
+        sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+        const AircraftStore_t *aircrafts = currentAircrafts;
+        int16_t i = selectedAircraft;
+        selected = -1;
 
-            }
+        // if there is a selected aircraft, populate that data
+        if (i != -1 && i < aircrafts->count) {
+            AircraftStore_CallsignText(AircraftStore_Callsign(aircrafts, i), CallSign);
+
+            // Print the fixed-point fields at the precision they're stored with
+            Format_Fixed(aircrafts->longitude[i], AIRCRAFT_POSITION_DIGITS, 4, Longitude);
+            Format_Fixed(aircrafts->latitude[i], AIRCRAFT_POSITION_DIGITS, 4, Latitude);
+            Format_Int(aircrafts->altitude[i], Altitude);
+            Format_Fixed(aircrafts->velocity[i], AIRCRAFT_VELOCITY_DIGITS, 1, Velocity);
+            Format_Fixed(aircrafts->heading[i], AIRCRAFT_HEADING_DIGITS, 1, TrueTrack);
+
+            selected = i;
+            selected_icao24 = aircrafts->icao24[i];
+        } else {
+            strcpy(CallSign, "N/A");
+            strcpy(Longitude, "N/A");
+            strcpy(Latitude, "N/A");
+            strcpy(Altitude, "N/A");
+            strcpy(Velocity, "N/A");
+            strcpy(TrueTrack, "N/A");
+            strcpy(Approach, "");
+        }
+    } while (Seqlock_ReadRetry(&seq_CURRENT_AIRCRAFTS, sequence));
+
+    // The search is too long to repeat for every writer that gets in, so it runs once for
+    // the aircraft copied above and a torn result waits for the next frame, as the radar does
+    if (selected != -1) {
+        sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+        const AircraftStore_t *aircrafts = currentAircrafts;
+
+        bool same = selected < aircrafts->count && aircrafts->icao24[selected] == selected_icao24;
+        if (same) {
+            ClosestApproach_Find(&selectedApproach, &radarProjection, &currentMotion, aircrafts, &currentScreen, selected);
+            format_approach(aircrafts, &selectedApproach, Approach);
         }
-        G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
 
-        sleep(100);
+        if (!same || Seqlock_ReadRetry(&seq_CURRENT_AIRCRAFTS, sequence)) {
+            FrameScheduler_Request(FRAME_INFO);
+            return;
+        }
     }
+
+    const char *const values[INFO_FIELDS] = {
+        [INFO_CALLSIGN] = CallSign, [INFO_LONGITUDE] = Longitude, [INFO_LATITUDE] = Latitude,
+        [INFO_ALTITUDE] = Altitude, [INFO_TRACK] = TrueTrack, [INFO_VELOCITY] = Velocity,
+        [INFO_APPROACH] = Approach
+    };
+
+    // The radar may be streaming pixels by DMA, wait for the bus
+    Mutex_LockCounted(&sem_SPIA, &spiLockStats);
+    InfoPanel_Draw(values);
+    G8RTOS_SignalSemaphore(&sem_SPIA);
 }
 
 
 
 /**
- * @brief Displays detailed information about a selected aircraft.
- *
- * This thread updates the bottom portion of the screen to show detailed information such as
- * the selected aircraft's call sign, latitude, longitude, altitude, velocity, and heading.
+ * @brief Displays aircraft positions and information on the screen.
  *
- * It waits for a semaphore to signal when an update is needed.
+ * This thread is the only one that draws to the screen. Other threads mark the radar or
+ * the information panel dirty through the frame scheduler, which wakes this thread at
+ * most once every FRAME_INTERVAL_MS with everything requested since the last frame. The
+ * scheduler also decides when the panel dims and sleeps, this thread applies it.
  */
-void Display_Aircraft_Info_Thread(void) {
-
-    while (1) {
+void Display_Thread(void) {
+    Profile_RegisterThread(PROFILE_DISPLAY);
+    StackWatch_RegisterThread("Display");
 
-        // Wait for some update to refresh this
-        G8RTOS_WaitSemaphore(&sem_INFO_DISPLAY);
-
-        char *CallSign = "N/A";
-        char Longitude[FLOAT_BUFF_SIZE] = "N/A";
-        char Latitude[FLOAT_BUFF_SIZE] = "N/A";
-        char Altitude[FLOAT_BUFF_SIZE] = "N/A";
-        char Velocity[FLOAT_BUFF_SIZE] = "N/A";
-        char TrueTrack[FLOAT_BUFF_SIZE] = "N/A";
-
-        // if there is a selected aircraft, populate that data
-        if (selectedAircraft != -1 && selectedAircraft < MAX_AIRCRAFTS) {
-            AircraftData_t *aircraft = &currentAircrafts[selectedAircraft];
+    while(1){
 
-            CallSign = aircraft->callsign;
+        // Wait for the next frame and the parts that need to be redrawn
+        Supervisor_Idle(SUPERVISOR_RENDER);
+        uint32_t parts = FrameScheduler_WaitFrame();
+        Supervisor_Busy(SUPERVISOR_RENDER);
 
-            // Cast floats to strings for printing
-            float_to_string(aircraft->longitude, Longitude, 4);
-            float_to_string(aircraft->latitude, Latitude, 4);
-            float_to_string(aircraft->altitude, Altitude, 4);
-            float_to_string(aircraft->velocity, Velocity, 4);
-            float_to_string(aircraft->heading, TrueTrack, 4);
+        // Dim, sleep or wake before drawing, a waking panel draws everything straight after
+        if (parts & FRAME_POWER) {
+            Mutex_LockCounted(&sem_SPIA, &spiLockStats);
+            Panel_SetPower(FrameScheduler_GetPower());
+            G8RTOS_SignalSemaphore(&sem_SPIA);
         }
 
-        // Draw background
-        ST7789_DrawRectangle(0, 0, X_MAX, MIDLINE, ST7789_LGRAY);
+        if (parts & (FRAME_RADAR | FRAME_MOTION))
+            draw_radar();
 
-        // Populate Information
-        ST7789_DrawString(10, MIDLINE - 15, "CALL SIGN", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(10, MIDLINE - 25, CallSign, ST7789_BLACK, ST7789_LGRAY);
+        if (parts & FRAME_INFO)
+            draw_aircraft_info();
 
-        ST7789_DrawString(95, MIDLINE - 15, "LONGITUDE", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(95, MIDLINE - 25, Longitude, ST7789_BLACK, ST7789_LGRAY);
+        if (parts & ~FRAME_POWER)
+            FrameScheduler_FrameDone();
 
-        ST7789_DrawString(175, MIDLINE - 15, "LATITUDE", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(175, MIDLINE - 25, Latitude, ST7789_BLACK, ST7789_LGRAY);
-
-        ST7789_DrawString(10, MIDLINE - 43, "ALTITUDE", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(10, MIDLINE - 53, Altitude, ST7789_BLACK, ST7789_LGRAY);
+        // Retry a latency or view report that found the transmit buffer busy
+        BurstLatency_Flush();
+        ViewReport_Flush();
+    }
+}
 
-        ST7789_DrawString(95, MIDLINE - 43, "TRUE TRACK", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(95, MIDLINE - 53, TrueTrack, ST7789_BLACK, ST7789_LGRAY);
 
-        ST7789_DrawString(175, MIDLINE - 43, "VELOCITY", ST7789_BLACK, ST7789_LGRAY);
-        ST7789_DrawString(175, MIDLINE - 53, Velocity, ST7789_BLACK, ST7789_LGRAY);
 
-        sleep(100);
+/**
+ * @brief Makes a selection worked out from a read of the live store.
+ *
+ * The search itself runs without the lock, only this store takes it.
+ *
+ * @param index     The aircraft to select, or -1.
+ * @param sequence  From the Seqlock_ReadBegin the search ran under.
+ * @return bool False if the store changed since, search again.
+ */
+static bool commit_selection(int16_t index, uint32_t sequence) {
+    Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+
+    bool current = !Seqlock_ReadRetry(&seq_CURRENT_AIRCRAFTS, sequence);
+    if (current) {
+        Seqlock_WriteBegin(&seq_CURRENT_AIRCRAFTS);
+        selectedAircraft = index;
+        Seqlock_WriteEnd(&seq_CURRENT_AIRCRAFTS);
     }
+
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+    return current;
 }
 
 
@@ -404,266 +1295,532 @@ void Display_Aircraft_Info_Thread(void) {
  *
  * This thread reads joystick inputs to navigate through the list of on-screen aircraft.
  * It identifies the nearest aircraft in the direction of the joystick movement and
- * selects it for display.
+ * selects it for display. A press selects the aircraft closest to the centre, whether or
+ * not one is selected already. Holding a tilt moves the selection again every
+ * `INPUT_REPEAT_MS`.
+ *
+ * Neither input sleeps the thread: presses arrive from the debounce timer, and
+ * `joystickSample` wakes it every `INPUT_POLL_MS` to read the tilt. With the ADC
+ * comparators watching the deadzone (JOYSTICK_USE_ADC) that only happens between the
+ * stick leaving the deadzone and coming back, otherwise for as long as an aircraft is
+ * selected.
  *
  * The selection is signaled to update the screen with new aircraft details.
  */
 void Select_Aircraft_Thread(void){
     int32_t joystick_dx, joystick_dy, joystick_dxy;
     int8_t joystick_debounce = true;
+    uint32_t last_hop_ms = 0;
+
+    Profile_RegisterThread(PROFILE_SELECT);
+    StackWatch_RegisterThread("Select");
 
     while(1){
 
-        // with no selected aircraft, pick the most centered one!
-        if(selectedAircraft == -1){
+        // One wait covers both inputs: a settled press, a tilt out of the deadzone, or the next joystick sample
+        uint32_t events = EventGroup_Wait(&select_events,
+                                          EVENT_JOYSTICK_PRESS | EVENT_JOYSTICK_TILT | EVENT_JOYSTICK_SAMPLE,
+                                          EVENT_GROUP_ANY | EVENT_GROUP_CLEAR, EVENT_GROUP_FOREVER);
 
-            // wait for a button press to signal
-            G8RTOS_WaitSemaphore(&sem_Joystick_Debounce);
-            sleep(5);
+        // a press always picks the most centered one!
+        if(events & EVENT_JOYSTICK_PRESS){
 
             int32_t press_status = JOYSTICK_GetPress();
-            UARTprintf("press_status: %d \n", press_status);
+            LOG_DEBUG(LOG_JOYSTICK_PRESS, press_status);
+            FrameScheduler_Activity();
 
             // Iterate through the visible aircrafts and select the one closest to the center
             if(press_status){
 
-                int32_t min_distance = INT32_MAX;
-
-
-                G8RTOS_WaitSemaphore(&sem_CURRENT_AIRCRAFTS);
-                for (int i = 0; i < currentAircraftCount; i++) {
-                    AircraftData_t *aircraft = &currentAircrafts[i];
-                    if (aircraft->on_screen) {
-                        int32_t dx = aircraft->screen_x - (X_MAX / 2);
-                        int32_t dy = aircraft->screen_y - ((Y_MAX + ((Y_MAX - 70) / 2)) / 2);
-                        int32_t distance = dx * dx + dy * dy;
-
-                        if (distance < min_distance) {
-                            min_distance = distance;
-                            selectedAircraft = i;
-                        }
-                    }
-                }
-                G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+                int16_t nearest;
+                uint32_t sequence;
+                do {
+                    sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+                    nearest = closest_aircraft_to_center();
+                } while (!commit_selection(nearest, sequence));
 
                 // Signal the display to refresh with the new selection
-                G8RTOS_SignalSemaphore(&sem_INFO_DISPLAY);
-                G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+                FrameScheduler_Request(FRAME_ALL);
 
             }
 
 
-            // Clear the interrupt
-            GPIOIntClear(JOYSTICK_INT_GPIO_BASE, JOYSTICK_INT_PIN);
-
-            // Re-enable interrupt for the joystick
-            GPIOIntEnable(GPIO_PORTD_BASE, JOYSTICK_INT_PIN);
+            // Clear and re-enable the interrupt after the hold-off, so the same press doesn't select twice
+            SoftTimer_Start(&joystickHoldoff, INPUT_HOLDOFF_MS, 0);
+        }
 
-            sleep (1000);
+        // Only sample the tilt while there is a selection to move, and with the
+        // comparators watching, only once the stick has left the deadzone
+        bool tilted = !JOYSTICK_USE_ADC || (events & EVENT_JOYSTICK_TILT);
+        if(selectedAircraft == -1){
+            SoftTimer_Stop(&joystickSample);
+        } else if(tilted && !SoftTimer_IsArmed(&joystickSample)){
+            SoftTimer_Start(&joystickSample, INPUT_POLL_MS, INPUT_POLL_MS);
         }
 
         // check for any change requested in selected aircraft
-        else {
+        if((events & (EVENT_JOYSTICK_TILT | EVENT_JOYSTICK_SAMPLE)) && selectedAircraft != -1){
 
-            // Read the joystick data from the FIFO (packed as 32 bits: upper 16 bits = X, lower 16 bits = Y)
-            joystick_dxy = JOYSTICK_GetXY();
+            // Read the joystick (packed as 32 bits: lower 16 bits = X, upper 16 bits = Y)
+            joystick_dxy = JoystickAdc_GetXY();
 
             // Unpack the X and Y values
             joystick_dx = joystick_dxy & 0xFFFF;          // Lower 16 bits for X
             joystick_dy = (joystick_dxy >> 16) & 0xFFFF;  // Upper 16 bits for Y
 
             // Ignore joystick movement in the deadzone
-            const int32_t DEADZONE = 900;
-            const int32_t MIDPOINT = 4096 / 2;
-
-            // Check if the joystick is in a neutral state
-            int8_t isNeutral = (joystick_dx > (MIDPOINT - DEADZONE) && joystick_dx < (MIDPOINT + DEADZONE) &&
-                                joystick_dy > (MIDPOINT - DEADZONE) && joystick_dy < (MIDPOINT + DEADZONE));
+            int8_t isNeutral = JoystickAdc_IsNeutral(joystick_dxy);
 
-            if (!isNeutral) {
+            // The first sample of a tilt moves the selection, then it repeats while the tilt is held
+            uint32_t now = Clock_Millis();
+            if (isNeutral) {
+                joystick_debounce = true;
 
-                // Debounce check
-                if(!joystick_debounce){
-                    sleep(100);
-                    continue;
-                }
+                // Back in the deadzone, the comparators take over until it next leaves
+                if (JOYSTICK_USE_ADC)
+                    SoftTimer_Stop(&joystickSample);
+            } else if (joystick_debounce || now - last_hop_ms >= INPUT_REPEAT_MS) {
 
-                UARTprintf("X pos: %d \t", joystick_dx);
-                UARTprintf("Y pos: %d \n", joystick_dy);
+                LOG_DEBUG(LOG_JOYSTICK_XY, joystick_dx, joystick_dy);
+                FrameScheduler_Activity();
                 joystick_debounce = false;
+                last_hop_ms = now;
 
                 // Update the currently selected aircraft & update the display to reflect that
-                selectedAircraft = closest_aircraft_by_angle(joystick_dx, joystick_dy);
-                G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
-                G8RTOS_SignalSemaphore(&sem_INFO_DISPLAY);
-
-
-            } else {
-                joystick_debounce = true;
-                sleep(50);
-                continue;
+                int16_t closest;
+                uint32_t sequence;
+                do {
+                    sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+                    closest = closest_aircraft_by_angle(joystick_dx, joystick_dy);
+                } while (!commit_selection(closest, sequence));
+                FrameScheduler_Request(FRAME_ALL);
             }
         }
-
-        sleep(100);
     }
 }
 
 
+/**
+ * @brief Sets the display range, clamped to its limits, and rescales the radar to it.
+ *
+ * @return bool True if the range changed.
+ */
+static bool set_display_range(int16_t target_km) {
+    int16_t range_km = (target_km > DISPLAY_MAX_RANGE_KM) ? DISPLAY_MAX_RANGE_KM :
+                       (target_km < DISPLAY_MIN_RANGE_KM) ? DISPLAY_MIN_RANGE_KM : target_km;
+    if (range_km == display_range_km)
+        return false;
+
+    display_range_km = range_km;
+    rescale_screen_positions();
+    FrameScheduler_Request(FRAME_RADAR);
+    return true;
+}
+
+
+/**
+ * @brief Keeps the display settings for the next boot, if they changed.
+ */
+static void store_display_settings(void) {
+    DisplaySettings_t settings = { display_range_km, display_track, display_callsign, display_trails };
+
+    SiteConfig_StoreDisplay(&settings);
+}
+
+
 /**
  * @brief Updates the display range based on button inputs.
  *
- * This thread listens for button presses to increase or decrease the display range. If
- * the range changes, it recalculates the aircraft positions and signals the main display
- * to refresh.
+ * This thread listens for button presses to increase or decrease the display range. A
+ * press of SW1 or SW2 steps the range by 10 km. Held past `INPUT_REPEAT_MS`, the range
+ * keeps zooming by 1/32 of itself every `ZOOM_FRAME_MS` until the button is let go or a
+ * limit is reached. Range changes only rescale the projected aircraft, see
+ * rescale_screen_positions, and signal the main display to refresh.
  *
- * The range is constrained between `MIN_RANGE` and `MAX_RANGE`.
+ * The range is constrained between `DISPLAY_MIN_RANGE_KM` and `DISPLAY_MAX_RANGE_KM`.
+ * Settings are stored once the buttons are let go, so a held zoom is one EEPROM write.
  */
 void Update_Search_Range(void){
 
-    const int16_t MAX_RANGE = 200;
-    const int16_t MIN_RANGE = 20;
-
     uint8_t button_status = 0;
+    uint8_t zoom_button = 0;
 
-    while(1){
-        // wait for button semaphore
-        G8RTOS_WaitSemaphore(&sem_PCA9555_Debounce);
+    Profile_RegisterThread(PROFILE_RANGE);
+    StackWatch_RegisterThread("Range");
 
-        // debounce buttons
-        sleep(5);
+    while(1){
+        // wait for a button interrupt, raised by the debounce timer once the buttons settle, or a zoom step
+        uint32_t events = EventGroup_Wait(&range_events, EVENT_BUTTONS | EVENT_ZOOM,
+                                          EVENT_GROUP_ANY | EVENT_GROUP_CLEAR, EVENT_GROUP_FOREVER);
 
         // Get buttons
         G8RTOS_WaitSemaphore(&sem_I2CA);
         button_status = MultimodButtons_Get();
         G8RTOS_SignalSemaphore(&sem_I2CA);
 
+        // Any press or release wakes the panel and brings back the full frame rate
+        FrameScheduler_Activity();
+
+        // A held zoom carries on while its button is down, the step grows with the range
+        if (events & EVENT_ZOOM) {
+            int16_t step = (display_range_km >> ZOOM_STEP_SHIFT) ? (display_range_km >> ZOOM_STEP_SHIFT) : 1;
+            bool held = !(button_status & zoom_button);
+
+            if (!held || !set_display_range(display_range_km + ((zoom_button == SW1) ? step : -step))) {
+                SoftTimer_Stop(&zoomStep);
+                zoom_button = 0;
+                store_display_settings();
+            }
+        }
+
+        if (!(events & EVENT_BUTTONS))
+            continue;
+
         // clear button interrupt
         GPIOIntClear(BUTTONS_INT_GPIO_BASE, BUTTONS_INT_PIN);
 
+        // Any change of the buttons ends a held zoom, a new press starts another
+        SoftTimer_Stop(&zoomStep);
+        zoom_button = 0;
+
 
         // check which buttons are pressed -- Increment or Decrement display range
         if (!(button_status & SW1)) {
-            UARTprintf("SW1: +10km Search Range\n");
-            display_range_km = (display_range_km + 10 <= MAX_RANGE) ? (display_range_km + 10) : MAX_RANGE;
-            recalculate_screen_positions();
-            G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+            LOG_INFO(LOG_RANGE_UP);
+            set_display_range(display_range_km + 10);
+            zoom_button = SW1;
+            SoftTimer_Start(&zoomStep, INPUT_REPEAT_MS, ZOOM_FRAME_MS);
         }
 
         else if (!(button_status & SW2)) {
-            UARTprintf("SW2: -10km Search Range\n");
-            display_range_km = (display_range_km - 10 >= MIN_RANGE) ? (display_range_km - 10) : MIN_RANGE;
-            recalculate_screen_positions();
-            G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+            LOG_INFO(LOG_RANGE_DOWN);
+            set_display_range(display_range_km - 10);
+            zoom_button = SW2;
+            SoftTimer_Start(&zoomStep, INPUT_REPEAT_MS, ZOOM_FRAME_MS);
+        }
+
+        // Both toggle buttons together switch the trail mode
+        else if (!(button_status & SW3) && !(button_status & SW4)) {
+            LOG_INFO(LOG_TOGGLE_TRAILS);
+            display_trails = !display_trails;
+            FrameScheduler_Request(FRAME_RADAR);
         }
 
         else if (!(button_status & SW3)) {
-            UARTprintf("SW3: Toggle True Track\n");
+            LOG_INFO(LOG_TOGGLE_TRACK);
             display_track = !display_track;
-            G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+            FrameScheduler_Request(FRAME_RADAR);
         }
 
         else if (!(button_status & SW4)) {
-            UARTprintf("SW2: Toggle CallSign\n");
+            LOG_INFO(LOG_TOGGLE_CALLSIGN);
             display_callsign = !display_callsign;
-            G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+            FrameScheduler_Request(FRAME_RADAR);
         }
 
-        // Re-enable interrupt for the buttons
-        GPIOIntEnable(GPIO_PORTE_BASE, BUTTONS_INT_PIN);
+        if (!zoom_button)
+            store_display_settings();
+
+        // Re-enable interrupt for the buttons after a hold-off, an edge in the meantime is latched and fires then
+        SoftTimer_Start(&buttonsHoldoff, INPUT_POLL_MS, 0);
+    }
+}
+
+
+
+/**
+ * @brief Whether a frame is one the feeder's BurstBuffer counts into BURST_END's frame_count.
+ *
+ * Center, schedule, link rate and node frames are sent on their own, outside any burst,
+ * and aren't among them.
+ */
+static bool counts_toward_burst(uint8_t type) {
+    switch (type) {
+        case PROTOCOL_FRAME_AIRCRAFT:
+        case PROTOCOL_FRAME_UPSERT:
+        case PROTOCOL_FRAME_COMPACT:
+        case PROTOCOL_FRAME_DELTA:
+        case PROTOCOL_FRAME_REMOVE:
+        case PROTOCOL_FRAME_FILTER:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Staged aircraft so far, read under the staging lock.
+ */
+static int16_t staged_count(void) {
+#if AIRCRAFT_STAGING_ENABLE
+    Mutex_LockCounted(&sem_STAGING_AIRCRAFTS, &stagingLockStats);
+    int16_t count = stagingAircrafts->count;
+    G8RTOS_SignalSemaphore(&sem_STAGING_AIRCRAFTS);
+    return count;
+#else
+    return 0;
+#endif
+}
+
+#if AIRCRAFT_STAGING_ENABLE
 
-        sleep(50);
+/**
+ * @brief Appends one keyframe aircraft to the staging store.
+ *
+ * A repeated address replaces the old record. The staging store is locked here.
+ */
+void stage_aircraft(const ProtocolAircraft_t *wire) {
+    uint16_t now = DeadReckoning_Now();
+    Mutex_LockCounted(&sem_STAGING_AIRCRAFTS, &stagingLockStats);
+
+    int16_t index = AircraftIndex_Find(stagingIndex, wire->icao24);
+    if (index != AIRCRAFT_INDEX_EMPTY) {
+        AircraftStore_Decode(stagingAircrafts, index, wire, now);
+    } else if (stagingAircrafts->count < MAX_AIRCRAFTS) {
+        index = stagingAircrafts->count++;
+        AircraftStore_Decode(stagingAircrafts, index, wire, now);
+        AircraftIndex_Insert(stagingIndex, wire->icao24, index);
+    } else {
+        LOG_WARN(LOG_STAGING_OVERFLOW);
     }
+
+    G8RTOS_SignalSemaphore(&sem_STAGING_AIRCRAFTS);
 }
+#endif
 
 
 
 /**
  * @brief Processes incoming aircraft data and updates the staging array.
  *
- * This thread reads aircraft data from the FIFO, parses it, and populates the `stagingAircrafts`
- * array. It converts raw integer data into meaningful float values for display.
+ * This thread drains validated frames from the UART receive ring in batches. Keyframe
+ * records populate the `stagingAircrafts` store, while incremental upserts, deltas and
+ * removals are applied to `currentAircrafts` in place. Wire fields are converted straight
+ * into the store's fixed-point columns. Keyframe bursts are forwarded to the swap thread.
+ * Without AIRCRAFT_STAGING_ENABLE keyframe records are upserted into the live store too,
+ * and the burst's end retires whatever it left out, as for PROTOCOL_BURST_RETIRE.
  *
- * If the staging array is full, new data is ignored, and a warning is printed.
+ * If the staging store is full, new data is ignored, and a warning is printed.
  */
 void Process_New_Aircraft_Thread(void) {
 
-    while (1) {
-        // Wait for a complete message to be available
-        G8RTOS_WaitSemaphore(&sem_DATA_READY);
+    int32_t burst_frames = 0;
 
-        // Special case for call-sign
-        int32_t low_byte = G8RTOS_ReadFIFO(DATA_FIFO);
-        int32_t high_byte = G8RTOS_ReadFIFO(DATA_FIFO);
-        int64_t callsign_raw = ((int64_t)high_byte << 32) | low_byte;
+    Profile_RegisterThread(PROFILE_PROCESS);
+    StackWatch_RegisterThread("Process");
 
-        // Send string to array (7 ASCII chars and a null terminator)
-        char callsign[8];
-        for (int32_t i = 0; i < 7; i++) {
-            callsign[i] = (char)((callsign_raw >> (i * 8)) & 0xFF);
-        }
+    while (1) {
+        // Woken once the receive ring has frames, then drain all of them
+        Supervisor_Idle(SUPERVISOR_INGEST);
+        G8RTOS_WaitSemaphore(&sem_DATA_READY);
+        Supervisor_Busy(SUPERVISOR_INGEST);
 
-        // Check for empty or invalid callsign
-        if (callsign[0] == ' ') {
-            strncpy(callsign, "N/A    ", sizeof(callsign));
-        }
+        // Each frame sits in a receive ring slot, already CRC checked
+        const ProtocolFrame_t *frame;
+        while ((frame = UartRx_PeekFrame()) != NULL) {
 
-        UARTprintf("Call Sign: %s\t", callsign);
+            // On a bus, frames for the other displays and the bus's own framing, see bus_node.h
+            if (!BusNode_Accept(frame)) {
+                UartRx_ReleaseFrame();
+                continue;
+            }
 
+            if (frame->type != PROTOCOL_FRAME_BURST_END)
+                BurstLatency_FrameReceived();
+
+            if (counts_toward_burst(frame->type))
+                burst_frames++;
+
+            switch (frame->type) {
+
+                // Keyframe bursts build up in the staging array and are swapped in at the end,
+                // or without staging are upserted as they arrive and retired at the end
+                case PROTOCOL_FRAME_AIRCRAFT: {
+                    const ProtocolAircraft_t *wire = (const ProtocolAircraft_t *)frame->payload;
+                    log_aircraft(wire);
+
+#if AIRCRAFT_STAGING_ENABLE
+                    stage_aircraft(wire);
+#else
+                    lock_current_aircrafts();
+                    upsert_current_aircraft(wire);
+                    unlock_current_aircrafts();
+                    FrameScheduler_Request(FRAME_RADAR);
+#endif
+                    break;
+                }
 
-        // Cast the scaled integer into floats
-        int32_t longitude_int = G8RTOS_ReadFIFO(DATA_FIFO);
-        int32_t latitude_int = G8RTOS_ReadFIFO(DATA_FIFO);
-        int32_t altitude_int = G8RTOS_ReadFIFO(DATA_FIFO);
-        int32_t velocity_int = G8RTOS_ReadFIFO(DATA_FIFO);
-        int32_t heading_int = G8RTOS_ReadFIFO(DATA_FIFO);
+                // Incremental updates are applied to the live array right away
+                case PROTOCOL_FRAME_UPSERT: {
+                    const ProtocolAircraft_t *wire = (const ProtocolAircraft_t *)frame->payload;
+                    log_aircraft(wire);
 
-        float longitude = (float)longitude_int / 10000.0f;
-        float latitude = (float)latitude_int / 10000.0f;
-        float altitude = (float)altitude_int / 10000.0f;
-        float velocity = (float)velocity_int / 10000.0f;
-        float heading = (float)heading_int / 10000.0f;
+                    lock_current_aircrafts();
+                    upsert_current_aircraft(wire);
+                    unlock_current_aircrafts();
 
+                    // Drawn as it lands, the scheduler folds a whole burst into a few frames
+                    FrameScheduler_Request(FRAME_RADAR);
+                    break;
+                }
 
-        // cast floats to strings and print the strings
-        char buffer[FLOAT_BUFF_SIZE];
+                // Several upserts to a frame, see compact.h
+                case PROTOCOL_FRAME_COMPACT:
+                    lock_current_aircrafts();
+                    apply_compact_records(frame->payload, frame->length);
+                    unlock_current_aircrafts();
+                    FrameScheduler_Request(FRAME_RADAR);
+                    break;
+
+                case PROTOCOL_FRAME_DELTA:
+                    lock_current_aircrafts();
+                    apply_delta_records(frame->payload, frame->length);
+                    unlock_current_aircrafts();
+                    FrameScheduler_Request(FRAME_RADAR);
+                    break;
+
+                case PROTOCOL_FRAME_REMOVE:
+                    lock_current_aircrafts();
+                    apply_removals(frame->payload, frame->length);
+                    unlock_current_aircrafts();
+                    FrameScheduler_Request(FRAME_RADAR);
+                    break;
+
+                // End-of-burst frame, everything before it has been parsed already
+                case PROTOCOL_FRAME_BURST_END: {
+                    const ProtocolBurstEnd_t *burst_end = (const ProtocolBurstEnd_t *)frame->payload;
+
+                    if (burst_end->frame_count != burst_frames)
+                        LOG_WARN(LOG_BURST_LOST, burst_end->frame_count - burst_frames);
+
+                    BurstLatency_BurstEnd(burst_end);
+                    LinkHealth_BurstEnd();
+
+                    // Keyframes need the swap, incremental bursts are live already and only need a redraw
+                    if (AIRCRAFT_STAGING_ENABLE &&
+                        ((burst_end->flags & PROTOCOL_BURST_KEYFRAME) || staged_count() > 0)) {
+                        G8RTOS_SignalSemaphore(&sem_BURST_COMPLETE);
+                    } else {
+                        if (burst_end->flags & (AIRCRAFT_STAGING_ENABLE ? PROTOCOL_BURST_RETIRE :
+                                                PROTOCOL_BURST_RETIRE | PROTOCOL_BURST_KEYFRAME)) {
+                            lock_current_aircrafts();
+                            retire_stale_aircraft();
+                            unlock_current_aircrafts();
+                        }
+                        burst_published();
+                        FrameScheduler_Request(selectedAircraft != -1 ? FRAME_ALL : FRAME_RADAR);
+                    }
 
-        float_to_string(longitude, buffer, 4);
-        UARTprintf("Longitude: %s\t", buffer);
+                    burst_frames = 0;
+                    break;
+                }
 
-        float_to_string(latitude, buffer, 4);
-        UARTprintf("Latitude: %s\t", buffer);
+                // Link rate handshake, see link_rate.h
+                case PROTOCOL_FRAME_BAUD:
+                    LinkRate_Request((const ProtocolBaud_t *)frame->payload);
+                    break;
+
+                case PROTOCOL_FRAME_BAUD_TEST:
+                    LinkRate_TestFrame(frame->payload, frame->length);
+                    break;
+
+                // Site setup from the feeder, see site_config.h
+                case PROTOCOL_FRAME_CENTER:
+                    apply_center((const ProtocolCenter_t *)frame->payload);
+                    break;
+
+                case PROTOCOL_FRAME_FILTER:
+                    apply_filter((const ProtocolFilter_t *)frame->payload);
+                    break;
+
+                // New quiet hours may start, or end, right away
+                case PROTOCOL_FRAME_SCHEDULE:
+                    if (QuietHours_Set((const ProtocolSchedule_t *)frame->payload))
+                        EventGroup_Set(&snapshot_events, EVENT_QUIET_CHECK);
+                    break;
+
+                // Bus node for the next boot, set once per unit
+                case PROTOCOL_FRAME_NODE:
+                    BusNode_Store((const ProtocolNode_t *)frame->payload);
+                    break;
+
+                // Skip frame types this thread doesn't handle
+                default:
+                    break;
+            }
 
-        float_to_string(altitude, buffer, 4);
-        UARTprintf("Altitude: %s\t", buffer);
+            // Every field has been used, hand the slot back to the receiver
+            UartRx_ReleaseFrame();
+        }
+    }
+}
 
-        float_to_string(velocity, buffer, 4);
-        UARTprintf("Velocity: %s\t", buffer);
 
-        float_to_string(heading, buffer, 4);
-        UARTprintf("True Track: %s\n", buffer);
 
+#if AIRCRAFT_STAGING_ENABLE
+/**
+ * @brief Publishes the staging store as the live one and starts the staging store over.
+ *
+ * The two stores trade roles by pointer, along with their indexes. Every swapped-in
+ * aircraft then has its rates worked out, and is aged, filtered and projected, since the
+ * screen and motion columns belong to the live store only. The distance order is carried
+ * over by address rather than rebuilt. Both stores are locked here.
+ */
+void publish_staged_aircraft(void) {
+    // Synchronize access to staging array and currentAircrafts
+    Mutex_LockCounted(&sem_STAGING_AIRCRAFTS, &stagingLockStats);
+    lock_current_aircrafts();
+
+    // Remember the selected aircraft by identity, its index will change
+    uint32_t selectedIcao24 = 0;
+    if(selectedAircraft != -1)
+        selectedIcao24 = currentAircrafts->icao24[selectedAircraft];
+
+    // Publish the staging store by swapping roles, readers only wait for a few stores
+    AircraftStore_t *aircrafts = currentAircrafts;
+    currentAircrafts = stagingAircrafts;
+    stagingAircrafts = aircrafts;
+
+    AircraftIndex_t *index = currentIndex;
+    currentIndex = stagingIndex;
+    stagingIndex = index;
+
+    // Every swapped-in aircraft counts as seen in the current epoch, and heard from just now
+    uint16_t now = DeadReckoning_Now();
+    memset(currentEpoch, liveEpoch, sizeof(currentEpoch));
+    memset(currentScreen.dimmed, false, sizeof(currentScreen.dimmed));
+    memset(currentScreen.conflict, 0, sizeof(currentScreen.conflict));
+    AircraftAging_Init(&currentAging, now);
+
+    // Follow the selected aircraft to its new slot, or drop it if it's gone
+    if(selectedAircraft != -1){
+        selectedAircraft = AircraftIndex_Find(currentIndex, selectedIcao24);
+        FrameScheduler_Request(FRAME_INFO);
+    }
 
+    // The screen and motion columns are shared by both stores, so calculate where the new
+    // aircrafts belong before anyone else reads them. The grid is refilled along the way.
+    for (int i = 0; i < currentAircrafts->count; i++) {
+        update_vectors(i);
+        AircraftAging_Add(&currentAging, i, now);
+        AircraftFilter_Apply(currentAircrafts, &currentScreen, i);
+    }
+    ScreenGrid_Clear();
 
-        // Pack collected information into struct
+    // Mostly the same aircraft under new slots, so the distance order only needs touching up
+    DistanceIndex_Renumber(stagingAircrafts, currentIndex, currentAircrafts->count);
+    project_all_aircraft();
 
-        AircraftData_t aircraftData;
-        strncpy(aircraftData.callsign, callsign, 8);
+    // The burst is live from here, the next frame drawn shows it
+    burst_published();
 
-        // Assign the float values
-        aircraftData.longitude = longitude;
-        aircraftData.latitude = latitude;
-        aircraftData.altitude = altitude;
-        aircraftData.velocity = velocity;
-        aircraftData.heading = heading;
+    unlock_current_aircrafts();
 
-        // Append new aircraft to staging array
-        if (stagingAircraftCount < MAX_AIRCRAFTS)
-            stagingAircrafts[stagingAircraftCount++] = aircraftData;
-        else
-            UARTprintf("Staging array overflow!\n");
+    // The old live store is only reachable through the staging pointer now, start it over
+    AircraftStore_Clear(stagingAircrafts);
+    AircraftIndex_Clear(stagingIndex);
 
-    }
+    G8RTOS_SignalSemaphore(&sem_STAGING_AIRCRAFTS);
 }
 
 
@@ -671,59 +1828,290 @@ void Process_New_Aircraft_Thread(void) {
 /**
  * @brief Transfers data from the staging array to the main aircraft array and updates screen positions.
  *
- * This thread synchronizes the `stagingAircrafts` array with the `currentAircrafts` array when a
- * burst of new data is received. It recalculates the screen positions for all updated aircraft
+ * This thread publishes the `stagingAircrafts` store as the new `currentAircrafts` store when a
+ * burst of new data is received. The two stores trade roles by pointer, so the swap itself takes
+ * constant time no matter how many aircraft there are. It recalculates the screen positions for all updated aircraft
  * and signals the main display to refresh.
  *
  * Thread-safe access to both arrays is ensured with semaphores.
  */
 void Update_Current_Aircrafts_Thread(void) {
 
+    Profile_RegisterThread(PROFILE_SWAP);
+    StackWatch_RegisterThread("Swap");
+
     while (1) {
         G8RTOS_WaitSemaphore(&sem_BURST_COMPLETE);
-        UARTprintf("BURST SEND COMPLETE!\n");
-
-        // Synchronize access to staging array and currentAircrafts
-        G8RTOS_WaitSemaphore(&sem_CURRENT_AIRCRAFTS);
-        G8RTOS_WaitSemaphore(&sem_STAGING_AIRCRAFTS);
-
-        // Quick check to preserve the selected aircraft
-        char *SelectedCallSign = "N/A";
-        if(selectedAircraft != -1){
-            for (int32_t i = 0; i < currentAircraftCount; i++) {
-                if(selectedAircraft == i)
-                    SelectedCallSign = currentAircrafts[i].callsign;
+        LOG_INFO(LOG_BURST_COMPLETE);
+
+        publish_staged_aircraft();
+
+        // Signal refresh screen
+        FrameScheduler_Request(FRAME_RADAR);
+
+        sleep(SCHEDULE_SWAP_MS);
+
+    }
+
+}
+#endif
+
+
+
+
+/**
+ * @brief Advances every aircraft along its track between bursts.
+ *
+ * Runs every DEAD_RECKONING_TICK_MS and reprojects the live store at the current time, so
+ * aircraft keep moving while the next burst is on its way. The renderer only repaints the
+ * aircraft that actually moved to another pixel, and a tick where none did asks for no
+ * frame at all. Aircraft that stopped reporting are aged out first, see age_aircraft.
+ */
+void Extrapolate_Aircrafts_Thread(void) {
+
+    SchedulePeriod_t period = { 0 };
+
+    Profile_RegisterThread(PROFILE_EXTRAPOLATE);
+    StackWatch_RegisterThread("Extrap");
+
+    while (1) {
+        Schedule_WaitPeriod(&period, DEAD_RECKONING_TICK_MS);
+
+        lock_current_aircrafts();
+        uint32_t before = screen_signature();
+        age_aircraft();
+        project_all_aircraft();
+        bool moved = screen_signature() != before;
+        unlock_current_aircrafts();
+
+        // Slow traffic crosses a pixel every few ticks, the frames in between would draw nothing
+        if (moved)
+            FrameScheduler_Request(FRAME_MOTION);
+    }
+}
+
+
+
+
+/**
+ * @brief Carries the link rate handshake along and falls back when the feeder goes quiet.
+ *
+ * Also restarts the receiver when the link stalls, see link_health.h, and feeds the
+ * watchdog while the parser and the display keep up, see supervisor.h.
+ */
+void Link_Rate_Thread(void) {
+
+    SchedulePeriod_t period = { 0 };
+
+    Profile_RegisterThread(PROFILE_LINK);
+    StackWatch_RegisterThread("Link");
+
+    while (1) {
+        Schedule_WaitPeriod(&period, LINK_RATE_POLL_MS);
+        LinkRate_Service();
+
+        // Frames left in the ring after a restart may have missed their wake-up
+        if (LinkHealth_Service())
+            G8RTOS_SignalSemaphore(&sem_DATA_READY);
+
+        Supervisor_Service();
+    }
+}
+
+
+
+
+/**
+ * @brief Saves the live store for a warm start, after the first burst and then every WARM_START_SAVE_MS.
+ *
+ * Erasing and programming flash stall the CPU, interrupts included, so each save waits
+ * for a burst to be published and goes in the quiet time before the next one. At a full
+ * table of 256 the snapshot ring lasts about five years at this rate.
+ *
+ * In the quiet hours this thread also hibernates the unit, each wake's burst saved first
+ * so the next wake starts from it, see quiet_hours.h.
+ */
+void Save_Snapshot_Thread(void) {
+    bool saved = false;
+    uint32_t saved_ms = 0;
+
+    Profile_RegisterThread(PROFILE_SNAPSHOT);
+    StackWatch_RegisterThread("Snapsht");
+
+    // A press on the WAKE pin counts as input, and holds the unit up like any other
+    if (QuietHours_WokeByPin())
+        FrameScheduler_Activity();
+    check_quiet_hours();
+
+    while (1) {
+        uint32_t events = EventGroup_Wait(&snapshot_events, EVENT_PUBLISHED | EVENT_QUIET_CHECK,
+                                          EVENT_GROUP_ANY | EVENT_GROUP_CLEAR, EVENT_GROUP_FOREVER);
+
+        if (events & EVENT_PUBLISHED) {
+            bool quiet = quiet_hours_due();
+
+            // Bursts published within WARM_START_SAVE_MS of the last save are skipped
+            if (quiet || !saved || Clock_Millis() - saved_ms >= WARM_START_SAVE_MS) {
+                save_snapshot();
+                saved = true;
+                saved_ms = Clock_Millis();
             }
+
+            // The wake's burst is saved, and on the screen once hibernate lets the frame finish
+            if (quiet)
+                hibernate();
         }
 
+        if (events & EVENT_QUIET_CHECK)
+            check_quiet_hours();
+    }
+}
+
+
+
+
+#if CONFLICT_DETECTION_ENABLE
+/**
+ * @brief Looks for aircraft closer than the separation minima, see conflict_detector.h.
+ *
+ * Runs after every published burst or recentered radar, and every CONFLICT_PERIOD_MS in
+ * between as dead reckoning moves the aircraft. The sweep reads the live store without
+ * the lock, so at the lowest priority that does real work it only ever waits for the
+ * commit. Aircraft in conflict are drawn in red, and each pair is logged when it starts.
+ */
+void Detect_Conflicts_Thread(void) {
 
-        // Replace the main array with the staging array
-        for (int32_t i = 0; i < stagingAircraftCount; i++) {
-            currentAircrafts[i] = stagingAircrafts[i];
+    Profile_RegisterThread(PROFILE_CONFLICT);
+    StackWatch_RegisterThread("Conflct");
 
-            // Update selected index if necessary
-            if(currentAircrafts[i].callsign == SelectedCallSign)
-                selectedAircraft = i;
+    while (1) {
+        EventGroup_Wait(&conflict_events, EVENT_TRAFFIC_CHANGED, EVENT_GROUP_ANY | EVENT_GROUP_CLEAR,
+                        CONFLICT_PERIOD_MS);
+
+        uint32_t sequence;
+        do {
+            sequence = Seqlock_ReadBegin(&seq_CURRENT_AIRCRAFTS);
+            ConflictDetector_Run(&conflictDetector, currentAircrafts, &currentScreen);
+        } while (!commit_conflicts(sequence));
+
+        for (int16_t i = 0; i < conflictDetector.pair_count; i++) {
+            if (ConflictDetector_IsNew(&conflictDetector, i))
+                LOG_WARN(LOG_CONFLICT, conflictDetector.pairs[i].icao24[0], conflictDetector.pairs[i].icao24[1]);
         }
+        ConflictDetector_Commit(&conflictDetector);
+    }
+}
+#endif
 
-        // Reset the staging array count for the next burst
-        currentAircraftCount = stagingAircraftCount;
-        stagingAircraftCount = 0;
 
-        // Release semaphores
-        G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
-        G8RTOS_SignalSemaphore(&sem_STAGING_AIRCRAFTS);
 
-        // Calculate where new aircrafts belong on the screen
-        recalculate_screen_positions();
 
-        // Signal refresh screen
-        G8RTOS_SignalSemaphore(&sem_MAIN_DISPLAY);
+/**
+ * @brief Logs the aircraft counts and the parse rate.
+ */
+static void report_traffic(void) {
+    LinkHealthStats_t link;
+    LinkHealth_GetStats(&link);
+
+    Mutex_LockCounted(&sem_CURRENT_AIRCRAFTS, &currentLockStats);
+    uint32_t live = currentAircrafts->count;
+    uint32_t drawn = 0;
+    for (int16_t i = 0; i < currentAircrafts->count; i++) {
+        if (currentScreen.on_screen[i] && AircraftFilter_IsVisible(&currentScreen, i))
+            drawn++;
+    }
+#if CONFLICT_DETECTION_ENABLE
+    uint32_t conflicts = conflictDetector.alerted_count;
+#else
+    uint32_t conflicts = 0;
+#endif
+    G8RTOS_SignalSemaphore(&sem_CURRENT_AIRCRAFTS);
+
+    LOG_INFO(LOG_STATS_TRAFFIC, live, staged_count(), drawn, conflicts, link.frames_per_s);
+}
+
+static void report_lock(const char *name, const MutexStats_t *stats) {
+    LOG_INFO(LOG_STATS_LOCK, LOG_TEXT(name), LOG_TEXT(name + 4), stats->locks, stats->waits,
+             stats->wait_us, stats->worst_wait_us);
+}
 
-        sleep(100);
+/**
+ * @brief Answers a debug console query, one group of counters after another.
+ *
+ * @param groups PROTOCOL_STATS_* groups to log.
+ */
+static void report_stats(uint32_t groups) {
+    if (groups & PROTOCOL_STATS_TRAFFIC)
+        report_traffic();
+
+    if (groups & PROTOCOL_STATS_LINK) {
+        LinkHealth_Report();
+        BusNode_Report();
+        UsbLink_Report();
+    }
+
+    if (groups & PROTOCOL_STATS_FRAMES) {
+        FrameSchedulerStats_t frames;
+        FrameScheduler_GetStats(&frames);
+        uint32_t average = frames.frames ? (uint32_t)(frames.draw_us / frames.frames) : 0;
+        LOG_INFO(LOG_STATS_FRAMES, frames.frames, average, frames.worst_draw_us,
+                 frames.worst_latency_ms, frames.missed);
+        LOG_INFO(LOG_STATS_POWER, frames.motion_frames, frames.sleeps, FrameScheduler_GetPower());
+        RadarRendererStats_t radar;
+        RadarRenderer_GetStats(&radar);
+        LOG_INFO(LOG_STATS_DETAIL, radar.detail, radar.degraded, radar.overruns, radar.worst_us);
+    }
+
+    if (groups & PROTOCOL_STATS_LOCKS) {
+        report_lock(LOCK_NAMES[0], &currentLockStats);
+        report_lock(LOCK_NAMES[1], &stagingLockStats);
+        report_lock(LOCK_NAMES[2], &spiLockStats);
+    }
 
+    if (groups & PROTOCOL_STATS_QUEUES) {
+        LOG_INFO(LOG_STATS_QUEUES, UartRx_GetRingHighWater(), FRAME_RING_SIZE, Log_HighWater(),
+                 LOG_RING_WORDS, Log_Dropped(), UartTx_GetDroppedCount());
     }
 
+    if (groups & PROTOCOL_STATS_STACKS)
+        StackWatch_Report();
+
+    if (groups & PROTOCOL_STATS_CPU) {
+        Profile_Report();
+        Schedule_Report();
+    }
+
+    LOG_INFO(LOG_STATS_END, groups);
+}
+
+/**
+ * @brief Answers statistics queries from the debug console, see System/console.h.
+ *
+ * Also closes a profiler window every PROFILE_REPORT_MS, so the CPU figures always cover
+ * a whole window however long ago the last query was.
+ */
+void Report_Stats_Thread(void) {
+
+    Profile_RegisterThread(PROFILE_REPORT);
+    StackWatch_RegisterThread("Report");
+
+    uint32_t next_sample = Clock_Millis() + PROFILE_REPORT_MS;
+
+    while (1) {
+        int32_t until_sample = (int32_t)(next_sample - Clock_Millis());
+        if (until_sample <= 0) {
+            Profile_Sample();
+            next_sample += PROFILE_REPORT_MS;
+            continue;
+        }
+
+        EventGroup_Wait(&console_events, EVENT_STATS_QUERY, EVENT_GROUP_ANY | EVENT_GROUP_CLEAR,
+                        until_sample);
+
+        uint32_t groups = Console_TakeQuery();
+        if (groups)
+            report_stats(groups);
+    }
 }
 
 
@@ -734,94 +2122,125 @@ void Update_Current_Aircrafts_Thread(void) {
 
 
 /**
- * @brief Handles button interrupts and signals the debounce semaphore.
+ * @brief Handles button interrupts and starts the debounce timer.
  *
  * This handler is triggered when a button press interrupt occurs. It disables the button
- * interrupt temporarily and signals the semaphore responsible for handling the button logic.
+ * interrupt temporarily, and the debounce timer wakes the thread handling the button
+ * logic `INPUT_DEBOUNCE_MS` later.
  */
 void Button_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_BUTTONS);
 
     //UARTprintf("Button interrupt triggered!\n");
 
     // Disable interrupt
     GPIOIntDisable(GPIO_PORTE_BASE, BUTTONS_INT_PIN);
 
-    // Signal semaphore to handle button press
-    G8RTOS_SignalSemaphore(&sem_PCA9555_Debounce);
+    // Wake the thread that handles button presses once they have settled
+    SoftTimer_Start(&buttonsDebounce, INPUT_DEBOUNCE_MS, 0);
+
+    Profile_IsrExit();
 }
 
 
 
 void Joystick_Button_Handler(void){
+    Profile_IsrEnter(PROFILE_ISR_JOYSTICK);
 
     //UARTprintf("Joystick interrupt triggered!\n");
 
     // Disable interrupt
     GPIOIntDisable(GPIO_PORTD_BASE, JOYSTICK_INT_PIN);
 
-    // Signal semaphore to handle joystick press
-    G8RTOS_SignalSemaphore(&sem_Joystick_Debounce);
+    // Wake the selection thread once the press has settled
+    SoftTimer_Start(&joystickDebounce, INPUT_DEBOUNCE_MS, 0);
 
+    Profile_IsrExit();
 }
 
 
 
 /**
- * @brief Handles incoming UART data for aircraft information.
- *
- * This handler processes incoming UART data from the FIFO. It reads bytes into a buffer and
- * reconstructs 32-bit words. Completed messages trigger semaphores to signal the data-ready
- * threads. End-of-burst signals are handled separately.
- */
-void UART4_Handler(void) {
-    uint32_t status = UARTIntStatus(UART4_BASE, true);
-    UARTIntClear(UART4_BASE, status);
-
-    static uint8_t byte_buffer[4];          // Temporary buffer to hold 4 bytes
-    static uint8_t byte_index = 0;          // Tracks how many bytes have been read
-    static uint8_t message_byte_count = 0;  // Tracks total bytes in the message
-
-    while (UARTCharsAvail(UART4_BASE)) {
-        // Read one byte
-        uint8_t received_byte = UARTCharGetNonBlocking(UART4_BASE);
-
-        // Add it to the buffer
-        byte_buffer[byte_index++] = received_byte;
-        message_byte_count++;
-
-        // If the buffer is full (4 bytes), write to FIFO as an int32_t
-        if (byte_index == 4) {
-            int32_t word = (byte_buffer[0]) |
-                           (byte_buffer[1] << 8) |
-                           (byte_buffer[2] << 16) |
-                           (byte_buffer[3] << 24);
-
-            // if the end burst signal is sent, signal the semaphore
-            if(word == 0xFFFFFFFF){
-                G8RTOS_SignalSemaphore(&sem_BURST_COMPLETE);
-                message_byte_count = 0;
-            } else {
-
-                // otherwise send the data to the FIFO for processing
-                G8RTOS_WriteFIFO(DATA_FIFO, word);
-            }
+ * @brief Handles the ADC1 comparator interrupt, raised when the joystick leaves the deadzone.
+ */
+void Joystick_Tilt_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_ADC1);
 
-            byte_index = 0; // Reset buffer index
+    if (JoystickAdc_HandleInterrupt()) {
+        EventGroup_Set(&select_events, EVENT_JOYSTICK_TILT);
+    }
+
+    Profile_IsrExit();
+}
+
+
+
+/**
+ * @brief Handles the Timer 1A interrupt, raised when the earliest software timer is due.
+ */
+void Timer1A_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_TIMER1A);
+    SoftTimer_HandleInterrupt();
+    Profile_IsrExit();
+}
+
+
+
+/**
+ * @brief Handles the display SSI interrupt, raised when a pixel DMA chunk finishes.
+ */
+void SSI3_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_SSI3);
+    Panel_HandleInterrupt();
+    Profile_IsrExit();
+}
 
-        }
 
-        // If the entire message is received, signal the thread
-        if (message_byte_count >= MESSAGE_SIZE) {
-            G8RTOS_SignalSemaphore(&sem_DATA_READY);
-            message_byte_count = 0;
-        }
 
+/**
+ * @brief Handles the debug console's receive interrupt, raised when a query comes in.
+ */
+void UART0_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_UART0);
+
+    if (Console_HandleInterrupt()) {
+        EventGroup_Set(&console_events, EVENT_STATS_QUERY);
     }
+
+    Profile_IsrExit();
 }
 
 
 
+/**
+ * @brief Handles incoming UART data for aircraft information.
+ *
+ * The receive path validates each frame (preamble, length and CRC) into the receive ring
+ * and resynchronizes on errors. The parser drains the ring on every wake-up, so it is
+ * only signaled when the ring stops being empty.
+ */
+RAMFUNC void UART4_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_UART4);
+
+    if (UartRx_HandleInterrupt()) {
+        G8RTOS_SignalSemaphore(&sem_DATA_READY);
+    }
 
+    Profile_IsrExit();
+}
 
+/**
+ * @brief Handles the USB device port, the feeder's other way in.
+ *
+ * Uplink frames land in a ring of their own, which the parser drains along with UART4's,
+ * so it is signaled the same way.
+ */
+void USB0_Handler(void) {
+    Profile_IsrEnter(PROFILE_ISR_USB0);
 
+    if (UsbLink_HandleInterrupt()) {
+        G8RTOS_SignalSemaphore(&sem_DATA_READY);
+    }
 
+    Profile_IsrExit();
+}
@@ -4,24 +4,54 @@
 /************************************Includes***************************************/
 
 #include "./G8RTOS/G8RTOS.h"
+#include "./Link/protocol.h"
+#include "./System/mutex.h"
+#include "./System/seqlock.h"
+#include "./System/event_group.h"
+#include "./Display/screen_geometry.h"
 
 /************************************Includes***************************************/
 
 /*************************************Defines***************************************/
 
-#define DATA_FIFO           0
-#define BUTTONS_FIFO        1
-#define JOYSTICK_FIFO       2
-#define Aircrafts_FIFO      4
+#define MESSAGE_SIZE        40   // total bytes for each v2 frame (see protocol.h)
+#ifndef MAX_AIRCRAFTS
+#define MAX_AIRCRAFTS       100  // max number of allowed aircrafts, what SRAM has room for, see aircraft_store.h
+#endif
 
-#define MESSAGE_SIZE        28   // total bytes for each aircraft message
-#define FLOAT_BUFF_SIZE     20   // for the buffer size of casting floats to strings
-#define INT_BUFF_SIZE       12
-#define MAX_AIRCRAFTS       200  // max number of allowed aircrafts
+// Optional features, each costs slots, see aircraft_store.h
+#ifndef AIRCRAFT_STAGING_ENABLE
+#define AIRCRAFT_STAGING_ENABLE     0    // 1 = keyframes fill a second store that is swapped in whole
+#endif
+#ifndef CONFLICT_DETECTION_ENABLE
+#define CONFLICT_DETECTION_ENABLE   0    // 1 = Detect_Conflicts_Thread, see conflict_detector.h
+#endif
 
 #define M_PI                3.14159265358979323846
 #define RAD_TO_DEG          (180.0f / M_PI)
-#define MIDLINE             70
+
+#define INPUT_DEBOUNCE_MS   5    // settle time between an input interrupt and reading it
+#define INPUT_POLL_MS       20   // joystick sampling period while an aircraft is selected
+#define INPUT_HOLDOFF_MS    250  // ignore the joystick button this long after a press
+#define INPUT_REPEAT_MS     300  // a held tilt moves the selection again this often
+#define ZOOM_FRAME_MS       40   // a held SW1 or SW2 zooms a step this often, after INPUT_REPEAT_MS
+#define ZOOM_STEP_SHIFT     5    // each zoom step changes the range by 1/32
+
+#define DISPLAY_MIN_RANGE_KM    20
+#define DISPLAY_MAX_RANGE_KM    200
+
+#define WARM_START_SAVE_MS  300000  // at most one traffic snapshot this often, see traffic_snapshot.h
+#define CONFLICT_PERIOD_MS  1000    // conflict checks between bursts, see conflict_detector.h
+
+#define EVENT_BUTTONS           0x01    // range_events: PCA9555 interrupt, debounced
+#define EVENT_ZOOM              0x02    // range_events: next step of a held zoom
+#define EVENT_JOYSTICK_PRESS    0x01    // select_events: joystick button interrupt, debounced
+#define EVENT_JOYSTICK_SAMPLE   0x02    // select_events: time to sample the joystick tilt
+#define EVENT_JOYSTICK_TILT     0x04    // select_events: ADC comparators saw the stick leave the deadzone
+#define EVENT_PUBLISHED         0x01    // snapshot_events: a burst was made live
+#define EVENT_QUIET_CHECK       0x02    // snapshot_events: the quiet hours may have started, or a wake timed out
+#define EVENT_TRAFFIC_CHANGED   0x01    // conflict_events: a burst was made live or the radar moved
+#define EVENT_STATS_QUERY       0x01    // console_events: the debug console asked for statistics
 
 
 
@@ -33,18 +63,22 @@
 
 semaphore_t sem_I2CA;
 semaphore_t sem_SPIA;
-semaphore_t sem_UART;
-semaphore_t sem_PCA9555_Debounce;
-semaphore_t sem_Joystick_Debounce;
 
+// Wake-ups for the input threads, a flag set twice before its thread runs wakes it once
+EventGroup_t range_events;      // Update_Search_Range
+EventGroup_t select_events;     // Select_Aircraft_Thread
+EventGroup_t snapshot_events;   // Save_Snapshot_Thread
+EventGroup_t conflict_events;   // Detect_Conflicts_Thread
+EventGroup_t console_events;    // Report_Stats_Thread
+
+// Binary semaphores used as locks. Writers to the live store also bump its sequence
+// counter, readers use that instead of the lock (see System/seqlock.h)
 semaphore_t sem_CURRENT_AIRCRAFTS;
 semaphore_t sem_STAGING_AIRCRAFTS;
+seqlock_t seq_CURRENT_AIRCRAFTS;
 semaphore_t sem_DATA_READY;
 semaphore_t sem_BURST_COMPLETE;
 
-semaphore_t sem_MAIN_DISPLAY;
-semaphore_t sem_INFO_DISPLAY;
-
 
 
 
@@ -53,20 +87,29 @@ semaphore_t sem_INFO_DISPLAY;
 
 /***********************************Structures**************************************/
 
-typedef struct {
-    char callsign[8];
-    float longitude;
-    float latitude;
-    float altitude;
-    float velocity;
-    float heading;
-    int16_t screen_x;
-    int16_t screen_y;
-    int8_t on_screen;
-} AircraftData_t;
+/***********************************Structures**************************************/
 
+/********************************Public Functions***********************************/
 
-/***********************************Structures**************************************/
+void init_aircraft_tables(void);
+void init_input_timers(void);
+void warm_start_aircraft(void);
+
+void project_aircraft(int16_t index, uint16_t now);
+void project_all_aircraft(void);
+void recalculate_screen_positions(void);
+void rescale_screen_positions(void);
+void recenter_radar(int32_t latitude, int32_t longitude);
+int16_t closest_aircraft_to_center(void);
+int16_t closest_aircraft_by_angle(int32_t joystick_dx, int32_t joystick_dy);
+
+#if AIRCRAFT_STAGING_ENABLE
+void stage_aircraft(const ProtocolAircraft_t *wire);
+void publish_staged_aircraft(void);
+#endif
+void draw_aircraft_info(void);
+
+/********************************Public Functions***********************************/
 
 /*******************************Background Threads**********************************/
 
@@ -74,13 +117,17 @@ void Idle_Thread(void);
 
 void Process_New_Aircraft_Thread(void);
 void Update_Current_Aircrafts_Thread(void);
+void Extrapolate_Aircrafts_Thread(void);
+void Report_Stats_Thread(void);
+void Link_Rate_Thread(void);
+void Save_Snapshot_Thread(void);
+void Detect_Conflicts_Thread(void);
 
 void Update_Search_Range(void);
 
 void Select_Aircraft_Thread(void);
 
-void Display_Aircraft_Info_Thread(void);
-void Display_Aircrafts_Thread(void);
+void Display_Thread(void);
 
 /*******************************Background Threads**********************************/
 
@@ -92,10 +139,20 @@ void Display_Aircrafts_Thread(void);
 
 void UART4_Handler(void);
 
+void USB0_Handler(void);
+
+void UART0_Handler(void);
+
 void Button_Handler(void);
 
 void Joystick_Button_Handler(void);
 
+void Joystick_Tilt_Handler(void);
+
+void SSI3_Handler(void);
+
+void Timer1A_Handler(void);
+
 /*******************************Aperiodic Threads***********************************/
 
 
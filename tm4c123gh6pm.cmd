@@ -8,10 +8,15 @@
 
 --retain=g_pfnVectors
 
+/* RAMFUNC code room, RAMFUNC_MAX_BYTES in System/ramfunc.h */
+#define RAMFUNC_MAX_BYTES   0x800
+
 MEMORY
 {
-    FLASH (RX) : origin = 0x00000000, length = 0x00040000
-    SRAM (RWX) : origin = 0x20000000, length = 0x00008000
+    /* The top 32 KB hold the traffic snapshot ring, see Radar/traffic_snapshot.h */
+    FLASH (RX) : origin = 0x00000000, length = 0x00038000
+    SRAM (RWX) : origin = 0x20000000, length = 0x00008000 - RAMFUNC_MAX_BYTES
+    SRAM_CODE (RWX) : origin = 0x20008000 - RAMFUNC_MAX_BYTES, length = RAMFUNC_MAX_BYTES
 }
 
 /* The following command line options are set as part of the CCS project.    */
@@ -31,15 +36,24 @@ SECTIONS
     .intvecs:   > 0x00000000
     .text   :   > FLASH
     .const  :   > FLASH
+    .lut    :   > FLASH                 /* FLASH_LUT tables, see System/ramfunc.h */
     .cinit  :   > FLASH
     .pinit  :   > FLASH
     .init_array : > FLASH
 
-    .vtable :   > 0x20000000
-    .data   :   > SRAM
-    .bss    :   > SRAM
-    .sysmem :   > SRAM
-    .stack  :   > SRAM
+    /* Sizes for the SRAM line of Arena_Report, see System/arena.h */
+    .vtable :   > 0x20000000, SIZE(__vtable_size)
+    .data   :   > SRAM, SIZE(__data_size)
+    .bss    :   > SRAM, SIZE(__bss_size)
+    .sysmem :   > SRAM, SIZE(__sysmem_size)
+    .stack  :   > SRAM, SIZE(__stack_size)
+
+    /* Left out of the zero fill, the watchdog's stuck record survives a reset */
+    .TI.noinit : > SRAM
+
+    /* RAMFUNC code, copied from flash to SRAM by ResetISR through ramfunc_copy_table.
+       Past SRAM_CODE the link fails, see System/ramfunc.h */
+    .TI.ramfunc : {} load = FLASH, run = SRAM_CODE, table(ramfunc_copy_table), RUN_SIZE(__ramfunc_size)
 }
 
 __STACK_TOP = __stack + 512;
@@ -23,6 +23,7 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include <cpy_tbl.h>
 
 //*****************************************************************************
 //
@@ -49,12 +50,20 @@ extern void _c_int00(void);
 //*****************************************************************************
 extern uint32_t __STACK_TOP;
 
+//*****************************************************************************
+//
+// Linker copy table for the functions that run from SRAM, see System/ramfunc.h.
+//
+//*****************************************************************************
+extern COPY_TABLE ramfunc_copy_table;
+
 //*****************************************************************************
 //
 // External declarations for the interrupt handlers used by the application.
 //
 //*****************************************************************************
 // To be added by user
+extern void StackGuard_FaultHandler(void);  // System/stack_guard_fault.asm
 
 //*****************************************************************************
 //
@@ -71,7 +80,7 @@ void (* const g_pfnVectors[])(void) =
     ResetISR,                               // The reset handler
     NmiSR,                                  // The NMI handler
     FaultISR,                               // The hard fault handler
-    IntDefaultHandler,                      // The MPU fault handler
+    StackGuard_FaultHandler,                // The MPU fault handler
     IntDefaultHandler,                      // The bus fault handler
     IntDefaultHandler,                      // The usage fault handler
     0,                                      // Reserved
@@ -237,6 +246,11 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    //
+    // Copy the RAMFUNC code into SRAM, before anything can call it.
+    //
+    copy_in(&ramfunc_copy_table);
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.